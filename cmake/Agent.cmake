@@ -121,6 +121,7 @@ add_library(core
   fboss/agent/MirrorManager.cpp
   fboss/agent/MirrorManagerImpl.cpp
   fboss/agent/NdpCache.cpp
+  fboss/agent/NeighborTimerWheel.cpp
   fboss/agent/NeighborUpdater.cpp
   fboss/agent/NeighborUpdaterImpl.cpp
   fboss/agent/PortUpdateHandler.cpp
@@ -128,10 +129,14 @@ add_library(core
   fboss/agent/ResolvedNexthopProbe.cpp
   fboss/agent/ResolvedNexthopProbeScheduler.cpp
   fboss/agent/RestartTimeTracker.cpp
+  fboss/agent/RouteChangePublisher.cpp
+  fboss/agent/RouteTableChunker.cpp
   fboss/agent/RouteUpdateLogger.cpp
   fboss/agent/RouteUpdateLoggingPrefixTracker.cpp
   fboss/agent/RouteUpdateWrapper.cpp
+  fboss/agent/RxPacketDispatcher.cpp
   fboss/agent/StandaloneRibConversions.cpp
+  fboss/agent/StateObserverNotifier.cpp
   fboss/agent/StaticL2ForNeighborObserver.cpp
   fboss/agent/StaticL2ForNeighborUpdater.cpp
   fboss/agent/StaticL2ForNeighborSwSwitchUpdater.cpp
@@ -170,6 +175,7 @@ target_link_libraries(core
   phy_cpp2
   transceiver_cpp2
   alert_logger
+  rcu_shared_ptr
   Folly::folly
   normalizer
   bidirectional_packet_stream
@@ -40,6 +40,7 @@ add_library(hw_cpu_fb303_stats
 
 add_library(hw_switch_warmboot_helper
   fboss/agent/hw/HwSwitchWarmBootHelper.cpp
+  fboss/agent/hw/WarmBootStateFile.cpp
 )
 
 add_library(buffer_stats
@@ -51,6 +52,7 @@ add_library(hw_resource_stats_publisher
 )
 
 target_link_libraries(hw_switch_warmboot_helper
+  error
   utils
   Folly::folly
 )
@@ -38,6 +38,17 @@ target_link_libraries(hw_stats_collection_speed
   Folly::follybenchmark
 )
 
+add_library(hw_control_path_timer
+  fboss/agent/hw/benchmarks/ControlPathTimer.cpp
+)
+
+target_link_libraries(hw_control_path_timer
+  state
+  function_call_time_reporter
+  Folly::folly
+  Folly::follybenchmark
+)
+
 add_library(hw_fsw_scale_route_add_speed
   fboss/agent/hw/benchmarks/HwFswScaleRouteAddBenchmark.cpp
 )
@@ -48,6 +59,7 @@ target_link_libraries(hw_fsw_scale_route_add_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -61,6 +73,7 @@ target_link_libraries(hw_fsw_scale_route_del_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -74,6 +87,7 @@ target_link_libraries(hw_th_alpm_scale_route_add_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -87,6 +101,7 @@ target_link_libraries(hw_th_alpm_scale_route_del_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -100,6 +115,7 @@ target_link_libraries(hw_hgrid_du_scale_route_add_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -113,6 +129,7 @@ target_link_libraries(hw_hgrid_du_scale_route_del_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -126,6 +143,7 @@ target_link_libraries(hw_hgrid_uu_scale_route_add_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -139,6 +157,7 @@ target_link_libraries(hw_hgrid_uu_scale_route_del_speed
   ecmp_helper
   hw_benchmark_main
   function_call_time_reporter
+  hw_control_path_timer
   Folly::folly
 )
 
@@ -175,8 +194,10 @@ add_library(hw_rx_slow_path_rate
 
 target_link_libraries(hw_rx_slow_path_rate
   config_factory
+  core
   hw_packet_utils
   ecmp_helper
+  pkt
   Folly::folly
 )
 
@@ -193,6 +214,7 @@ target_link_libraries(hw_init_and_exit_benchmark_helper
   Folly::folly
   Folly::follybenchmark
   function_call_time_reporter
+  hw_control_path_timer
 )
 
 add_library(hw_init_and_exit_40Gx10G
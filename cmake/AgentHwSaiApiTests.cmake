@@ -33,6 +33,7 @@ add_executable(api_test
     fboss/agent/hw/sai/api/tests/WredApiTest.cpp
     fboss/agent/hw/sai/api/tests/AdapterKeySerializerTest.cpp
     fboss/agent/hw/sai/api/tests/LoggingUtilTest.cpp
+    fboss/agent/hw/sai/api/tests/SaiApiLockTest.cpp
 )
 
 target_link_libraries(api_test
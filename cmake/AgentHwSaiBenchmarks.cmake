@@ -353,6 +353,38 @@ function(BUILD_SAI_BENCHMARKS SAI_IMPL_NAME SAI_IMPL_ARG)
     -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
   )
 
+  # The control path benchmarks which don't depend on the ASIC, in one binary
+  # that runs on FakeSai in CI and on developer boxes
+  if(SAI_IMPL_NAME STREQUAL "fake")
+    add_executable(sai_control_path_scale-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX} /dev/null)
+
+    target_link_libraries(sai_control_path_scale-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX}
+      -Wl,--whole-archive
+      sai_switch_ensemble
+      sai_copp_utils
+      hw_fsw_scale_route_add_speed
+      hw_fsw_scale_route_del_speed
+      hw_th_alpm_scale_route_add_speed
+      hw_th_alpm_scale_route_del_speed
+      hw_hgrid_du_scale_route_add_speed
+      hw_hgrid_du_scale_route_del_speed
+      hw_hgrid_uu_scale_route_add_speed
+      hw_hgrid_uu_scale_route_del_speed
+      hw_init_and_exit_100Gx100G
+      hw_stats_collection_speed
+      route_scale_gen
+      ${SAI_IMPL_ARG}
+      -Wl,--no-whole-archive
+    )
+
+    set_target_properties(sai_control_path_scale-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX}
+      PROPERTIES COMPILE_FLAGS
+      "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+      -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+      -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+    )
+  endif()
+
 endfunction()
 
 BUILD_SAI_BENCHMARKS("fake" fake_sai)
@@ -3,6 +3,21 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+add_library(sai_binary_trace
+  fboss/agent/hw/sai/tracer/SaiBinaryTrace.cpp
+)
+
+target_link_libraries(sai_binary_trace
+  fboss_error
+  Folly::folly
+)
+
+set_target_properties(sai_binary_trace PROPERTIES COMPILE_FLAGS
+  "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+  -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+  -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+)
+
 add_library(sai_tracer
   fboss/agent/hw/sai/tracer/AclApiTracer.cpp
   fboss/agent/hw/sai/tracer/BridgeApiTracer.cpp
@@ -33,6 +48,7 @@ add_library(sai_tracer
 target_link_libraries(sai_tracer
   fboss_error
   async_logger
+  sai_binary_trace
   sai_version
   Folly::folly
 )
@@ -27,10 +27,54 @@ function(BUILD_SAI_REPLAYER SAI_IMPL_NAME SAI_IMPL_ARG)
       -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
     )
 
+  # Replays binary traces, recorded with --sai_binary_log, without
+  # generating and building C source first
+  add_executable(sai_trace_replayer-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX}
+    fboss/agent/hw/sai/tracer/run/SaiTraceReplayer.cpp
+  )
+
+  target_link_libraries(sai_trace_replayer-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX}
+    sai_binary_trace
+    fboss_error
+    # This is needed for 'dlsym', 'dlopen' etc.
+    -Wl,--no-as-needed -ldl
+    -lz
+    ${SAI_IMPL_ARG}
+    Folly::folly
+    ${CMAKE_THREAD_LIBS_INIT}
+  )
+
+  set_target_properties(sai_trace_replayer-${SAI_IMPL_NAME}-${SAI_VER_SUFFIX}
+      PROPERTIES COMPILE_FLAGS
+      "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+      -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+      -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+    )
+
 endfunction()
 
 BUILD_SAI_REPLAYER("fake" fake_sai)
 
+# Converts binary traces into the C source of the replayer. It makes no SAI
+# calls, but the tracer wraps sai_api_query, so link FakeSai.
+add_executable(sai_trace_converter
+  fboss/agent/hw/sai/tracer/run/SaiTraceConverter.cpp
+)
+
+target_link_libraries(sai_trace_converter
+  sai_tracer
+  sai_binary_trace
+  fboss_error
+  fake_sai
+  Folly::folly
+)
+
+set_target_properties(sai_trace_converter PROPERTIES COMPILE_FLAGS
+  "-DSAI_VER_MAJOR=${SAI_VER_MAJOR} \
+  -DSAI_VER_MINOR=${SAI_VER_MINOR}  \
+  -DSAI_VER_RELEASE=${SAI_VER_RELEASE}"
+)
+
 # If libsai_impl is provided, build sai replayer linking with it
 find_library(SAI_IMPL sai_impl)
 message(STATUS "SAI_IMPL: ${SAI_IMPL}")
@@ -39,5 +83,6 @@ if(SAI_IMPL)
   BUILD_SAI_REPLAYER("sai_impl" ${SAI_IMPL})
   install(
     TARGETS
-    sai_replayer-sai_impl-${SAI_VER_SUFFIX})
+    sai_replayer-sai_impl-${SAI_VER_SUFFIX}
+    sai_trace_replayer-sai_impl-${SAI_VER_SUFFIX})
 endif()
@@ -202,6 +202,7 @@ target_link_libraries(hw_switch_test
   config_factory
   hw_packet_utils
   hw_switch_ensemble
+  hw_switch_warmboot_helper
   load_balancer_utils
   prod_config_utils
   traffic_policy_utils
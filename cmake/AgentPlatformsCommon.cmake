@@ -25,6 +25,44 @@ target_link_libraries(platform_mapping
   ${RE2}
 )
 
+add_executable(platform_mapping_compiler
+  fboss/agent/platforms/common/platform_mapping_compiler.cpp
+)
+
+target_link_libraries(platform_mapping_compiler
+  platform_mapping
+  Folly::folly
+)
+
+# Compile JSON_FILE into the CompactSerializer blob returned by FUNCTION,
+# declared in HEADER, so that the agent doesn't parse the JSON at startup.
+# With MULTI_PIM, only the mapping of each PIM is compiled.
+# The generated source file is appended to the OUTPUT_SOURCES variable.
+function(COMPILE_PLATFORM_MAPPING OUTPUT_SOURCES JSON_FILE HEADER FUNCTION)
+  cmake_parse_arguments(ARG "MULTI_PIM" "" "" ${ARGN})
+  get_filename_component(json_dir ${JSON_FILE} DIRECTORY)
+  get_filename_component(json_name ${JSON_FILE} NAME_WE)
+  set(output_dir ${CMAKE_CURRENT_BINARY_DIR}/${json_dir})
+  set(output ${output_dir}/${json_name}.compiled.cpp)
+  set(multi_pim_arg)
+  if(ARG_MULTI_PIM)
+    set(multi_pim_arg --multi_pim)
+  endif()
+  file(MAKE_DIRECTORY ${output_dir})
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND platform_mapping_compiler
+      --json_file ${CMAKE_CURRENT_SOURCE_DIR}/${JSON_FILE}
+      ${multi_pim_arg}
+      --header ${HEADER}
+      --function ${FUNCTION}
+      --output ${output}
+    DEPENDS platform_mapping_compiler ${CMAKE_CURRENT_SOURCE_DIR}/${JSON_FILE}
+    COMMENT "Compiling platform mapping ${JSON_FILE}"
+  )
+  set(${OUTPUT_SOURCES} ${${OUTPUT_SOURCES}} ${output} PARENT_SCOPE)
+endfunction()
+
 add_library(wedge_led_utils
   fboss/agent/platforms/common/utils/GalaxyLedUtils.cpp
   fboss/agent/platforms/common/utils/Wedge100LedUtils.cpp
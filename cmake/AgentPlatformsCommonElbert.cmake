@@ -3,9 +3,17 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(elbert_platform_mapping_compiled
+  fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.json
+  fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.h
+  getElbert16QPimCompiledPlatformMapping
+  MULTI_PIM
+)
+
 add_library(elbert_platform_mapping
   fboss/agent/platforms/common/elbert/oss/ElbertPlatformMapping.cpp
   fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.cpp
+  ${elbert_platform_mapping_compiled}
 )
 
 target_link_libraries(elbert_platform_mapping
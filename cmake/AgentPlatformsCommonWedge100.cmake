@@ -3,8 +3,15 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(wedge100_platform_mapping_compiled
+  fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.json
+  fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.h
+  getWedge100CompiledPlatformMapping
+)
+
 add_library(wedge100_platform_mapping
   fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.cpp
+  ${wedge100_platform_mapping_compiled}
 )
 
 target_link_libraries(wedge100_platform_mapping
@@ -3,8 +3,15 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(wedge40_platform_mapping_compiled
+  fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.json
+  fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.h
+  getWedge40CompiledPlatformMapping
+)
+
 add_library(wedge40_platform_mapping
   fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.cpp
+  ${wedge40_platform_mapping_compiled}
 )
 
 target_link_libraries(wedge40_platform_mapping
@@ -3,8 +3,15 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(wedge400_platform_mapping_compiled
+  fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.json
+  fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.h
+  getWedge400CompiledPlatformMapping
+)
+
 add_library(wedge400_platform_mapping
   fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.cpp
+  ${wedge400_platform_mapping_compiled}
 )
 
 target_link_libraries(wedge400_platform_mapping
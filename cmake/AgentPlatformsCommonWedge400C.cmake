@@ -3,8 +3,15 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(wedge400c_platform_mapping_compiled
+  fboss/agent/platforms/common/wedge400c/Wedge400CPlatformMapping.json
+  fboss/agent/platforms/common/wedge400c/Wedge400CPlatformMapping.h
+  getWedge400CCompiledPlatformMapping
+)
+
 add_library(wedge400c_platform_mapping
     fboss/agent/platforms/common/wedge400c/Wedge400CPlatformMapping.cpp
+    ${wedge400c_platform_mapping_compiled}
 )
 
 target_link_libraries(wedge400c_platform_mapping
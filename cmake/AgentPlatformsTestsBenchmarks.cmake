@@ -0,0 +1,21 @@
+# CMake to build libraries and binaries in fboss/agent/platforms/tests/benchmarks
+
+# In general, libraries and binaries in fboss/foo/bar are built by
+# cmake/FooBar.cmake
+
+add_executable(platform_mapping_benchmark
+  fboss/agent/platforms/tests/benchmarks/PlatformMappingBenchmark.cpp
+)
+
+target_link_libraries(platform_mapping_benchmark
+  elbert_platform_mapping
+  fuji_platform_mapping
+  minipack_platform_mapping
+  wedge40_platform_mapping
+  wedge100_platform_mapping
+  wedge400_platform_mapping
+  wedge400c_platform_mapping
+  yamp_platform_mapping
+  Folly::folly
+  Folly::follybenchmark
+)
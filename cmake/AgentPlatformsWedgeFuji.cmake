@@ -3,9 +3,17 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(fuji_platform_mapping_compiled
+  fboss/agent/platforms/wedge/fuji/Fuji16QPimPlatformMapping.json
+  fboss/agent/platforms/wedge/fuji/Fuji16QPimPlatformMapping.h
+  getFuji16QPimCompiledPlatformMapping
+  MULTI_PIM
+)
+
 add_library(fuji_platform_mapping
   fboss/agent/platforms/wedge/fuji/FujiPlatformMapping.cpp
   fboss/agent/platforms/wedge/fuji/Fuji16QPimPlatformMapping.cpp
+  ${fuji_platform_mapping_compiled}
 )
 
 target_link_libraries(fuji_platform_mapping
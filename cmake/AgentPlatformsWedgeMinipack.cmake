@@ -3,9 +3,24 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(minipack_platform_mapping_compiled
+  fboss/agent/platforms/wedge/minipack/Minipack16QPimMiln42PlatformMapping.json
+  fboss/agent/platforms/wedge/minipack/Minipack16QPimPlatformMapping.h
+  getMinipack16QPimMiln42CompiledPlatformMapping
+  MULTI_PIM
+)
+
+COMPILE_PLATFORM_MAPPING(minipack_platform_mapping_compiled
+  fboss/agent/platforms/wedge/minipack/Minipack16QPimMiln52PlatformMapping.json
+  fboss/agent/platforms/wedge/minipack/Minipack16QPimPlatformMapping.h
+  getMinipack16QPimMiln52CompiledPlatformMapping
+  MULTI_PIM
+)
+
 add_library(minipack_platform_mapping
   fboss/agent/platforms/wedge/minipack/Minipack16QPimPlatformMapping.cpp
   fboss/agent/platforms/wedge/minipack/oss/MinipackPlatformMapping.cpp
+  ${minipack_platform_mapping_compiled}
 )
 
 target_link_libraries(minipack_platform_mapping
@@ -3,9 +3,17 @@
 # In general, libraries and binaries in fboss/foo/bar are built by
 # cmake/FooBar.cmake
 
+COMPILE_PLATFORM_MAPPING(yamp_platform_mapping_compiled
+  fboss/agent/platforms/wedge/yamp/Yamp16QPimPlatformMapping.json
+  fboss/agent/platforms/wedge/yamp/Yamp16QPimPlatformMapping.h
+  getYamp16QPimCompiledPlatformMapping
+  MULTI_PIM
+)
+
 add_library(yamp_platform_mapping
   fboss/agent/platforms/wedge/yamp/Yamp16QPimPlatformMapping.cpp
   fboss/agent/platforms/wedge/yamp/YampPlatformMapping.cpp
+  ${yamp_platform_mapping_compiled}
 )
 
 target_link_libraries(yamp_platform_mapping
@@ -35,6 +35,12 @@ add_library(ref_map
 
 set_target_properties(ref_map PROPERTIES LINKER_LANGUAGE CXX)
 
+add_library(rcu_shared_ptr
+  fboss/lib/RcuSharedPtr.h
+)
+
+set_target_properties(rcu_shared_ptr PROPERTIES LINKER_LANGUAGE CXX)
+
 add_library(tuple_utils
   fboss/lib/TupleUtils.h
 )
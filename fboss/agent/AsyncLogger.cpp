@@ -8,7 +8,9 @@
  *
  */
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -17,6 +19,7 @@
 #include "fboss/agent/SysError.h"
 
 #include <folly/FileUtil.h>
+#include <folly/logging/xlog.h>
 #include <gflags/gflags.h>
 
 DEFINE_bool(
@@ -24,31 +27,85 @@ DEFINE_bool(
     false,
     "Flag to indicate whether to disable async logging and directly write into the file");
 
-enum BufferToWrite { BUFFER0, BUFFER1 };
+namespace {
 
-static std::string exitFilePath;
-static uint32_t offset = 0;
-static BufferToWrite currentBuffer = BUFFER0;
-static std::array<char, facebook::fboss::AsyncLogger::kBufferSize> buffer0;
-static std::array<char, facebook::fboss::AsyncLogger::kBufferSize> buffer1;
+// Each record is buffered as its sequence number, size and data
+auto constexpr kRecordHeaderSize = sizeof(uint64_t) + sizeof(uint32_t);
 
-namespace {
+// Logger whose buffered records the terminate handler writes out
+std::atomic<facebook::fboss::AsyncLogger*> exitLogger{nullptr};
+
+} // namespace
 
-void terminateHandler() {
-  if (offset > 0) {
-    // Use standard library instead of folly because in unclean exit, folly
-    // library could be inaccessible so there's a higher chance of writing into
-    // file using standard library.
-    std::ofstream logfile;
-    logfile.open(exitFilePath, std::ofstream::app);
+namespace facebook::fboss {
 
-    if (currentBuffer == BUFFER0) {
-      logfile.write(buffer0.data(), offset);
-    } else {
-      logfile.write(buffer1.data(), offset);
+/*
+ * Records appended by a thread, which only that thread writes to, and only
+ * the flush thread reads from.
+ */
+struct AsyncLogger::Chunk {
+  explicit Chunk(size_t size) : data(new char[size]), capacity(size) {}
+
+  std::unique_ptr<char[]> data;
+  const size_t capacity;
+  // Bytes of records the flush thread may read
+  std::atomic<size_t> published{0};
+  // Set once the thread moved on to the next chunk
+  std::atomic<Chunk*> next{nullptr};
+};
+
+struct AsyncLogger::ThreadBuffer {
+  ThreadBuffer()
+      : writeChunk(new Chunk(kBufferSize)),
+        readChunk(writeChunk),
+        oldestChunk(writeChunk),
+        bufferedBytes(kBufferSize) {}
+
+  ~ThreadBuffer() {
+    while (oldestChunk) {
+      auto next = oldestChunk->next.load();
+      delete oldestChunk;
+      oldestChunk = next;
     }
-    std::cerr << "Async logger exit with " << offset
-              << " bytes written to file " << std::endl;
+  }
+
+  // Whether the flush thread read all records published
+  bool drained() const {
+    return !readChunk->next.load(std::memory_order_acquire) &&
+        readOffset == readChunk->published.load(std::memory_order_acquire);
+  }
+
+  // Accessed by the appending thread only
+  Chunk* writeChunk;
+  // Accessed by the flush thread only: records are read up to readOffset of
+  // readChunk, and chunks before readChunk are freed once written out
+  Chunk* readChunk;
+  size_t readOffset{0};
+  Chunk* oldestChunk;
+  // Capacity of the chunks not freed yet
+  std::atomic<size_t> bufferedBytes;
+};
+
+AsyncLogger::AsyncLogger(std::string filePath, uint32_t logTimeout)
+    : filePath_(filePath), logTimeout_(std::chrono::milliseconds(logTimeout)) {
+  openLogFile(filePath);
+
+  if (!FLAGS_disable_async_logger) {
+    exitLogger = this;
+    std::set_terminate(&AsyncLogger::terminateHandler);
+  }
+}
+
+AsyncLogger::~AsyncLogger() {
+  stopFlushThread();
+  auto self = this;
+  exitLogger.compare_exchange_strong(self, nullptr);
+  fsync(logFile_.wlock()->fd());
+}
+
+void AsyncLogger::terminateHandler() {
+  if (auto logger = exitLogger.load()) {
+    logger->writeOnTerminate();
   }
 
   std::exception_ptr eptr = std::current_exception();
@@ -63,111 +120,216 @@ void terminateHandler() {
   abort();
 }
 
-} // namespace
-
-namespace facebook::fboss {
-AsyncLogger::AsyncLogger(std::string filePath, uint32_t logTimeout)
-    : bufferSize_(AsyncLogger::kBufferSize) {
-  openLogFile(filePath);
-
-  if (!FLAGS_disable_async_logger) {
-    logBuffer_ = buffer0.data();
-    flushBuffer_ = buffer1.data();
-
-    exitFilePath = filePath;
-
-    logTimeout_ = std::chrono::milliseconds(logTimeout);
-
-    std::set_terminate(terminateHandler);
+void AsyncLogger::writeOnTerminate() {
+  // Best effort: without taking any lock, which the terminating thread may
+  // hold, write out the records not flushed yet, less any still being appended
+  auto base = flushedSequence_.load();
+  auto limit = nextSequence_.load();
+  if (limit <= base) {
+    return;
+  }
+  RecordSlots slots(limit - base);
+  for (auto& buffer : threadBuffers_.unsafeGetUnlocked()) {
+    collectRecords(buffer.get(), base, limit, slots);
   }
-}
 
-AsyncLogger::~AsyncLogger() {
-  fsync(logFile_.wlock()->fd());
+  // Use standard library instead of folly because in unclean exit, folly
+  // library could be inaccessible so there's a higher chance of writing into
+  // file using standard library.
+  std::ofstream logfile;
+  logfile.open(filePath_, std::ofstream::app);
+  size_t bytesWritten = 0;
+  for (const auto& [record, size] : slots) {
+    if (record) {
+      logfile.write(record, size);
+      bytesWritten += size;
+    }
+  }
+  std::cerr << "Async logger exit with " << bytesWritten
+            << " bytes written to file " << std::endl;
 }
 
 void AsyncLogger::worker_thread() {
   while (enableLogging_) {
-    std::unique_lock<std::mutex> lock(latch_);
+    {
+      std::unique_lock<std::mutex> lock(latch_);
+      // Wait for either 1. Timeout 2. Force flush or full buffer 3. Stop
+      cv_.wait_for(lock, logTimeout_, [this] {
+        return wakeUp_.load() || !enableLogging_.load();
+      });
+    }
+    wakeUp_ = false;
+    flush();
+  }
+  // Write out what was appended before logging stopped
+  flush();
+}
 
-    // Wait for either 1. Timeout 2. Force flush or full flush
-    cv_.wait_for(lock, logTimeout_, [this] {
-      return this->forceFlush_ || this->fullFlush_;
-    });
+size_t AsyncLogger::flush() {
+  auto base = flushedSequence_.load();
+  auto limit = nextSequence_.load(std::memory_order_acquire);
+  RecordSlots slots(limit - base);
+
+  // Threads publish their records right after taking a sequence number, so
+  // wait for those still being appended rather than write records out of order
+  size_t collected = 0;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  while (true) {
+    buffers = threadBuffers_.copy();
+    for (auto& buffer : buffers) {
+      collected += collectRecords(buffer.get(), base, limit, slots);
+    }
+    if (collected == slots.size()) {
+      break;
+    }
+    std::this_thread::yield();
+  }
 
-    // Swap log buffer and flush buffer
-    char* writeBuffer = logBuffer_;
-    uint32_t currSize = offset;
-    offset = 0;
-    currentBuffer = ((currentBuffer == BUFFER0) ? BUFFER1 : BUFFER0);
-    logBuffer_ = flushBuffer_;
+  writeBuffer_.clear();
+  for (const auto& [record, size] : slots) {
+    writeBuffer_.append(record, size);
+  }
+  if (!writeBuffer_.empty()) {
+    auto bytesWritten = logFile_.withWLock([&](auto& lockedFile) {
+      return folly::writeFull(
+          lockedFile.fd(), writeBuffer_.data(), writeBuffer_.size());
+    });
 
-    if (fullFlush_) {
-      fullFlush_ = false;
+    if (bytesWritten < 0) {
+      throw SysError(
+          errno, "error writing ", writeBuffer_.size(), " bytes to log file.");
     }
 
-    lock.unlock();
-    cv_.notify_one();
+    flushCount_++;
+  }
 
-    // Write content in swap buffer to file
-    if (currSize > 0) {
-      auto bytesWritten = logFile_.withWLock([&](auto& lockedFile) {
-        return folly::writeFull(lockedFile.fd(), writeBuffer, currSize);
-      });
+  // Free the chunks written out, and the buffers of threads that exited
+  for (auto& buffer : buffers) {
+    while (buffer->oldestChunk != buffer->readChunk) {
+      auto chunk = buffer->oldestChunk;
+      buffer->oldestChunk = chunk->next.load(std::memory_order_acquire);
+      buffer->bufferedBytes.fetch_sub(chunk->capacity);
+      delete chunk;
+    }
+  }
+  buffers.clear();
+  threadBuffers_.withWLock([](auto& allBuffers) {
+    allBuffers.erase(
+        std::remove_if(
+            allBuffers.begin(),
+            allBuffers.end(),
+            [](const auto& buffer) {
+              return buffer.use_count() == 1 && buffer->drained();
+            }),
+        allBuffers.end());
+  });
+
+  auto dropped = droppedCount_.load();
+  if (dropped != droppedReported_) {
+    XLOG(WARN) << "Async logger dropped " << dropped - droppedReported_
+               << " records to " << filePath_
+               << " while falling behind, " << dropped << " in total";
+    droppedReported_ = dropped;
+  }
 
-      if (bytesWritten < 0) {
-        throw SysError(
-            errno, "error writing ", currSize, " bytes to log file.");
-      }
+  {
+    std::lock_guard<std::mutex> lock(latch_);
+    flushedSequence_ = limit;
+  }
+  flushedCv_.notify_all();
+  return writeBuffer_.size();
+}
 
-      flushCount_++;
+size_t AsyncLogger::collectRecords(
+    ThreadBuffer* buffer,
+    uint64_t base,
+    uint64_t limit,
+    RecordSlots& slots) {
+  size_t collected = 0;
+  while (true) {
+    auto chunk = buffer->readChunk;
+    auto published = chunk->published.load(std::memory_order_acquire);
+    if (buffer->readOffset == published) {
+      auto next = chunk->next.load(std::memory_order_acquire);
+      if (!next) {
+        break;
+      }
+      // The thread may have published more before moving on
+      if (buffer->readOffset ==
+          chunk->published.load(std::memory_order_acquire)) {
+        buffer->readChunk = next;
+        buffer->readOffset = 0;
+      }
+      continue;
     }
 
-    memset(writeBuffer, 0, bufferSize_);
-    flushBuffer_ = writeBuffer;
-
-    // Notify force flush that write completes
-    if (forceFlush_) {
-      forceFlush_ = false;
-      promise_.set_value(0);
-      promise_ = std::promise<int>();
+    auto record = chunk->data.get() + buffer->readOffset;
+    uint64_t sequence;
+    uint32_t size;
+    memcpy(&sequence, record, sizeof(sequence));
+    memcpy(&size, record + sizeof(sequence), sizeof(size));
+    if (sequence >= limit) {
+      // Left for the next flush
+      break;
     }
+    slots[sequence - base] = {record + kRecordHeaderSize, size};
+    buffer->readOffset += kRecordHeaderSize + size;
+    ++collected;
   }
+  return collected;
 }
 
 void AsyncLogger::startFlushThread() {
   enableLogging_ = true;
   if (!FLAGS_disable_async_logger) {
-    flushThread_ = new std::thread(&AsyncLogger::worker_thread, this);
+    flushThread_ =
+        std::make_unique<std::thread>(&AsyncLogger::worker_thread, this);
   }
 }
 
 void AsyncLogger::stopFlushThread() {
-  if (!FLAGS_disable_async_logger && enableLogging_) {
-    enableLogging_ = false;
+  if (enableLogging_.exchange(false) && flushThread_) {
+    wakeFlushThread();
     flushThread_->join();
-    delete flushThread_;
+    flushThread_.reset();
   }
 }
 
 void AsyncLogger::forceFlush() {
-  if (!FLAGS_disable_async_logger) {
-    future_ = promise_.get_future();
+  if (!FLAGS_disable_async_logger && enableLogging_) {
+    auto sequence = nextSequence_.load(std::memory_order_acquire);
+    wakeFlushThread();
 
-    forceFlush_ = true;
+    // Wait for flush to complete
+    std::unique_lock<std::mutex> lock(latch_);
+    flushedCv_.wait(
+        lock, [&] { return flushedSequence_.load() >= sequence; });
+  }
+}
+
+void AsyncLogger::wakeFlushThread() {
+  if (!wakeUp_.exchange(true)) {
+    std::lock_guard<std::mutex> lock(latch_);
     cv_.notify_one();
+  }
+}
 
-    // Wait for flush to complete
-    future_.get();
+AsyncLogger::ThreadBuffer* AsyncLogger::getThreadBuffer() {
+  auto& buffer = *threadBuffer_;
+  if (!buffer) {
+    // First append of this thread
+    buffer = std::make_shared<ThreadBuffer>();
+    threadBuffers_.wlock()->push_back(buffer);
   }
+  return buffer.get();
 }
 
 void AsyncLogger::appendLog(const char* logRecord, size_t logSize) {
-  if (!enableLogging_) {
+  if (!enableLogging_ || logSize == 0) {
     return;
   }
 
-  if (FLAGS_disable_async_logger && logSize > 0) {
+  if (FLAGS_disable_async_logger) {
     auto bytesWritten = logFile_.withWLock([&](auto& lockedFile) {
       return folly::writeFull(lockedFile.fd(), logRecord, logSize);
     });
@@ -178,33 +340,34 @@ void AsyncLogger::appendLog(const char* logRecord, size_t logSize) {
     return;
   }
 
-  // Acquire the lock and check if there's enough space in the buffer
-  latch_.lock();
-
-  if (logSize + offset >= bufferSize_) {
-    // Release the lock and notify worker thread to flush logs
-    fullFlush_ = true;
-    latch_.unlock();
-    cv_.notify_one();
-
-    // Wait for worker to finish
-    std::unique_lock<std::mutex> lock(latch_);
-    cv_.wait(lock, [logSize] {
-      return logSize + offset < AsyncLogger::kBufferSize;
-    });
-
-    // Write to buffer
-    memcpy(logBuffer_ + offset, logRecord, logSize);
-    offset += logSize;
-
-    lock.unlock();
-  } else {
-    // Directly write to buffer
-    memcpy(logBuffer_ + offset, logRecord, logSize);
-    offset += logSize;
-
-    latch_.unlock();
+  auto buffer = getThreadBuffer();
+  auto recordSize = kRecordHeaderSize + logSize;
+  auto chunk = buffer->writeChunk;
+  auto offset = chunk->published.load(std::memory_order_relaxed);
+  if (offset + recordSize > chunk->capacity) {
+    // Chain another chunk rather than wait for this one to be written out
+    auto capacity = std::max<size_t>(kBufferSize, recordSize);
+    if (buffer->bufferedBytes.load() + capacity > kMaxBufferedBytes) {
+      droppedCount_++;
+      wakeFlushThread();
+      return;
+    }
+    buffer->bufferedBytes += capacity;
+    auto next = new Chunk(capacity);
+    chunk->next.store(next, std::memory_order_release);
+    buffer->writeChunk = next;
+    chunk = next;
+    offset = 0;
+    wakeFlushThread();
   }
+
+  uint64_t sequence = nextSequence_.fetch_add(1, std::memory_order_acq_rel);
+  uint32_t size = logSize;
+  auto record = chunk->data.get() + offset;
+  memcpy(record, &sequence, sizeof(sequence));
+  memcpy(record + sizeof(sequence), &size, sizeof(size));
+  memcpy(record + kRecordHeaderSize, logRecord, logSize);
+  chunk->published.store(offset + recordSize, std::memory_order_release);
 }
 
 void AsyncLogger::openLogFile(std::string& file_path) {
@@ -10,16 +10,32 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
-#include <future>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <folly/File.h>
 #include <folly/Synchronized.h>
+#include <folly/ThreadLocal.h>
 
 namespace facebook::fboss {
 
+/*
+ * AsyncLogger writes logs to a file from a flush thread, so that SaiTracer and
+ * BcmCinter, which log every SDK call, do not wait on file IO.
+ *
+ * Threads append to buffers of their own, without taking any lock or ever
+ * waiting for the flush thread: when a thread fills up its buffer, it chains
+ * another one and wakes up the flush thread. Each record is tagged with a
+ * sequence number as it is appended, which the flush thread merges the records
+ * of all threads by, so that they are written in the order they were appended.
+ */
 class AsyncLogger {
  public:
   explicit AsyncLogger(std::string filePath, uint32_t logTimeout);
@@ -27,50 +43,80 @@ class AsyncLogger {
   ~AsyncLogger();
 
   /*
-   * To handle unclean exit, we use terminate handler to write out the logs that
-   * are still in the buffer. However, terminate handler is invoked after the
-   * program exits, meaning variables could be already destructed when we enter
-   * terminate handler. Therefore, we use static variables for the async buffer
-   * and related data structures. They are not garbage collected until terminate
-   * handler is finished.
-   * However, the downside of this approach is that the buffer size needs to be
-   * hardcoded (instead of declaring a google flag and pass in as command line
-   * argument). The buffer size should be known at compile time.
-   * Therefore, we chose the buffer size of 409600, which is an appropriate
-   * number that's not introducing too much memory overhead (roughly 0.035% of
-   * current prod usage), but still perform well in frequent updates and
-   * benchmark tests.
+   * Size of the buffers threads append to. Records are written out every log
+   * timeout, or as soon as a thread fills up a buffer.
    */
   static auto constexpr kBufferSize = 409600;
+  /*
+   * Most a thread may have buffered, should the flush thread fall behind.
+   * Past this, records are dropped rather than have the thread wait.
+   */
+  static auto constexpr kMaxBufferedBytes = kBufferSize * 64;
 
   void startFlushThread();
   void stopFlushThread();
+  // Wait for the records appended so far to be written out
   void forceFlush();
 
   void appendLog(const char* logRecord, size_t logSize);
 
+  uint64_t getDroppedCount() const {
+    return droppedCount_.load();
+  }
+
   // Expose these variables for testing purpose
   uint32_t flushCount_{0};
 
  private:
+  struct Chunk;
+  struct ThreadBuffer;
+  // Records of sequence numbers from flushedSequence_ on, as data and size
+  using RecordSlots = std::vector<std::pair<const char*, uint32_t>>;
+
+  // Forbidden copy constructor and assignment operator
+  AsyncLogger(AsyncLogger const&) = delete;
+  AsyncLogger& operator=(AsyncLogger const&) = delete;
+
+  static void terminateHandler();
+
+  ThreadBuffer* getThreadBuffer();
+  void wakeFlushThread();
   void worker_thread();
+  // Write out the records appended so far, returns the number of bytes
+  size_t flush();
+  // Collect the records of buffer below limit, returns how many
+  size_t collectRecords(
+      ThreadBuffer* buffer,
+      uint64_t base,
+      uint64_t limit,
+      RecordSlots& slots);
+  void writeOnTerminate();
   void openLogFile(std::string& file_path);
 
-  bool forceFlush_{false};
-  bool fullFlush_{false};
-  bool enableLogging_{false};
+  std::atomic<bool> enableLogging_{false};
+  std::atomic<bool> wakeUp_{false};
 
-  uint32_t bufferSize_;
+  // Sequence number of the next record appended
+  std::atomic<uint64_t> nextSequence_{0};
+  // Records before this sequence number are written out
+  std::atomic<uint64_t> flushedSequence_{0};
+  std::atomic<uint64_t> droppedCount_{0};
+  uint64_t droppedReported_{0};
 
-  char* logBuffer_;
-  char* flushBuffer_;
+  folly::ThreadLocal<std::shared_ptr<ThreadBuffer>> threadBuffer_;
+  // Buffers of every thread that appended, which the flush thread drains
+  folly::Synchronized<std::vector<std::shared_ptr<ThreadBuffer>>>
+      threadBuffers_;
+  std::string writeBuffer_;
 
-  std::promise<int> promise_;
-  std::future<int> future_;
+  std::string filePath_;
   std::mutex latch_;
-  std::thread* flushThread_;
+  // Wakes up the flush thread
   std::condition_variable cv_;
-  std::chrono::microseconds logTimeout_;
+  // Wakes up forceFlush() callers once records are written out
+  std::condition_variable flushedCv_;
+  std::unique_ptr<std::thread> flushThread_;
+  std::chrono::milliseconds logTimeout_;
 
   folly::Synchronized<folly::File> logFile_;
 };
@@ -12,23 +12,175 @@
 #include "fboss/agent/L2Entry.h"
 #include "fboss/agent/MacTableUtils.h"
 #include "fboss/agent/SwSwitch.h"
+#include "fboss/agent/SwitchStats.h"
 #include "fboss/agent/state/SwitchState.h"
 
+#include <folly/io/async/EventBase.h>
+
+#include <algorithm>
+#include <iterator>
+
+DEFINE_int32(
+    l2_learning_batch_window_ms,
+    0,
+    "Time to buffer L2 learning updates for before applying them to the "
+    "state. With 0, they are applied as soon as the update thread is free");
+DEFINE_int32(
+    l2_learning_batch_max_updates,
+    10000,
+    "Maximum number of L2 learning updates applied in a single state update");
+
 namespace facebook::fboss {
 
-MacTableManager::MacTableManager(SwSwitch* sw) : sw_(sw) {}
+namespace {
+
+using Update = L2LearningUpdateBuffer::Update;
+
+constexpr auto kL2LearningBatch = "Programming L2 learning updates";
+
+// Whether applying b right after a has no further effect
+bool sameUpdate(const Update& a, const Update& b) {
+  if (a.second != b.second) {
+    return false;
+  }
+  // Learning only uses the port of the entry, aging its classID
+  return a.second == L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD
+      ? a.first.getPort() == b.first.getPort()
+      : a.first.getClassID() == b.first.getClassID();
+}
+
+// Whether applying [x, y] twice has the same effect as applying it once
+bool idempotentPair(const Update& x, const Update& y) {
+  // Learning a MAC which already has a classID keeps it, and aging it with
+  // that classID then removes it. Learning it again however creates an entry
+  // without classID, which the same aging leaves in place.
+  return !(
+      x.second == L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD &&
+      y.second == L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_DELETE &&
+      y.first.getClassID().has_value());
+}
+
+size_t maxBatchUpdates() {
+  return std::max(FLAGS_l2_learning_batch_max_updates, 1);
+}
+
+} // namespace
+
+bool L2LearningUpdateBuffer::add(
+    const L2Entry& l2Entry,
+    L2EntryUpdateType updateType) {
+  auto& updates =
+      updates_[std::make_pair(l2Entry.getVlanID(), l2Entry.getMac())];
+  Update update(l2Entry, updateType);
+  auto numUpdates = updates.size();
+  if (numUpdates >= 1 && sameUpdate(updates[numUpdates - 1], update)) {
+    return false;
+  }
+  if (numUpdates >= 3 && sameUpdate(updates[numUpdates - 3], updates.back()) &&
+      sameUpdate(updates[numUpdates - 2], update) &&
+      idempotentPair(updates[numUpdates - 1], update)) {
+    // [..., x, y, x] + y: drop the last x and y
+    updates.pop_back();
+    --size_;
+    return false;
+  }
+  updates.push_back(std::move(update));
+  ++size_;
+  return true;
+}
+
+std::vector<L2LearningUpdateBuffer::Update> L2LearningUpdateBuffer::take(
+    size_t maxUpdates) {
+  std::vector<Update> taken;
+  auto it = updates_.begin();
+  while (it != updates_.end() &&
+         (taken.empty() || taken.size() + it->second.size() <= maxUpdates)) {
+    taken.insert(
+        taken.end(),
+        std::make_move_iterator(it->second.begin()),
+        std::make_move_iterator(it->second.end()));
+    size_ -= it->second.size();
+    it = updates_.erase(it);
+  }
+  return taken;
+}
+
+MacTableManager::MacTableManager(SwSwitch* sw)
+    : sw_(sw), pending_(std::make_shared<SynchronizedPendingUpdates>()) {}
 
 void MacTableManager::handleL2LearningUpdate(
     L2Entry l2Entry,
     L2EntryUpdateType l2EntryUpdateType) {
-  auto updateMacTableFn =
-      [l2Entry, l2EntryUpdateType](const std::shared_ptr<SwitchState>& state) {
-        return MacTableUtils::updateMacTable(state, l2Entry, l2EntryUpdateType);
-      };
-
-  sw_->updateState(
-      folly::to<std::string>("Programming : ", l2Entry.str()),
-      std::move(updateMacTableFn));
+  if (l2EntryUpdateType == L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD) {
+    sw_->stats()->l2LearnEvent();
+  } else {
+    sw_->stats()->l2AgeEvent();
+  }
+
+  auto locked = pending_->wlock();
+  if (!locked->buffer.add(l2Entry, l2EntryUpdateType)) {
+    sw_->stats()->l2LearningUpdateCoalesced();
+  }
+  if (locked->scheduledBatches == 0 && FLAGS_l2_learning_batch_window_ms > 0 &&
+      locked->buffer.size() < maxBatchUpdates()) {
+    if (!locked->windowPending) {
+      locked->windowPending = true;
+      auto* evb = sw_->getBackgroundEvb();
+      evb->runInEventBaseThread([sw = sw_, pending = pending_, evb]() {
+        evb->runAfterDelay(
+            [sw, pending]() {
+              auto locked = pending->wlock();
+              locked->windowPending = false;
+              scheduleBatchesNeeded(sw, pending, &*locked);
+            },
+            FLAGS_l2_learning_batch_window_ms);
+      });
+    }
+    return;
+  }
+  scheduleBatchesNeeded(sw_, pending_, &*locked);
+}
+
+void MacTableManager::scheduleBatch(
+    SwSwitch* sw,
+    const std::shared_ptr<SynchronizedPendingUpdates>& pending) {
+  sw->updateState(
+      kL2LearningBatch,
+      [sw, pending](const std::shared_ptr<SwitchState>& state) {
+        return applyBatch(sw, pending, state);
+      });
+}
+
+void MacTableManager::scheduleBatchesNeeded(
+    SwSwitch* sw,
+    const std::shared_ptr<SynchronizedPendingUpdates>& pending,
+    PendingUpdates* locked) {
+  while (locked->scheduledBatches * maxBatchUpdates() <
+         locked->buffer.size()) {
+    ++locked->scheduledBatches;
+    scheduleBatch(sw, pending);
+  }
+}
+
+std::shared_ptr<SwitchState> MacTableManager::applyBatch(
+    SwSwitch* sw,
+    const std::shared_ptr<SynchronizedPendingUpdates>& pending,
+    const std::shared_ptr<SwitchState>& state) {
+  std::vector<L2LearningUpdateBuffer::Update> updates;
+  {
+    auto locked = pending->wlock();
+    --locked->scheduledBatches;
+    updates = locked->buffer.take(maxBatchUpdates());
+    // The updates of a single MAC may not fit in a batch
+    if (!locked->windowPending) {
+      scheduleBatchesNeeded(sw, pending, &*locked);
+    }
+  }
+  if (updates.empty()) {
+    return nullptr;
+  }
+  sw->stats()->l2LearningBatch();
+  return MacTableUtils::updateMacTable(state, updates);
 }
 
 } // namespace facebook::fboss
@@ -11,10 +11,72 @@
 
 #include "fboss/agent/L2Entry.h"
 
+#include <folly/MacAddress.h>
+#include <folly/Synchronized.h>
+#include <gflags/gflags.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+DECLARE_int32(l2_learning_batch_window_ms);
+DECLARE_int32(l2_learning_batch_max_updates);
+
 namespace facebook::fboss {
 
+class SwitchState;
 class SwSwitch;
 
+/*
+ * L2LearningUpdateBuffer holds the L2 learning updates received from the
+ * HwSwitch until they are applied to the MAC tables, coalescing the updates
+ * of each MAC which cannot change the outcome:
+ *  - an update identical to the previous one for the MAC, since applying an
+ *    update twice has the same effect as applying it once.
+ *  - a learn/age flap: [x, y, x, y] has the same effect as [x, y], for all
+ *    pairs except a learn followed by the aging of an entry with a classID.
+ */
+class L2LearningUpdateBuffer {
+ public:
+  using Update = std::pair<L2Entry, L2EntryUpdateType>;
+
+  /*
+   * Returns false if the update was coalesced with the pending updates of
+   * its MAC.
+   */
+  bool add(const L2Entry& l2Entry, L2EntryUpdateType updateType);
+
+  /*
+   * Remove the pending updates of as many MACs as fit in maxUpdates, or of a
+   * single MAC if it has more, and return them. The updates of each MAC are
+   * returned in the order they were received.
+   */
+  std::vector<Update> take(size_t maxUpdates);
+
+  size_t size() const {
+    return size_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  std::map<std::pair<VlanID, folly::MacAddress>, std::vector<Update>>
+      updates_;
+  size_t size_{0};
+};
+
+/*
+ * MacTableManager applies the L2 learning updates of the HwSwitch to the MAC
+ * tables of the SwitchState.
+ *
+ * Instead of one state update per learned or aged MAC, updates are buffered
+ * and applied in batches of up to --l2_learning_batch_max_updates, so that a
+ * learning storm costs a few state updates rather than one per MAC. A batch
+ * is applied as soon as the update thread gets to it, or after
+ * --l2_learning_batch_window_ms to let more updates accumulate.
+ */
 class MacTableManager {
  public:
   explicit MacTableManager(SwSwitch* sw);
@@ -24,11 +86,35 @@ class MacTableManager {
       L2EntryUpdateType l2EntryUpdateType);
 
  private:
+  struct PendingUpdates {
+    L2LearningUpdateBuffer buffer;
+    // Number of state updates scheduled to apply the buffered updates
+    size_t scheduledBatches{0};
+    // Whether a flush is waiting for the batch window to expire
+    bool windowPending{false};
+  };
+  using SynchronizedPendingUpdates = folly::Synchronized<PendingUpdates>;
+
+  // These don't refer to the MacTableManager, which may be destroyed before
+  // the updates and timers they schedule run.
+  static void scheduleBatch(
+      SwSwitch* sw,
+      const std::shared_ptr<SynchronizedPendingUpdates>& pending);
+  static void scheduleBatchesNeeded(
+      SwSwitch* sw,
+      const std::shared_ptr<SynchronizedPendingUpdates>& pending,
+      PendingUpdates* locked);
+  static std::shared_ptr<SwitchState> applyBatch(
+      SwSwitch* sw,
+      const std::shared_ptr<SynchronizedPendingUpdates>& pending,
+      const std::shared_ptr<SwitchState>& state);
+
   // Forbidden copy constructor and assignment operator
   MacTableManager(MacTableManager const&) = delete;
   MacTableManager& operator=(MacTableManager const&) = delete;
 
   SwSwitch* sw_{nullptr};
+  std::shared_ptr<SynchronizedPendingUpdates> pending_;
 };
 
 } // namespace facebook::fboss
@@ -117,6 +117,18 @@ std::shared_ptr<SwitchState> MacTableUtils::updateMacTable(
   return newState;
 }
 
+std::shared_ptr<SwitchState> MacTableUtils::updateMacTable(
+    const std::shared_ptr<SwitchState>& state,
+    const std::vector<std::pair<L2Entry, L2EntryUpdateType>>& updates) {
+  // Only the first update clones the MAC tables it modifies, the following
+  // ones modify the unpublished copies in place.
+  auto newState = state;
+  for (const auto& [l2Entry, l2EntryUpdateType] : updates) {
+    newState = updateMacTable(newState, l2Entry, l2EntryUpdateType);
+  }
+  return newState;
+}
+
 std::shared_ptr<SwitchState> MacTableUtils::updateOrAddEntryWithClassID(
     const std::shared_ptr<SwitchState>& state,
     VlanID vlanID,
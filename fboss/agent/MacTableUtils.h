@@ -12,6 +12,9 @@
 #include "fboss/agent/L2Entry.h"
 #include "fboss/agent/state/SwitchState.h"
 
+#include <utility>
+#include <vector>
+
 namespace facebook::fboss {
 
 class SwitchState;
@@ -24,6 +27,13 @@ class MacTableUtils {
       L2Entry l2Entry,
       L2EntryUpdateType l2EntryUpdateType);
 
+  /*
+   * Apply a batch of L2 learning updates in order, in a single new state.
+   */
+  static std::shared_ptr<SwitchState> updateMacTable(
+      const std::shared_ptr<SwitchState>& state,
+      const std::vector<std::pair<L2Entry, L2EntryUpdateType>>& updates);
+
   static std::shared_ptr<SwitchState> updateOrAddEntryWithClassID(
       const std::shared_ptr<SwitchState>& state,
       VlanID vlanID,
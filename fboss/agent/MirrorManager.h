@@ -12,7 +12,11 @@ namespace facebook::fboss {
 class MirrorManager : public AutoRegisterStateObserver {
  public:
   explicit MirrorManager(SwSwitch* sw)
-      : AutoRegisterStateObserver(sw, "MirrorManager"),
+      : AutoRegisterStateObserver(
+            sw,
+            "MirrorManager",
+            // Only queues a state update when mirrors need resolving
+            StateObserverOptions{StateObserverMode::PARALLEL, {}}),
         sw_(sw),
         v4Manager_(std::make_unique<MirrorManagerV4>(sw)),
         v6Manager_(std::make_unique<MirrorManagerV6>(sw)) {}
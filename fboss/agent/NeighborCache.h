@@ -11,6 +11,7 @@
 
 #include "fboss/agent/NeighborCacheEntry.h"
 #include "fboss/agent/NeighborCacheImpl-defs.h"
+#include "fboss/agent/NeighborTimerWheel.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/state/PortDescriptor.h"
 
@@ -21,7 +22,9 @@
 #include <folly/logging/xlog.h>
 #include <chrono>
 #include <list>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace facebook::fboss {
 
@@ -35,15 +38,20 @@ namespace facebook::fboss {
  *
  * This class wraps the common logic for a NeighborCache. It is meant to be
  * extended for ARP/NDP specific caches.
+ *
+ * The cache owns the timeouts of its entries on the switch's
+ * NeighborTimerWheel: all the entries expiring in a tick are processed under
+ * a single acquisition of the cache lock, and the probes they send go out
+ * once the lock is released.
  */
 template <typename NTable>
-class NeighborCache {
+class NeighborCache : public NeighborTimerWheel::Owner {
   friend class NeighborCacheEntry<NTable>;
 
  public:
   typedef typename NTable::Entry::AddressType AddressType;
 
-  virtual ~NeighborCache() {}
+  ~NeighborCache() override {}
 
   bool flushEntryBlocking(AddressType ip) {
     std::lock_guard<std::mutex> g(cacheLock_);
@@ -185,7 +193,13 @@ class NeighborCache {
   }
 
  private:
-  // This should only be called by a NeighborCacheEntry
+  struct PendingProbe {
+    AddressType ip;
+    // Only set for unicast reachability probes
+    std::optional<folly::MacAddress> mac;
+    std::optional<PortDescriptor> port;
+  };
+
   virtual void checkReachability(
       AddressType /*targetIP*/,
       folly::MacAddress /*targetMac*/,
@@ -205,9 +219,54 @@ class NeighborCache {
     return impl_->flushEntry(ip);
   }
 
-  void processEntry(AddressType ip) {
-    std::lock_guard<std::mutex> g(cacheLock_);
-    return impl_->processEntry(ip);
+  /*
+   * Called on the neighbor cache thread with the entries whose timeout
+   * expired in the last tick of the timer wheel.
+   */
+  void timeoutsExpired(
+      const std::vector<std::shared_ptr<NeighborTimerWheel::Timeout>>& expired)
+      noexcept override {
+    std::vector<PendingProbe> probes;
+    {
+      std::lock_guard<std::mutex> g(cacheLock_);
+      std::vector<AddressType> ips;
+      ips.reserve(expired.size());
+      for (const auto& timeout : expired) {
+        ips.push_back(
+            static_cast<NeighborCacheEntry<NTable>*>(timeout.get())->getIP());
+      }
+      pendingProbes_ = &probes;
+      impl_->processEntries(ips);
+      pendingProbes_ = nullptr;
+    }
+    for (const auto& probe : probes) {
+      if (probe.mac) {
+        checkReachability(probe.ip, *probe.mac, *probe.port);
+      } else {
+        probeFor(probe.ip);
+      }
+    }
+  }
+
+  // These should only be called by a NeighborCacheEntry. Probes sent while
+  // expired entries are processed are deferred until the lock is released.
+  void sendProbe(AddressType ip) {
+    if (pendingProbes_) {
+      pendingProbes_->push_back(PendingProbe{ip, std::nullopt, std::nullopt});
+    } else {
+      probeFor(ip);
+    }
+  }
+
+  void sendReachabilityProbe(
+      AddressType ip,
+      folly::MacAddress mac,
+      PortDescriptor port) {
+    if (pendingProbes_) {
+      pendingProbes_->push_back(PendingProbe{ip, mac, port});
+    } else {
+      checkReachability(ip, mac, port);
+    }
   }
 
   // Has the entry corresponding to ip has been hit in hw
@@ -225,6 +284,8 @@ class NeighborCache {
   std::chrono::seconds staleEntryInterval_;
   std::unique_ptr<NeighborCacheImpl<NTable>> impl_;
   std::mutex cacheLock_;
+  // Probes queued while processing expired entries, protected by cacheLock_
+  std::vector<PendingProbe>* pendingProbes_{nullptr};
 };
 
 } // namespace facebook::fboss
@@ -11,6 +11,7 @@
 
 #include "fboss/agent/AddressUtil.h"
 #include "fboss/agent/FbossError.h"
+#include "fboss/agent/NeighborTimerWheel.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/state/NeighborEntry.h"
 #include "fboss/agent/state/PortDescriptor.h"
@@ -52,9 +53,10 @@
  * UNINITIALIZED - Placeholder on startup.
  *
  * Once an entry is created, it is responsible for scheduling the timeout for
- * its next update. When that timeout expires, the state machine is run and the
- * next update is scheduled. If the entry ever transitions to the EXPIRED state,
- * we do not schedule another update and the cache will flush the entry.
+ * its next update on the switch's NeighborTimerWheel. When that timeout
+ * expires, the state machine is run and the next update is scheduled. If the
+ * entry ever transitions to the EXPIRED state, we do not schedule another
+ * update and the cache will flush the entry.
  *
  * There is no locking in this class. Instead, the class relies on the
  * synchronization provided by NeighborCache, which should lock around all calls
@@ -78,7 +80,7 @@ template <typename NTable>
 class NeighborCache;
 
 template <typename NTable>
-class NeighborCacheEntry : private folly::AsyncTimeout {
+class NeighborCacheEntry : public NeighborTimerWheel::Timeout {
  public:
   typedef typename NTable::Entry::AddressType AddressType;
   typedef NeighborCache<NTable> Cache;
@@ -89,7 +91,7 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
       folly::EventBase* evb,
       Cache* cache,
       NeighborEntryState state)
-      : AsyncTimeout(evb),
+      : Timeout(cache),
         fields_(fields),
         cache_(cache),
         evb_(evb),
@@ -224,19 +226,10 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
   }
 
  private:
-  /*
-   * We tell the cache that this entry needs to be processed. The cache is
-   * responsible for serializing this with other flush or rx events to prevent
-   * races.
-   */
-  void timeoutExpired() noexcept override {
-    cache_->processEntry(getIP());
-  }
-
   /*
    * Schedules an update on the evb_. This is done synchronously so that we
    * can have a destructor guard around both running the state machine and
-   * scheduling the next update in timeoutExpired.
+   * scheduling the next update in process().
    */
   void scheduleNextUpdate() {
     CHECK(evb_->inRunningEventBaseThread());
@@ -249,7 +242,7 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
         scheduleTimeout(lifetime);
         break;
       case NeighborEntryState::STALE:
-        scheduleTimeout(std::chrono::seconds(cache_->getStaleEntryInterval()));
+        scheduleTimeout(calculateStaleInterval());
         break;
       case NeighborEntryState::PROBE:
       case NeighborEntryState::INCOMPLETE:
@@ -281,6 +274,24 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
     return std::chrono::milliseconds(lifetime);
   }
 
+  /*
+   * Calculates how long an entry stays STALE before its hit bit is checked
+   * again. The interval is stretched by up to 10% so that entries which went
+   * stale together, e.g. after a warm boot, don't keep getting processed in
+   * the same tick.
+   */
+  std::chrono::milliseconds calculateStaleInterval() const {
+    auto base = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    cache_->getStaleEntryInterval())
+                    .count();
+    auto jitter = folly::Random::rand32(base / 10 + 1);
+    return std::chrono::milliseconds(base + jitter);
+  }
+
+  void scheduleTimeout(std::chrono::milliseconds delay) {
+    cache_->getSw()->getNeighborTimerWheel()->scheduleTimeout(this, delay);
+  }
+
   bool hasProbesLeft() const {
     return probesLeft_ > 0;
   }
@@ -321,10 +332,10 @@ class NeighborCacheEntry : private folly::AsyncTimeout {
     if (hasProbesLeft()) {
       if (state_ == NeighborEntryState::INCOMPLETE) {
         /* entry is INCOMPLETE, issue multicast probe */
-        cache_->probeFor(getIP());
+        cache_->sendProbe(getIP());
       } else {
         /* entry is PROBE, issue unicast probe */
-        cache_->checkReachability(getIP(), getMac(), getPort());
+        cache_->sendReachabilityProbe(getIP(), getMac(), getPort());
       }
       --probesLeft_;
     } else {
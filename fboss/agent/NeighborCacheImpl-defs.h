@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <folly/Conv.h>
 #include <folly/IPAddress.h>
 #include <folly/MacAddress.h>
 #include <folly/futures/Future.h>
@@ -273,14 +274,37 @@ void NeighborCacheImpl<NTable>::setPendingEntry(AddressType ip, bool force) {
 }
 
 template <typename NTable>
-void NeighborCacheImpl<NTable>::processEntry(AddressType ip) {
-  auto entry = getCacheEntry(ip);
-  if (entry) {
+void NeighborCacheImpl<NTable>::processEntries(
+    const std::vector<AddressType>& ips) {
+  std::vector<AddressType> expired;
+  for (const auto& ip : ips) {
+    auto entry = getCacheEntry(ip);
+    if (!entry) {
+      continue;
+    }
     entry->process();
     if (entry->getState() == NeighborEntryState::EXPIRED) {
-      flushEntry(ip);
+      removeEntry(ip);
+      expired.push_back(ip);
     }
   }
+  if (expired.empty()) {
+    return;
+  }
+
+  auto name = folly::to<std::string>(
+      "remove ", expired.size(), " expired neighbor entries");
+  auto updateFn = [this, expired = std::move(expired)](
+                      const std::shared_ptr<SwitchState>& state)
+      -> std::shared_ptr<SwitchState> {
+    std::shared_ptr<SwitchState> newState{state};
+    bool flushed{false};
+    for (const auto& ip : expired) {
+      flushed |= flushEntryFromSwitchState(&newState, ip);
+    }
+    return flushed ? newState : nullptr;
+  };
+  sw_->updateState(name, std::move(updateFn));
 }
 
 template <typename NTable>
@@ -21,6 +21,7 @@
 #include <list>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace facebook::fboss {
 
@@ -129,7 +130,9 @@ class NeighborCacheImpl {
   void programEntry(Entry* entry);
   void programPendingEntry(Entry* entry, bool force = false);
 
-  void processEntry(AddressType ip);
+  // Run the state machine of the entries whose timeout expired, and flush
+  // the ones that expired from the SwitchState in a single update
+  void processEntries(const std::vector<AddressType>& ips);
 
   // Pass in a non-null flushed if you care whether an entry
   // was actually flushed from the switch state
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/NeighborTimerWheel.h"
+
+#include "fboss/agent/FbossError.h"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <unordered_map>
+
+DEFINE_int32(
+    neighbor_timer_wheel_tick_ms,
+    20,
+    "Granularity of the timer wheel aging neighbor cache entries. Entries "
+    "expire up to one tick late, and all the entries expiring in the same "
+    "tick are processed together");
+
+using namespace std::chrono_literals;
+
+namespace facebook::fboss {
+
+NeighborTimerWheel::NeighborTimerWheel(
+    folly::EventBase* evb,
+    std::chrono::milliseconds tick,
+    size_t numSlots)
+    : AsyncTimeout(evb),
+      evb_(evb),
+      tick_(tick),
+      start_(std::chrono::steady_clock::now()),
+      slots_(numSlots) {
+  if (tick_.count() <= 0 || numSlots == 0) {
+    throw FbossError(
+        "Invalid neighbor timer wheel with ",
+        tick_.count(),
+        "ms ticks and ",
+        numSlots,
+        " slots");
+  }
+}
+
+uint64_t NeighborTimerWheel::currentTick() const {
+  return (std::chrono::steady_clock::now() - start_) / tick_;
+}
+
+void NeighborTimerWheel::scheduleTimeout(
+    Timeout* timeout,
+    std::chrono::milliseconds delay) {
+  CHECK(evb_->isInEventBaseThread());
+  if (numRecords_ == 0) {
+    // Nothing is pending, so no slot needs to be revisited
+    lastTick_ = currentTick();
+  }
+
+  // Round up so that timeouts never expire early
+  auto expireAt = std::chrono::steady_clock::now() + delay - start_;
+  uint64_t expireTick =
+      std::max<uint64_t>((expireAt + tick_ - 1ns) / tick_, lastTick_ + 1);
+
+  timeout->scheduled_ = true;
+  auto scheduleId = ++timeout->scheduleId_;
+  auto weakTimeout = timeout->weak_from_this();
+  DCHECK(!weakTimeout.expired()) << "timeout is not owned by a shared_ptr";
+  slots_[expireTick % slots_.size()].push_back(
+      Record{std::move(weakTimeout), scheduleId, expireTick});
+  ++numRecords_;
+
+  if (!isScheduled()) {
+    scheduleNextTick();
+  }
+}
+
+void NeighborTimerWheel::scheduleNextTick() {
+  // Fire at the start of the next tick
+  auto elapsed = std::chrono::steady_clock::now() - start_;
+  auto nextTick = (elapsed / tick_ + 1) * tick_;
+  AsyncTimeout::scheduleTimeout(
+      std::max(1ms, std::chrono::ceil<std::chrono::milliseconds>(
+                        nextTick - elapsed)));
+}
+
+void NeighborTimerWheel::expireSlot(
+    std::vector<Record>* slot,
+    uint64_t tick,
+    std::vector<std::shared_ptr<Timeout>>* expired) {
+  auto kept = slot->begin();
+  for (auto& record : *slot) {
+    if (record.expireTick > tick) {
+      // Due in a later round of the wheel
+      *kept++ = std::move(record);
+      continue;
+    }
+    auto timeout = record.timeout.lock();
+    if (timeout && timeout->scheduled_ &&
+        timeout->scheduleId_ == record.scheduleId) {
+      timeout->scheduled_ = false;
+      expired->push_back(std::move(timeout));
+    }
+  }
+  numRecords_ -= std::distance(kept, slot->end());
+  slot->erase(kept, slot->end());
+}
+
+void NeighborTimerWheel::timeoutExpired() noexcept {
+  auto tick = currentTick();
+  std::vector<std::shared_ptr<Timeout>> expired;
+  // Every slot was due if we fell a whole revolution behind
+  auto numTicks = std::min<uint64_t>(tick - lastTick_, slots_.size());
+  for (uint64_t t = tick - numTicks + 1; t <= tick; ++t) {
+    expireSlot(&slots_[t % slots_.size()], tick, &expired);
+  }
+  lastTick_ = tick;
+
+  // Owners schedule new timeouts from their callbacks, so only call them once
+  // the slots are swept
+  std::unordered_map<Owner*, std::vector<std::shared_ptr<Timeout>>> byOwner;
+  for (auto& timeout : expired) {
+    auto owner = timeout->owner_;
+    byOwner[owner].push_back(std::move(timeout));
+  }
+  for (const auto& ownerAndExpired : byOwner) {
+    ownerAndExpired.first->timeoutsExpired(ownerAndExpired.second);
+  }
+
+  if (numRecords_ > 0 && !isScheduled()) {
+    scheduleNextTick();
+  }
+}
+
+} // namespace facebook::fboss
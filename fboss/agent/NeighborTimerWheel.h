@@ -0,0 +1,131 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/io/async/AsyncTimeout.h>
+#include <folly/io/async/EventBase.h>
+#include <gflags/gflags.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+DECLARE_int32(neighbor_timer_wheel_tick_ms);
+
+namespace facebook::fboss {
+
+/*
+ * NeighborTimerWheel is a hashed timer wheel shared by all the neighbor
+ * cache entries of a switch, in place of one AsyncTimeout per entry.
+ *
+ * A single AsyncTimeout ticks the wheel every tick interval while timeouts
+ * are scheduled. Scheduling a timeout is O(1): it is appended to the slot of
+ * the tick it expires in, rounded up, and the slots are reused every
+ * numSlots ticks for timeouts further out. On every tick, all the timeouts
+ * that expired are handed to their Owner in one timeoutsExpired() call, so
+ * that an owner can process them under one lock and coalesce the resulting
+ * work.
+ *
+ * The wheel only holds weak references to the timeouts, so a Timeout may be
+ * destroyed from any thread without being cancelled first. Rescheduling a
+ * timeout lazily invalidates its previous schedule. Everything else must
+ * happen in the thread of the wheel's EventBase.
+ */
+class NeighborTimerWheel : private folly::AsyncTimeout {
+ public:
+  class Timeout;
+
+  class Owner {
+   public:
+    virtual ~Owner() {}
+
+    /*
+     * Called with every timeout of this owner that expired in a tick. The
+     * timeouts are no longer scheduled when this is called.
+     */
+    virtual void timeoutsExpired(
+        const std::vector<std::shared_ptr<Timeout>>& expired) noexcept = 0;
+  };
+
+  /*
+   * A timeout must be owned by a std::shared_ptr to be scheduled.
+   */
+  class Timeout : public std::enable_shared_from_this<Timeout> {
+   public:
+    explicit Timeout(Owner* owner) : owner_(owner) {}
+    virtual ~Timeout() {}
+
+    bool isScheduled() const {
+      return scheduled_;
+    }
+
+   private:
+    friend class NeighborTimerWheel;
+
+    Owner* const owner_;
+    bool scheduled_{false};
+    // Bumped every time the timeout is scheduled, so that the wheel can
+    // skip the records of previous schedules
+    uint64_t scheduleId_{0};
+  };
+
+  static constexpr size_t kDefaultNumSlots = 1024;
+
+  explicit NeighborTimerWheel(
+      folly::EventBase* evb,
+      std::chrono::milliseconds tick =
+          std::chrono::milliseconds(FLAGS_neighbor_timer_wheel_tick_ms),
+      size_t numSlots = kDefaultNumSlots);
+  ~NeighborTimerWheel() override {}
+
+  /*
+   * Schedule timeout to expire after delay, replacing any previous schedule
+   * of it.
+   */
+  void scheduleTimeout(Timeout* timeout, std::chrono::milliseconds delay);
+
+  /*
+   * Number of schedules held by the wheel, including the stale records of
+   * rescheduled or destroyed timeouts that were not swept yet.
+   */
+  size_t numRecords() const {
+    return numRecords_;
+  }
+
+ private:
+  struct Record {
+    std::weak_ptr<Timeout> timeout;
+    uint64_t scheduleId;
+    uint64_t expireTick;
+  };
+
+  void timeoutExpired() noexcept override;
+  uint64_t currentTick() const;
+  void scheduleNextTick();
+  // Move the timeouts of slot that expired by tick into expired
+  void expireSlot(
+      std::vector<Record>* slot,
+      uint64_t tick,
+      std::vector<std::shared_ptr<Timeout>>* expired);
+
+  // Forbidden copy constructor and assignment operator
+  NeighborTimerWheel(NeighborTimerWheel const&) = delete;
+  NeighborTimerWheel& operator=(NeighborTimerWheel const&) = delete;
+
+  folly::EventBase* evb_;
+  const std::chrono::milliseconds tick_;
+  const std::chrono::steady_clock::time_point start_;
+  std::vector<std::vector<Record>> slots_;
+  // Every slot up to and including this tick has been processed
+  uint64_t lastTick_{0};
+  size_t numRecords_{0};
+};
+
+} // namespace facebook::fboss
@@ -58,7 +58,12 @@ folly::Synchronized<std::set<ClientID>>
     ResolvedNexthopMonitor::kMonitoredClients;
 
 ResolvedNexthopMonitor::ResolvedNexthopMonitor(SwSwitch* sw)
-    : AutoRegisterStateObserver(sw, "ResolvedNexthopMonitor"), sw_(sw) {}
+    : AutoRegisterStateObserver(
+          sw,
+          "ResolvedNexthopMonitor",
+          // Its probe scheduler is only driven from stateUpdated()
+          StateObserverOptions{StateObserverMode::PARALLEL, {}}),
+      sw_(sw) {}
 
 void ResolvedNexthopMonitor::stateUpdated(const StateDelta& delta) {
   scheduleProbes_ = false;
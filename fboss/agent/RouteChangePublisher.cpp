@@ -0,0 +1,307 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/RouteChangePublisher.h"
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/RouteTableChunker.h"
+#include "fboss/agent/SwSwitch.h"
+#include "fboss/agent/state/Route.h"
+#include "fboss/agent/state/RouteDelta.h"
+#include "fboss/agent/state/StateDelta.h"
+#include "fboss/agent/state/SwitchState.h"
+
+#include <folly/ScopeGuard.h>
+#include <folly/logging/xlog.h>
+#if FOLLY_HAS_COROUTINES
+#include <folly/experimental/coro/UnboundedQueue.h>
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+
+DEFINE_int32(
+    route_change_subscription_max_pending,
+    100000,
+    "Number of route changes queued for a subscriber beyond which they are "
+    "dropped, and the subscriber is sent a new snapshot of the route table");
+
+using folly::IPAddressV4;
+using folly::IPAddressV6;
+
+namespace facebook::fboss {
+
+namespace {
+
+/*
+ * The change of a route as seen by a subscriber: routes which the filter does
+ * not report, such as unresolved ones, are absent.
+ */
+template <typename RouteT>
+void addRouteChange(
+    const RouteTableFilterMatcher& matcher,
+    RouterID vrf,
+    const std::shared_ptr<RouteT>& oldRoute,
+    const std::shared_ptr<RouteT>& newRoute,
+    std::vector<RouteChange>* changes) {
+  auto reported = [&matcher](const std::shared_ptr<RouteT>& route) {
+    return route && matcher.matches(*route) ? matcher.toUnicastRoute(*route)
+                                            : std::nullopt;
+  };
+  auto oldReported = reported(oldRoute);
+  auto newReported = reported(newRoute);
+
+  RouteChange change;
+  *change.vrf_ref() = vrf;
+  if (newReported) {
+    if (!oldReported) {
+      *change.type_ref() = RouteChangeType::ADDED;
+    } else if (*oldReported != *newReported) {
+      *change.type_ref() = RouteChangeType::CHANGED;
+    } else {
+      return;
+    }
+    *change.route_ref() = std::move(*newReported);
+  } else if (oldReported) {
+    *change.type_ref() = RouteChangeType::REMOVED;
+    change.route_ref()->dest = std::move(oldReported->dest);
+  } else {
+    return;
+  }
+  changes->emplace_back(std::move(change));
+}
+
+template <typename AddrT, typename RoutesDelta>
+void addRouteChanges(
+    const RouteTableFilterMatcher& matcher,
+    RouterID vrf,
+    const RoutesDelta& routesDelta,
+    std::vector<RouteChange>* changes) {
+  if (!matcher.matchesFamily<AddrT>()) {
+    return;
+  }
+  for (const auto& routeDelta : routesDelta) {
+    addRouteChange(
+        matcher, vrf, routeDelta.getOld(), routeDelta.getNew(), changes);
+  }
+}
+
+} // namespace
+
+struct RouteChangePublisher::Subscription {
+  Subscription(const RouteTableFilter& filter, size_t chunkSize)
+      : filter(filter), matcher(filter), chunkSize(chunkSize) {}
+
+  /*
+   * Queue the route changes of a delta. Returns false once the subscription
+   * is closed.
+   */
+  bool publish(const StateDelta& delta);
+
+  /*
+   * The next batch to send, or none if the subscription is closed or there is
+   * nothing to send until the next wakeup.
+   */
+  std::optional<RouteUpdateBatch> nextBatch();
+
+  bool isClosed();
+  void close();
+  // Must be called with lock held
+  void wakeUp();
+
+  const RouteTableFilter filter;
+  const RouteTableFilterMatcher matcher;
+  const size_t chunkSize;
+
+  std::mutex lock;
+  // All of the following are protected by lock
+
+  // Set when the subscriber needs a new snapshot, of this state. No changes
+  // are queued until the snapshot has been started.
+  std::shared_ptr<SwitchState> snapshotState;
+  // The snapshot being sent
+  std::unique_ptr<RouteTableChunker> snapshot;
+  std::deque<RouteChange> pending;
+  int64_t nextSequenceNumber{0};
+  // Whether the subscriber is waiting for a wakeup to pull the next batch
+  bool waiting{false};
+  bool closed{false};
+#if FOLLY_HAS_COROUTINES
+  folly::coro::UnboundedQueue<folly::Unit, false, true> wakeups;
+#endif
+};
+
+bool RouteChangePublisher::Subscription::publish(const StateDelta& delta) {
+  std::lock_guard<std::mutex> guard(lock);
+  if (closed) {
+    return false;
+  }
+  if (snapshotState) {
+    // The snapshot has not been started yet: just take a later one
+    snapshotState = delta.newState();
+    return true;
+  }
+
+  std::vector<RouteChange> changes;
+  for (const auto& rtDelta : delta.getRouteTablesDelta()) {
+    auto vrf = rtDelta.getOld() ? rtDelta.getOld()->getID()
+                                : rtDelta.getNew()->getID();
+    if (!matcher.matchesVrf(vrf)) {
+      continue;
+    }
+    addRouteChanges<IPAddressV4>(
+        matcher, vrf, rtDelta.getRoutesV4Delta(), &changes);
+    addRouteChanges<IPAddressV6>(
+        matcher, vrf, rtDelta.getRoutesV6Delta(), &changes);
+  }
+  if (changes.empty()) {
+    return true;
+  }
+
+  auto maxPending =
+      static_cast<size_t>(FLAGS_route_change_subscription_max_pending);
+  if (pending.size() + changes.size() > maxPending) {
+    XLOG(WARNING) << "Route change subscriber fell more than " << maxPending
+                  << " changes behind, sending it a new snapshot";
+    pending.clear();
+    snapshot.reset();
+    snapshotState = delta.newState();
+  } else {
+    pending.insert(
+        pending.end(),
+        std::make_move_iterator(changes.begin()),
+        std::make_move_iterator(changes.end()));
+  }
+  wakeUp();
+  return true;
+}
+
+std::optional<RouteUpdateBatch>
+RouteChangePublisher::Subscription::nextBatch() {
+  std::lock_guard<std::mutex> guard(lock);
+  if (closed) {
+    return std::nullopt;
+  }
+  RouteUpdateBatch batch;
+  if (snapshotState) {
+    snapshot = std::make_unique<RouteTableChunker>(
+        std::move(snapshotState), filter, chunkSize);
+    snapshotState = nullptr;
+    *batch.resync_ref() = true;
+  }
+  if (snapshot) {
+    *batch.changes_ref() = snapshot->nextAddedRoutes();
+    if (snapshot->done()) {
+      *batch.snapshotDone_ref() = true;
+      snapshot.reset();
+    }
+  } else if (!pending.empty()) {
+    auto end = pending.begin() + std::min(chunkSize, pending.size());
+    batch.changes_ref()->assign(
+        std::make_move_iterator(pending.begin()),
+        std::make_move_iterator(end));
+    pending.erase(pending.begin(), end);
+  } else {
+    waiting = true;
+    return std::nullopt;
+  }
+  *batch.sequenceNumber_ref() = nextSequenceNumber++;
+  return batch;
+}
+
+bool RouteChangePublisher::Subscription::isClosed() {
+  std::lock_guard<std::mutex> guard(lock);
+  return closed;
+}
+
+void RouteChangePublisher::Subscription::close() {
+  std::lock_guard<std::mutex> guard(lock);
+  closed = true;
+  wakeUp();
+}
+
+void RouteChangePublisher::Subscription::wakeUp() {
+  if (!waiting) {
+    return;
+  }
+  waiting = false;
+#if FOLLY_HAS_COROUTINES
+  wakeups.enqueue(folly::Unit());
+#endif
+}
+
+RouteChangePublisher::RouteChangePublisher(SwSwitch* sw)
+    : AutoRegisterStateObserver(
+          sw,
+          "RouteChangePublisher",
+          // Publishing route changes never feeds back into the state
+          StateObserverOptions{StateObserverMode::ASYNC, {}}),
+      sw_(sw) {}
+
+RouteChangePublisher::~RouteChangePublisher() {
+  unregister();
+  std::lock_guard<std::mutex> guard(lock_);
+  for (const auto& subscription : subscriptions_) {
+    subscription->close();
+  }
+}
+
+void RouteChangePublisher::stateUpdated(const StateDelta& delta) {
+  std::lock_guard<std::mutex> guard(lock_);
+  lastState_ = delta.newState();
+  subscriptions_.erase(
+      std::remove_if(
+          subscriptions_.begin(),
+          subscriptions_.end(),
+          [&delta](const auto& subscription) {
+            return !subscription->publish(delta);
+          }),
+      subscriptions_.end());
+}
+
+#if FOLLY_HAS_COROUTINES
+folly::coro::AsyncGenerator<RouteUpdateBatch&&> RouteChangePublisher::subscribe(
+    const RouteTableFilter& filter,
+    size_t chunkSize) {
+  if (chunkSize == 0) {
+    throw FbossError("route change batch size must be positive");
+  }
+  auto subscription = std::make_shared<Subscription>(filter, chunkSize);
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    // Until the first delta, the applied state is the one changes will be
+    // computed against
+    subscription->snapshotState = lastState_ ? lastState_ : sw_->getState();
+    subscriptions_.push_back(subscription);
+  }
+  return generateBatches(std::move(subscription));
+}
+
+folly::coro::AsyncGenerator<RouteUpdateBatch&&>
+RouteChangePublisher::generateBatches(
+    std::shared_ptr<Subscription> subscription) {
+  // Let the next stateUpdated() drop the subscription once the subscriber
+  // is gone
+  SCOPE_EXIT {
+    subscription->close();
+  };
+  while (true) {
+    if (auto batch = subscription->nextBatch()) {
+      co_yield std::move(*batch);
+    } else if (subscription->isClosed()) {
+      co_return;
+    } else {
+      co_await subscription->wakeups.dequeue();
+    }
+  }
+}
+#endif
+
+} // namespace facebook::fboss
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include "fboss/agent/StateObserver.h"
+#include "fboss/agent/if/gen-cpp2/ctrl_types.h"
+
+#include <folly/Portability.h>
+#include <gflags/gflags.h>
+#if FOLLY_HAS_COROUTINES
+#include <folly/experimental/coro/AsyncGenerator.h>
+#endif
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+DECLARE_int32(route_change_subscription_max_pending);
+
+namespace facebook::fboss {
+
+class StateDelta;
+class SwSwitch;
+class SwitchState;
+
+/*
+ * RouteChangePublisher sends the route changes of the applied state to the
+ * subscribers of the subscribeToRouteChanges thrift API.
+ *
+ * A subscriber first gets a snapshot of the routes matching its filter, then
+ * the routes added, changed and removed by each state update. The changes are
+ * queued until the subscriber pulls them. Once more than
+ * --route_change_subscription_max_pending changes are queued, they are dropped
+ * and the subscriber gets a new snapshot instead, of the latest state.
+ *
+ * Snapshots are taken from the states the changes are computed against, so a
+ * subscriber applying the batches in order always holds the routes of the
+ * last state it heard about.
+ */
+class RouteChangePublisher : public AutoRegisterStateObserver {
+ public:
+  explicit RouteChangePublisher(SwSwitch* sw);
+  ~RouteChangePublisher() override;
+
+  void stateUpdated(const StateDelta& delta) override;
+
+#if FOLLY_HAS_COROUTINES
+  /*
+   * Subscribe to the changes of the routes matching the filter, in batches of
+   * at most chunkSize changes. The subscription ends when the generator is
+   * destroyed, or when the RouteChangePublisher is.
+   */
+  folly::coro::AsyncGenerator<RouteUpdateBatch&&> subscribe(
+      const RouteTableFilter& filter,
+      size_t chunkSize);
+#endif
+
+ private:
+  struct Subscription;
+
+#if FOLLY_HAS_COROUTINES
+  static folly::coro::AsyncGenerator<RouteUpdateBatch&&> generateBatches(
+      std::shared_ptr<Subscription> subscription);
+#endif
+
+  // Forbidden copy constructor and assignment operator
+  RouteChangePublisher(RouteChangePublisher const&) = delete;
+  RouteChangePublisher& operator=(RouteChangePublisher const&) = delete;
+
+  SwSwitch* sw_;
+
+  std::mutex lock_;
+  // The new state of the last delta published, which the snapshots of new
+  // subscriptions are taken from
+  std::shared_ptr<SwitchState> lastState_;
+  std::vector<std::shared_ptr<Subscription>> subscriptions_;
+};
+
+} // namespace facebook::fboss
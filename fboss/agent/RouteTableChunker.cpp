@@ -0,0 +1,240 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/RouteTableChunker.h"
+
+#include "fboss/agent/AddressUtil.h"
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/state/Route.h"
+#include "fboss/agent/state/StateUtils.h"
+#include "fboss/agent/state/SwitchState.h"
+
+#include <folly/logging/xlog.h>
+
+#include <type_traits>
+
+using facebook::network::toBinaryAddress;
+using facebook::network::toIPAddress;
+using folly::IPAddressV4;
+using folly::IPAddressV6;
+
+namespace facebook::fboss {
+
+namespace util {
+
+std::vector<network::thrift::BinaryAddress> fromFwdNextHops(
+    RouteNextHopSet const& nexthops) {
+  std::vector<network::thrift::BinaryAddress> nhs;
+  nhs.reserve(nexthops.size());
+  for (auto const& nexthop : nexthops) {
+    auto addr = network::toBinaryAddress(nexthop.addr());
+    addr.ifName_ref() = util::createTunIntfName(nexthop.intf());
+    nhs.emplace_back(std::move(addr));
+  }
+  return nhs;
+}
+
+} // namespace util
+
+RouteTableFilterMatcher::RouteTableFilterMatcher(
+    const RouteTableFilter& filter) {
+  if (auto vrf = filter.vrf_ref()) {
+    vrf_ = RouterID(*vrf);
+  }
+  if (auto prefix = filter.prefix_ref()) {
+    auto address = toIPAddress(prefix->ip);
+    // prefixLength is an i16, check it before narrowing it to a mask
+    if (prefix->prefixLength < 0 ||
+        prefix->prefixLength > address.bitCount()) {
+      throw FbossError(
+          "Invalid prefix length ",
+          prefix->prefixLength,
+          " of route table filter prefix ",
+          address,
+          ", expected 0 to ",
+          address.bitCount());
+    }
+    prefix_ = folly::CIDRNetwork(address, prefix->prefixLength);
+  }
+  if (auto clientId = filter.clientId_ref()) {
+    clientId_ = ClientID(*clientId);
+  }
+}
+
+bool RouteTableFilterMatcher::matchesVrf(RouterID vrf) const {
+  return !vrf_ || *vrf_ == vrf;
+}
+
+template <typename AddrT>
+bool RouteTableFilterMatcher::matchesFamily() const {
+  return !prefix_ ||
+      prefix_->first.isV4() == std::is_same_v<AddrT, IPAddressV4>;
+}
+
+template <typename AddrT>
+bool RouteTableFilterMatcher::matches(const Route<AddrT>& route) const {
+  if (prefix_) {
+    const auto& prefix = route.prefix();
+    if (prefix.mask < prefix_->second ||
+        !folly::IPAddress(prefix.network)
+             .inSubnet(prefix_->first, prefix_->second)) {
+      return false;
+    }
+  }
+  return !clientId_ || route.getEntryForClient(*clientId_);
+}
+
+template <typename AddrT>
+std::optional<UnicastRoute> RouteTableFilterMatcher::toUnicastRoute(
+    const Route<AddrT>& route) const {
+  UnicastRoute unicastRoute;
+  unicastRoute.dest.ip = toBinaryAddress(route.prefix().network);
+  unicastRoute.dest.prefixLength = route.prefix().mask;
+  if (clientId_) {
+    const auto* entry = route.getEntryForClient(*clientId_);
+    *unicastRoute.nextHops_ref() =
+        util::fromRouteNextHopSet(entry->getNextHopSet());
+    for (const auto& nh : *unicastRoute.nextHops_ref()) {
+      unicastRoute.nextHopAddrs_ref()->emplace_back(*nh.address_ref());
+    }
+    return unicastRoute;
+  }
+  if (!route.isResolved()) {
+    XLOG(DBG3) << "Skipping unresolved route: " << route.str();
+    return std::nullopt;
+  }
+  const auto& fwdInfo = route.getForwardInfo();
+  *unicastRoute.nextHopAddrs_ref() =
+      util::fromFwdNextHops(fwdInfo.getNextHopSet());
+  *unicastRoute.nextHops_ref() =
+      util::fromRouteNextHopSet(fwdInfo.getNextHopSet());
+  return unicastRoute;
+}
+
+template bool RouteTableFilterMatcher::matchesFamily<IPAddressV4>() const;
+template bool RouteTableFilterMatcher::matchesFamily<IPAddressV6>() const;
+template bool RouteTableFilterMatcher::matches(const RouteV4& route) const;
+template bool RouteTableFilterMatcher::matches(const RouteV6& route) const;
+template std::optional<UnicastRoute> RouteTableFilterMatcher::toUnicastRoute(
+    const RouteV4& route) const;
+template std::optional<UnicastRoute> RouteTableFilterMatcher::toUnicastRoute(
+    const RouteV6& route) const;
+
+RouteTableChunker::RouteTableChunker(
+    std::shared_ptr<SwitchState> state,
+    const RouteTableFilter& filter,
+    size_t chunkSize)
+    : state_(std::move(state)),
+      tables_(state_->getRouteTables()),
+      matcher_(filter),
+      chunkSize_(chunkSize),
+      tableIt_(tables_->begin()) {
+  if (chunkSize_ == 0) {
+    throw FbossError("route table chunk size must be positive");
+  }
+  startTable();
+}
+
+bool RouteTableChunker::done() const {
+  return tableIt_ == tables_->end();
+}
+
+void RouteTableChunker::startTable() {
+  // Skip the tables of other VRFs
+  while (!done() && !matcher_.matchesVrf((*tableIt_)->getID())) {
+    ++tableIt_;
+  }
+  if (done()) {
+    return;
+  }
+  v4Done_ = false;
+  v4It_ = (*tableIt_)->getRibV4()->routes()->begin();
+  v6It_ = (*tableIt_)->getRibV6()->routes()->begin();
+}
+
+template <typename AddRouteFn>
+void RouteTableChunker::walk(AddRouteFn addRoute) {
+  size_t remaining = chunkSize_;
+  while (!done() && remaining > 0) {
+    const auto& table = *tableIt_;
+    auto vrf = table->getID();
+    if (!v4Done_) {
+      v4Done_ = walkRib(
+          *table->getRibV4()->routes(), &v4It_, vrf, addRoute, &remaining);
+      continue;
+    }
+    if (walkRib(
+            *table->getRibV6()->routes(), &v6It_, vrf, addRoute, &remaining)) {
+      ++tableIt_;
+      startTable();
+    }
+  }
+}
+
+template <typename AddrT, typename AddRouteFn>
+bool RouteTableChunker::walkRib(
+    const RouteTableRibNodeMap<AddrT>& routes,
+    RibIterator<AddrT>* it,
+    RouterID vrf,
+    AddRouteFn& addRoute,
+    size_t* remaining) {
+  if (!matcher_.matchesFamily<AddrT>()) {
+    // None of the routes of this address family can match
+    *it = routes.end();
+    return true;
+  }
+  for (; *it != routes.end() && *remaining > 0; ++*it) {
+    const auto& route = **it;
+    if (matcher_.matches(*route) && addRoute(vrf, *route)) {
+      --*remaining;
+    }
+  }
+  return *it == routes.end();
+}
+
+std::vector<UnicastRoute> RouteTableChunker::nextUnicastRoutes() {
+  std::vector<UnicastRoute> routes;
+  walk([&](RouterID /* vrf */, const auto& route) {
+    auto unicastRoute = matcher_.toUnicastRoute(route);
+    if (!unicastRoute) {
+      return false;
+    }
+    routes.emplace_back(std::move(*unicastRoute));
+    return true;
+  });
+  return routes;
+}
+
+std::vector<RouteDetails> RouteTableChunker::nextRouteDetails() {
+  std::vector<RouteDetails> routes;
+  walk([&](RouterID /* vrf */, const auto& route) {
+    routes.emplace_back(route.toRouteDetails());
+    return true;
+  });
+  return routes;
+}
+
+std::vector<RouteChange> RouteTableChunker::nextAddedRoutes() {
+  std::vector<RouteChange> changes;
+  walk([&](RouterID vrf, const auto& route) {
+    auto unicastRoute = matcher_.toUnicastRoute(route);
+    if (!unicastRoute) {
+      return false;
+    }
+    RouteChange change;
+    *change.type_ref() = RouteChangeType::ADDED;
+    *change.vrf_ref() = vrf;
+    *change.route_ref() = std::move(*unicastRoute);
+    changes.emplace_back(std::move(change));
+    return true;
+  });
+  return changes;
+}
+
+} // namespace facebook::fboss
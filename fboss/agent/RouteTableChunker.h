@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include "fboss/agent/if/gen-cpp2/ctrl_types.h"
+#include "fboss/agent/state/RouteTable.h"
+#include "fboss/agent/state/RouteTableMap.h"
+#include "fboss/agent/state/RouteTableRib.h"
+#include "fboss/agent/types.h"
+
+#include <folly/IPAddress.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace facebook::fboss {
+
+class SwitchState;
+
+namespace util {
+
+/**
+ * Utility function to convert `Nexthops` (resolved ones) to list<BinaryAddress>
+ */
+std::vector<network::thrift::BinaryAddress> fromFwdNextHops(
+    RouteNextHopSet const& nexthops);
+
+} // namespace util
+
+/*
+ * RouteTableFilterMatcher tells which routes a RouteTableFilter selects, and
+ * how they are reported to the clients of the route table APIs.
+ */
+class RouteTableFilterMatcher {
+ public:
+  explicit RouteTableFilterMatcher(const RouteTableFilter& filter);
+
+  bool matchesVrf(RouterID vrf) const;
+  // Whether any route of this address family can match
+  template <typename AddrT>
+  bool matchesFamily() const;
+  template <typename AddrT>
+  bool matches(const Route<AddrT>& route) const;
+
+  /*
+   * The route with the next hops it resolves to or, if the filter has a
+   * client ID, the next hops of that client. Without a client ID, unresolved
+   * routes are not reported.
+   */
+  template <typename AddrT>
+  std::optional<UnicastRoute> toUnicastRoute(const Route<AddrT>& route) const;
+
+ private:
+  std::optional<RouterID> vrf_;
+  std::optional<folly::CIDRNetwork> prefix_;
+  std::optional<ClientID> clientId_;
+};
+
+/*
+ * RouteTableChunker walks the routes of a SwitchState snapshot which match a
+ * RouteTableFilter, and returns them in chunks of at most chunkSize routes.
+ * This lets the route table be streamed to thrift clients without ever
+ * building all of it in memory.
+ *
+ * The routes are returned VRF by VRF, IPv4 before IPv6, in the order of the
+ * route tables.
+ */
+class RouteTableChunker {
+ public:
+  RouteTableChunker(
+      std::shared_ptr<SwitchState> state,
+      const RouteTableFilter& filter,
+      size_t chunkSize);
+
+  /*
+   * The next chunk of routes, with the next hops they resolve to or, if the
+   * filter has a client ID, the next hops of that client. Without a client
+   * ID, unresolved routes are skipped.
+   *
+   * Returns an empty chunk once all the routes have been returned.
+   */
+  std::vector<UnicastRoute> nextUnicastRoutes();
+
+  /*
+   * The next chunk of routes, with their details.
+   *
+   * Returns an empty chunk once all the routes have been returned.
+   */
+  std::vector<RouteDetails> nextRouteDetails();
+
+  /*
+   * The next chunk of routes, as reported by nextUnicastRoutes(), as ADDED
+   * changes of their VRF. This is the snapshot sent to route change
+   * subscribers.
+   */
+  std::vector<RouteChange> nextAddedRoutes();
+
+  bool done() const;
+
+ private:
+  template <typename AddrT>
+  using RibIterator = typename RouteTableRibNodeMap<AddrT>::Iterator;
+
+  /*
+   * Call addRoute(vrf, route) on the following routes which match the filter
+   * until it has accepted chunkSize_ of them or all the routes have been
+   * walked.
+   */
+  template <typename AddRouteFn>
+  void walk(AddRouteFn addRoute);
+  template <typename AddrT, typename AddRouteFn>
+  bool walkRib(
+      const RouteTableRibNodeMap<AddrT>& routes,
+      RibIterator<AddrT>* it,
+      RouterID vrf,
+      AddRouteFn& addRoute,
+      size_t* remaining);
+  void startTable();
+
+  // Keeps the snapshot being walked alive
+  std::shared_ptr<SwitchState> state_;
+  std::shared_ptr<RouteTableMap> tables_;
+  RouteTableFilterMatcher matcher_;
+  size_t chunkSize_;
+
+  RouteTableMap::Iterator tableIt_;
+  // Whether the IPv4 routes of the current table have all been walked
+  bool v4Done_{false};
+  RibIterator<folly::IPAddressV4> v4It_;
+  RibIterator<folly::IPAddressV6> v6It_;
+};
+
+} // namespace facebook::fboss
@@ -0,0 +1,211 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/RxPacketDispatcher.h"
+
+#include "fboss/agent/RxPacket.h"
+#include "fboss/agent/packet/Ethertype.h"
+
+#include <fb303/ThreadCachedServiceData.h>
+#include <folly/Format.h>
+#include <folly/String.h>
+#include <folly/io/Cursor.h>
+#include <folly/logging/xlog.h>
+#include <folly/system/ThreadName.h>
+
+using facebook::fb303::SUM;
+
+DEFINE_bool(
+    rx_pipeline,
+    false,
+    "Hand trapped packets off to the RX dispatcher threads instead of "
+    "processing them on the HwSwitch callback thread");
+DEFINE_int32(
+    rx_pipeline_threads,
+    2,
+    "Number of RX dispatcher worker threads when --rx_pipeline is set");
+DEFINE_int32(
+    rx_pipeline_queue_size,
+    4096,
+    "Capacity of each per-protocol RX dispatcher queue");
+
+namespace facebook::fboss {
+
+namespace {
+// dst mac + src mac + ethertype
+constexpr uint32_t kEthHdrLen = 14;
+constexpr uint32_t kVlanTagLen = 4;
+} // namespace
+
+RxPacketDispatcher::RxQueue::RxQueue(Queue id, uint32_t capacity)
+    : pkts(capacity),
+      backpressureDepth(capacity * kBackpressureThreshold),
+      droppedKey(folly::sformat("rx_pipeline.{}.dropped", queueName(id))),
+      backpressuredKey(
+          folly::sformat("rx_pipeline.{}.backpressure", queueName(id))) {}
+
+RxPacketDispatcher::RxPacketDispatcher(
+    Handler handler,
+    uint32_t numThreads,
+    uint32_t queueSize)
+    : handler_(std::move(handler)) {
+  CHECK_GT(queueSize, 0);
+  // Each queue has a single consumer, so there is no use for more workers
+  // than queues.
+  numThreads =
+      std::max<uint32_t>(1, std::min<uint32_t>(numThreads, kNumQueues));
+  for (size_t i = 0; i < kNumQueues; ++i) {
+    queues_[i] = std::make_unique<RxQueue>(static_cast<Queue>(i), queueSize);
+  }
+  for (size_t i = 0; i < numThreads; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < kNumQueues; ++i) {
+    workerFor(i)->queues.push_back(queues_[i].get());
+  }
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    auto worker = workers_[i].get();
+    worker->thread = std::make_unique<std::thread>(
+        [this, worker, i]() { workerLoop(worker, i); });
+  }
+  XLOG(INFO) << "Started RX packet dispatcher with " << workers_.size()
+             << " threads, queue size " << queueSize;
+}
+
+RxPacketDispatcher::~RxPacketDispatcher() {
+  stop();
+}
+
+void RxPacketDispatcher::stop() {
+  if (stopped_.exchange(true)) {
+    return;
+  }
+  for (auto& worker : workers_) {
+    worker->sem.post();
+  }
+  for (auto& worker : workers_) {
+    worker->thread->join();
+  }
+  // Drop whatever the workers did not get to
+  std::unique_ptr<RxPacket> pkt;
+  for (auto& queue : queues_) {
+    while (queue->pkts.read(pkt)) {
+      pkt.reset();
+    }
+  }
+}
+
+bool RxPacketDispatcher::enqueue(std::unique_ptr<RxPacket> pkt) {
+  auto queueIdx = static_cast<size_t>(classify(pkt.get()));
+  auto queue = queues_[queueIdx].get();
+  if (stopped_.load(std::memory_order_acquire) ||
+      !queue->pkts.write(std::move(pkt))) {
+    queue->dropped.fetch_add(1, std::memory_order_relaxed);
+    tcData().addStatValue(queue->droppedKey, 1, SUM);
+    return false;
+  }
+  queue->enqueued.fetch_add(1, std::memory_order_relaxed);
+  if (queue->pkts.sizeGuess() > queue->backpressureDepth) {
+    queue->backpressured.fetch_add(1, std::memory_order_relaxed);
+    tcData().addStatValue(queue->backpressuredKey, 1, SUM);
+  }
+  workerFor(queueIdx)->sem.post();
+  return true;
+}
+
+void RxPacketDispatcher::workerLoop(Worker* worker, size_t workerIdx) {
+  folly::setThreadName(folly::sformat("fbossRxWorker{}", workerIdx));
+  auto& queues = worker->queues;
+  // Rotate the queue we look at first so that a busy protocol can't starve
+  // the other ones assigned to the same worker.
+  size_t next = 0;
+  std::unique_ptr<RxPacket> pkt;
+  while (true) {
+    worker->sem.wait();
+    if (stopped_.load(std::memory_order_acquire)) {
+      return;
+    }
+    // Every post follows a completed write, so some queue is non-empty.
+    for (size_t i = 0; i < queues.size(); ++i) {
+      auto queue = queues[(next + i) % queues.size()];
+      if (queue->pkts.read(pkt)) {
+        next = (next + i + 1) % queues.size();
+        process(queue, std::move(pkt));
+        break;
+      }
+    }
+  }
+}
+
+void RxPacketDispatcher::process(
+    RxQueue* queue,
+    std::unique_ptr<RxPacket> pkt) {
+  try {
+    handler_(std::move(pkt));
+  } catch (const std::exception& ex) {
+    queue->errors.fetch_add(1, std::memory_order_relaxed);
+    XLOG(ERR) << "error processing trapped packet: " << folly::exceptionStr(ex);
+  } catch (...) {
+    queue->errors.fetch_add(1, std::memory_order_relaxed);
+    XLOG(ERR) << "unknown error processing trapped packet";
+  }
+  queue->processed.fetch_add(1, std::memory_order_relaxed);
+}
+
+RxPacketDispatcher::Queue RxPacketDispatcher::classify(const RxPacket* pkt) {
+  if (pkt->getLength() < kEthHdrLen + kVlanTagLen) {
+    return Queue::OTHER;
+  }
+  folly::io::Cursor c(pkt->buf());
+  c.skip(kEthHdrLen - sizeof(uint16_t));
+  auto ethertype = c.readBE<uint16_t>();
+  if (ethertype == static_cast<uint16_t>(ETHERTYPE::ETHERTYPE_VLAN)) {
+    c.skip(sizeof(uint16_t));
+    ethertype = c.readBE<uint16_t>();
+  }
+  switch (static_cast<ETHERTYPE>(ethertype)) {
+    case ETHERTYPE::ETHERTYPE_ARP:
+      return Queue::ARP;
+    case ETHERTYPE::ETHERTYPE_IPV6:
+      return Queue::IPV6;
+    case ETHERTYPE::ETHERTYPE_IPV4:
+      return Queue::IPV4;
+    case ETHERTYPE::ETHERTYPE_LLDP:
+      return Queue::LLDP;
+    case ETHERTYPE::ETHERTYPE_SLOW_PROTOCOLS:
+      return Queue::LACP;
+    case ETHERTYPE::ETHERRTPE_EAPOL:
+      return Queue::EAPOL;
+    default:
+      return Queue::OTHER;
+  }
+}
+
+std::string RxPacketDispatcher::queueName(Queue queue) {
+  switch (queue) {
+    case Queue::ARP:
+      return "arp";
+    case Queue::IPV6:
+      return "ipv6";
+    case Queue::IPV4:
+      return "ipv4";
+    case Queue::LLDP:
+      return "lldp";
+    case Queue::LACP:
+      return "lacp";
+    case Queue::EAPOL:
+      return "eapol";
+    case Queue::OTHER:
+    case Queue::NUM_QUEUES:
+      break;
+  }
+  return "other";
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/MPMCQueue.h>
+#include <folly/synchronization/LifoSem.h>
+#include <gflags/gflags.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+DECLARE_bool(rx_pipeline);
+DECLARE_int32(rx_pipeline_threads);
+DECLARE_int32(rx_pipeline_queue_size);
+
+namespace facebook::fboss {
+
+class RxPacket;
+
+/*
+ * RxPacketDispatcher decouples packet processing from the thread on which
+ * the HwSwitch delivers trapped packets.
+ *
+ * Packets are classified by ethertype into one of a fixed set of bounded,
+ * lock-free queues. Each queue is drained by exactly one worker thread, so
+ * packets of a given protocol are handled in arrival order and never
+ * concurrently with each other, while different protocols (e.g. ARP and
+ * NDP) no longer wait behind one another. When there are fewer workers than
+ * queues, queue i is served by worker (i % numThreads).
+ *
+ * Enqueue never blocks: a packet that finds its queue full is dropped and
+ * counted. Queues above kBackpressureThreshold of their capacity count a
+ * backpressure event on every enqueue, which is an early signal that a
+ * handler can't keep up.
+ */
+class RxPacketDispatcher {
+ public:
+  enum class Queue : uint8_t {
+    ARP,
+    IPV6,
+    IPV4,
+    LLDP,
+    LACP,
+    EAPOL,
+    OTHER,
+    NUM_QUEUES,
+  };
+  static constexpr auto kNumQueues = static_cast<size_t>(Queue::NUM_QUEUES);
+  // Fraction of queue capacity above which enqueues count as backpressure
+  static constexpr double kBackpressureThreshold = 0.75;
+
+  /*
+   * Called on a worker thread for every dequeued packet. Exceptions
+   * escaping the handler are logged and counted as errors for the queue.
+   */
+  using Handler = std::function<void(std::unique_ptr<RxPacket>)>;
+
+  RxPacketDispatcher(
+      Handler handler,
+      uint32_t numThreads = FLAGS_rx_pipeline_threads,
+      uint32_t queueSize = FLAGS_rx_pipeline_queue_size);
+  ~RxPacketDispatcher();
+
+  /*
+   * Queue a packet for processing. Returns false if the packet was dropped
+   * because its queue is full or the dispatcher is stopped.
+   */
+  bool enqueue(std::unique_ptr<RxPacket> pkt);
+
+  /*
+   * Stop the workers. Packets still queued are discarded. Safe to call
+   * more than once; called by the destructor.
+   */
+  void stop();
+
+  static Queue classify(const RxPacket* pkt);
+  static std::string queueName(Queue queue);
+
+  uint64_t getEnqueued(Queue queue) const {
+    return queues_[static_cast<size_t>(queue)]->enqueued.load(
+        std::memory_order_relaxed);
+  }
+  uint64_t getProcessed(Queue queue) const {
+    return queues_[static_cast<size_t>(queue)]->processed.load(
+        std::memory_order_relaxed);
+  }
+  uint64_t getDropped(Queue queue) const {
+    return queues_[static_cast<size_t>(queue)]->dropped.load(
+        std::memory_order_relaxed);
+  }
+  uint64_t getBackpressured(Queue queue) const {
+    return queues_[static_cast<size_t>(queue)]->backpressured.load(
+        std::memory_order_relaxed);
+  }
+  uint64_t getErrors(Queue queue) const {
+    return queues_[static_cast<size_t>(queue)]->errors.load(
+        std::memory_order_relaxed);
+  }
+  size_t getNumThreads() const {
+    return workers_.size();
+  }
+
+ private:
+  struct RxQueue {
+    RxQueue(Queue id, uint32_t capacity);
+
+    folly::MPMCQueue<std::unique_ptr<RxPacket>> pkts;
+    const size_t backpressureDepth;
+    const std::string droppedKey;
+    const std::string backpressuredKey;
+    std::atomic<uint64_t> enqueued{0};
+    std::atomic<uint64_t> processed{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> backpressured{0};
+    std::atomic<uint64_t> errors{0};
+  };
+
+  struct Worker {
+    // One post per packet enqueued to any of this worker's queues
+    folly::LifoSem sem;
+    std::vector<RxQueue*> queues;
+    std::unique_ptr<std::thread> thread;
+  };
+
+  // Forbidden copy constructor and assignment operator
+  RxPacketDispatcher(RxPacketDispatcher const&) = delete;
+  RxPacketDispatcher& operator=(RxPacketDispatcher const&) = delete;
+
+  Worker* workerFor(size_t queueIdx) {
+    return workers_[queueIdx % workers_.size()].get();
+  }
+  void workerLoop(Worker* worker, size_t workerIdx);
+  void process(RxQueue* queue, std::unique_ptr<RxPacket> pkt);
+
+  Handler handler_;
+  std::array<std::unique_ptr<RxQueue>, kNumQueues> queues_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<bool> stopped_{false};
+};
+
+} // namespace facebook::fboss
@@ -24,11 +24,15 @@ class StateObserver : public boost::noncopyable {
 
 class AutoRegisterStateObserver : public StateObserver {
  public:
-  AutoRegisterStateObserver(SwSwitch* sw, const std::string& name) : sw_(sw) {
-    sw_->registerStateObserver(this, name);
+  AutoRegisterStateObserver(
+      SwSwitch* sw,
+      const std::string& name,
+      const StateObserverOptions& options = StateObserverOptions())
+      : sw_(sw) {
+    sw_->registerStateObserver(this, name, options);
   }
   ~AutoRegisterStateObserver() override {
-    sw_->unregisterStateObserver(this);
+    unregister();
   }
 
   // This empty implementation should be overridden by subclasses, but it is
@@ -38,8 +42,23 @@ class AutoRegisterStateObserver : public StateObserver {
   // during that time if this didn't exist.
   void stateUpdated(const StateDelta& /*delta*/) override {}
 
+ protected:
+  /*
+   * Stop receiving state updates. Observers registered with
+   * StateObserverMode::ASYNC must call this from their destructor, as
+   * stateUpdated() may otherwise still be running on another thread while
+   * the derived class is destroyed.
+   */
+  void unregister() {
+    if (registered_) {
+      registered_ = false;
+      sw_->unregisterStateObserver(this);
+    }
+  }
+
  private:
   SwSwitch* sw_{nullptr};
+  bool registered_{true};
 };
 
 } // namespace facebook::fboss
@@ -0,0 +1,285 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/StateObserverNotifier.h"
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/StateObserver.h"
+#include "fboss/agent/state/StateDelta.h"
+
+#include <fb303/ServiceData.h>
+#include <fb303/ThreadCachedServiceData.h>
+#include <folly/Format.h>
+#include <folly/executors/thread_factory/NamedThreadFactory.h>
+#include <folly/futures/Future.h>
+#include <folly/logging/xlog.h>
+#include <folly/synchronization/Baton.h>
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+DEFINE_int32(
+    state_observer_threads,
+    4,
+    "Number of threads used to notify parallel and asynchronous state "
+    "observers. With 0, every observer is notified on the update thread");
+
+namespace {
+// Observer latencies are in usecs, anything past 1s lands in the overflow
+// bucket
+constexpr int64_t kHistogramBucketUsecs = 1000;
+constexpr int64_t kHistogramMaxUsecs = 1000000;
+} // namespace
+
+namespace facebook::fboss {
+
+StateObserverNotifier::Observer::Observer(
+    StateObserver* observer,
+    const std::string& name,
+    const StateObserverOptions& options)
+    : observer(observer),
+      name(name),
+      options(options),
+      latencyKey(folly::sformat("state_observer.{}.latency.us", name)),
+      queueDelayKey(folly::sformat("state_observer.{}.queue_delay.us", name)) {
+  std::vector<std::string> keys{latencyKey};
+  if (options.mode == StateObserverMode::ASYNC) {
+    keys.push_back(queueDelayKey);
+  }
+  for (const auto& key : keys) {
+    fb303::fbData->addHistogram(
+        key, kHistogramBucketUsecs, 0, kHistogramMaxUsecs);
+    fb303::fbData->exportHistogramPercentile(key, 50, 95, 99);
+  }
+}
+
+StateObserverNotifier::StateObserverNotifier(uint32_t numThreads) {
+  if (numThreads > 0) {
+    pool_ = std::make_unique<folly::CPUThreadPoolExecutor>(
+        numThreads,
+        std::make_shared<folly::NamedThreadFactory>("StateObserver"));
+  }
+}
+
+StateObserverNotifier::~StateObserverNotifier() {
+  waitForAsyncObservers();
+  observers_.clear();
+  rounds_.clear();
+  if (pool_) {
+    pool_->join();
+  }
+}
+
+bool StateObserverNotifier::runsAsync(const Observer& observer) const {
+  return pool_ && observer.options.mode == StateObserverMode::ASYNC;
+}
+
+bool StateObserverNotifier::runsInParallel(const Observer& observer) const {
+  return pool_ && observer.options.mode == StateObserverMode::PARALLEL;
+}
+
+const StateObserverNotifier::Observer* StateObserverNotifier::findByName(
+    const std::string& name) const {
+  for (const auto& observer : observers_) {
+    if (observer->name == name) {
+      return observer.get();
+    }
+  }
+  return nullptr;
+}
+
+bool StateObserverNotifier::isRegistered(StateObserver* observer) const {
+  return std::any_of(
+      observers_.begin(), observers_.end(), [observer](const auto& entry) {
+        return entry->observer == observer;
+      });
+}
+
+void StateObserverNotifier::addObserver(
+    StateObserver* observer,
+    const std::string& name,
+    const StateObserverOptions& options) {
+  if (isRegistered(observer)) {
+    throw FbossError("State observer add failed: ", name, " already exists");
+  }
+  auto entry = std::make_shared<Observer>(observer, name, options);
+  if (runsAsync(*entry)) {
+    // Deliver deltas on the queue of an asynchronous observer this one
+    // depends on, so that it always sees them first.
+    for (const auto& depName : options.dependencies) {
+      auto dep = findByName(depName);
+      if (dep && runsAsync(*dep)) {
+        entry->queue = dep->queue;
+        break;
+      }
+    }
+    if (!entry->queue) {
+      entry->queue = folly::SerialExecutor::create(
+          folly::getKeepAliveToken(pool_.get()));
+    }
+  }
+  observers_.push_back(entry);
+  try {
+    rebuildRounds();
+  } catch (const FbossError&) {
+    observers_.pop_back();
+    throw;
+  }
+}
+
+void StateObserverNotifier::removeObserver(StateObserver* observer) {
+  auto it = std::find_if(
+      observers_.begin(), observers_.end(), [observer](const auto& entry) {
+        return entry->observer == observer;
+      });
+  if (it == observers_.end()) {
+    throw FbossError("State observer remove failed: observer does not exist");
+  }
+  auto entry = *it;
+  observers_.erase(it);
+  rebuildRounds();
+  // The observer may be destroyed as soon as we return
+  if (entry->queue) {
+    waitForQueue(entry->queue);
+  }
+}
+
+void StateObserverNotifier::rebuildRounds() {
+  // Round of each SERIAL or PARALLEL observer, -1 while its dependencies are
+  // being visited
+  std::unordered_map<const Observer*, int> roundOf;
+  std::function<int(const Observer*)> visit = [&](const Observer* observer) {
+    auto it = roundOf.find(observer);
+    if (it != roundOf.end()) {
+      if (it->second < 0) {
+        throw FbossError(
+            "State observer ", observer->name, " has a circular dependency");
+      }
+      return it->second;
+    }
+    roundOf[observer] = -1;
+    int round = 0;
+    for (const auto& depName : observer->options.dependencies) {
+      auto dep = findByName(depName);
+      if (!dep) {
+        continue;
+      }
+      if (dep->options.mode == StateObserverMode::ASYNC) {
+        if (observer->options.mode != StateObserverMode::ASYNC) {
+          throw FbossError(
+              "State observer ",
+              observer->name,
+              " can't depend on asynchronous state observer ",
+              dep->name);
+        }
+        if (dep->queue.get() != observer->queue.get()) {
+          throw FbossError(
+              "State observer ",
+              observer->name,
+              " must be registered after asynchronous state observer ",
+              dep->name,
+              " it depends on");
+        }
+        continue;
+      }
+      if (!runsAsync(*observer)) {
+        round = std::max(round, visit(dep) + 1);
+      }
+    }
+    roundOf[observer] = round;
+    return round;
+  };
+
+  std::vector<std::vector<std::shared_ptr<Observer>>> rounds;
+  for (const auto& observer : observers_) {
+    auto round = visit(observer.get());
+    if (runsAsync(*observer)) {
+      continue;
+    }
+    if (rounds.size() <= static_cast<size_t>(round)) {
+      rounds.resize(round + 1);
+    }
+    rounds[round].push_back(observer);
+  }
+  rounds_ = std::move(rounds);
+}
+
+void StateObserverNotifier::notify(const StateDelta& delta) {
+  for (const auto& round : rounds_) {
+    std::vector<folly::Future<folly::Unit>> parallel;
+    for (const auto& observer : round) {
+      if (runsInParallel(*observer)) {
+        parallel.push_back(folly::via(pool_.get(), [observer, &delta]() {
+          runObserver(*observer, delta);
+        }));
+      }
+    }
+    for (const auto& observer : round) {
+      if (!runsInParallel(*observer)) {
+        runObserver(*observer, delta);
+      }
+    }
+    folly::collectAll(parallel.begin(), parallel.end()).wait();
+  }
+
+  for (const auto& observer : observers_) {
+    if (!runsAsync(*observer)) {
+      continue;
+    }
+    observer->queue->add([observer,
+                          oldState = delta.oldState(),
+                          newState = delta.newState(),
+                          queued = std::chrono::steady_clock::now()]() {
+      recordDuration(observer->queueDelayKey, queued);
+      runObserver(*observer, StateDelta(oldState, newState));
+    });
+  }
+}
+
+void StateObserverNotifier::waitForAsyncObservers() {
+  for (const auto& observer : observers_) {
+    if (observer->queue) {
+      waitForQueue(observer->queue);
+    }
+  }
+}
+
+void StateObserverNotifier::waitForQueue(
+    const folly::Executor::KeepAlive<folly::SerialExecutor>& queue) {
+  folly::Baton<> drained;
+  queue->add([&drained]() { drained.post(); });
+  drained.wait();
+}
+
+void StateObserverNotifier::runObserver(
+    const Observer& observer,
+    const StateDelta& delta) {
+  auto start = std::chrono::steady_clock::now();
+  try {
+    observer.observer->stateUpdated(delta);
+  } catch (const std::exception& ex) {
+    // TODO: Figure out the best way to handle errors here.
+    XLOG(FATAL) << "error notifying " << observer.name
+                << " of update: " << folly::exceptionStr(ex);
+  }
+  recordDuration(observer.latencyKey, start);
+}
+
+void StateObserverNotifier::recordDuration(
+    const std::string& key,
+    std::chrono::steady_clock::time_point start) {
+  fb303::ThreadCachedServiceData::get()->addHistogramValue(
+      key,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,151 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/executors/SerialExecutor.h>
+#include <gflags/gflags.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+DECLARE_int32(state_observer_threads);
+
+namespace facebook::fboss {
+
+class StateDelta;
+class StateObserver;
+
+enum class StateObserverMode {
+  /*
+   * stateUpdated() runs on the update thread. This is the default, and the
+   * only mode that is safe for observers which share data with other code
+   * running on the update thread.
+   */
+  SERIAL,
+  /*
+   * stateUpdated() runs on the notifier thread pool, concurrently with the
+   * other observers it does not depend on. The update thread still waits for
+   * it to return before applying the next state update.
+   */
+  PARALLEL,
+  /*
+   * stateUpdated() runs on the notifier thread pool and the update thread
+   * does not wait for it. Deltas are delivered one at a time, in the order
+   * they were applied. Only suitable for observers that read the state and
+   * do not need to act on a delta before the next update is applied.
+   */
+  ASYNC,
+};
+
+struct StateObserverOptions {
+  StateObserverMode mode{StateObserverMode::SERIAL};
+  /*
+   * Names of the observers which must finish processing a delta before this
+   * observer is notified of it. Names that are not registered are ignored.
+   * SERIAL and PARALLEL observers can't depend on ASYNC ones. An ASYNC
+   * observer depending on another ASYNC observer shares its delivery queue.
+   */
+  std::vector<std::string> dependencies;
+};
+
+/*
+ * StateObserverNotifier delivers every applied StateDelta to the registered
+ * StateObservers.
+ *
+ * SERIAL and PARALLEL observers are notified in rounds: an observer's round
+ * is one past the latest round of the observers it depends on. Within a
+ * round PARALLEL observers are handed to the thread pool while SERIAL ones
+ * run on the calling thread in registration order, and the next round
+ * starts once all of them are done. notify() returns once every SERIAL and
+ * PARALLEL observer has processed the delta; ASYNC observers are only
+ * queued by then.
+ *
+ * All methods except waitForAsyncObservers() must be called from the same
+ * thread (the SwSwitch update thread). With no threads, every observer is
+ * notified on the calling thread regardless of its mode.
+ *
+ * The time each observer spends in stateUpdated() is exported as the
+ * state_observer.<name>.latency.us histogram, and the time ASYNC deltas spend
+ * queued as state_observer.<name>.queue_delay.us.
+ */
+class StateObserverNotifier {
+ public:
+  explicit StateObserverNotifier(
+      uint32_t numThreads = FLAGS_state_observer_threads);
+  ~StateObserverNotifier();
+
+  /*
+   * Throws FbossError if observer is already registered, or if its
+   * dependencies can't be satisfied.
+   */
+  void addObserver(
+      StateObserver* observer,
+      const std::string& name,
+      const StateObserverOptions& options);
+  /*
+   * Throws FbossError if observer is not registered. Returns once observer
+   * has processed every delta it was already sent.
+   */
+  void removeObserver(StateObserver* observer);
+  bool isRegistered(StateObserver* observer) const;
+
+  void notify(const StateDelta& delta);
+
+  /*
+   * Block until ASYNC observers have processed every delta queued so far.
+   */
+  void waitForAsyncObservers();
+
+  uint32_t getNumThreads() const {
+    return pool_ ? pool_->numThreads() : 0;
+  }
+
+ private:
+  struct Observer {
+    Observer(
+        StateObserver* observer,
+        const std::string& name,
+        const StateObserverOptions& options);
+
+    StateObserver* const observer;
+    const std::string name;
+    const StateObserverOptions options;
+    const std::string latencyKey;
+    const std::string queueDelayKey;
+    // Only set for ASYNC observers
+    folly::Executor::KeepAlive<folly::SerialExecutor> queue;
+  };
+
+  // Forbidden copy constructor and assignment operator
+  StateObserverNotifier(StateObserverNotifier const&) = delete;
+  StateObserverNotifier& operator=(StateObserverNotifier const&) = delete;
+
+  bool runsAsync(const Observer& observer) const;
+  bool runsInParallel(const Observer& observer) const;
+  const Observer* findByName(const std::string& name) const;
+  void rebuildRounds();
+  static void waitForQueue(
+      const folly::Executor::KeepAlive<folly::SerialExecutor>& queue);
+  static void runObserver(const Observer& observer, const StateDelta& delta);
+  static void recordDuration(
+      const std::string& key,
+      std::chrono::steady_clock::time_point start);
+
+  std::unique_ptr<folly::CPUThreadPoolExecutor> pool_;
+  // In registration order
+  std::vector<std::shared_ptr<Observer>> observers_;
+  // SERIAL and PARALLEL observers, grouped by the round they are notified in
+  std::vector<std::vector<std::shared_ptr<Observer>>> rounds_;
+};
+
+} // namespace facebook::fboss
@@ -32,6 +32,7 @@
 #endif
 #include "fboss/agent/MacTableManager.h"
 #include "fboss/agent/MirrorManager.h"
+#include "fboss/agent/NeighborTimerWheel.h"
 #include "fboss/agent/NeighborUpdater.h"
 #include "fboss/agent/Platform.h"
 #include "fboss/agent/PortStats.h"
@@ -39,8 +40,10 @@
 #include "fboss/agent/ResolvedNexthopMonitor.h"
 #include "fboss/agent/ResolvedNexthopProbeScheduler.h"
 #include "fboss/agent/RestartTimeTracker.h"
+#include "fboss/agent/RouteChangePublisher.h"
 #include "fboss/agent/RouteUpdateLogger.h"
 #include "fboss/agent/RxPacket.h"
+#include "fboss/agent/RxPacketDispatcher.h"
 #include "fboss/agent/StaticL2ForNeighborObserver.h"
 #include "fboss/agent/SwitchStats.h"
 #include "fboss/agent/ThriftHandler.h"
@@ -114,6 +117,12 @@ DEFINE_bool(
     false,
     "Flag to turn on logging of all updates to the FIB");
 
+DEFINE_bool(
+    pipelined_state_updates,
+    false,
+    "Program switch state updates to HW on a dedicated thread, so that the "
+    "update thread can compute the next state while HW is busy");
+
 namespace {
 
 /**
@@ -165,6 +174,8 @@ namespace facebook::fboss {
 SwSwitch::SwSwitch(std::unique_ptr<Platform> platform)
     : hw_(platform->getHwSwitch()),
       platform_(std::move(platform)),
+      neighborTimerWheel_(new NeighborTimerWheel(&neighborCacheEventBase_)),
+      stateObserverNotifier_(new StateObserverNotifier()),
       arp_(new ArpHandler(this)),
       ipv4_(new IPv4Handler(this)),
       ipv6_(new IPv6Handler(this)),
@@ -172,6 +183,7 @@ SwSwitch::SwSwitch(std::unique_ptr<Platform> platform)
       pcapMgr_(new PktCaptureManager(this)),
       mirrorManager_(new MirrorManager(this)),
       routeUpdateLogger_(new RouteUpdateLogger(this)),
+      routeChangePublisher_(new RouteChangePublisher(this)),
       resolvedNexthopMonitor_(new ResolvedNexthopMonitor(this)),
       resolvedNexthopProbeScheduler_(new ResolvedNexthopProbeScheduler(this)),
       rib_(new rib::RoutingInformationBase()),
@@ -205,6 +217,10 @@ void SwSwitch::stop() {
   // while we are destroying ourselves
   hw_->unregisterCallbacks();
 
+  // Drain no more trapped packets; the handlers they would be dispatched
+  // to, tunMgr_ among them, are torn down below.
+  rxPacketDispatcher_.reset();
+
   // Stop tunMgr so we don't get any packets to process
   // in software that were sent to the switch ip or were
   // routed from kernel to the front panel tunnel interface.
@@ -239,6 +255,7 @@ void SwSwitch::stop() {
   ipv6_.reset();
 
   routeUpdateLogger_.reset();
+  routeChangePublisher_.reset();
 
   bgThreadHeartbeat_.reset();
   updThreadHeartbeat_.reset();
@@ -551,6 +568,24 @@ void SwSwitch::init(std::unique_ptr<TunManager> tunMgr, SwitchFlags flags) {
         stats()->neighborCacheEventBacklog(backlog);
       });
 
+  if (FLAGS_rx_pipeline) {
+    rxPacketDispatcher_ = std::make_unique<RxPacketDispatcher>(
+        [this](std::unique_ptr<RxPacket> pkt) {
+          // Same checks as handlePacket(), the switch may have started
+          // exiting while the packet was queued.
+          if (!isFullyInitialized()) {
+            return;
+          }
+          PortID port = pkt->getSrcPort();
+          try {
+            processPacket(std::move(pkt));
+          } catch (const std::exception&) {
+            portStats(port)->pktError();
+            throw;
+          }
+        });
+  }
+
   setSwitchRunState(SwitchRunState::INITIALIZED);
   if (FLAGS_log_all_fib_updates) {
     constexpr auto kAllFibUpdates = "all_fib_updates";
@@ -616,10 +651,11 @@ void SwSwitch::fibSynced() {
 
 void SwSwitch::registerStateObserver(
     StateObserver* observer,
-    const string name) {
+    const string name,
+    const StateObserverOptions& options) {
   XLOG(DBG2) << "Registering state observer: " << name;
   updateEventBase_.runImmediatelyOrRunInEventBaseThreadAndWait(
-      [=]() { addStateObserver(observer, name); });
+      [=]() { addStateObserver(observer, name, options); });
 }
 
 void SwSwitch::unregisterStateObserver(StateObserver* observer) {
@@ -629,23 +665,20 @@ void SwSwitch::unregisterStateObserver(StateObserver* observer) {
 
 bool SwSwitch::stateObserverRegistered(StateObserver* observer) {
   DCHECK(updateEventBase_.isInEventBaseThread());
-  return stateObservers_.find(observer) != stateObservers_.end();
+  return stateObserverNotifier_->isRegistered(observer);
 }
 
 void SwSwitch::removeStateObserver(StateObserver* observer) {
   DCHECK(updateEventBase_.isInEventBaseThread());
-  auto nErased = stateObservers_.erase(observer);
-  if (!nErased) {
-    throw FbossError("State observer remove failed: observer does not exist");
-  }
+  stateObserverNotifier_->removeObserver(observer);
 }
 
-void SwSwitch::addStateObserver(StateObserver* observer, const string& name) {
+void SwSwitch::addStateObserver(
+    StateObserver* observer,
+    const string& name,
+    const StateObserverOptions& options) {
   DCHECK(updateEventBase_.isInEventBaseThread());
-  if (stateObserverRegistered(observer)) {
-    throw FbossError("State observer add failed: ", name, " already exists");
-  }
-  stateObservers_.emplace(observer, name);
+  stateObserverNotifier_->addObserver(observer, name, options);
 }
 
 void SwSwitch::notifyStateObservers(const StateDelta& delta) {
@@ -654,16 +687,7 @@ void SwSwitch::notifyStateObservers(const StateDelta& delta) {
     // Make sure the SwSwitch is not already being destroyed
     return;
   }
-  for (auto observerName : stateObservers_) {
-    try {
-      auto observer = observerName.first;
-      observer->stateUpdated(delta);
-    } catch (const std::exception& ex) {
-      // TODO: Figure out the best way to handle errors here.
-      XLOG(FATAL) << "error notifying " << observerName.second
-                  << " of update: " << folly::exceptionStr(ex);
-    }
-  }
+  stateObserverNotifier_->notify(delta);
 }
 
 bool SwSwitch::updateState(unique_ptr<StateUpdate> update) {
@@ -729,13 +753,26 @@ void SwSwitch::handlePendingUpdatesHelper(SwSwitch* sw) {
 }
 
 void SwSwitch::handlePendingUpdates() {
+  if (hwUpdateThread_ && !isExiting()) {
+    handlePendingUpdatesPipelined();
+    return;
+  }
+  // Anything still in the pipeline was queued before the updates below
+  drainUpdatePipeline();
+  StateUpdateList updates;
+  if (!takePendingUpdates(&updates)) {
+    return;
+  }
+  applyPendingUpdates(&updates);
+}
+
+bool SwSwitch::takePendingUpdates(StateUpdateList* updates) {
   // Get the list of updates to run.
   //
   // We might pull multiple updates off the list at once if several updates
   // were scheduled before we had a chance to process them.  In some cases we
   // might also end up finding 0 updates to process if a previous
   // handlePendingUpdates() call processed multiple updates.
-  StateUpdateList updates;
   {
     folly::SpinLockGuard guard(pendingUpdatesLock_);
     // When deciding how many elements to pull off the pendingUpdates_
@@ -758,24 +795,24 @@ void SwSwitch::handlePendingUpdates() {
       }
       ++iter;
     }
-    updates.splice(
-        updates.begin(), pendingUpdates_, pendingUpdates_.begin(), iter);
+    updates->splice(
+        updates->begin(), pendingUpdates_, pendingUpdates_.begin(), iter);
   }
 
   // handlePendingUpdates() is invoked once for each update, but a previous
   // call might have already processed everything.  If we don't have anything
   // to do just return early.
-  if (updates.empty()) {
-    return;
+  if (updates->empty()) {
+    return false;
   }
 
   // Non coalescing updates should be applied individually
-  bool isNonCoalescing = updates.begin()->isNonCoalescing();
+  bool isNonCoalescing = updates->begin()->isNonCoalescing();
   if (isNonCoalescing) {
-    CHECK_EQ(updates.size(), 1)
+    CHECK_EQ(updates->size(), 1)
         << " Non coalescing updates should be applied individually";
   }
-  if (updates.begin()->hwFailureProtected()) {
+  if (updates->begin()->hwFailureProtected()) {
     CHECK(isNonCoalescing)
         << " Hw Failure protected updates should be non coalescing";
   }
@@ -783,13 +820,16 @@ void SwSwitch::handlePendingUpdates() {
   // This function should never be called with valid updates while we are
   // not initialized yet
   DCHECK(isInitialized());
+  return true;
+}
 
-  // Call all of the update functions to prepare the new SwitchState
-  auto oldAppliedState = getState();
-  // We start with the old state, and apply state updates one at a time.
-  auto newDesiredState = oldAppliedState;
-  auto iter = updates.begin();
-  while (iter != updates.end()) {
+std::shared_ptr<SwitchState> SwSwitch::prepareUpdates(
+    StateUpdateList* updates,
+    const std::shared_ptr<SwitchState>& startState) {
+  // We start with the given state, and apply state updates one at a time.
+  auto newDesiredState = startState;
+  auto iter = updates->begin();
+  while (iter != updates->end()) {
     StateUpdate* update = &(*iter);
     ++iter;
 
@@ -816,62 +856,161 @@ void SwSwitch::handlePendingUpdates() {
       newDesiredState = intermediateState;
     }
   }
+  return newDesiredState;
+}
+
+void SwSwitch::applyPendingUpdates(StateUpdateList* updates) {
+  // Call all of the update functions to prepare the new SwitchState
+  auto oldAppliedState = getState();
+  auto newDesiredState = prepareUpdates(updates, oldAppliedState);
   // Start newAppliedState as equal to newDesiredState unless
   // we learn otherwise
   auto newAppliedState = newDesiredState;
   // Now apply the update and notify subscribers
   if (newDesiredState != oldAppliedState) {
-    auto isTransaction = updates.begin()->hwFailureProtected() &&
+    auto isTransaction = updates->begin()->hwFailureProtected() &&
         getHw()->transactionsSupported();
     // There was some change during these state updates
     newAppliedState =
         applyUpdate(oldAppliedState, newDesiredState, isTransaction);
-    if (newDesiredState != newAppliedState) {
-      if (updates.size() == 1 && updates.begin()->hwFailureProtected()) {
-        fb303::fbData->incrementCounter(kHwUpdateFailures);
-        unique_ptr<StateUpdate> update(&updates.front());
-        try {
-          throw FbossHwUpdateError(
-              newDesiredState,
-              newAppliedState,
-              "Update : ",
-              update->getName(),
-              " application to HW failed");
-
-        } catch (const std::exception& ex) {
-          update->onError(ex);
-        }
-        return;
-      } else if (!isExiting()) {
-        XLOG(FATAL)
-            << " Failed to apply update to HW and the update is not marked for "
-               "HW failure protection";
-      } else {
-        // We failed to non protected updates since SwSwitch started its
-        // exit sequence alongside these updates being scheduled. So ideally
-        // we should signal a error to these updates. However since these are
-        // non protected updates, if we signal error, these updates will FATAL.
-        // TODO: Modify such updates to handle errors due to SwSwitch exit
-        // overlap.
+  }
+  signalUpdates(updates, newDesiredState, newAppliedState);
+}
+
+void SwSwitch::signalUpdates(
+    StateUpdateList* updates,
+    const std::shared_ptr<SwitchState>& newDesiredState,
+    const std::shared_ptr<SwitchState>& newAppliedState) {
+  if (newDesiredState != newAppliedState) {
+    if (updates->size() == 1 && updates->begin()->hwFailureProtected()) {
+      fb303::fbData->incrementCounter(kHwUpdateFailures);
+      unique_ptr<StateUpdate> update(&updates->front());
+      try {
+        throw FbossHwUpdateError(
+            newDesiredState,
+            newAppliedState,
+            "Update : ",
+            update->getName(),
+            " application to HW failed");
+
+      } catch (const std::exception& ex) {
+        update->onError(ex);
       }
+      return;
+    } else if (!isExiting()) {
+      XLOG(FATAL)
+          << " Failed to apply update to HW and the update is not marked for "
+             "HW failure protection";
+    } else {
+      // We failed to non protected updates since SwSwitch started its
+      // exit sequence alongside these updates being scheduled. So ideally
+      // we should signal a error to these updates. However since these are
+      // non protected updates, if we signal error, these updates will FATAL.
+      // TODO: Modify such updates to handle errors due to SwSwitch exit
+      // overlap.
     }
   }
 
   // Notify all of the updates of success and delete them.
-  while (!updates.empty()) {
-    unique_ptr<StateUpdate> update(&updates.front());
-    updates.pop_front();
+  while (!updates->empty()) {
+    unique_ptr<StateUpdate> update(&updates->front());
+    updates->pop_front();
     update->onSuccess();
   }
 }
 
+void SwSwitch::handlePendingUpdatesPipelined() {
+  // Retire the batch the HwSwitch finished programming, if any
+  if (inFlightUpdates_ && inFlightUpdates_->appliedState.isReady()) {
+    retireInFlightUpdates();
+  }
+
+  StateUpdateList updates;
+  if (takePendingUpdates(&updates)) {
+    if (updates.begin()->isNonCoalescing()) {
+      // Non coalescing updates, which include all HW failure protected ones,
+      // are prepared from the state actually applied to HW, and nothing is
+      // prepared on top of them until HW has accepted or rejected them.
+      drainUpdatePipeline();
+      applyPendingUpdates(&updates);
+      return;
+    }
+    // Prepare these updates on top of the ones HW has yet to program
+    if (!stagedUpdates_) {
+      stagedUpdates_ = std::make_unique<UpdateBatch>();
+      stagedUpdates_->desiredState = inFlightUpdates_
+          ? inFlightUpdates_->desiredState
+          : getState();
+    }
+    stagedUpdates_->desiredState =
+        prepareUpdates(&updates, stagedUpdates_->desiredState);
+    stagedUpdates_->updates.splice(stagedUpdates_->updates.end(), updates);
+  }
+
+  if (stagedUpdates_ && !inFlightUpdates_) {
+    programStagedUpdates();
+  }
+}
+
+void SwSwitch::programStagedUpdates() {
+  DCHECK(!inFlightUpdates_);
+  auto batch = std::move(stagedUpdates_);
+  // Program the delta from what HW actually applied. If the previous batch
+  // was not fully applied, this also retries whatever was left out of it.
+  batch->oldState = getState();
+  if (batch->desiredState == batch->oldState) {
+    signalUpdates(&batch->updates, batch->desiredState, batch->oldState);
+    return;
+  }
+  batch->start = std::chrono::steady_clock::now();
+  folly::Promise<std::shared_ptr<SwitchState>> applied;
+  batch->appliedState = applied.getSemiFuture();
+  hwUpdateEventBase_.runInEventBaseThread(
+      [this,
+       oldState = batch->oldState,
+       newState = batch->desiredState,
+       applied = std::move(applied)]() mutable {
+        applied.setValue(
+            isExiting() ? oldState
+                        : programHwUpdate(oldState, newState, false));
+        // Wake the update thread up to retire this batch, the value must
+        // be set by then.
+        updateEventBase_.runInEventBaseThread(handlePendingUpdatesHelper, this);
+      });
+  inFlightUpdates_ = std::move(batch);
+}
+
+void SwSwitch::retireInFlightUpdates() {
+  auto batch = std::move(inFlightUpdates_);
+  auto newAppliedState = std::move(batch->appliedState).get();
+  publishAppliedState(batch->oldState, newAppliedState, batch->start);
+  signalUpdates(&batch->updates, batch->desiredState, newAppliedState);
+}
+
+void SwSwitch::drainUpdatePipeline() {
+  if (inFlightUpdates_) {
+    inFlightUpdates_->appliedState.wait();
+    retireInFlightUpdates();
+  }
+  if (stagedUpdates_) {
+    auto batch = std::move(stagedUpdates_);
+    auto oldAppliedState = getState();
+    auto newAppliedState = batch->desiredState;
+    if (newAppliedState != oldAppliedState) {
+      newAppliedState =
+          applyUpdate(oldAppliedState, batch->desiredState, false);
+    }
+    signalUpdates(&batch->updates, batch->desiredState, newAppliedState);
+  }
+}
+
 void SwSwitch::setStateInternal(std::shared_ptr<SwitchState> newAppliedState) {
-  // This is one of the only two places that should ever directly access
-  // stateDontUseDirectly_.  (getState() being the other one.)
+  // This is one of the only places that should ever directly access
+  // stateDontUseDirectly_.  (getAppliedState() and readState() being the
+  // other ones.)
   CHECK(bool(newAppliedState));
   CHECK(newAppliedState->isPublished());
-  folly::SpinLockGuard guard(stateLock_);
-  appliedStateDontUseDirectly_.swap(newAppliedState);
+  appliedStateDontUseDirectly_.store(std::move(newAppliedState));
 }
 
 std::shared_ptr<SwitchState> SwSwitch::applyUpdate(
@@ -882,11 +1021,6 @@ std::shared_ptr<SwitchState> SwSwitch::applyUpdate(
   DCHECK_EQ(oldState, getAppliedState());
 
   auto start = std::chrono::steady_clock::now();
-  XLOG(INFO) << "Updating state: old_gen=" << oldState->getGeneration()
-             << " new_gen=" << newState->getGeneration();
-  DCHECK_GT(newState->getGeneration(), oldState->getGeneration());
-
-  StateDelta delta(oldState, newState);
 
   // If we are already exiting, abort the update
   if (isExiting()) {
@@ -894,12 +1028,26 @@ std::shared_ptr<SwitchState> SwSwitch::applyUpdate(
     return oldState;
   }
 
-  std::shared_ptr<SwitchState> newAppliedState;
+  auto newAppliedState = programHwUpdate(oldState, newState, isTransaction);
+  publishAppliedState(oldState, newAppliedState, start);
+  return newAppliedState;
+}
+
+std::shared_ptr<SwitchState> SwSwitch::programHwUpdate(
+    const shared_ptr<SwitchState>& oldState,
+    const shared_ptr<SwitchState>& newState,
+    bool isTransaction) {
+  XLOG(INFO) << "Updating state: old_gen=" << oldState->getGeneration()
+             << " new_gen=" << newState->getGeneration();
+  DCHECK_GT(newState->getGeneration(), oldState->getGeneration());
 
+  StateDelta delta(oldState, newState);
+
+  std::shared_ptr<SwitchState> newAppliedState;
   // Inform the HwSwitch of the change.
   //
   // Note that at this point we have already updated the state pointer and
-  // released stateLock_, so the new state is already published and visible to
+  // published it, so the new state is already published and visible to
   // other threads.  This does mean that there is a window where the new state
   // is visible but the hardware is not using the new configuration yet.
   //
@@ -924,17 +1072,25 @@ std::shared_ptr<SwitchState> SwSwitch::applyUpdate(
                 << folly::exceptionStr(ex);
   }
 
+  return newAppliedState;
+}
+
+void SwSwitch::publishAppliedState(
+    const shared_ptr<SwitchState>& oldState,
+    const shared_ptr<SwitchState>& newAppliedState,
+    std::chrono::steady_clock::time_point start) {
   setStateInternal(newAppliedState);
 
   // Notifies all observers of the current state update.
-  notifyStateObservers(StateDelta(oldState, newAppliedState));
+  if (!isExiting()) {
+    notifyStateObservers(StateDelta(oldState, newAppliedState));
+  }
 
   auto end = std::chrono::steady_clock::now();
   auto duration =
       std::chrono::duration_cast<std::chrono::microseconds>(end - start);
   stats()->stateUpdate(duration);
   XLOG(DBG0) << "Update state took " << duration.count() << "us";
-  return newAppliedState;
 }
 
 void SwSwitch::dumpBadStateUpdate(
@@ -962,11 +1118,11 @@ PortStats* SwSwitch::portStats(PortID portID) {
   if (portStats) {
     return portStats;
   }
-  auto portIf = getState()->getPorts()->getPortIf(portID);
+  auto state = readState();
+  auto portIf = state->getPorts()->getPortIf(portID);
   if (portIf) {
     // get portName from current state
-    return stats()->createPortStats(
-        portID, getState()->getPort(portID)->getName());
+    return stats()->createPortStats(portID, portIf->getName());
   } else {
     // only for port0 case
     XLOG(DBG0) << "Port node doesn't exist, use default name=port" << portID;
@@ -980,16 +1136,16 @@ PortStats* SwSwitch::portStats(const RxPacket* pkt) {
 
 map<int32_t, PortStatus> SwSwitch::getPortStatus() {
   map<int32_t, PortStatus> statusMap;
-  std::shared_ptr<PortMap> portMap = getState()->getPorts();
-  for (const auto& p : *portMap) {
+  auto state = readState();
+  for (const auto& p : *state->getPorts()) {
     statusMap[p->getID()] = fillInPortStatus(*p, this);
   }
   return statusMap;
 }
 
 PortStatus SwSwitch::getPortStatus(PortID portID) {
-  std::shared_ptr<Port> port = getState()->getPort(portID);
-  return fillInPortStatus(*port, this);
+  auto state = readState();
+  return fillInPortStatus(*state->getPort(portID), this);
 }
 
 SwitchStats* SwSwitch::createSwitchStats() {
@@ -999,8 +1155,7 @@ SwitchStats* SwSwitch::createSwitchStats() {
 }
 
 void SwSwitch::setPortStatusCounter(PortID port, bool up) {
-  auto state = getState();
-  if (!state) {
+  if (!readState()) {
     // Make sure the state actually exists, this could be an issue if
     // called during initialization
     return;
@@ -1011,6 +1166,18 @@ void SwSwitch::setPortStatusCounter(PortID port, bool up) {
 void SwSwitch::packetReceived(std::unique_ptr<RxPacket> pkt) noexcept {
   PortID port = pkt->getSrcPort();
   try {
+    if (rxPacketDispatcher_) {
+      if (!isFullyInitialized()) {
+        XLOG(DBG3)
+            << "Dropping received packets received on UNINITIALIZED switch";
+        return;
+      }
+      portStats(port)->trappedPkt();
+      if (!rxPacketDispatcher_->enqueue(std::move(pkt))) {
+        portStats(port)->pktDropped();
+      }
+      return;
+    }
     handlePacket(std::move(pkt));
   } catch (const std::exception& ex) {
     portStats(port)->pktError();
@@ -1033,9 +1200,12 @@ void SwSwitch::handlePacket(std::unique_ptr<RxPacket> pkt) {
     XLOG(DBG3) << "Dropping received packets received on UNINITIALIZED switch";
     return;
   }
-  PortID port = pkt->getSrcPort();
-  portStats(port)->trappedPkt();
+  portStats(pkt->getSrcPort())->trappedPkt();
+  processPacket(std::move(pkt));
+}
 
+void SwSwitch::processPacket(std::unique_ptr<RxPacket> pkt) {
+  PortID port = pkt->getSrcPort();
   pcapMgr_->packetReceived(pkt.get());
 
   // The minimum required frame length for ethernet is 64 bytes.
@@ -1165,6 +1335,10 @@ void SwSwitch::startThreads() {
   neighborCacheThread_.reset(new std::thread([=] {
     this->threadLoop("fbossNeighborCacheThread", &neighborCacheEventBase_);
   }));
+  if (FLAGS_pipelined_state_updates) {
+    hwUpdateThread_.reset(new std::thread(
+        [=] { this->threadLoop("fbossHwUpdateThread", &hwUpdateEventBase_); }));
+  }
 }
 
 void SwSwitch::stopThreads() {
@@ -1216,6 +1390,14 @@ void SwSwitch::stopThreads() {
   if (neighborCacheThread_) {
     neighborCacheThread_->join();
   }
+  // The update thread is the only one handing work to the HW update thread,
+  // so stop it only once the update thread is gone. Anything it already
+  // scheduled still runs first, which completes the batch in flight.
+  if (hwUpdateThread_) {
+    hwUpdateEventBase_.runInEventBaseThread(
+        [this] { hwUpdateEventBase_.terminateLoopSoon(); });
+    hwUpdateThread_->join();
+  }
   // Drain any pending updates by calling handlePendingUpdates. Since
   // we already set state to EXITING, handlePendingUpdates will simply
   // signal the updates and not apply them to HW.
@@ -1280,8 +1462,7 @@ void SwSwitch::sendPacketOutOfPortAsync(
     std::unique_ptr<TxPacket> pkt,
     PortID portID,
     std::optional<uint8_t> queue) noexcept {
-  auto state = getState();
-  if (!state->getPorts()->getPortIf(portID)) {
+  if (!readState()->getPorts()->getPortIf(portID)) {
     XLOG(ERR) << "SendPacketOutOfPortAsync: dropping packet to unexpected port "
               << portID;
     stats()->pktDropped();
@@ -1314,7 +1495,8 @@ void SwSwitch::sendPacketOutOfPortAsync(
     std::unique_ptr<TxPacket> pkt,
     AggregatePortID aggPortID,
     std::optional<uint8_t> queue) noexcept {
-  auto aggPort = getState()->getAggregatePorts()->getAggregatePortIf(aggPortID);
+  auto aggPort =
+      readState()->getAggregatePorts()->getAggregatePortIf(aggPortID);
   if (!aggPort) {
     XLOG(ERR) << "failed to send packet out aggregate port " << aggPortID
               << ": no aggregate port corresponding to identifier";
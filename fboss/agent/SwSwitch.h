@@ -10,6 +10,7 @@
 #pragma once
 
 #include "fboss/agent/HwSwitch.h"
+#include "fboss/agent/StateObserverNotifier.h"
 #include "fboss/agent/ThreadHeartbeat.h"
 #include "fboss/agent/Utils.h"
 #include "fboss/agent/gen-cpp2/switch_config_types.h"
@@ -17,20 +18,26 @@
 #include "fboss/agent/rib/RoutingInformationBase.h"
 #include "fboss/agent/state/StateUpdate.h"
 #include "fboss/agent/types.h"
+#include "fboss/lib/RcuSharedPtr.h"
 
 #include <folly/IntrusiveList.h>
 #include <folly/Range.h>
 #include <folly/SpinLock.h>
 #include <folly/ThreadLocal.h>
+#include <folly/futures/Future.h>
 #include <folly/io/async/EventBase.h>
+#include <gflags/gflags.h>
 #include <optional>
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <type_traits>
 
+DECLARE_bool(pipelined_state_updates);
+
 namespace facebook::fboss {
 
 class ArpHandler;
@@ -45,10 +52,13 @@ class PortDescriptor;
 class PortStats;
 class PortUpdateHandler;
 class RxPacket;
+class RxPacketDispatcher;
 class SwitchState;
 class SwitchStats;
 class StateDelta;
+class NeighborTimerWheel;
 class NeighborUpdater;
+class RouteChangePublisher;
 class RouteUpdateLogger;
 class StateObserver;
 class TunManager;
@@ -195,6 +205,22 @@ class SwSwitch : public HwSwitch::Callback {
   std::shared_ptr<SwitchState> getState() const {
     return getAppliedState();
   }
+
+  using StateReadGuard = RcuSharedPtr<SwitchState>::ReadGuard;
+
+  /*
+   * Get read access to the current (applied) switch state for the lifetime
+   * of the returned guard.
+   *
+   * Unlike getState(), this does not touch the reference count of the state,
+   * which all the threads reading it would otherwise contend on. Use it in hot
+   * paths such as packet handling and stats collection. The guard must not be
+   * held across blocking calls, and callers which need to keep the state
+   * around should use getState() instead.
+   */
+  StateReadGuard readState() const {
+    return appliedStateDontUseDirectly_.read();
+  }
   /**
    * Schedule an update to the switch state.
    *
@@ -288,10 +314,15 @@ class SwSwitch : public HwSwitch::Callback {
    * all state updates that occur and all classes that care about state updates
    * should register using this api.
    *
-   * The only required method for observers is stateUpdated and observers can
-   * count on this always being called from the update thread.
+   * The only required method for observers is stateUpdated. With the default
+   * options it is always called from the update thread; see
+   * StateObserverOptions for observers that can be notified in parallel with
+   * others or asynchronously.
    */
-  void registerStateObserver(StateObserver* observer, const std::string name);
+  void registerStateObserver(
+      StateObserver* observer,
+      const std::string name,
+      const StateObserverOptions& options = StateObserverOptions());
   void unregisterStateObserver(StateObserver* observer);
 
   /*
@@ -417,6 +448,14 @@ class SwSwitch : public HwSwitch::Callback {
     return &neighborCacheEventBase_;
   }
 
+  /*
+   * Get the timer wheel aging Arp/Ndp cache entries, which runs on the
+   * neighbor cache EventBase
+   */
+  NeighborTimerWheel* getNeighborTimerWheel() {
+    return neighborTimerWheel_.get();
+  }
+
   /**
    * Do the packet received callback, and throw exception if there is an error
    * in the handling of packet.
@@ -568,6 +607,13 @@ class SwSwitch : public HwSwitch::Callback {
     return routeUpdateLogger_.get();
   }
 
+  /*
+   * Get the RouteChangePublisher object
+   */
+  RouteChangePublisher* getRouteChangePublisher() {
+    return routeChangePublisher_.get();
+  }
+
   LinkAggregationManager* getLagManager() {
     return lagManager_.get();
   }
@@ -680,13 +726,27 @@ class SwSwitch : public HwSwitch::Callback {
    * to h/w
    */
   std::shared_ptr<SwitchState> getAppliedState() const {
-    folly::SpinLockGuard guard(stateLock_);
-    return appliedStateDontUseDirectly_;
+    return appliedStateDontUseDirectly_.load();
   }
 
   typedef folly::IntrusiveList<StateUpdate, &StateUpdate::listHook_>
       StateUpdateList;
 
+  /*
+   * A batch of coalescing updates on its way to HW, see
+   * handlePendingUpdatesPipelined().
+   */
+  struct UpdateBatch {
+    StateUpdateList updates;
+    // The applied state the batch is programmed on top of
+    std::shared_ptr<SwitchState> oldState;
+    std::shared_ptr<SwitchState> desiredState;
+    // Set by the HW update thread once it is done programming the batch
+    folly::SemiFuture<std::shared_ptr<SwitchState>> appliedState =
+        folly::SemiFuture<std::shared_ptr<SwitchState>>::makeEmpty();
+    std::chrono::steady_clock::time_point start;
+  };
+
   // Forbidden copy constructor and assignment operator
   SwSwitch(SwSwitch const&) = delete;
   SwSwitch& operator=(SwSwitch const&) = delete;
@@ -705,13 +765,52 @@ class SwSwitch : public HwSwitch::Callback {
   void setSwitchRunState(SwitchRunState desiredState);
   SwitchStats* createSwitchStats();
   void handlePacket(std::unique_ptr<RxPacket> pkt);
+  void processPacket(std::unique_ptr<RxPacket> pkt);
 
   static void handlePendingUpdatesHelper(SwSwitch* sw);
   void handlePendingUpdates();
+  /*
+   * Move the next batch of updates off pendingUpdates_, returns false if
+   * there was none.
+   */
+  bool takePendingUpdates(StateUpdateList* updates);
+  /*
+   * Run the update functions on top of startState and return the resulting
+   * desired state. Updates that throw are signalled and dropped from the list.
+   */
+  std::shared_ptr<SwitchState> prepareUpdates(
+      StateUpdateList* updates,
+      const std::shared_ptr<SwitchState>& startState);
+  void applyPendingUpdates(StateUpdateList* updates);
+  void signalUpdates(
+      StateUpdateList* updates,
+      const std::shared_ptr<SwitchState>& newDesiredState,
+      const std::shared_ptr<SwitchState>& newAppliedState);
+  /*
+   * With --pipelined_state_updates, the update thread prepares the next
+   * batch of coalescing updates on top of the desired state of the batch the
+   * HW update thread is programming. The staged batch is programmed as the
+   * delta from whatever HW ended up applying, so a partially applied batch
+   * never leaves the ones after it computed against a state HW does not have.
+   * Non coalescing updates drain the pipeline and are applied synchronously,
+   * so HW failure protected updates keep their rollback semantics.
+   */
+  void handlePendingUpdatesPipelined();
+  void programStagedUpdates();
+  void retireInFlightUpdates();
+  void drainUpdatePipeline();
   std::shared_ptr<SwitchState> applyUpdate(
       const std::shared_ptr<SwitchState>& oldState,
       const std::shared_ptr<SwitchState>& newState,
       bool isTransaction);
+  std::shared_ptr<SwitchState> programHwUpdate(
+      const std::shared_ptr<SwitchState>& oldState,
+      const std::shared_ptr<SwitchState>& newState,
+      bool isTransaction);
+  void publishAppliedState(
+      const std::shared_ptr<SwitchState>& oldState,
+      const std::shared_ptr<SwitchState>& newAppliedState,
+      std::chrono::steady_clock::time_point start);
 
   void startThreads();
   void stopThreads();
@@ -723,7 +822,10 @@ class SwSwitch : public HwSwitch::Callback {
    * called from the update thread, if the update thread is running.
    */
   bool stateObserverRegistered(StateObserver* observer);
-  void addStateObserver(StateObserver* observer, const std::string& name);
+  void addStateObserver(
+      StateObserver* observer,
+      const std::string& name,
+      const StateObserverOptions& options);
   void removeStateObserver(StateObserver* observer);
 
   /*
@@ -771,23 +873,29 @@ class SwSwitch : public HwSwitch::Callback {
   folly::SpinLock pendingUpdatesLock_;
   StateUpdateList pendingUpdates_;
 
+  /*
+   * Update batches prepared but not programmed yet, and being programmed by
+   * the HW update thread. Only accessed from the update thread.
+   */
+  std::unique_ptr<UpdateBatch> stagedUpdates_;
+  std::unique_ptr<UpdateBatch> inFlightUpdates_;
+
   /*
    * The current switch state represented as :  appliedState,
    * as in  what is actually applied in the hardware.
    *
    *
    * BEWARE: You generally shouldn't access these states directly, even
-   * internally within SwSwitch private methods.  These should only be accessed
-   * while holding stateLock_.
+   * internally within SwSwitch private methods.  The state is published with
+   * RCU, so that readers never block or contend with each other.
    *
-   * You almost certainly should call getAppliedState() setStateInternal()
-   * instead of directly accessing appliedState
+   * You almost certainly should call getAppliedState(), readState() or
+   * setStateInternal() instead of directly accessing appliedState
    *
    * This intentionally has an awkward name so people won't forget and try to
    * directly access this pointer.
    */
-  std::shared_ptr<SwitchState> appliedStateDontUseDirectly_;
-  mutable folly::SpinLock stateLock_;
+  RcuSharedPtr<SwitchState> appliedStateDontUseDirectly_;
 
   /*
    * A thread for performing various background tasks.
@@ -818,6 +926,13 @@ class SwSwitch : public HwSwitch::Callback {
   folly::EventBase updateEventBase_;
   std::unique_ptr<ThreadHeartbeat> updThreadHeartbeat_;
 
+  /*
+   * A thread programming SwitchState updates to HW, only started with
+   * --pipelined_state_updates.
+   */
+  std::unique_ptr<std::thread> hwUpdateThread_;
+  folly::EventBase hwUpdateEventBase_;
+
   /*
    * A thread dedicated to LACP processing.
    */
@@ -831,6 +946,7 @@ class SwSwitch : public HwSwitch::Callback {
   std::unique_ptr<std::thread> neighborCacheThread_;
   folly::EventBase neighborCacheEventBase_;
   std::unique_ptr<ThreadHeartbeat> neighborCacheThreadHeartbeat_;
+  std::unique_ptr<NeighborTimerWheel> neighborTimerWheel_;
 
   /*
    * A callback for listening to neighbors coming and going.
@@ -842,19 +958,22 @@ class SwSwitch : public HwSwitch::Callback {
       neighborListener_{nullptr};
 
   /*
-   * The list of classes to notify on a state update. This container should only
-   * be accessed/modified from the update thread. This removes the need for
-   * locking when we access the container during a state update.
+   * The classes to notify on a state update. This should only be
+   * accessed/modified from the update thread. This removes the need for
+   * locking when we access the observers during a state update.
    */
-  std::map<StateObserver*, std::string> stateObservers_;
+  std::unique_ptr<StateObserverNotifier> stateObserverNotifier_;
 
   std::unique_ptr<ArpHandler> arp_;
   std::unique_ptr<IPv4Handler> ipv4_;
   std::unique_ptr<IPv6Handler> ipv6_;
   std::unique_ptr<NeighborUpdater> nUpdater_;
   std::unique_ptr<PktCaptureManager> pcapMgr_;
+  // Only set when --rx_pipeline is enabled
+  std::unique_ptr<RxPacketDispatcher> rxPacketDispatcher_;
   std::unique_ptr<MirrorManager> mirrorManager_;
   std::unique_ptr<RouteUpdateLogger> routeUpdateLogger_;
+  std::unique_ptr<RouteChangePublisher> routeChangePublisher_;
   std::unique_ptr<LinkAggregationManager> lagManager_;
   std::unique_ptr<ResolvedNexthopMonitor> resolvedNexthopMonitor_;
   std::unique_ptr<ResolvedNexthopProbeScheduler> resolvedNexthopProbeScheduler_;
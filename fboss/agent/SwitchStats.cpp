@@ -216,6 +216,18 @@ SwitchStats::SwitchStats(ThreadLocalStatsMap* map)
           map,
           kCounterPrefix + "mka_service.recvd",
           SUM,
+          RATE),
+      l2LearnEvents_(map, kCounterPrefix + "l2_learning.learn", SUM, RATE),
+      l2AgeEvents_(map, kCounterPrefix + "l2_learning.age", SUM, RATE),
+      l2LearningUpdatesCoalesced_(
+          map,
+          kCounterPrefix + "l2_learning.coalesced",
+          SUM,
+          RATE),
+      l2LearningBatches_(
+          map,
+          kCounterPrefix + "l2_learning.batches",
+          SUM,
           RATE) {}
 
 PortStats* FOLLY_NULLABLE SwitchStats::port(PortID portID) {
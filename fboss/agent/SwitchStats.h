@@ -331,6 +331,19 @@ class SwitchStats : public boost::noncopyable {
     MKAServiceRecvSuccess_.addValue(1);
   }
 
+  void l2LearnEvent() {
+    l2LearnEvents_.addValue(1);
+  }
+  void l2AgeEvent() {
+    l2AgeEvents_.addValue(1);
+  }
+  void l2LearningUpdateCoalesced() {
+    l2LearningUpdatesCoalesced_.addValue(1);
+  }
+  void l2LearningBatch() {
+    l2LearningBatches_.addValue(1);
+  }
+
  private:
   // Forbidden copy constructor and assignment operator
   SwitchStats(SwitchStats const&) = delete;
@@ -535,6 +548,15 @@ class SwitchStats : public boost::noncopyable {
   TLTimeseries MKAServiceSendSuccess_;
   // Number of pkts recvd from MkaService.
   TLTimeseries MKAServiceRecvSuccess_;
+
+  // Number of MAC learn events from the HwSwitch
+  TLTimeseries l2LearnEvents_;
+  // Number of MAC aging events from the HwSwitch
+  TLTimeseries l2AgeEvents_;
+  // Number of MAC learn and aging events coalesced with pending ones
+  TLTimeseries l2LearningUpdatesCoalesced_;
+  // Number of state updates applying MAC learn and aging events
+  TLTimeseries l2LearningBatches_;
 };
 
 } // namespace facebook::fboss
@@ -18,6 +18,8 @@
 #include "fboss/agent/LinkAggregationManager.h"
 #include "fboss/agent/LldpManager.h"
 #include "fboss/agent/NeighborUpdater.h"
+#include "fboss/agent/RouteChangePublisher.h"
+#include "fboss/agent/RouteTableChunker.h"
 #include "fboss/agent/RouteUpdateLogger.h"
 #include "fboss/agent/SwSwitch.h"
 #include "fboss/agent/SwitchStats.h"
@@ -66,6 +68,10 @@
 #include <folly/logging/xlog.h>
 #include <thrift/lib/cpp/util/EnumUtils.h>
 #include <thrift/lib/cpp2/async/DuplexChannel.h>
+#if FOLLY_HAS_COROUTINES
+#include <folly/experimental/coro/AsyncGenerator.h>
+#include <folly/experimental/coro/Invoke.h>
+#endif
 
 #include <limits>
 
@@ -101,28 +107,24 @@ DEFINE_bool(
     false,
     "Allow external mutations of running config");
 
-namespace facebook::fboss {
-
-namespace util {
+DEFINE_int32(
+    route_table_stream_chunk_size,
+    1000,
+    "Number of routes per chunk when streaming the route table");
 
-/**
- * Utility function to convert `Nexthops` (resolved ones) to list<BinaryAddress>
- */
-std::vector<network::thrift::BinaryAddress> fromFwdNextHops(
-    RouteNextHopSet const& nexthops) {
-  std::vector<network::thrift::BinaryAddress> nhs;
-  nhs.reserve(nexthops.size());
-  for (auto const& nexthop : nexthops) {
-    auto addr = network::toBinaryAddress(nexthop.addr());
-    addr.ifName_ref() = util::createTunIntfName(nexthop.intf());
-    nhs.emplace_back(std::move(addr));
+namespace {
+// The chunk size is converted to a size_t, so reject values that would wrap
+bool validateRouteTableStreamChunkSize(const char* flagName, int32_t value) {
+  if (value <= 0) {
+    XLOG(ERR) << "--" << flagName << " must be positive, got " << value;
+    return false;
   }
-  return nhs;
+  return true;
 }
-
-} // namespace util
-
-} // namespace facebook::fboss
+} // namespace
+DEFINE_validator(
+    route_table_stream_chunk_size,
+    &validateRouteTableStreamChunkSize);
 
 namespace {
 
@@ -517,6 +519,42 @@ void translateToFibError(const FbossHwUpdateError& updError) {
       });
   throw fibError;
 }
+
+/*
+ * Stream the chunks returned by nextChunk() until it returns an empty one.
+ * With coroutines, chunks are only built as the client consumes them, so at
+ * most a few chunks are in memory at once.
+ */
+template <typename NextChunkFn>
+auto streamRouteChunks(
+    std::unique_ptr<facebook::fboss::RouteTableChunker> chunker,
+    NextChunkFn nextChunk) {
+  using Chunk = decltype(nextChunk(chunker.get()));
+#if FOLLY_HAS_COROUTINES
+  return apache::thrift::ServerStream<Chunk>(folly::coro::co_invoke(
+      [chunker = std::move(chunker),
+       nextChunk]() mutable -> folly::coro::AsyncGenerator<Chunk&&> {
+        while (true) {
+          auto chunk = nextChunk(chunker.get());
+          if (chunk.empty()) {
+            co_return;
+          }
+          co_yield std::move(chunk);
+        }
+      }));
+#else
+  // Without coroutines the stream has no flow control: publish all the chunks
+  // up front.
+  auto streamAndPublisher =
+      apache::thrift::ServerStream<Chunk>::createPublisher();
+  for (auto chunk = nextChunk(chunker.get()); !chunk.empty();
+       chunk = nextChunk(chunker.get())) {
+    streamAndPublisher.second.next(std::move(chunk));
+  }
+  std::move(streamAndPublisher.second).complete();
+  return std::move(streamAndPublisher.first);
+#endif
+}
 } // namespace
 
 namespace facebook::fboss {
@@ -1292,39 +1330,11 @@ void ThriftHandler::setPortState(int32_t portNum, bool enable) {
 void ThriftHandler::getRouteTable(std::vector<UnicastRoute>& routes) {
   auto log = LOG_THRIFT_CALL(DBG1);
   ensureConfigured(__func__);
-  auto appliedState = sw_->getState();
-  for (const auto& routeTable : (*appliedState->getRouteTables())) {
-    for (const auto& ipv4 : *(routeTable->getRibV4()->routes())) {
-      UnicastRoute tempRoute;
-      if (!ipv4->isResolved()) {
-        XLOG(INFO) << "Skipping unresolved route: " << ipv4->toFollyDynamic();
-        continue;
-      }
-      auto fwdInfo = ipv4->getForwardInfo();
-      tempRoute.dest.ip = toBinaryAddress(ipv4->prefix().network);
-      tempRoute.dest.prefixLength = ipv4->prefix().mask;
-      *tempRoute.nextHopAddrs_ref() =
-          util::fromFwdNextHops(fwdInfo.getNextHopSet());
-      *tempRoute.nextHops_ref() =
-          util::fromRouteNextHopSet(fwdInfo.getNextHopSet());
-      routes.emplace_back(std::move(tempRoute));
-    }
-    for (const auto& ipv6 : *(routeTable->getRibV6()->routes())) {
-      UnicastRoute tempRoute;
-      if (!ipv6->isResolved()) {
-        XLOG(INFO) << "Skipping unresolved route: " << ipv6->toFollyDynamic();
-        continue;
-      }
-      auto fwdInfo = ipv6->getForwardInfo();
-      tempRoute.dest.ip = toBinaryAddress(ipv6->prefix().network);
-      tempRoute.dest.prefixLength = ipv6->prefix().mask;
-      *tempRoute.nextHopAddrs_ref() =
-          util::fromFwdNextHops(fwdInfo.getNextHopSet());
-      *tempRoute.nextHops_ref() =
-          util::fromRouteNextHopSet(fwdInfo.getNextHopSet());
-      routes.emplace_back(std::move(tempRoute));
-    }
-  }
+  RouteTableChunker chunker(
+      sw_->getState(),
+      RouteTableFilter(),
+      std::numeric_limits<size_t>::max());
+  routes = chunker.nextUnicastRoutes();
 }
 
 void ThriftHandler::getRouteTableByClient(
@@ -1332,58 +1342,57 @@ void ThriftHandler::getRouteTableByClient(
     int16_t client) {
   auto log = LOG_THRIFT_CALL(DBG1);
   ensureConfigured(__func__);
-  auto state = sw_->getState();
-  for (const auto& routeTable : (*state->getRouteTables())) {
-    for (const auto& ipv4 : *(routeTable->getRibV4()->routes())) {
-      auto entry = ipv4->getEntryForClient(ClientID(client));
-      if (not entry) {
-        continue;
-      }
+  RouteTableFilter filter;
+  filter.clientId_ref() = client;
+  RouteTableChunker chunker(
+      sw_->getState(), filter, std::numeric_limits<size_t>::max());
+  routes = chunker.nextUnicastRoutes();
+}
 
-      UnicastRoute tempRoute;
-      tempRoute.dest.ip = toBinaryAddress(ipv4->prefix().network);
-      tempRoute.dest.prefixLength = ipv4->prefix().mask;
-      *tempRoute.nextHops_ref() =
-          util::fromRouteNextHopSet(entry->getNextHopSet());
-      for (const auto& nh : *tempRoute.nextHops_ref()) {
-        tempRoute.nextHopAddrs_ref()->emplace_back(*nh.address_ref());
-      }
-      routes.emplace_back(std::move(tempRoute));
-    }
+void ThriftHandler::getRouteTableDetails(std::vector<RouteDetails>& routes) {
+  auto log = LOG_THRIFT_CALL(DBG1);
+  ensureConfigured(__func__);
+  RouteTableChunker chunker(
+      sw_->getState(),
+      RouteTableFilter(),
+      std::numeric_limits<size_t>::max());
+  routes = chunker.nextRouteDetails();
+}
 
-    for (const auto& ipv6 : *(routeTable->getRibV6()->routes())) {
-      auto entry = ipv6->getEntryForClient(ClientID(client));
-      if (not entry) {
-        continue;
-      }
+apache::thrift::ServerStream<std::vector<UnicastRoute>>
+ThriftHandler::streamRouteTable(std::unique_ptr<RouteTableFilter> filter) {
+  auto log = LOG_THRIFT_CALL(DBG1);
+  ensureConfigured(__func__);
+  return streamRouteChunks(
+      std::make_unique<RouteTableChunker>(
+          sw_->getState(), *filter, FLAGS_route_table_stream_chunk_size),
+      [](RouteTableChunker* chunker) { return chunker->nextUnicastRoutes(); });
+}
 
-      UnicastRoute tempRoute;
-      tempRoute.dest.ip = toBinaryAddress(ipv6->prefix().network);
-      tempRoute.dest.prefixLength = ipv6->prefix().mask;
-      *tempRoute.nextHops_ref() =
-          util::fromRouteNextHopSet(entry->getNextHopSet());
-      for (const auto& nh : *tempRoute.nextHops_ref()) {
-        tempRoute.nextHopAddrs_ref()->emplace_back(*nh.address_ref());
-      }
-      routes.emplace_back(std::move(tempRoute));
-    }
-  }
+apache::thrift::ServerStream<std::vector<RouteDetails>>
+ThriftHandler::streamRouteTableDetails(
+    std::unique_ptr<RouteTableFilter> filter) {
+  auto log = LOG_THRIFT_CALL(DBG1);
+  ensureConfigured(__func__);
+  return streamRouteChunks(
+      std::make_unique<RouteTableChunker>(
+          sw_->getState(), *filter, FLAGS_route_table_stream_chunk_size),
+      [](RouteTableChunker* chunker) { return chunker->nextRouteDetails(); });
 }
 
-void ThriftHandler::getRouteTableDetails(std::vector<RouteDetails>& routes) {
+apache::thrift::ServerStream<RouteUpdateBatch>
+ThriftHandler::subscribeToRouteChanges(
+    std::unique_ptr<RouteTableFilter> filter) {
   auto log = LOG_THRIFT_CALL(DBG1);
   ensureConfigured(__func__);
-  auto state = sw_->getState();
-  for (const auto& routeTable : *(state->getRouteTables())) {
-    for (const auto& ipv4 : *(routeTable->getRibV4()->routes())) {
-      RouteDetails rd = ipv4->toRouteDetails();
-      routes.emplace_back(std::move(rd));
-    }
-    for (const auto& ipv6 : *(routeTable->getRibV6()->routes())) {
-      RouteDetails rd = ipv6->toRouteDetails();
-      routes.emplace_back(std::move(rd));
-    }
-  }
+#if FOLLY_HAS_COROUTINES
+  return sw_->getRouteChangePublisher()->subscribe(
+      *filter, FLAGS_route_table_stream_chunk_size);
+#else
+  // Without coroutines, the stream cannot tell how far behind the subscriber
+  // is, so the queued changes could grow without bounds.
+  throw FbossError("route change subscriptions are not supported");
+#endif
 }
 
 void ThriftHandler::getIpRoute(
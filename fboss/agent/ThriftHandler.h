@@ -165,6 +165,12 @@ class ThriftHandler : virtual public FbossCtrlSvIf,
       std::vector<UnicastRoute>& routeTable,
       int16_t clientId) override;
   void getRouteTableDetails(std::vector<RouteDetails>& routeTable) override;
+  apache::thrift::ServerStream<std::vector<UnicastRoute>> streamRouteTable(
+      std::unique_ptr<RouteTableFilter> filter) override;
+  apache::thrift::ServerStream<std::vector<RouteDetails>>
+  streamRouteTableDetails(std::unique_ptr<RouteTableFilter> filter) override;
+  apache::thrift::ServerStream<RouteUpdateBatch> subscribeToRouteChanges(
+      std::unique_ptr<RouteTableFilter> filter) override;
 
   void getPortStatus(
       std::map<int32_t, PortStatus>& status,
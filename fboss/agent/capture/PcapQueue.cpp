@@ -11,7 +11,8 @@
 
 #include "fboss/agent/RxPacket.h"
 #include "fboss/agent/TxPacket.h"
-#include "fboss/agent/capture/PcapPkt.h"
+
+#include <glog/logging.h>
 
 DEFINE_int32(
     fboss_pcap_queue_depth,
@@ -25,95 +26,121 @@ namespace facebook::fboss {
 PcapQueue::PcapQueue(uint32_t pktCapacity, uint64_t bytesCapacity)
     : pktCapacity_(
           pktCapacity == 0 ? FLAGS_fboss_pcap_queue_depth : pktCapacity),
-      bytesCapacity_(bytesCapacity) {
-  queue_.reserve(pktCapacity_);
+      bytesCapacity_(bytesCapacity),
+      slots_(new Slot[pktCapacity_]) {
+  for (uint32_t i = 0; i < pktCapacity_; ++i) {
+    slots_[i].seq.store(i, std::memory_order_relaxed);
+  }
 }
 
 PcapQueue::~PcapQueue() {}
 
 template <typename PktType>
 void PcapQueue::addPktInternal(const PktType* pkt) {
-  // Check to see if this would exceed the queue capacity.
-  if (queue_.size() >= pktCapacity_) {
-    pktsDropped_ += 1;
+  auto len = pkt->buf()->computeChainDataLength();
+  if (bytesCapacity_ > 0 &&
+      bytesInQueue_.fetch_add(len, std::memory_order_relaxed) + len >=
+          bytesCapacity_) {
+    bytesInQueue_.fetch_sub(len, std::memory_order_relaxed);
+    pktsDropped_.fetch_add(1, std::memory_order_relaxed);
     return;
   }
-  auto newBytes = bytesInQueue_ + pkt->buf()->computeChainDataLength();
-  if (bytesCapacity_ > 0 && newBytes >= bytesCapacity_) {
-    pktsDropped_ += 1;
-    return;
+
+  // Claim a slot. The reader frees a slot by bumping its sequence number by
+  // pktCapacity_, so a slot still holding the packet from the previous lap
+  // means the ring is full.
+  Slot* slot;
+  auto pos = tail_.load(std::memory_order_relaxed);
+  while (true) {
+    slot = &slots_[pos % pktCapacity_];
+    auto seq = slot->seq.load(std::memory_order_acquire);
+    auto diff = static_cast<int64_t>(seq - pos);
+    if (diff == 0) {
+      if (tail_.compare_exchange_weak(
+              pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      if (bytesCapacity_ > 0) {
+        bytesInQueue_.fetch_sub(len, std::memory_order_relaxed);
+      }
+      pktsDropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      pos = tail_.load(std::memory_order_relaxed);
+    }
   }
 
-  queue_.emplace_back(pkt);
+  slot->pkt = PcapPkt(pkt);
+  slot->seq.store(pos + 1, std::memory_order_release);
+  pktsReady_.post();
 }
 
 void PcapQueue::addPkt(const RxPacket* pkt) {
-  {
-    std::lock_guard<std::mutex> guard(mutex_);
-    addPktInternal(pkt);
-  }
-  cv_.notify_one();
-}
-
-void PcapQueue::addPktLocked(const RxPacket* pkt) {
   addPktInternal(pkt);
-  // It is preferred not to be holding the lock when we signal cv_,
-  // but it is okay to call it with the lock held anyway.  (Having the lock
-  // held will just prevent the reader thread from being able to acquire it
-  // immediately when the reader wakes.)
-  cv_.notify_one();
 }
 
 void PcapQueue::addPkt(const TxPacket* pkt) {
-  {
-    std::lock_guard<std::mutex> guard(mutex_);
-    addPktInternal(pkt);
-  }
-  cv_.notify_one();
-}
-
-void PcapQueue::addPktLocked(const TxPacket* pkt) {
   addPktInternal(pkt);
-  // It is preferred not to be holding the lock when we signal cv_,
-  // but it is okay to call it with the lock held anyway.  (Having the lock
-  // held will just prevent the reader thread from being able to acquire it
-  // immediately when the reader wakes.)
-  cv_.notify_one();
 }
 
 void PcapQueue::finish() {
-  std::lock_guard<std::mutex> guard(mutex_);
-  finished_ = true;
-  cv_.notify_all();
+  finished_.store(true, std::memory_order_release);
+  pktsReady_.post();
 }
 
 bool PcapQueue::isFinished() const {
-  std::lock_guard<std::mutex> guard(mutex_);
-  return finished_;
+  return finished_.load(std::memory_order_acquire);
 }
 
 uint64_t PcapQueue::numDropped() const {
-  std::lock_guard<std::mutex> guard(mutex_);
-  return pktsDropped_;
+  return pktsDropped_.load(std::memory_order_relaxed);
+}
+
+size_t PcapQueue::drain(std::vector<PcapPkt>* out) {
+  size_t count = 0;
+  uint64_t bytes = 0;
+  while (true) {
+    auto& slot = slots_[head_ % pktCapacity_];
+    if (slot.seq.load(std::memory_order_acquire) != head_ + 1) {
+      break;
+    }
+    bytes += slot.pkt.buf()->computeChainDataLength();
+    out->push_back(std::move(slot.pkt));
+    slot.seq.store(head_ + pktCapacity_, std::memory_order_release);
+    ++head_;
+    ++count;
+  }
+  if (bytesCapacity_ > 0 && bytes > 0) {
+    bytesInQueue_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+  return count;
 }
 
 bool PcapQueue::wait(std::vector<PcapPkt>* swapQueue) {
   swapQueue->clear();
   swapQueue->reserve(pktCapacity_);
 
-  std::unique_lock<std::mutex> guard(mutex_);
-  while (queue_.empty() && !finished_) {
-    cv_.wait(guard);
+  while (true) {
+    // Check finished_ before draining, so that packets added before finish()
+    // are always returned before we report that we are done.
+    bool finished = isFinished();
+    if (drain(swapQueue) > 0) {
+      return true;
+    }
+    if (finished) {
+      return false;
+    }
+    // Re-check after resetting, a producer may have published a packet
+    // between the drain above and the reset.
+    pktsReady_.reset();
+    if (drain(swapQueue) > 0) {
+      return true;
+    }
+    if (!isFinished()) {
+      pktsReady_.wait();
+    }
   }
-  if (queue_.empty()) {
-    DCHECK(finished_);
-    queue_.shrink_to_fit();
-    return false;
-  }
-
-  swapQueue->swap(queue_);
-  bytesInQueue_ = 0;
-  return true;
 }
 
 } // namespace facebook::fboss
@@ -9,21 +9,29 @@
  */
 #pragma once
 
-#include <condition_variable>
-#include <mutex>
+#include "fboss/agent/capture/PcapPkt.h"
+
+#include <folly/synchronization/SaturatingSemaphore.h>
+
+#include <atomic>
+#include <memory>
 #include <vector>
 
 namespace facebook::fboss {
 
 class RxPacket;
 class TxPacket;
-class PcapPkt;
 
 /*
  * PcapQueue stores a queue of PcapPkt objects, for transferring packets
  * from an asynchronous capture thread to a blocking thread that will process
  * the packets.  (For instance, writing them to disk using blocking I/O.)
  *
+ * The queue is a fixed size ring of pre-allocated slots. Any number of
+ * threads may call addPkt() concurrently without taking a lock; a packet
+ * that finds the ring (or the byte budget) full is dropped and counted.
+ * PcapPkt shares the packet's IOBuf rather than copying its contents.
+ *
  * There can only be a single reader.
  */
 class PcapQueue {
@@ -32,25 +40,11 @@ class PcapQueue {
   virtual ~PcapQueue();
 
   uint32_t getPktCapacity() const {
-    // pktCapacity_ is const, so no need for locking
     return pktCapacity_;
   }
 
-  /*
-   * Get the mutex protecting this PcapQueue.
-   *
-   * This is exposed to allow callers to also protect their own data
-   * with the same mutex if desired.  Callers should call addPktLocked()
-   * instead of addPkt() when they are already holding the PcapQueue mutex.
-   */
-  std::mutex& mutex() const {
-    return mutex_;
-  }
-
   void addPkt(const RxPacket* pkt);
-  void addPktLocked(const RxPacket* pkt);
   void addPkt(const TxPacket* pkt);
-  void addPktLocked(const TxPacket* pkt);
 
   /*
    * finish() signals that no more packets will be added to the queue.
@@ -71,31 +65,48 @@ class PcapQueue {
   uint64_t numDropped() const;
 
   /*
-   * Wait for new packets from the queue.
+   * Wait for new packets from the queue, and append all the packets
+   * currently queued to swapQueue.
    *
    * Note: for best performance, the writer should re-use the same vector
-   * for multiple wait() calls.  On subsequent calls the queue will already
+   * for multiple wait() calls.  On subsequent calls the vector will already
    * have the desired capacity, and will not need to reallocate memory.
    */
   bool wait(std::vector<PcapPkt>* swapQueue);
 
  private:
+  struct Slot {
+    // Equal to the ring position when the slot is free for the producer
+    // claiming that position, and to position + 1 once the packet stored
+    // in it is ready for the reader.
+    std::atomic<uint64_t> seq{0};
+    PcapPkt pkt;
+  };
+
   // Forbidden copy constructor and assignment operator
   PcapQueue(PcapQueue const&) = delete;
   PcapQueue& operator=(PcapQueue const&) = delete;
 
   template <typename PktType>
   void addPktInternal(const PktType* pkt);
+  // Move all ready packets to out. Only called by the reader.
+  size_t drain(std::vector<PcapPkt>* out);
 
-  mutable std::mutex mutex_;
-  std::condition_variable cv_;
-
-  bool finished_{false};
   const uint32_t pktCapacity_{0};
-  uint64_t bytesCapacity_{0};
-  uint64_t bytesInQueue_{0};
-  uint64_t pktsDropped_{0};
-  std::vector<PcapPkt> queue_;
+  const uint64_t bytesCapacity_{0};
+  std::unique_ptr<Slot[]> slots_;
+
+  // Next position to be claimed by a producer
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  // Next position to be read, only touched by the reader
+  alignas(64) uint64_t head_{0};
+  std::atomic<uint64_t> bytesInQueue_{0};
+  std::atomic<uint64_t> pktsDropped_{0};
+  std::atomic<bool> finished_{false};
+  // Posted by producers after publishing a packet. Posting an already posted
+  // semaphore is just an atomic load, so this costs nothing while the reader
+  // is busy writing.
+  folly::SaturatingSemaphore<true> pktsReady_;
 };
 
 } // namespace facebook::fboss
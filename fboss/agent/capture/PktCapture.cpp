@@ -44,22 +44,20 @@ void PktCapture::stop() {
 }
 
 bool PktCapture::packetReceived(const RxPacket* pkt) {
-  std::lock_guard<std::mutex> guard(writer_.mutex());
   if (direction_ != CaptureDirection::CAPTURE_ONLY_TX &&
       true == packetFilter_.passes(pkt)) {
-    ++numPacketsReceived_;
-    writer_.addPktLocked(pkt);
+    numPacketsReceived_.fetch_add(1, std::memory_order_relaxed);
+    writer_.addPkt(pkt);
   }
-  return (numPacketsSent_ + numPacketsReceived_) < maxPackets_;
+  return numPackets() < maxPackets_;
 }
 
 bool PktCapture::packetSent(const TxPacket* pkt) {
-  std::lock_guard<std::mutex> guard(writer_.mutex());
   if (direction_ != CaptureDirection::CAPTURE_ONLY_RX) {
-    ++numPacketsSent_;
-    writer_.addPktLocked(pkt);
+    numPacketsSent_.fetch_add(1, std::memory_order_relaxed);
+    writer_.addPkt(pkt);
   }
-  return (numPacketsSent_ + numPacketsReceived_) < maxPackets_;
+  return numPackets() < maxPackets_;
 }
 
 std::string PktCapture::toString(bool withStats) const {
@@ -70,8 +68,8 @@ std::string PktCapture::toString(bool withStats) const {
              : ((direction_ == CaptureDirection::CAPTURE_ONLY_RX) ? "RX only"
                                                                   : "TX only"));
   if (withStats) {
-    ss << ", Packet received:" << numPacketsReceived_
-       << ", Packet sent:" << numPacketsSent_;
+    ss << ", Packet received:" << numPacketsReceived_.load()
+       << ", Packet sent:" << numPacketsSent_.load();
   }
   return ss.str();
 }
@@ -14,6 +14,7 @@
 
 #include <boost/container/flat_set.hpp>
 #include <folly/Range.h>
+#include <atomic>
 #include <string>
 #include "fboss/agent/RxPacket.h"
 #include "fboss/agent/TxPacket.h"
@@ -82,14 +83,19 @@ class PktCapture {
   PktCapture(PktCapture const&) = delete;
   PktCapture& operator=(PktCapture const&) = delete;
 
+  uint64_t numPackets() const {
+    return numPacketsSent_.load(std::memory_order_relaxed) +
+        numPacketsReceived_.load(std::memory_order_relaxed);
+  }
+
   const std::string name_;
 
-  // Note: the rest of the state in this class is protcted by
-  // the PcapWriter's mutex.
+  // packetReceived() and packetSent() may be called concurrently from the
+  // RX and TX threads, without any lock held.
   PcapWriter writer_;
   uint64_t maxPackets_{0};
-  uint64_t numPacketsReceived_{0};
-  uint64_t numPacketsSent_{0};
+  std::atomic<uint64_t> numPacketsReceived_{0};
+  std::atomic<uint64_t> numPacketsSent_{0};
   CaptureDirection direction_{CaptureDirection::CAPTURE_TX_RX};
   PacketFilter packetFilter_;
 };
@@ -18,6 +18,9 @@
 #include <folly/String.h>
 #include <folly/logging/xlog.h>
 
+#include <shared_mutex>
+#include <vector>
+
 using folly::StringPiece;
 using std::string;
 using std::unique_ptr;
@@ -38,7 +41,7 @@ void PktCaptureManager::startCapture(unique_ptr<PktCapture> capture) {
   auto path =
       folly::to<std::string>(captureDir_, "/", capture->name(), ".pcap");
 
-  std::lock_guard<std::mutex> g(mutex_);
+  std::lock_guard<folly::SharedMutex> g(mutex_);
 
   const auto& name = capture->name();
   if (activeCaptures_.find(name) != activeCaptures_.end()) {
@@ -51,7 +54,7 @@ void PktCaptureManager::startCapture(unique_ptr<PktCapture> capture) {
 }
 
 void PktCaptureManager::stopCapture(StringPiece name) {
-  std::lock_guard<std::mutex> g(mutex_);
+  std::lock_guard<folly::SharedMutex> g(mutex_);
 
   auto nameStr = name.str();
   auto it = activeCaptures_.find(nameStr);
@@ -65,7 +68,7 @@ void PktCaptureManager::stopCapture(StringPiece name) {
 }
 
 unique_ptr<PktCapture> PktCaptureManager::forgetCapture(StringPiece name) {
-  std::lock_guard<std::mutex> g(mutex_);
+  std::lock_guard<folly::SharedMutex> g(mutex_);
   auto nameStr = name.str();
   auto activeIt = activeCaptures_.find(nameStr);
   if (activeIt != activeCaptures_.end()) {
@@ -87,50 +90,59 @@ unique_ptr<PktCapture> PktCaptureManager::forgetCapture(StringPiece name) {
 }
 
 void PktCaptureManager::stopAllCaptures() {
-  std::lock_guard<std::mutex> g(mutex_);
+  std::lock_guard<folly::SharedMutex> g(mutex_);
 
   // FIXME
 }
 
 void PktCaptureManager::forgetAllCaptures() {
-  std::lock_guard<std::mutex> g(mutex_);
+  std::lock_guard<folly::SharedMutex> g(mutex_);
 
   // FIXME
 }
 
 template <typename Fn>
 void PktCaptureManager::invokeCaptures(const Fn& fn) {
-  std::lock_guard<std::mutex> g(mutex_);
-
-  for (auto it = activeCaptures_.begin(); it != activeCaptures_.end();
-       /* increment in loop */) {
-    // Increment the iterator now, in case this capture deactivates itself and
-    // we need to remove it from the active captures.
-    auto thisIt = it;
-    ++it;
-    PktCapture* capture = thisIt->second.get();
-    bool stillActive = false;
-    try {
-      stillActive = fn(capture);
-    } catch (const std::exception& ex) {
-      XLOG(ERR) << "error when processing packet for capture "
-                << capture->name() << " : " << folly::exceptionStr(ex);
-      stillActive = false;
-    }
-
-    if (!stillActive) {
-      XLOG(INFO) << "auto-stopping packet capture \"" << capture->name()
-                 << "\"";
+  // Captures are only read on the packet path, so RX and TX threads can
+  // share the lock. Captures that hit their limit are deactivated under the
+  // exclusive lock afterwards.
+  std::vector<std::string> finished;
+  {
+    std::shared_lock<folly::SharedMutex> g(mutex_);
+    for (const auto& [name, capture] : activeCaptures_) {
+      bool stillActive = false;
       try {
-        inactiveCaptures_[capture->name()] = std::move(thisIt->second);
+        stillActive = fn(capture.get());
       } catch (const std::exception& ex) {
-        XLOG(ERR) << "error adding capture " << capture->name()
-                  << " to the inactive list";
-        // Can't do much else here.  Just continue and forget the capture.
+        XLOG(ERR) << "error when processing packet for capture " << name
+                  << " : " << folly::exceptionStr(ex);
+        stillActive = false;
+      }
+      if (!stillActive) {
+        finished.push_back(name);
       }
-      activeCaptures_.erase(thisIt);
     }
   }
+  if (finished.empty()) {
+    return;
+  }
+
+  std::lock_guard<folly::SharedMutex> g(mutex_);
+  for (const auto& name : finished) {
+    auto it = activeCaptures_.find(name);
+    if (it == activeCaptures_.end()) {
+      // Deactivated by another thread, or stopped explicitly, meanwhile
+      continue;
+    }
+    XLOG(INFO) << "auto-stopping packet capture \"" << name << "\"";
+    try {
+      inactiveCaptures_[name] = std::move(it->second);
+    } catch (const std::exception& ex) {
+      XLOG(ERR) << "error adding capture " << name << " to the inactive list";
+      // Can't do much else here.  Just continue and forget the capture.
+    }
+    activeCaptures_.erase(it);
+  }
 
   bool running = !activeCaptures_.empty();
   capturesRunning_.store(running, std::memory_order_release);
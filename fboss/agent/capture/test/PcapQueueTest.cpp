@@ -71,3 +71,84 @@ TEST(PcapQueueTest, SimpleAdd) {
   ByteRange waitedPktData = waitedPktBufClone->coalesce();
   EXPECT_EQ(expectedPktData, waitedPktData);
 }
+
+namespace {
+std::unique_ptr<MockRxPacket> makePkt(uint8_t id) {
+  auto pkt = MockRxPacket::fromHex(
+      // dst mac, src mac, ethertype
+      "02 00 01 00 00 01  02 00 02 01 02 03  08 00");
+  pkt->padToLength(68, id);
+  return pkt;
+}
+
+// The padding byte identifies the packet
+uint8_t pktId(const PcapPkt& pkt) {
+  auto buf = pkt.buf()->clone();
+  return buf->coalesce().back();
+}
+} // namespace
+
+TEST(PcapQueueTest, DropWhenFull) {
+  PcapQueue queue(4);
+  for (int i = 0; i < 10; ++i) {
+    queue.addPkt(makePkt(i).get());
+  }
+  EXPECT_EQ(6, queue.numDropped());
+
+  std::vector<PcapPkt> pkts;
+  ASSERT_TRUE(queue.wait(&pkts));
+  ASSERT_EQ(4, pkts.size());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(i, pktId(pkts[i]));
+  }
+
+  // The slots are reusable once read
+  queue.addPkt(makePkt(4).get());
+  queue.finish();
+  ASSERT_TRUE(queue.wait(&pkts));
+  ASSERT_EQ(1, pkts.size());
+  EXPECT_FALSE(queue.wait(&pkts));
+  EXPECT_EQ(6, queue.numDropped());
+}
+
+TEST(PcapQueueTest, DropOverByteCapacity) {
+  // Room for two 68 byte packets
+  PcapQueue queue(100, 200);
+  for (int i = 0; i < 5; ++i) {
+    queue.addPkt(makePkt(i).get());
+  }
+  EXPECT_EQ(3, queue.numDropped());
+}
+
+TEST(PcapQueueTest, ConcurrentWriters) {
+  constexpr int kNumThreads = 4;
+  constexpr int kPktsPerThread = 5000;
+  PcapQueue queue(kNumThreads * kPktsPerThread);
+  std::vector<PcapPkt> waitedPkts;
+  std::thread waiter([&]() { pktWaitThread(&queue, &waitedPkts); });
+
+  std::vector<std::thread> writers;
+  for (int t = 0; t < kNumThreads; ++t) {
+    writers.emplace_back([&queue, t]() {
+      auto pkt = makePkt(t);
+      for (int i = 0; i < kPktsPerThread; ++i) {
+        queue.addPkt(pkt.get());
+      }
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  queue.finish();
+  waiter.join();
+
+  EXPECT_EQ(0, queue.numDropped());
+  ASSERT_EQ(kNumThreads * kPktsPerThread, waitedPkts.size());
+  std::vector<int> perThread(kNumThreads, 0);
+  for (const auto& pkt : waitedPkts) {
+    ++perThread[pktId(pkt)];
+  }
+  for (int t = 0; t < kNumThreads; ++t) {
+    EXPECT_EQ(kPktsPerThread, perThread[t]);
+  }
+}
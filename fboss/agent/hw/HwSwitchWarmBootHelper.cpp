@@ -12,8 +12,10 @@
 
 #include "fboss/agent/SysError.h"
 #include "fboss/agent/Utils.h"
+#include "fboss/agent/hw/WarmBootStateFile.h"
 
 #include <folly/FileUtil.h>
+#include <folly/String.h>
 #include <folly/json.h>
 #include <folly/logging/xlog.h>
 
@@ -22,6 +24,17 @@ DEFINE_string(
     switch_state_file,
     "switch_state",
     "File for dumping switch state JSON in on exit");
+DEFINE_bool(
+    warm_boot_state_binary,
+    true,
+    "Store warm boot state in the binary snapshot format. Set to false "
+    "to store JSON, e.g. before downgrading to an agent which can only "
+    "read JSON");
+DEFINE_bool(
+    dump_warm_boot_state_json,
+    false,
+    "Additionally dump the warm boot state as JSON, for debugging, to "
+    "<switch_state_file>.json when storing it in binary format");
 
 namespace {
 constexpr auto wbFlagPrefix = "can_warm_boot_";
@@ -134,17 +147,99 @@ bool HwSwitchWarmBootHelper::checkAndClearWarmBootFlags() {
 
 bool HwSwitchWarmBootHelper::storeWarmBootState(
     const folly::dynamic& switchState) {
-  warmBootStateWritten_ =
-      dumpStateToFile(warmBootSwitchStateFile(), switchState);
+  // The file read at startup is about to be replaced
+  releaseWarmBootState();
+  if (!FLAGS_warm_boot_state_binary) {
+    warmBootStateWritten_ =
+        dumpStateToFile(warmBootSwitchStateFile(), switchState);
+    return warmBootStateWritten_;
+  }
+  try {
+    WarmBootStateFile::write(warmBootSwitchStateFile(), switchState);
+    warmBootStateWritten_ = true;
+  } catch (const std::exception& ex) {
+    XLOG(ERR) << "Unable to write warm boot state to "
+              << warmBootSwitchStateFile() << ": " << folly::exceptionStr(ex);
+    warmBootStateWritten_ = false;
+  }
+  if (FLAGS_dump_warm_boot_state_json) {
+    auto jsonFile = folly::to<std::string>(warmBootSwitchStateFile(), ".json");
+    if (!dumpStateToFile(jsonFile, switchState)) {
+      XLOG(ERR) << "Unable to dump warm boot state JSON to " << jsonFile;
+    }
+  }
   return warmBootStateWritten_;
 }
 
+bool HwSwitchWarmBootHelper::warmBootStateIsBinary() const {
+  if (warmBootStateReader_ || warmBootStateJson_) {
+    return warmBootStateReader_ != nullptr;
+  }
+  // State written by agents predating the binary format is JSON.
+  return WarmBootStateFile::isBinary(warmBootSwitchStateFile());
+}
+
+const WarmBootStateReader& HwSwitchWarmBootHelper::getWarmBootStateReader()
+    const {
+  if (!warmBootStateReader_) {
+    warmBootStateReader_ =
+        std::make_unique<WarmBootStateReader>(warmBootSwitchStateFile());
+  }
+  return *warmBootStateReader_;
+}
+
+const folly::dynamic& HwSwitchWarmBootHelper::getWarmBootStateJson() const {
+  if (!warmBootStateJson_) {
+    std::string warmBootJson;
+    auto ret =
+        folly::readFile(warmBootSwitchStateFile().c_str(), warmBootJson);
+    sysCheckError(
+        ret, "Unable to read switch state from : ", warmBootSwitchStateFile());
+    warmBootStateJson_ = folly::parseJson(warmBootJson);
+  }
+  return *warmBootStateJson_;
+}
+
 folly::dynamic HwSwitchWarmBootHelper::getWarmBootState() const {
-  std::string warmBootJson;
-  auto ret = folly::readFile(warmBootSwitchStateFile().c_str(), warmBootJson);
-  sysCheckError(
-      ret, "Unable to read switch state from : ", warmBootSwitchStateFile());
-  return folly::parseJson(warmBootJson);
+  if (warmBootStateIsBinary()) {
+    return getWarmBootStateReader().getAll();
+  }
+  return getWarmBootStateJson();
+}
+
+folly::dynamic HwSwitchWarmBootHelper::getWarmBootState(
+    folly::StringPiece top) const {
+  if (warmBootStateIsBinary()) {
+    return getWarmBootStateReader().getSubtree(top);
+  }
+  return getWarmBootStateJson()[top];
+}
+
+std::optional<folly::dynamic> HwSwitchWarmBootHelper::getWarmBootStateIf(
+    folly::StringPiece top,
+    folly::StringPiece child) const {
+  if (warmBootStateIsBinary()) {
+    const auto& reader = getWarmBootStateReader();
+    if (!reader.hasSubtree(top, child)) {
+      return std::nullopt;
+    }
+    return reader.getSubtree(top, child);
+  }
+  const auto& state = getWarmBootStateJson();
+  auto topIt = state.find(top);
+  if (topIt == state.items().end()) {
+    return std::nullopt;
+  }
+  auto childIt = topIt->second.find(child);
+  if (childIt == topIt->second.items().end()) {
+    return std::nullopt;
+  }
+  return childIt->second;
+}
+
+void HwSwitchWarmBootHelper::releaseWarmBootState() {
+  warmBootStateReader_.reset();
+  warmBootStateJson_.reset();
 }
 
 void HwSwitchWarmBootHelper::setupWarmBootFile() {
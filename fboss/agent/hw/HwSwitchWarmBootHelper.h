@@ -9,12 +9,17 @@
  */
 #pragma once
 
+#include <folly/Range.h>
 #include <folly/dynamic.h>
 
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace facebook::fboss {
 
+class WarmBootStateReader;
+
 /*
  * This class encapsulates much of the warm boot functionality for an individual
  * HwSwitch. It will store all the files necessary to perform warm boot on a
@@ -42,6 +47,20 @@ class HwSwitchWarmBootHelper {
 
   bool storeWarmBootState(const folly::dynamic& switchState);
   folly::dynamic getWarmBootState() const;
+  /*
+   * Load only part of the warm boot state, e.g. kSwSwitch, or
+   * (kHwSwitch, kAdapterKeys). With the binary state format only the
+   * requested subtrees are read and decoded.
+   */
+  folly::dynamic getWarmBootState(folly::StringPiece top) const;
+  std::optional<folly::dynamic> getWarmBootStateIf(
+      folly::StringPiece top,
+      folly::StringPiece child) const;
+  /*
+   * The warm boot state file is read once, and kept for the calls above
+   * until released, once warm boot no longer needs it.
+   */
+  void releaseWarmBootState();
 
   std::string startupSdkDumpFile() const;
   std::string shutdownSdkDumpFile() const;
@@ -67,6 +86,9 @@ class HwSwitchWarmBootHelper {
   std::string warmBootFlag() const;
   std::string forceColdBootOnceFlag() const;
   std::string warmBootSwitchStateFile() const;
+  bool warmBootStateIsBinary() const;
+  const WarmBootStateReader& getWarmBootStateReader() const;
+  const folly::dynamic& getWarmBootStateJson() const;
 
   void setupWarmBootFile();
   /*
@@ -88,5 +110,8 @@ class HwSwitchWarmBootHelper {
   int warmBootFd_{-1};
   bool canWarmBoot_{false};
   bool warmBootStateWritten_{false};
+  // Warm boot state read so far, in whichever format it was stored
+  mutable std::unique_ptr<WarmBootStateReader> warmBootStateReader_;
+  mutable std::optional<folly::dynamic> warmBootStateJson_;
 };
 } // namespace facebook::fboss
@@ -0,0 +1,260 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/hw/WarmBootStateFile.h"
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/SysError.h"
+
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <folly/experimental/bser/Bser.h>
+#include <folly/lang/Bits.h>
+
+#include <fcntl.h>
+#include <cstring>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace facebook::fboss {
+
+namespace {
+
+struct Header {
+  char magic[WarmBootStateFile::kMagic.size()];
+  uint32_t version;
+} __attribute__((packed));
+
+struct Footer {
+  uint64_t indexOffset;
+  uint64_t indexLength;
+  char magic[WarmBootStateFile::kMagic.size()];
+} __attribute__((packed));
+
+class ChunkWriter {
+ public:
+  explicit ChunkWriter(const std::string& path)
+      : path_(path), file_(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) {}
+
+  void writeHeader() {
+    Header hdr;
+    memcpy(hdr.magic, WarmBootStateFile::kMagic.data(), sizeof(hdr.magic));
+    hdr.version = folly::Endian::little(WarmBootStateFile::kVersion);
+    writeRaw(&hdr, sizeof(hdr));
+  }
+
+  void writeChunk(
+      folly::StringPiece top,
+      folly::StringPiece child,
+      const folly::dynamic& value) {
+    auto encoded = folly::bser::toBser(value, serializationOpts_);
+    index_.push_back(folly::dynamic::array(
+        top,
+        child,
+        static_cast<int64_t>(offset_),
+        static_cast<int64_t>(encoded.size())));
+    writeRaw(encoded.data(), encoded.size());
+  }
+
+  void writeIndexAndFooter() {
+    Footer footer;
+    footer.indexOffset = folly::Endian::little(offset_);
+    auto encoded = folly::bser::toBser(index_, serializationOpts_);
+    writeRaw(encoded.data(), encoded.size());
+    footer.indexLength = folly::Endian::little<uint64_t>(encoded.size());
+    memcpy(
+        footer.magic, WarmBootStateFile::kMagic.data(), sizeof(footer.magic));
+    writeRaw(&footer, sizeof(footer));
+    sysCheckError(fsync(file_.fd()), "Unable to sync ", path_);
+  }
+
+ private:
+  void writeRaw(const void* data, size_t len) {
+    sysCheckError(
+        folly::writeFull(file_.fd(), data, len), "Unable to write ", path_);
+    offset_ += len;
+  }
+
+  std::string path_;
+  folly::File file_;
+  uint64_t offset_{0};
+  folly::dynamic index_ = folly::dynamic::array;
+  folly::bser::serialization_opts serializationOpts_;
+};
+
+} // namespace
+
+bool WarmBootStateFile::isBinary(const std::string& path) {
+  folly::File file(path.c_str(), O_RDONLY);
+  char magic[kMagic.size()];
+  auto ret = folly::readFull(file.fd(), magic, sizeof(magic));
+  sysCheckError(ret, "Unable to read ", path);
+  return ret == sizeof(magic) && kMagic == folly::StringPiece(magic, ret);
+}
+
+void WarmBootStateFile::write(
+    const std::string& path,
+    const folly::dynamic& state) {
+  if (!state.isObject()) {
+    throw FbossError("warm boot state must be an object");
+  }
+  // Write to a temporary file and rename over path only once complete, so a
+  // failed write never leaves a truncated snapshot behind.
+  auto tmpPath = folly::to<std::string>(path, ".tmp");
+  {
+    ChunkWriter writer(tmpPath);
+    writer.writeHeader();
+    for (const auto& [top, value] : state.items()) {
+      auto topKey = top.asString();
+      if (!value.isObject() || value.empty()) {
+        writer.writeChunk(topKey, "", value);
+        continue;
+      }
+      for (const auto& [child, subtree] : value.items()) {
+        auto childKey = child.asString();
+        if (childKey.empty()) {
+          throw FbossError(
+              "empty key under ", topKey, " in warm boot state is reserved");
+        }
+        writer.writeChunk(topKey, childKey, subtree);
+      }
+    }
+    writer.writeIndexAndFooter();
+  }
+  sysCheckError(
+      rename(tmpPath.c_str(), path.c_str()),
+      "Unable to rename ",
+      tmpPath,
+      " to ",
+      path);
+}
+
+WarmBootStateReader::WarmBootStateReader(const std::string& path)
+    : path_(path), file_(path.c_str(), O_RDONLY) {
+  Header hdr;
+  auto ret = folly::preadFull(file_.fd(), &hdr, sizeof(hdr), 0);
+  sysCheckError(ret, "Unable to read ", path_);
+  if (ret != sizeof(hdr) ||
+      WarmBootStateFile::kMagic !=
+          folly::StringPiece(hdr.magic, sizeof(hdr.magic))) {
+    throw FbossError(path_, " is not a binary warm boot state file");
+  }
+  auto version = folly::Endian::little(hdr.version);
+  if (version > WarmBootStateFile::kVersion) {
+    throw FbossError(
+        path_,
+        " has warm boot state format version ",
+        version,
+        ", newer than supported version ",
+        WarmBootStateFile::kVersion);
+  }
+
+  struct stat st;
+  sysCheckError(fstat(file_.fd(), &st), "Unable to stat ", path_);
+  Footer footer;
+  if (st.st_size < static_cast<off_t>(sizeof(hdr) + sizeof(footer))) {
+    throw FbossError(path_, " is truncated");
+  }
+  ret = folly::preadFull(
+      file_.fd(), &footer, sizeof(footer), st.st_size - sizeof(footer));
+  sysCheckError(ret, "Unable to read ", path_);
+  if (ret != sizeof(footer) ||
+      WarmBootStateFile::kMagic !=
+          folly::StringPiece(footer.magic, sizeof(footer.magic))) {
+    throw FbossError(path_, " is truncated");
+  }
+
+  Chunk indexChunk{
+      folly::Endian::little(footer.indexOffset),
+      folly::Endian::little(footer.indexLength)};
+  if (indexChunk.offset + indexChunk.length + sizeof(footer) >
+      static_cast<uint64_t>(st.st_size)) {
+    throw FbossError(path_, " has a corrupt index");
+  }
+  for (const auto& entry : readChunk(indexChunk)) {
+    Chunk chunk{
+        static_cast<uint64_t>(entry[2].asInt()),
+        static_cast<uint64_t>(entry[3].asInt())};
+    if (chunk.offset + chunk.length > indexChunk.offset) {
+      throw FbossError(path_, " has a corrupt index");
+    }
+    index_[entry[0].asString()][entry[1].asString()] = chunk;
+  }
+}
+
+folly::dynamic WarmBootStateReader::readChunk(const Chunk& chunk) const {
+  std::string buf(chunk.length, '\0');
+  auto ret =
+      folly::preadFull(file_.fd(), buf.data(), chunk.length, chunk.offset);
+  sysCheckError(ret, "Unable to read ", path_);
+  if (static_cast<uint64_t>(ret) != chunk.length) {
+    throw FbossError(path_, " is truncated");
+  }
+  return folly::bser::parseBser(folly::ByteRange(folly::StringPiece(buf)));
+}
+
+std::vector<std::string> WarmBootStateReader::topLevelKeys() const {
+  std::vector<std::string> keys;
+  for (const auto& entry : index_) {
+    keys.push_back(entry.first);
+  }
+  return keys;
+}
+
+bool WarmBootStateReader::hasSubtree(folly::StringPiece top) const {
+  return index_.find(top.str()) != index_.end();
+}
+
+bool WarmBootStateReader::hasSubtree(
+    folly::StringPiece top,
+    folly::StringPiece child) const {
+  auto it = index_.find(top.str());
+  return it != index_.end() &&
+      it->second.find(child.str()) != it->second.end();
+}
+
+folly::dynamic WarmBootStateReader::getSubtree(
+    folly::StringPiece top,
+    folly::StringPiece child) const {
+  auto it = index_.find(top.str());
+  if (it != index_.end()) {
+    auto childIt = it->second.find(child.str());
+    if (childIt != it->second.end()) {
+      return readChunk(childIt->second);
+    }
+  }
+  throw FbossError("no ", top, "/", child, " in warm boot state ", path_);
+}
+
+folly::dynamic WarmBootStateReader::getSubtree(folly::StringPiece top) const {
+  auto it = index_.find(top.str());
+  if (it == index_.end()) {
+    throw FbossError("no ", top, " in warm boot state ", path_);
+  }
+  auto wholeIt = it->second.find("");
+  if (wholeIt != it->second.end()) {
+    return readChunk(wholeIt->second);
+  }
+  folly::dynamic value = folly::dynamic::object;
+  for (const auto& [child, chunk] : it->second) {
+    value[child] = readChunk(chunk);
+  }
+  return value;
+}
+
+folly::dynamic WarmBootStateReader::getAll() const {
+  folly::dynamic state = folly::dynamic::object;
+  for (const auto& entry : index_) {
+    state[entry.first] = getSubtree(entry.first);
+  }
+  return state;
+}
+
+} // namespace facebook::fboss
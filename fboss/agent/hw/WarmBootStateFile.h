@@ -0,0 +1,101 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/File.h>
+#include <folly/Range.h>
+#include <folly/dynamic.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Binary warm boot state snapshot.
+ *
+ * The switch state handed to HwSwitchWarmBootHelper is an object whose
+ * values (swSwitch, hwSwitch) are themselves objects with one entry per
+ * state table. Each of those second level subtrees is encoded separately
+ * as BSER (a binary encoding of folly::dynamic) and appended to the file
+ * as soon as it is encoded, so the serialized form of the whole state is
+ * never held in memory at once, and no JSON is printed or parsed.
+ *
+ * Layout:
+ *   header:  magic (8 bytes) | format version (uint32)
+ *   chunks:  BSER encoded subtrees, back to back
+ *   index:   BSER encoded array of [top key, child key, offset, length]
+ *   footer:  index offset (uint64) | index length (uint64) | magic
+ *
+ * An entry with an empty child key holds the whole top level value; this is
+ * used for values which are not objects or are empty objects.
+ *
+ * WarmBootStateReader only reads the footer and the index when opened;
+ * subtrees are read and decoded when asked for.
+ */
+class WarmBootStateFile {
+ public:
+  static constexpr folly::StringPiece kMagic{"FBOSSWB\n"};
+  static constexpr uint32_t kVersion = 1;
+
+  /*
+   * Returns true if the file at path starts with the binary snapshot magic.
+   * Older agents wrote the warm boot state as JSON.
+   */
+  static bool isBinary(const std::string& path);
+
+  /*
+   * Write state to path, truncating any existing file.
+   */
+  static void write(const std::string& path, const folly::dynamic& state);
+};
+
+class WarmBootStateReader {
+ public:
+  explicit WarmBootStateReader(const std::string& path);
+
+  std::vector<std::string> topLevelKeys() const;
+  bool hasSubtree(folly::StringPiece top) const;
+  bool hasSubtree(folly::StringPiece top, folly::StringPiece child) const;
+
+  /*
+   * Load a single second level subtree, e.g. ("hwSwitch", "adapterKeys").
+   */
+  folly::dynamic getSubtree(folly::StringPiece top, folly::StringPiece child)
+      const;
+  /*
+   * Load all of a top level value, e.g. "swSwitch".
+   */
+  folly::dynamic getSubtree(folly::StringPiece top) const;
+  /*
+   * Load the entire state.
+   */
+  folly::dynamic getAll() const;
+
+ private:
+  struct Chunk {
+    uint64_t offset{0};
+    uint64_t length{0};
+  };
+  // top level key -> (child key -> chunk). The empty child key maps to a
+  // chunk holding the whole top level value.
+  using Index = std::map<std::string, std::map<std::string, Chunk>>;
+
+  folly::dynamic readChunk(const Chunk& chunk) const;
+
+  std::string path_;
+  folly::File file_;
+  Index index_;
+};
+
+} // namespace facebook::fboss
@@ -27,6 +27,20 @@
 
 using namespace std;
 
+DEFINE_int32(
+    sflow_flush_interval_ms,
+    100,
+    "Longest time an sFlow sample is held back to be batched with others");
+DEFINE_int32(
+    sflow_counter_interval_s,
+    20,
+    "Interval at which sFlow interface counter samples are exported");
+DEFINE_bool(
+    sflow_thrift_export,
+    false,
+    "Export each sFlow sample as a thrift serialized SflowPacketInfo "
+    "instead of sFlow v5 datagrams");
+
 namespace {
 std::optional<folly::IPAddress> getLocalIPv6FromWhoAmI() {
   const std::string whoAmIFn = "/etc/fbwhoami";
@@ -189,25 +203,72 @@ ssize_t BcmSflowExporter::sendUDPDatagram(iovec* vec, const size_t iovec_len) {
   return ret;
 }
 
+size_t BcmSflowExporter::sendUDPDatagrams(
+    const std::vector<std::unique_ptr<folly::IOBuf>>& datagrams) {
+  sockaddr_storage addrStorage;
+  address_.getAddress(&addrStorage);
+
+  std::vector<iovec> vecs(datagrams.size());
+  std::vector<mmsghdr> msgs(datagrams.size());
+  for (size_t i = 0; i < datagrams.size(); ++i) {
+    DCHECK(!datagrams[i]->isChained());
+    vecs[i].iov_base = const_cast<uint8_t*>(datagrams[i]->data());
+    vecs[i].iov_len = datagrams[i]->length();
+    auto& msg = msgs[i].msg_hdr;
+    msg.msg_name = reinterpret_cast<void*>(&addrStorage);
+    msg.msg_namelen = address_.getActualSize();
+    msg.msg_iov = &vecs[i];
+    msg.msg_iovlen = 1;
+  }
+
+  size_t sent = 0;
+  while (sent < msgs.size()) {
+    auto ret = ::sendmmsg(socket_, msgs.data() + sent, msgs.size() - sent, 0);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      XLOG(DBG1) << "Failed sending " << msgs.size() - sent
+                 << " sFlow datagrams to " << address_.describe()
+                 << " reason: " << folly::errnoStr(errno);
+      break;
+    }
+    sent += ret;
+  }
+  XLOG(DBG4) << "Sent " << sent << " sFlow datagrams to "
+             << address_.describe();
+  return sent;
+}
+
 BcmSflowExporter::~BcmSflowExporter() {
   if (socket_ != -1) {
     close(socket_);
   }
 }
 
+BcmSflowExporterTable::BcmSflowExporterTable()
+    : builder_(folly::IPAddress("::")) {}
+
+BcmSflowExporterTable::~BcmSflowExporterTable() {
+  stopFlushTimer();
+}
+
 bool BcmSflowExporterTable::contains(
     const shared_ptr<SflowCollector>& c) const {
+  std::lock_guard<std::mutex> guard(lock_);
   auto iter = map_.find(c->getID());
   return iter != map_.end();
 }
 
 size_t BcmSflowExporterTable::size() const {
+  std::lock_guard<std::mutex> guard(lock_);
   return map_.size();
 }
 
 void BcmSflowExporterTable::addExporter(const shared_ptr<SflowCollector>& c) {
   try {
-    auto exporter = make_unique<BcmSflowExporter>(c->getAddress());
+    auto exporter = std::make_shared<BcmSflowExporter>(c->getAddress());
+    std::lock_guard<std::mutex> guard(lock_);
     map_.emplace(c->getID(), move(exporter));
   } catch (const fboss::thrift::FbossBaseError& ex) {
     XLOG(ERR) << "Could not add exporter: "
@@ -215,6 +276,8 @@ void BcmSflowExporterTable::addExporter(const shared_ptr<SflowCollector>& c) {
               << " reason: " << folly::exceptionStr(ex);
     return;
   }
+  // Collectors are only added and removed from the update thread
+  startFlushTimer();
 
   XLOG(INFO) << "Successfully added exporter for "
              << c->getAddress().getFullyQualified();
@@ -222,26 +285,180 @@ void BcmSflowExporterTable::addExporter(const shared_ptr<SflowCollector>& c) {
 
 void BcmSflowExporterTable::removeExporter(const std::string& id) {
   XLOG(INFO) << "Removed sFlow exporter " << id;
-  map_.erase(id);
+  bool empty;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    map_.erase(id);
+    empty = map_.empty();
+  }
+  if (empty) {
+    stopFlushTimer();
+  }
 }
 
 void BcmSflowExporterTable::updateSamplingRates(
     PortID id,
     int64_t inRate,
     int64_t outRate) {
-  std::pair<int64_t, int64_t> rates(inRate, outRate);
-  auto it = port2samplingRates_.find(id);
-  if (it != port2samplingRates_.end()) {
-    it->second = rates;
-  } else {
-    port2samplingRates_.insert(std::make_pair(id, rates));
-  }
-
   // We piggyback the update of local IPv6
-  localIP_ = getLocalIPv6();
+  auto localIP = getLocalIPv6();
+
+  PendingDatagrams pending;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::pair<int64_t, int64_t> rates(inRate, outRate);
+    auto it = port2samplingRates_.find(id);
+    if (it != port2samplingRates_.end()) {
+      it->second = rates;
+    } else {
+      port2samplingRates_.insert(std::make_pair(id, rates));
+    }
+
+    if (localIP != localIP_) {
+      // Datagrams carry the agent address in their header
+      pending = takePendingLocked();
+      localIP_ = localIP;
+      builder_.setAgentAddress(localIP_);
+    }
+  }
+  sendPending(pending);
 }
 
 void BcmSflowExporterTable::sendToAll(const SflowPacketInfo& info) {
+  if (FLAGS_sflow_thrift_export) {
+    sendThriftToAll(info);
+    return;
+  }
+  PendingDatagrams pending;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (map_.empty()) {
+      XLOG(DBG1)
+          << "zero sFlow collectors with sflow enabled, skipping sample export";
+      return;
+    }
+    addFlowSampleLocked(info);
+    if (builder_.numFullDatagrams() >= kMaxDatagramBatch) {
+      pending = takePendingLocked();
+    }
+  }
+  sendPending(pending);
+}
+
+void BcmSflowExporterTable::addFlowSampleLocked(const SflowPacketInfo& info) {
+  // Attribute the sample to the port whose sampling rate picked it
+  PortID sourcePort(
+      *info.ingressSampled_ref() ? *info.srcPort_ref() : *info.dstPort_ref());
+  uint32_t samplingRate = 0;
+  auto rates = port2samplingRates_.find(sourcePort);
+  if (rates != port2samplingRates_.end()) {
+    samplingRate = *info.ingressSampled_ref() ? rates->second.first
+                                              : rates->second.second;
+  }
+
+  sflow::PacketSample sample;
+  sample.sourceIfIndex = sourcePort;
+  sample.samplingRate = samplingRate;
+  sample.input = static_cast<uint16_t>(*info.srcPort_ref());
+  sample.output = static_cast<uint16_t>(*info.dstPort_ref());
+  sample.frameLength = *info.frameLength_ref();
+  sample.header = folly::ByteRange(folly::StringPiece(*info.packetData_ref()));
+  builder_.addFlowSample(sample);
+}
+
+bool BcmSflowExporterTable::counterSamplesDue() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return !map_.empty() &&
+      std::chrono::steady_clock::now() - lastCounterSamples_ >=
+      std::chrono::seconds(FLAGS_sflow_counter_interval_s);
+}
+
+void BcmSflowExporterTable::exportCounters(
+    const std::vector<std::pair<PortID, sflow::IfCounters>>& counters) {
+  if (FLAGS_sflow_thrift_export) {
+    return;
+  }
+  PendingDatagrams pending;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto now = std::chrono::steady_clock::now();
+    if (map_.empty() ||
+        now - lastCounterSamples_ <
+            std::chrono::seconds(FLAGS_sflow_counter_interval_s)) {
+      return;
+    }
+    lastCounterSamples_ = now;
+    for (const auto& portAndCounters : counters) {
+      // Only export counters for ports being sampled
+      if (port2samplingRates_.find(portAndCounters.first) ==
+          port2samplingRates_.end()) {
+        continue;
+      }
+      builder_.addCountersSample(portAndCounters.second);
+    }
+    pending = takePendingLocked();
+  }
+  sendPending(pending);
+}
+
+void BcmSflowExporterTable::flush() {
+  PendingDatagrams pending;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    pending = takePendingLocked();
+  }
+  sendPending(pending);
+}
+
+BcmSflowExporterTable::PendingDatagrams
+BcmSflowExporterTable::takePendingLocked() {
+  PendingDatagrams pending;
+  if (builder_.empty()) {
+    return pending;
+  }
+  pending.datagrams = builder_.takeDatagrams();
+  // Collectors removed meanwhile are kept alive until the datagrams are sent
+  pending.exporters.reserve(map_.size());
+  for (const auto& c : map_) {
+    pending.exporters.push_back(c.second);
+  }
+  return pending;
+}
+
+void BcmSflowExporterTable::sendPending(const PendingDatagrams& pending) {
+  for (const auto& exporter : pending.exporters) {
+    exporter->sendUDPDatagrams(pending.datagrams);
+  }
+}
+
+void BcmSflowExporterTable::startFlushTimer() {
+  if (flushTimer_) {
+    return;
+  }
+  flushTimer_ = std::make_unique<folly::FunctionScheduler>();
+  flushTimer_->setThreadName("SflowFlush");
+  flushTimer_->addFunction(
+      [this]() { flush(); },
+      std::chrono::milliseconds(FLAGS_sflow_flush_interval_ms),
+      "sflowFlush");
+  flushTimer_->start();
+}
+
+void BcmSflowExporterTable::stopFlushTimer() {
+  if (!flushTimer_) {
+    return;
+  }
+  flushTimer_->shutdown();
+  flushTimer_.reset();
+  // Samples left behind have no collector to go to anymore
+  std::lock_guard<std::mutex> guard(lock_);
+  if (map_.empty()) {
+    builder_.takeDatagrams();
+  }
+}
+
+void BcmSflowExporterTable::sendThriftToAll(const SflowPacketInfo& info) {
+  std::lock_guard<std::mutex> guard(lock_);
   if (map_.empty()) {
     XLOG(DBG1)
         << "zero sFlow collectors with sflow enabled, skipping sample export";
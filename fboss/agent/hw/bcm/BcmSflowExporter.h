@@ -9,15 +9,27 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <folly/IPAddress.h>
 #include <folly/SocketAddress.h>
+#include <folly/experimental/FunctionScheduler.h>
+#include <folly/io/IOBuf.h>
+#include <gflags/gflags.h>
 
+#include "fboss/agent/hw/gen-cpp2/hardware_stats_types.h"
 #include "fboss/agent/if/gen-cpp2/sflow_types.h"
+#include "fboss/agent/packet/SflowDatagramBuilder.h"
 #include "fboss/agent/state/SflowCollector.h"
 #include "fboss/agent/types.h"
 
+DECLARE_int32(sflow_flush_interval_ms);
+DECLARE_int32(sflow_counter_interval_s);
+DECLARE_bool(sflow_thrift_export);
+
 namespace facebook::fboss {
 
 class BcmSflowExporter {
@@ -35,6 +47,13 @@ class BcmSflowExporter {
    */
   ssize_t sendUDPDatagram(iovec* vec, const size_t iovec_len);
 
+  /*
+   * Send out each of the datagrams, which must be single buffers, in as few
+   * sendmmsg() calls as possible. Returns the number of datagrams sent.
+   */
+  size_t sendUDPDatagrams(
+      const std::vector<std::unique_ptr<folly::IOBuf>>& datagrams);
+
  private:
   // no copy or assignment
   BcmSflowExporter(BcmSflowExporter const&) = delete;
@@ -44,10 +63,25 @@ class BcmSflowExporter {
   int socket_{-1};
 };
 
+/*
+ * Exports sFlow v5 datagrams to every configured collector.
+ *
+ * Samples are encoded as they come in and packed into datagrams by an
+ * sflow::SflowDatagramBuilder. The datagrams are sent to each collector with
+ * sendmmsg() every --sflow_flush_interval_ms, or as soon as a batch worth of
+ * datagrams has been filled. Interface counter samples are exported from
+ * port stats every --sflow_counter_interval_s.
+ *
+ * Samples come in on the RX thread while collectors and sampling rates change
+ * on the update thread, so all methods are thread safe.
+ */
 class BcmSflowExporterTable {
  public:
-  BcmSflowExporterTable() = default;
-  ~BcmSflowExporterTable() = default;
+  // Datagrams handed to a single sendmmsg() call
+  static constexpr size_t kMaxDatagramBatch = 32;
+
+  BcmSflowExporterTable();
+  ~BcmSflowExporterTable();
 
   bool contains(const std::shared_ptr<SflowCollector>& collector) const;
   size_t size() const;
@@ -58,17 +92,52 @@ class BcmSflowExporterTable {
 
   void sendToAll(const SflowPacketInfo& info);
 
+  /*
+   * Add a counter sample for each port if --sflow_counter_interval_s went by
+   * since the last ones.
+   */
+  void exportCounters(
+      const std::vector<std::pair<PortID, sflow::IfCounters>>& counters);
+  bool counterSamplesDue() const;
+
+  /*
+   * Send every datagram built so far.
+   */
+  void flush();
+
  private:
   // no copy or assignment
   BcmSflowExporterTable(BcmSflowExporterTable const&) = delete;
   BcmSflowExporterTable& operator=(BcmSflowExporterTable const&) = delete;
 
-  std::unordered_map<std::string, std::unique_ptr<BcmSflowExporter>> map_;
+  // Datagrams built so far, and the collectors to send them to
+  struct PendingDatagrams {
+    std::vector<std::unique_ptr<folly::IOBuf>> datagrams;
+    std::vector<std::shared_ptr<BcmSflowExporter>> exporters;
+  };
+
+  void sendThriftToAll(const SflowPacketInfo& info);
+  // Must be called with lock_ held
+  void addFlowSampleLocked(const SflowPacketInfo& info);
+  // Must be called with lock_ held. The datagrams are sent with
+  // sendPending() once lock_ is released, so that the RX thread does not
+  // wait on socket IO.
+  PendingDatagrams takePendingLocked();
+  static void sendPending(const PendingDatagrams& pending);
+  void startFlushTimer();
+  void stopFlushTimer();
+
+  mutable std::mutex lock_;
+  std::unordered_map<std::string, std::shared_ptr<BcmSflowExporter>> map_;
   std::unordered_map<
       PortID,
       std::pair<int64_t /* ingress rate */, int64_t /* egress rate */>>
       port2samplingRates_;
   folly::IPAddress localIP_;
+  sflow::SflowDatagramBuilder builder_;
+  std::chrono::steady_clock::time_point lastCounterSamples_;
+  // Only running while there are collectors to flush to
+  std::unique_ptr<folly::FunctionScheduler> flushTimer_;
 };
 
 } // namespace facebook::fboss
@@ -12,6 +12,7 @@
 #include <boost/cast.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <fstream>
+#include <limits>
 #include <map>
 #include <optional>
 #include <utility>
@@ -338,6 +339,39 @@ bool isValidLabeledNextHopSet(
   return true;
 }
 
+/*
+ * sFlow generic interface counters of an ethernet port. Counters which are
+ * not collected are left at all ones, as the sFlow spec asks.
+ */
+facebook::fboss::sflow::IfCounters toSflowIfCounters(
+    facebook::fboss::PortID port,
+    uint64_t speedMbps,
+    bool up,
+    const facebook::fboss::HwPortStats& stats) {
+  facebook::fboss::sflow::IfCounters counters;
+  counters.ifIndex = port;
+  counters.ifType = 6; // ethernetCsmacd
+  counters.ifSpeed = speedMbps * 1000000;
+  counters.ifDirection = 1; // full-duplex
+  // bit 0 is admin status, bit 1 is oper status
+  counters.ifStatus = up ? 3 : 1;
+  counters.ifInOctets = *stats.inBytes__ref();
+  counters.ifInUcastPkts = *stats.inUnicastPkts__ref();
+  counters.ifInMulticastPkts = *stats.inMulticastPkts__ref();
+  counters.ifInBroadcastPkts = *stats.inBroadcastPkts__ref();
+  counters.ifInDiscards = *stats.inDiscards__ref();
+  counters.ifInErrors = *stats.inErrors__ref();
+  counters.ifInUnknownProtos = std::numeric_limits<uint32_t>::max();
+  counters.ifOutOctets = *stats.outBytes__ref();
+  counters.ifOutUcastPkts = *stats.outUnicastPkts__ref();
+  counters.ifOutMulticastPkts = *stats.outMulticastPkts__ref();
+  counters.ifOutBroadcastPkts = *stats.outBroadcastPkts__ref();
+  counters.ifOutDiscards = *stats.outDiscards__ref();
+  counters.ifOutErrors = *stats.outErrors__ref();
+  counters.ifPromiscuousMode = 0;
+  return counters;
+}
+
 } // namespace
 
 namespace facebook::fboss {
@@ -2595,6 +2629,9 @@ void BcmSwitch::unregisterSwitchEventCallback(bcm_switch_event_t eventID) {
 
 void BcmSwitch::updateGlobalStats() {
   portTable_->updatePortStats();
+  if (sFlowExporterTable_->counterSamplesDue()) {
+    exportSflowCounters();
+  }
   trunkTable_->updateStats();
   bcmStatUpdater_->updateStats();
 
@@ -2607,6 +2644,28 @@ void BcmSwitch::updateGlobalStats() {
   }
 }
 
+void BcmSwitch::exportSflowCounters() {
+  std::vector<std::pair<PortID, sflow::IfCounters>> counters;
+  for (auto& bcmPortEntry : *portTable_) {
+    auto bcmPort = bcmPortEntry.second;
+    if (!bcmPort->isEnabled()) {
+      continue;
+    }
+    auto stats = bcmPort->getPortStats();
+    if (!stats) {
+      continue;
+    }
+    counters.emplace_back(
+        bcmPort->getPortID(),
+        toSflowIfCounters(
+            bcmPort->getPortID(),
+            static_cast<uint64_t>(bcmPort->getSpeed()),
+            bcmPort->isUp(),
+            *stats));
+  }
+  sFlowExporterTable_->exportCounters(counters);
+}
+
 uint64_t BcmSwitch::getDeviceWatermarkBytes() const {
   return bstStatsMgr_->getDeviceWatermarkBytes();
 }
@@ -3116,6 +3175,7 @@ bool BcmSwitch::handleSflowPacket(BcmPacketT& bcmPacket) noexcept {
   info.srcPort_ref() = src_port;
   info.dstPort_ref() = dest_port;
   info.vlan_ref() = vlan;
+  info.frameLength_ref() = pkt_len;
 
   auto snapLen = std::min(kMaxSflowSnapLen, (unsigned int)(pkt_len));
 
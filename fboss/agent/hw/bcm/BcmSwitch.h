@@ -767,6 +767,11 @@ class BcmSwitch : public BcmSwitchIf {
    */
   void updateGlobalStats();
 
+  /*
+   * Hand port counters to the sFlow exporters.
+   */
+  void exportSflowCounters();
+
   /*
    * Drop IPv6 Router Advertisements.
    */
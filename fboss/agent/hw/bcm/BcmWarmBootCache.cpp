@@ -206,7 +206,11 @@ folly::dynamic BcmWarmBootCache::toFollyDynamic() const {
 }
 
 folly::dynamic BcmWarmBootCache::getWarmBootState() const {
-  return hw_->getPlatform()->getWarmBootHelper()->getWarmBootState();
+  auto wbHelper = hw_->getPlatform()->getWarmBootHelper();
+  auto warmBootState = wbHelper->getWarmBootState();
+  // The state is only read once, to populate the cache
+  wbHelper->releaseWarmBootState();
+  return warmBootState;
 }
 
 void BcmWarmBootCache::populateFromWarmBootState(
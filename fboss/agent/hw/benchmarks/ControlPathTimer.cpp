@@ -0,0 +1,145 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/benchmarks/ControlPathTimer.h"
+
+#include "fboss/agent/state/DeltaFunctions.h"
+#include "fboss/agent/state/StateDelta.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/lib/FunctionCallTimeReporter.h"
+
+#include <folly/json.h>
+#include <folly/logging/xlog.h>
+
+#include <iostream>
+
+namespace facebook::fboss::utility {
+
+namespace {
+
+template <typename MapDelta>
+size_t walkNodeMapDelta(const MapDelta& delta) {
+  using NodePtr = std::shared_ptr<typename MapDelta::Node>;
+  size_t changed = 0;
+  DeltaFunctions::forEachChanged(
+      delta,
+      [&](const NodePtr& /*oldNode*/, const NodePtr& /*newNode*/) {
+        ++changed;
+      },
+      [&](const NodePtr& /*newNode*/) { ++changed; },
+      [&](const NodePtr& /*oldNode*/) { ++changed; });
+  return changed;
+}
+
+} // namespace
+
+size_t walkStateDelta(const StateDelta& delta) {
+  size_t changed = 0;
+  changed += walkNodeMapDelta(delta.getPortsDelta());
+  changed += walkNodeMapDelta(delta.getVlansDelta());
+  for (const auto& vlanDelta : delta.getVlansDelta()) {
+    changed += walkNodeMapDelta(vlanDelta.getArpDelta());
+    changed += walkNodeMapDelta(vlanDelta.getNdpDelta());
+    changed += walkNodeMapDelta(vlanDelta.getMacDelta());
+  }
+  changed += walkNodeMapDelta(delta.getIntfsDelta());
+  for (const auto& routeTableDelta : delta.getRouteTablesDelta()) {
+    changed += walkNodeMapDelta(routeTableDelta.getRoutesV4Delta());
+    changed += walkNodeMapDelta(routeTableDelta.getRoutesV6Delta());
+  }
+  for (const auto& fibDelta : delta.getFibsDelta()) {
+    changed += walkNodeMapDelta(fibDelta.getV4FibDelta());
+    changed += walkNodeMapDelta(fibDelta.getV6FibDelta());
+  }
+  changed += walkNodeMapDelta(delta.getLabelForwardingInformationBaseDelta());
+  changed += walkNodeMapDelta(delta.getAggregatePortsDelta());
+  changed += walkNodeMapDelta(delta.getLoadBalancersDelta());
+  changed += walkNodeMapDelta(delta.getAclsDelta());
+  changed += walkNodeMapDelta(delta.getMirrorsDelta());
+  changed += walkNodeMapDelta(delta.getQosPoliciesDelta());
+  changed += walkNodeMapDelta(delta.getSflowCollectorsDelta());
+  return changed;
+}
+
+ControlPathTimer::~ControlPathTimer() {
+  auto timings = toDynamic();
+  if (FLAGS_json) {
+    std::cout << folly::toJson(timings) << std::endl;
+  } else {
+    XLOG(INFO) << " control path msecs: " << folly::toJson(timings);
+  }
+}
+
+void ControlPathTimer::timeStateDeltas(
+    std::shared_ptr<SwitchState> oldState,
+    const SwitchStates& newStates) {
+  auto start = std::chrono::steady_clock::now();
+  size_t changed = 0;
+  for (const auto& newState : newStates) {
+    changed += walkStateDelta(StateDelta(oldState, newState));
+    oldState = newState;
+  }
+  stateDelta_ = stateDelta_.value_or(Duration(0)) +
+      (std::chrono::steady_clock::now() - start);
+  XLOG(DBG2) << name_ << ": " << changed << " nodes changed over "
+             << newStates.size() << " state deltas";
+}
+
+void ControlPathTimer::timeSwSwitch(const std::function<void()>& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  swSwitch_ = swSwitch_.value_or(Duration(0)) +
+      (std::chrono::steady_clock::now() - start);
+}
+
+void ControlPathTimer::timeHwSwitch(const std::function<void()>& fn) {
+  auto reporter = FunctionCallTimeReporter::getInstance();
+  // Turn on the timing of SDK calls, unless already on with
+  // --enable_call_timing
+  bool startReporter = !reporter->isOn();
+  if (startReporter) {
+    reporter->start();
+  }
+  auto sdkCallsStart = reporter->getCallTime();
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  hwSwitch_ = hwSwitch_.value_or(Duration(0)) +
+      (std::chrono::steady_clock::now() - start);
+  sdkCalls_ = sdkCalls_.value_or(Duration(0)) +
+      (reporter->getCallTime() - sdkCallsStart);
+  if (startReporter) {
+    reporter->end();
+  }
+}
+
+folly::dynamic ControlPathTimer::toDynamic() const {
+  auto msecs = [](Duration duration) { return duration.count() / 1000.0; };
+  folly::dynamic timings = folly::dynamic::object;
+  timings["name"] = name_;
+  if (swSwitch_) {
+    timings["sw_switch_msecs"] = msecs(*swSwitch_);
+  }
+  if (hwSwitch_) {
+    timings["hw_switch_msecs"] = msecs(*hwSwitch_);
+  }
+  if (stateDelta_) {
+    timings["state_delta_msecs"] = msecs(*stateDelta_);
+  }
+  if (sdkCalls_) {
+    timings["sdk_calls_msecs"] = msecs(*sdkCalls_);
+    if (hwSwitch_) {
+      timings["hw_switch_overhead_msecs"] = msecs(
+          *hwSwitch_ - *sdkCalls_ - stateDelta_.value_or(Duration(0)));
+    }
+  }
+  return timings;
+}
+
+} // namespace facebook::fboss::utility
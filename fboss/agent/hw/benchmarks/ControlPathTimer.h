@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <gflags/gflags.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+DECLARE_bool(json);
+
+namespace facebook::fboss {
+
+class StateDelta;
+class SwitchState;
+
+namespace utility {
+
+/*
+ * Walk all the deltas a HwSwitch walks to program a state update, without
+ * programming anything. Returns the number of nodes changed.
+ */
+size_t walkStateDelta(const StateDelta& delta);
+
+/*
+ * ControlPathTimer breaks down the time the control path takes to apply
+ * switch states, so that software regressions can be caught on FakeSai or
+ * SimSwitch before they reach hardware:
+ *  - sw_switch: applying the states through SwSwitch end to end, or the
+ *    SwSwitch side of an update such as applying the config.
+ *  - hw_switch: applying the states through HwSwitch::stateChanged.
+ *  - state_delta: computing and walking the deltas between the states alone.
+ *  - sdk_calls: the part of hw_switch spent in SDK calls, as timed by
+ *    TIME_CALL on the calling thread.
+ *  - hw_switch_overhead: hw_switch less state_delta and sdk_calls, i.e. the
+ *    bookkeeping of the HwSwitch itself, such as the SAI store for SaiSwitch.
+ *
+ * Only the timings measured are reported, in milliseconds, when the
+ * ControlPathTimer is destroyed: as JSON on stdout with --json, else logged.
+ */
+class ControlPathTimer {
+ public:
+  using SwitchStates = std::vector<std::shared_ptr<SwitchState>>;
+
+  explicit ControlPathTimer(std::string name) : name_(std::move(name)) {}
+  ~ControlPathTimer();
+
+  /*
+   * Compute and walk the deltas from oldState through each of newStates in
+   * turn. Meant to run outside of the benchmark measurements.
+   */
+  void timeStateDeltas(
+      std::shared_ptr<SwitchState> oldState,
+      const SwitchStates& newStates);
+
+  // Time fn, which applies states through SwSwitch
+  void timeSwSwitch(const std::function<void()>& fn);
+
+  // Time fn, which applies states through HwSwitch, and its SDK calls
+  void timeHwSwitch(const std::function<void()>& fn);
+
+  folly::dynamic toDynamic() const;
+
+ private:
+  using Duration = std::chrono::duration<double, std::micro>;
+
+  // Forbidden copy constructor and assignment operator
+  ControlPathTimer(ControlPathTimer const&) = delete;
+  ControlPathTimer& operator=(ControlPathTimer const&) = delete;
+
+  std::string name_;
+  std::optional<Duration> swSwitch_;
+  std::optional<Duration> hwSwitch_;
+  std::optional<Duration> stateDelta_;
+  std::optional<Duration> sdkCalls_;
+};
+
+} // namespace utility
+} // namespace facebook::fboss
@@ -10,6 +10,7 @@
 
 #include "fboss/agent/hw/benchmarks/HwInitAndExitBenchmarkHelper.h"
 #include "fboss/agent/ApplyThriftConfig.h"
+#include "fboss/agent/hw/benchmarks/ControlPathTimer.h"
 #include "fboss/agent/hw/switch_asics/HwAsic.h"
 #include "fboss/agent/hw/test/ConfigFactory.h"
 #include "fboss/agent/hw/test/HwSwitchEnsemble.h"
@@ -111,6 +112,10 @@ std::optional<uint16_t> getUplinksCount(
         cfg::PortSpeed::HUNDREDG,
         cfg::PortSpeed::HUNDREDG},
        4},
+      {{PlatformMode::FAKE_WEDGE,
+        cfg::PortSpeed::HUNDREDG,
+        cfg::PortSpeed::HUNDREDG},
+       4},
   };
 
   auto iter = numUplinksMap.find(
@@ -129,6 +134,7 @@ RouteDistributionGenerator::SwitchStates getRouteScaleSwitchStates(
    * |  TOMAHAWK   |   FSW  |
    * |  TOMAHAWK3  |    UU  |
    * |  TAJO       |   RSW  |
+   * |  FAKE       |   FSW  |
    *
    * The benchmarks are categorized by chip and not by the route scale.
    * Pick the highest scale for that chip. For instance, any TH asic will
@@ -147,7 +153,9 @@ RouteDistributionGenerator::SwitchStates getRouteScaleSwitchStates(
       asicType == HwAsic::AsicType::ASIC_TYPE_TAJO) {
     return utility::HgridUuRouteScaleGenerator(ensemble->getProgrammedState())
         .getSwitchStates();
-  } else if (asicType == HwAsic::AsicType::ASIC_TYPE_TOMAHAWK) {
+  } else if (
+      asicType == HwAsic::AsicType::ASIC_TYPE_TOMAHAWK ||
+      asicType == HwAsic::AsicType::ASIC_TYPE_FAKE) {
     return utility::FSWRouteScaleGenerator(ensemble->getProgrammedState())
         .getSwitchStates();
   } else {
@@ -196,6 +204,9 @@ void initandExitBenchmarkHelper(
    * warmboot setup. Enable benchmarking only for coldboot/warmbot init and
    * disable when setting up for warmboot
    */
+  ControlPathTimer controlPathTimer("init_to_configured");
+  auto initState = ensemble->getProgrammedState();
+  std::shared_ptr<SwitchState> newState;
   suspender.dismiss();
   {
     ScopedCallTimer timeIt;
@@ -205,12 +216,17 @@ void initandExitBenchmarkHelper(
      * to measure the performance only for hw switch init and also the state
      * transition from INIT TO CONFIGURED.
      */
-    auto newState = applyThriftConfig(
-        ensemble->getProgrammedState(), &config, hwSwitch->getPlatform());
-    ensemble->applyNewState(newState);
-    ensemble->switchRunStateChanged(SwitchRunState::CONFIGURED);
+    controlPathTimer.timeSwSwitch([&]() {
+      newState =
+          applyThriftConfig(initState, &config, hwSwitch->getPlatform());
+    });
+    controlPathTimer.timeHwSwitch([&]() {
+      ensemble->applyNewState(newState);
+      ensemble->switchRunStateChanged(SwitchRunState::CONFIGURED);
+    });
   }
   suspender.rehire();
+  controlPathTimer.timeStateDeltas(initState, {newState});
   auto states = getRouteScaleSwitchStates(ensemble.get());
   for (auto& state : states) {
     ensemble->applyNewState(state);
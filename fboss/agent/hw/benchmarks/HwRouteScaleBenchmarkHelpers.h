@@ -9,6 +9,7 @@
  */
 
 #include "fboss/agent/HwSwitch.h"
+#include "fboss/agent/hw/benchmarks/ControlPathTimer.h"
 #include "fboss/agent/hw/test/ConfigFactory.h"
 #include "fboss/agent/hw/test/HwSwitchEnsemble.h"
 #include "fboss/agent/hw/test/HwSwitchEnsembleFactory.h"
@@ -38,14 +39,24 @@ void routeAddDelBenchmarker(bool measureAdd) {
   }
   static const auto states = routeGenerator.getSwitchStates();
 
+  /*
+   * Break the time down into state delta processing, SDK calls and the
+   * overhead of the HwSwitch itself. Route deletion tears down the HwSwitch
+   * rather than going through state deltas.
+   */
+  utility::ControlPathTimer controlPathTimer(
+      measureAdd ? "route_add" : "route_del");
   if (measureAdd) {
+    controlPathTimer.timeStateDeltas(ensemble->getProgrammedState(), states);
     ScopedCallTimer timeIt;
     // Activate benchmarker before applying switch states
     // for adding routes to h/w
     suspender.dismiss();
-    for (auto& state : states) {
-      ensemble->applyNewState(state);
-    }
+    controlPathTimer.timeHwSwitch([&ensemble]() {
+      for (auto& state : states) {
+        ensemble->applyNewState(state);
+      }
+    });
     // We are about to blow away all routes, before that
     // deactivate benchmark measurement.
     suspender.rehire();
@@ -57,7 +68,7 @@ void routeAddDelBenchmarker(bool measureAdd) {
     // We are about to blow away all routes, before that
     // activate benchmark measurement.
     suspender.dismiss();
-    ensemble.reset();
+    controlPathTimer.timeHwSwitch([&ensemble]() { ensemble.reset(); });
   }
 }
 
@@ -9,6 +9,9 @@
  */
 
 #include "fboss/agent/Platform.h"
+#include "fboss/agent/RxPacket.h"
+#include "fboss/agent/RxPacketDispatcher.h"
+#include "fboss/agent/hw/mock/MockRxPacket.h"
 #include "fboss/agent/hw/test/ConfigFactory.h"
 #include "fboss/agent/hw/test/HwSwitchEnsemble.h"
 #include "fboss/agent/hw/test/HwSwitchEnsembleFactory.h"
@@ -23,8 +26,11 @@
 #include <folly/IPAddressV6.h>
 #include <folly/dynamic.h>
 #include <folly/init/Init.h>
+#include <folly/io/Cursor.h>
+#include <folly/io/IOBuf.h>
 #include <folly/json.h>
 
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -36,6 +42,63 @@ DEFINE_bool(
 
 namespace facebook::fboss {
 
+namespace {
+/*
+ * With --rx_pipeline, copies every packet the HwSwitch punts to the CPU into
+ * an RxPacketDispatcher, so we can measure the rate at which the pipeline
+ * hands packets to protocol handlers alongside the raw CPU queue rate.
+ */
+class RxPipelineObserver : public HwSwitchEnsemble::HwSwitchEventObserverIf {
+ public:
+  RxPipelineObserver()
+      : dispatcher_([this](std::unique_ptr<RxPacket> pkt) {
+          // Stand in for a handler: touch the L2 header like
+          // SwSwitch::processPacket() does before dispatching.
+          folly::io::Cursor c(pkt->buf());
+          c.skip(12);
+          ethertypeSum_.fetch_add(
+              c.readBE<uint16_t>(), std::memory_order_relaxed);
+        }) {}
+
+  void packetReceived(RxPacket* pkt) noexcept override {
+    auto buf = pkt->buf()->clone();
+    // The HwSwitch may reuse its buffer once the callback returns
+    buf->unshare();
+    auto copy = std::make_unique<MockRxPacket>(std::move(buf));
+    copy->setSrcPort(pkt->getSrcPort());
+    copy->setSrcVlan(pkt->getSrcVlan());
+    dispatcher_.enqueue(std::move(copy));
+  }
+  void linkStateChanged(PortID /*port*/, bool /*up*/) override {}
+  void l2LearningUpdateReceived(
+      L2Entry /*l2Entry*/,
+      L2EntryUpdateType /*l2EntryUpdateType*/) override {}
+
+  template <typename Getter>
+  uint64_t sum(Getter getter) const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < RxPacketDispatcher::kNumQueues; ++i) {
+      total += (dispatcher_.*getter)(static_cast<RxPacketDispatcher::Queue>(i));
+    }
+    return total;
+  }
+  uint64_t processed() const {
+    return sum(&RxPacketDispatcher::getProcessed);
+  }
+  uint64_t dropped() const {
+    return sum(&RxPacketDispatcher::getDropped);
+  }
+  uint64_t backpressured() const {
+    return sum(&RxPacketDispatcher::getBackpressured);
+  }
+
+ private:
+  // Declared first so it outlives the dispatcher's workers
+  std::atomic<uint64_t> ethertypeSum_{0};
+  RxPacketDispatcher dispatcher_;
+};
+} // namespace
+
 void runRxSlowPathBenchmark() {
   constexpr int kEcmpWidth = 1;
   auto ensemble = createHwEnsemble(HwSwitchEnsemble::getAllFeatures());
@@ -44,6 +107,11 @@ void runRxSlowPathBenchmark() {
   auto portUsed = ensemble->masterLogicalPortIds()[0];
   auto config = utility::oneL3IntfConfig(hwSwitch, portUsed);
   ensemble->applyInitialConfig(config);
+  std::unique_ptr<RxPipelineObserver> rxPipeline;
+  if (FLAGS_rx_pipeline) {
+    rxPipeline = std::make_unique<RxPipelineObserver>();
+    ensemble->addHwEventObserver(rxPipeline.get());
+  }
   // capture packet exiting port 0 (entering due to loopback)
   auto packetCapture = HwTestPacketTrapEntry(hwSwitch, dstIp);
   auto dstMac = utility::getInterfaceMac(
@@ -78,10 +146,12 @@ void runRxSlowPathBenchmark() {
   auto [pktsBefore, bytesBefore] =
       utility::getCpuQueueOutPacketsAndBytes(hwSwitch, kCpuQueue);
   auto timeBefore = std::chrono::steady_clock::now();
+  auto pipelineBefore = rxPipeline ? rxPipeline->processed() : 0;
   CHECK_NE(pktsBefore, 0);
   std::this_thread::sleep_for(std::chrono::seconds(kBurnIntevalInSeconds));
   auto [pktsAfter, bytesAfter] =
       utility::getCpuQueueOutPacketsAndBytes(hwSwitch, kCpuQueue);
+  auto pipelineAfter = rxPipeline ? rxPipeline->processed() : 0;
   auto timeAfter = std::chrono::steady_clock::now();
   std::chrono::duration<double, std::milli> durationMillseconds =
       timeAfter - timeBefore;
@@ -91,16 +161,32 @@ void runRxSlowPathBenchmark() {
   uint32_t bytesPerSec = (static_cast<double>(bytesAfter - bytesBefore) /
                           durationMillseconds.count()) *
       1000;
+  uint32_t pipelinePps = (static_cast<double>(pipelineAfter - pipelineBefore) /
+                          durationMillseconds.count()) *
+      1000;
+  if (rxPipeline) {
+    ensemble->removeHwEventObserver(rxPipeline.get());
+  }
 
   if (FLAGS_json) {
     folly::dynamic cpuRxRateJson = folly::dynamic::object;
     cpuRxRateJson["cpu_rx_pps"] = pps;
     cpuRxRateJson["cpu_rx_bytes_per_sec"] = bytesPerSec;
+    if (rxPipeline) {
+      cpuRxRateJson["rx_pipeline_pps"] = pipelinePps;
+      cpuRxRateJson["rx_pipeline_dropped"] = rxPipeline->dropped();
+      cpuRxRateJson["rx_pipeline_backpressure"] = rxPipeline->backpressured();
+    }
     std::cout << toPrettyJson(cpuRxRateJson) << std::endl;
   } else {
     XLOG(INFO) << " Pkts before: " << pktsBefore << " Pkts after: " << pktsAfter
                << " interval ms: " << durationMillseconds.count()
                << " pps: " << pps << " bytes per sec: " << bytesPerSec;
+    if (rxPipeline) {
+      XLOG(INFO) << " RX pipeline pps: " << pipelinePps
+                 << " dropped: " << rxPipeline->dropped()
+                 << " backpressure: " << rxPipeline->backpressured();
+    }
   }
 }
 } // namespace facebook::fboss
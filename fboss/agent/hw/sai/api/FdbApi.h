@@ -15,6 +15,7 @@
 #include "fboss/agent/hw/sai/api/SaiAttribute.h"
 #include "fboss/agent/hw/sai/api/SaiAttributeDataTypes.h"
 #include "fboss/agent/hw/sai/api/SaiDefaultAttributeValues.h"
+#include "fboss/agent/hw/sai/api/SaiVersion.h"
 
 #include <folly/IPAddress.h>
 #include <folly/MacAddress.h>
@@ -132,6 +133,67 @@ class FdbApi : public SaiApi<FdbApi> {
     return api_->set_fdb_entry_attribute(fdbEntry.entry(), attr);
   }
 
+#if SAI_API_VERSION >= SAI_VERSION(1, 7, 0)
+  sai_status_t _bulkCreate(
+      const SaiFdbTraits::FdbEntry* fdbEntries,
+      size_t count,
+      const uint32_t* attrCounts,
+      const sai_attribute_t** attrLists,
+      sai_status_t* statuses) {
+    if (!api_->create_fdb_entries) {
+      // Adapters, or the SAI tracer's wrappers of them, may not have any
+      return SaiApi<FdbApi>::_bulkCreate(
+          fdbEntries, count, attrCounts, attrLists, statuses);
+    }
+    auto entries = saiFdbEntries(fdbEntries, count);
+    return api_->create_fdb_entries(
+        count,
+        entries.data(),
+        attrCounts,
+        attrLists,
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        statuses);
+  }
+  sai_status_t _bulkRemove(
+      const SaiFdbTraits::FdbEntry* fdbEntries,
+      size_t count,
+      sai_status_t* statuses) {
+    if (!api_->remove_fdb_entries) {
+      return SaiApi<FdbApi>::_bulkRemove(fdbEntries, count, statuses);
+    }
+    auto entries = saiFdbEntries(fdbEntries, count);
+    return api_->remove_fdb_entries(
+        count, entries.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+  }
+  sai_status_t _bulkSetAttribute(
+      const SaiFdbTraits::FdbEntry* fdbEntries,
+      size_t count,
+      const sai_attribute_t* attrs,
+      sai_status_t* statuses) {
+    if (!api_->set_fdb_entries_attribute) {
+      return SaiApi<FdbApi>::_bulkSetAttribute(
+          fdbEntries, count, attrs, statuses);
+    }
+    auto entries = saiFdbEntries(fdbEntries, count);
+    return api_->set_fdb_entries_attribute(
+        count,
+        entries.data(),
+        attrs,
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        statuses);
+  }
+  static std::vector<sai_fdb_entry_t> saiFdbEntries(
+      const SaiFdbTraits::FdbEntry* fdbEntries,
+      size_t count) {
+    std::vector<sai_fdb_entry_t> entries;
+    entries.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      entries.push_back(*fdbEntries[i].entry());
+    }
+    return entries;
+  }
+#endif
+
   sai_fdb_api_t* api_;
   friend class SaiApi<FdbApi>;
 };
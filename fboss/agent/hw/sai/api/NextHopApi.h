@@ -19,6 +19,7 @@
 #include <folly/logging/xlog.h>
 
 #include <tuple>
+#include <vector>
 
 extern "C" {
 #include <sai.h>
@@ -198,6 +199,35 @@ class NextHopApi : public SaiApi<NextHopApi> {
     return api_->set_next_hop_attribute(id, attr);
   }
 
+  // The next hop API has no bulk functions of its own, but SAI provides
+  // generic bulk create and remove for objects identified by object id
+  sai_status_t _bulkCreate(
+      NextHopSaiId* ids,
+      sai_object_id_t switch_id,
+      size_t count,
+      const uint32_t* attrCounts,
+      const sai_attribute_t** attrLists,
+      sai_status_t* statuses) {
+    return sai_bulk_object_create(
+        switch_id,
+        SAI_OBJECT_TYPE_NEXT_HOP,
+        count,
+        attrCounts,
+        attrLists,
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        rawSaiId(ids),
+        statuses);
+  }
+  sai_status_t
+  _bulkRemove(const NextHopSaiId* ids, size_t count, sai_status_t* statuses) {
+    std::vector<sai_object_id_t> objectIds(ids, ids + count);
+    return sai_bulk_object_remove(
+        count,
+        objectIds.data(),
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        statuses);
+  }
+
   sai_next_hop_api_t* api_;
   friend class SaiApi<NextHopApi>;
 };
@@ -21,6 +21,7 @@
 #include <folly/logging/xlog.h>
 
 #include <iterator>
+#include <vector>
 
 extern "C" {
 #include <sai.h>
@@ -130,6 +131,65 @@ class RouteApi : public SaiApi<RouteApi> {
     return api_->set_route_entry_attribute(routeEntry.entry(), attr);
   }
 
+  sai_status_t _bulkCreate(
+      const SaiRouteTraits::RouteEntry* routeEntries,
+      size_t count,
+      const uint32_t* attrCounts,
+      const sai_attribute_t** attrLists,
+      sai_status_t* statuses) {
+    if (!api_->create_route_entries) {
+      // Adapters, or the SAI tracer's wrappers of them, may not have any
+      return SaiApi<RouteApi>::_bulkCreate(
+          routeEntries, count, attrCounts, attrLists, statuses);
+    }
+    auto entries = saiRouteEntries(routeEntries, count);
+    return api_->create_route_entries(
+        count,
+        entries.data(),
+        attrCounts,
+        attrLists,
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        statuses);
+  }
+  sai_status_t _bulkRemove(
+      const SaiRouteTraits::RouteEntry* routeEntries,
+      size_t count,
+      sai_status_t* statuses) {
+    if (!api_->remove_route_entries) {
+      return SaiApi<RouteApi>::_bulkRemove(routeEntries, count, statuses);
+    }
+    auto entries = saiRouteEntries(routeEntries, count);
+    return api_->remove_route_entries(
+        count, entries.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+  }
+  sai_status_t _bulkSetAttribute(
+      const SaiRouteTraits::RouteEntry* routeEntries,
+      size_t count,
+      const sai_attribute_t* attrs,
+      sai_status_t* statuses) {
+    if (!api_->set_route_entries_attribute) {
+      return SaiApi<RouteApi>::_bulkSetAttribute(
+          routeEntries, count, attrs, statuses);
+    }
+    auto entries = saiRouteEntries(routeEntries, count);
+    return api_->set_route_entries_attribute(
+        count,
+        entries.data(),
+        attrs,
+        SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+        statuses);
+  }
+  static std::vector<sai_route_entry_t> saiRouteEntries(
+      const SaiRouteTraits::RouteEntry* routeEntries,
+      size_t count) {
+    std::vector<sai_route_entry_t> entries;
+    entries.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      entries.push_back(*routeEntries[i].entry());
+    }
+    return entries;
+  }
+
   sai_route_api_t* api_;
   friend class SaiApi<RouteApi>;
 };
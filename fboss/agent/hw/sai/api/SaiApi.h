@@ -23,7 +23,6 @@
 
 #include <algorithm>
 #include <exception>
-#include <mutex>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -38,6 +37,45 @@ namespace facebook::fboss {
 
 enum class HwWriteBehavior : int { FAIL, SKIP, WRITE };
 
+namespace detail {
+
+/*
+ * Lays out the create attributes of a batch of objects the way SAI bulk
+ * create functions take them: parallel arrays of attribute counts and
+ * attribute lists, one entry per object.
+ */
+class SaiBulkCreateAttributes {
+ public:
+  template <typename CreateAttributesT>
+  explicit SaiBulkCreateAttributes(
+      const std::vector<CreateAttributesT>& createAttributes) {
+    saiAttributeTs_.reserve(createAttributes.size());
+    attrCounts_.reserve(createAttributes.size());
+    attrLists_.reserve(createAttributes.size());
+    for (const auto& attributes : createAttributes) {
+      saiAttributeTs_.push_back(saiAttrs(attributes));
+      attrCounts_.push_back(saiAttributeTs_.back().size());
+      attrLists_.push_back(saiAttributeTs_.back().data());
+    }
+  }
+  SaiBulkCreateAttributes(const SaiBulkCreateAttributes&) = delete;
+  SaiBulkCreateAttributes& operator=(const SaiBulkCreateAttributes&) = delete;
+
+  const uint32_t* attrCounts() const {
+    return attrCounts_.data();
+  }
+  const sai_attribute_t** attrLists() {
+    return attrLists_.data();
+  }
+
+ private:
+  std::vector<std::vector<sai_attribute_t>> saiAttributeTs_;
+  std::vector<uint32_t> attrCounts_;
+  std::vector<const sai_attribute_t*> attrLists_;
+};
+
+} // namespace detail
+
 template <typename ApiT>
 class SaiApi {
  public:
@@ -86,7 +124,7 @@ class SaiApi {
           "Attempting create SAI obj with {}, while hw writes are blocked",
           createAttributes);
     }
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     sai_status_t status;
     {
       TIME_CALL;
@@ -121,7 +159,7 @@ class SaiApi {
           "Attempting create SAI obj with {}, while hw writes are blocked",
           createAttributes);
     }
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     sai_status_t status;
     {
       TIME_CALL;
@@ -147,7 +185,7 @@ class SaiApi {
           "Attempting to remove SAI obj {} while hw writes are blocked",
           key);
     }
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     sai_status_t status;
     {
       TIME_CALL;
@@ -160,6 +198,178 @@ class SaiApi {
     XLOGF(DBG5, "removed SAI object: {}", key);
   }
 
+  /*
+   * Bulk variants of create, remove and setAttribute.
+   *
+   * A whole batch is programmed under a single acquisition of the SAI API
+   * lock, through the adapter's bulk functions for APIs which implement them
+   * (see _bulkCreate and friends below) and one object at a time otherwise.
+   * The adapter is asked to carry on past failed objects, and rather than
+   * throwing, the status of every object is returned so that callers can
+   * tell which objects were programmed.
+   */
+
+  // entry struct case
+  template <typename SaiObjectTraits>
+  std::enable_if_t<
+      AdapterKeyIsEntryStruct<SaiObjectTraits>::value,
+      std::vector<sai_status_t>>
+  bulkCreate(
+      const std::vector<typename SaiObjectTraits::AdapterKey>& entries,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          createAttributes) {
+    static_assert(
+        std::is_same_v<typename SaiObjectTraits::SaiApiT, ApiT>,
+        "invalid traits for the api");
+    CHECK_EQ(entries.size(), createAttributes.size());
+    if (UNLIKELY(skipHwWrites())) {
+      return std::vector<sai_status_t>(entries.size(), SAI_STATUS_SUCCESS);
+    }
+    if (UNLIKELY(failHwWrites())) {
+      XLOGF(
+          FATAL,
+          "Attempting bulk create of {} SAI objs, while hw writes are blocked",
+          entries.size());
+    }
+    detail::SaiBulkCreateAttributes attributes(createAttributes);
+    std::vector<sai_status_t> statuses(entries.size(), SAI_STATUS_FAILURE);
+    if (entries.empty()) {
+      return statuses;
+    }
+    auto g = SaiApiLock::getInstance()->lock(apiType());
+    sai_status_t status;
+    {
+      TIME_CALL;
+      status = impl()._bulkCreate(
+          entries.data(),
+          entries.size(),
+          attributes.attrCounts(),
+          attributes.attrLists(),
+          statuses.data());
+    }
+    bulkStatuses(status, &statuses);
+    XLOGF(DBG5, "bulk created {} SAI objects: {}", entries.size(), status);
+    return statuses;
+  }
+
+  // sai_object_id_t case
+  template <typename SaiObjectTraits>
+  std::enable_if_t<
+      AdapterKeyIsObjectId<SaiObjectTraits>::value,
+      std::vector<sai_status_t>>
+  bulkCreate(
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          createAttributes,
+      sai_object_id_t switch_id,
+      std::vector<typename SaiObjectTraits::AdapterKey>* keys) {
+    static_assert(
+        std::is_same_v<typename SaiObjectTraits::SaiApiT, ApiT>,
+        "invalid traits for the api");
+    if (UNLIKELY(failHwWrites() || skipHwWrites())) {
+      // As with create, keys can only come from the adapter
+      XLOGF(
+          FATAL,
+          "Attempting bulk create of {} SAI objs, while hw writes are blocked",
+          createAttributes.size());
+    }
+    detail::SaiBulkCreateAttributes attributes(createAttributes);
+    keys->resize(createAttributes.size());
+    std::vector<sai_status_t> statuses(
+        createAttributes.size(), SAI_STATUS_FAILURE);
+    if (createAttributes.empty()) {
+      return statuses;
+    }
+    auto g = SaiApiLock::getInstance()->lock(apiType());
+    sai_status_t status;
+    {
+      TIME_CALL;
+      status = impl()._bulkCreate(
+          keys->data(),
+          switch_id,
+          createAttributes.size(),
+          attributes.attrCounts(),
+          attributes.attrLists(),
+          statuses.data());
+    }
+    bulkStatuses(status, &statuses);
+    XLOGF(
+        DBG5,
+        "bulk created {} SAI objects: {}",
+        createAttributes.size(),
+        status);
+    return statuses;
+  }
+
+  template <typename AdapterKeyT>
+  std::vector<sai_status_t> bulkRemove(const std::vector<AdapterKeyT>& keys) {
+    if (UNLIKELY(skipHwWrites())) {
+      return std::vector<sai_status_t>(keys.size(), SAI_STATUS_SUCCESS);
+    }
+    if (UNLIKELY(failHwWrites())) {
+      XLOGF(
+          FATAL,
+          "Attempting bulk remove of {} SAI objs, while hw writes are blocked",
+          keys.size());
+    }
+    std::vector<sai_status_t> statuses(keys.size(), SAI_STATUS_FAILURE);
+    if (keys.empty()) {
+      return statuses;
+    }
+    auto g = SaiApiLock::getInstance()->lock(apiType());
+    sai_status_t status;
+    {
+      TIME_CALL;
+      status = impl()._bulkRemove(keys.data(), keys.size(), statuses.data());
+    }
+    bulkStatuses(status, &statuses);
+    XLOGF(DBG5, "bulk removed {} SAI objects: {}", keys.size(), status);
+    return statuses;
+  }
+
+  template <typename AdapterKeyT, typename AttrT>
+  std::vector<sai_status_t> bulkSetAttribute(
+      const std::vector<AdapterKeyT>& keys,
+      const std::vector<AttrT>& attrs) {
+    CHECK_EQ(keys.size(), attrs.size());
+    if (UNLIKELY(skipHwWrites())) {
+      return std::vector<sai_status_t>(keys.size(), SAI_STATUS_SUCCESS);
+    }
+    if (UNLIKELY(failHwWrites())) {
+      XLOGF(
+          FATAL,
+          "Attempting bulk set of {} SAI attributes, while hw writes are blocked",
+          keys.size());
+    }
+    if constexpr (IsSaiExtensionAttribute<AttrT>::value) {
+      auto id = typename AttrT::AttributeId()();
+      if (!id.has_value()) {
+        XLOGF(
+            FATAL,
+            "attempting to bulk set unsupported extension SAI attribute {}",
+            attrs.front());
+      }
+    }
+    std::vector<sai_attribute_t> saiAttributeTs;
+    saiAttributeTs.reserve(attrs.size());
+    for (const auto& attr : attrs) {
+      saiAttributeTs.push_back(*saiAttr(attr));
+    }
+    std::vector<sai_status_t> statuses(keys.size(), SAI_STATUS_FAILURE);
+    if (keys.empty()) {
+      return statuses;
+    }
+    auto g = SaiApiLock::getInstance()->lock(apiType());
+    sai_status_t status;
+    {
+      TIME_CALL;
+      status = impl()._bulkSetAttribute(
+          keys.data(), keys.size(), saiAttributeTs.data(), statuses.data());
+    }
+    bulkStatuses(status, &statuses);
+    XLOGF(DBG5, "bulk set {} SAI attributes: {}", keys.size(), status);
+    return statuses;
+  }
+
   /*
    * We can do getAttribute on top of more complicated types than just
    * attributes. For example, if we overload on tuples and optionals, we
@@ -181,7 +391,8 @@ class SaiApi {
         IsSaiAttribute<typename std::remove_reference<AttrT>::type>::value,
         "getAttribute must be called on a SaiAttribute or supported "
         "collection of SaiAttributes");
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g =
+        SaiApiLock::getInstance()->lock(apiType(), SaiApiLock::Access::READ);
     sai_status_t status;
     {
       TIME_CALL;
@@ -321,7 +532,7 @@ class SaiApi {
   }
   template <typename AdapterKeyT, typename AttrT>
   void setAttribute(const AdapterKeyT& key, const AttrT& attr) {
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     setAttributeUnlocked(key, attr);
   }
 
@@ -333,7 +544,7 @@ class SaiApi {
     static_assert(
         SaiObjectHasStats<SaiObjectTraits>::value,
         "getStats only supported for Sai objects with stats");
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType(), statsAccess(mode));
     return getStatsImpl<SaiObjectTraits>(
         key, counterIds.data(), counterIds.size(), mode);
   }
@@ -344,7 +555,7 @@ class SaiApi {
     static_assert(
         SaiObjectHasStats<SaiObjectTraits>::value,
         "getStats only supported for Sai objects with stats");
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType(), statsAccess(mode));
     XLOGF(DBG6, "got SAI stats for {}", key);
     return mode == SAI_STATS_MODE_READ
         ? getStatsImpl<SaiObjectTraits>(
@@ -366,7 +577,7 @@ class SaiApi {
     static_assert(
         SaiObjectHasStats<SaiObjectTraits>::value,
         "clearStats only supported for Sai objects with stats");
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     clearStatsImpl<SaiObjectTraits>(key, counterIds.data(), counterIds.size());
   }
   template <typename SaiObjectTraits>
@@ -374,7 +585,7 @@ class SaiApi {
     static_assert(
         SaiObjectHasStats<SaiObjectTraits>::value,
         "clearStats only supported for Sai objects with stats");
-    std::lock_guard<std::mutex> g{SaiApiLock::getInstance()->lock};
+    auto g = SaiApiLock::getInstance()->lock(apiType());
     clearStatsImpl<SaiObjectTraits>(
         key,
         SaiObjectTraits::CounterIdsToRead.data(),
@@ -395,6 +606,11 @@ class SaiApi {
   bool skipHwWrites() const {
     return hwWriteBehavior_ == HwWriteBehavior::SKIP;
   }
+  static SaiApiLock::Access statsAccess(sai_stats_mode_t mode) {
+    // Read and clear modifies the counters in the adapter
+    return mode == SAI_STATS_MODE_READ ? SaiApiLock::Access::READ
+                                       : SaiApiLock::Access::WRITE;
+  }
   template <typename SaiObjectTraits>
   std::vector<uint64_t> getStatsImpl(
       const typename SaiObjectTraits::AdapterKey& key,
@@ -439,6 +655,93 @@ class SaiApi {
       saiApiCheckError(status, apiType(), "Failed to clear stats");
     }
   }
+  /*
+   * Adapters only set per-object statuses when a bulk call fails, a
+   * successful call means every object was programmed.
+   */
+  static void bulkStatuses(
+      sai_status_t status,
+      std::vector<sai_status_t>* statuses) {
+    if (status == SAI_STATUS_SUCCESS) {
+      std::fill(statuses->begin(), statuses->end(), SAI_STATUS_SUCCESS);
+    }
+  }
+
+ protected:
+  /*
+   * Fallbacks for APIs which have no bulk functions in the adapter, these
+   * are hidden by the corresponding methods of APIs which do, which call
+   * them in turn should the adapter leave its bulk functions unset.
+   */
+  template <typename AdapterKeyT>
+  sai_status_t _bulkCreate(
+      const AdapterKeyT* entries,
+      size_t count,
+      const uint32_t* attrCounts,
+      const sai_attribute_t** attrLists,
+      sai_status_t* statuses) {
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = impl()._create(
+          entries[i],
+          attrCounts[i],
+          const_cast<sai_attribute_t*>(attrLists[i]));
+      if (statuses[i] != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+      }
+    }
+    return status;
+  }
+  template <typename AdapterKeyT>
+  sai_status_t _bulkCreate(
+      AdapterKeyT* keys,
+      sai_object_id_t switch_id,
+      size_t count,
+      const uint32_t* attrCounts,
+      const sai_attribute_t** attrLists,
+      sai_status_t* statuses) {
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = impl()._create(
+          &keys[i],
+          switch_id,
+          attrCounts[i],
+          const_cast<sai_attribute_t*>(attrLists[i]));
+      if (statuses[i] != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+      }
+    }
+    return status;
+  }
+  template <typename AdapterKeyT>
+  sai_status_t
+  _bulkRemove(const AdapterKeyT* keys, size_t count, sai_status_t* statuses) {
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = impl()._remove(keys[i]);
+      if (statuses[i] != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+      }
+    }
+    return status;
+  }
+  template <typename AdapterKeyT>
+  sai_status_t _bulkSetAttribute(
+      const AdapterKeyT* keys,
+      size_t count,
+      const sai_attribute_t* attrs,
+      sai_status_t* statuses) {
+    sai_status_t status = SAI_STATUS_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = impl()._setAttribute(keys[i], &attrs[i]);
+      if (statuses[i] != SAI_STATUS_SUCCESS) {
+        status = SAI_STATUS_FAILURE;
+      }
+    }
+    return status;
+  }
+
+ private:
   ApiT& impl() {
     return static_cast<ApiT&>(*this);
   }
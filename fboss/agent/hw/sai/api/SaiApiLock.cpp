@@ -10,14 +10,103 @@
 
 #include "fboss/agent/hw/sai/api/SaiApiLock.h"
 
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/hw/sai/api/LoggingUtil.h"
+
+#include <folly/Format.h>
 #include <folly/Singleton.h>
-#include <mutex>
 
 namespace {
 struct singleton_tag_type {};
+
+// Lock waits and holds are in usecs, anything past 100ms lands in the
+// overflow bucket
+constexpr int64_t kHistogramBucketUsecs = 50;
+constexpr int64_t kHistogramMaxUsecs = 100000;
 } // namespace
 
 static folly::Singleton<SaiApiLock, singleton_tag_type> saiApiLockSingleton{};
 std::shared_ptr<SaiApiLock> SaiApiLock::getInstance() {
   return saiApiLockSingleton.try_get();
 }
+
+SaiApiLock::SaiApiLock() {
+  for (uint32_t api = SAI_API_UNSPECIFIED; api < SAI_API_MAX; api++) {
+    folly::StringPiece apiName;
+    try {
+      apiName =
+          facebook::fboss::saiApiTypeToString(static_cast<sai_api_t>(api));
+    } catch (const facebook::fboss::FbossError&) {
+      // API of newer SAI headers, which FBOSS makes no calls to
+      continue;
+    }
+    waitHistograms_[api] = std::make_unique<facebook::fb303::HistogramWrapper>(
+        folly::sformat("sai.{}.lock_wait.us", apiName),
+        kHistogramBucketUsecs,
+        0,
+        kHistogramMaxUsecs,
+        50,
+        95,
+        99);
+    holdHistograms_[api] = std::make_unique<facebook::fb303::HistogramWrapper>(
+        folly::sformat("sai.{}.lock_hold.us", apiName),
+        kHistogramBucketUsecs,
+        0,
+        kHistogramMaxUsecs,
+        50,
+        95,
+        99);
+  }
+}
+
+folly::SharedMutex& SaiApiLock::mutexFor(sai_api_t api) {
+  if (concurrency_ == Concurrency::NONE || api >= SAI_API_MAX) {
+    return globalLock_;
+  }
+  return apiLocks_[api];
+}
+
+void SaiApiLock::recordWait(sai_api_t api, std::chrono::microseconds wait)
+    const {
+  if (api < SAI_API_MAX && waitHistograms_[api]) {
+    waitHistograms_[api]->add(wait.count());
+  }
+}
+
+void SaiApiLock::recordHold(sai_api_t api, std::chrono::microseconds hold)
+    const {
+  if (api < SAI_API_MAX && holdHistograms_[api]) {
+    holdHistograms_[api]->add(hold.count());
+  }
+}
+
+SaiApiLock::Guard::Guard(SaiApiLock* apiLock, sai_api_t api, Access access)
+    : apiLock_(apiLock),
+      mutex_(&apiLock->mutexFor(api)),
+      api_(api),
+      exclusive_(
+          access == Access::WRITE ||
+          apiLock->getConcurrency() != Concurrency::PER_API_RW) {
+  auto start = std::chrono::steady_clock::now();
+  if (exclusive_) {
+    mutex_->lock();
+  } else {
+    mutex_->lock_shared();
+  }
+  acquired_ = std::chrono::steady_clock::now();
+  apiLock_->recordWait(
+      api_,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          acquired_ - start));
+}
+
+SaiApiLock::Guard::~Guard() {
+  auto held = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - acquired_);
+  if (exclusive_) {
+    mutex_->unlock();
+  } else {
+    mutex_->unlock_shared();
+  }
+  apiLock_->recordHold(api_, held);
+}
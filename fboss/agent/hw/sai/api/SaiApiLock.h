@@ -9,11 +9,91 @@
  */
 #pragma once
 
+#include <fb303/ThreadCachedServiceData.h>
+#include <folly/SharedMutex.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
-#include <mutex>
+#include <string>
+
+extern "C" {
+#include <sai.h>
+}
 
+/*
+ * Serializes calls into the SAI adapter.
+ *
+ * By default the adapter is assumed not to be thread safe and every SAI
+ * call runs under one process wide lock. Adapters which can take concurrent
+ * calls declare so via setConcurrency(), after which calls to different SAI
+ * APIs (e.g., port stats collection and route programming) stop contending
+ * and, with PER_API_RW, reads of the same API may also run concurrently.
+ *
+ * Time spent waiting for and holding the lock is exported per SAI API as
+ * sai.<api>.lock_wait.us and sai.<api>.lock_hold.us histograms.
+ */
 class SaiApiLock {
  public:
+  enum class Access { READ, WRITE };
+
+  enum class Concurrency {
+    // one SAI call at a time
+    NONE,
+    // calls to different SAI APIs may run concurrently
+    PER_API,
+    // as PER_API, and reads of the same SAI API may run concurrently
+    PER_API_RW,
+  };
+
+  class Guard {
+   public:
+    Guard(SaiApiLock* apiLock, sai_api_t api, Access access);
+    ~Guard();
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+    Guard(Guard&&) = delete;
+    Guard& operator=(Guard&&) = delete;
+
+   private:
+    SaiApiLock* apiLock_;
+    folly::SharedMutex* mutex_;
+    sai_api_t api_;
+    bool exclusive_;
+    std::chrono::steady_clock::time_point acquired_;
+  };
+
+  SaiApiLock();
   static std::shared_ptr<SaiApiLock> getInstance();
-  std::mutex lock;
+
+  Guard lock(sai_api_t api, Access access = Access::WRITE) {
+    return Guard(this, api, access);
+  }
+
+  /*
+   * Must be set before SAI calls are made from more than one thread, since
+   * changing it while a lock is held would let calls slip past each other.
+   */
+  void setConcurrency(Concurrency concurrency) {
+    concurrency_ = concurrency;
+  }
+  Concurrency getConcurrency() const {
+    return concurrency_;
+  }
+
+ private:
+  folly::SharedMutex& mutexFor(sai_api_t api);
+  void recordWait(sai_api_t api, std::chrono::microseconds wait) const;
+  void recordHold(sai_api_t api, std::chrono::microseconds hold) const;
+
+  std::atomic<Concurrency> concurrency_{Concurrency::NONE};
+  folly::SharedMutex globalLock_;
+  std::array<folly::SharedMutex, SAI_API_MAX> apiLocks_;
+  // Resolved once, so that SAI calls do not look histograms up by name.
+  // Null for API ids the SAI headers define but FBOSS does not know of.
+  std::array<std::unique_ptr<facebook::fb303::HistogramWrapper>, SAI_API_MAX>
+      waitHistograms_;
+  std::array<std::unique_ptr<facebook::fb303::HistogramWrapper>, SAI_API_MAX>
+      holdHistograms_;
 };
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/api/SaiApiLock.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+
+namespace {
+constexpr auto kBlocked = std::chrono::milliseconds(100);
+constexpr auto kUnblocked = std::chrono::seconds(10);
+
+// Returns the future of taking the lock from another thread
+std::future<void> lockAsync(
+    SaiApiLock& apiLock,
+    sai_api_t api,
+    SaiApiLock::Access access) {
+  return std::async(std::launch::async, [&apiLock, api, access]() {
+    auto g = apiLock.lock(api, access);
+  });
+}
+} // namespace
+
+TEST(SaiApiLockTest, serializedByDefault) {
+  SaiApiLock apiLock;
+  EXPECT_EQ(apiLock.getConcurrency(), SaiApiLock::Concurrency::NONE);
+  std::future<void> other;
+  {
+    auto g = apiLock.lock(SAI_API_ROUTE);
+    other = lockAsync(apiLock, SAI_API_PORT, SaiApiLock::Access::READ);
+    EXPECT_EQ(other.wait_for(kBlocked), std::future_status::timeout);
+  }
+  EXPECT_EQ(other.wait_for(kUnblocked), std::future_status::ready);
+}
+
+TEST(SaiApiLockTest, perApi) {
+  SaiApiLock apiLock;
+  apiLock.setConcurrency(SaiApiLock::Concurrency::PER_API);
+  std::future<void> sameApi;
+  {
+    auto g = apiLock.lock(SAI_API_ROUTE);
+    // Stats reads off another API do not wait for route programming
+    auto other = lockAsync(apiLock, SAI_API_PORT, SaiApiLock::Access::READ);
+    EXPECT_EQ(other.wait_for(kUnblocked), std::future_status::ready);
+    // Reads of the same API still do
+    sameApi = lockAsync(apiLock, SAI_API_ROUTE, SaiApiLock::Access::READ);
+    EXPECT_EQ(sameApi.wait_for(kBlocked), std::future_status::timeout);
+  }
+  EXPECT_EQ(sameApi.wait_for(kUnblocked), std::future_status::ready);
+}
+
+TEST(SaiApiLockTest, perApiReadersShareLock) {
+  SaiApiLock apiLock;
+  apiLock.setConcurrency(SaiApiLock::Concurrency::PER_API_RW);
+  std::future<void> writer;
+  {
+    auto g = apiLock.lock(SAI_API_PORT, SaiApiLock::Access::READ);
+    auto reader = lockAsync(apiLock, SAI_API_PORT, SaiApiLock::Access::READ);
+    EXPECT_EQ(reader.wait_for(kUnblocked), std::future_status::ready);
+    writer = lockAsync(apiLock, SAI_API_PORT, SaiApiLock::Access::WRITE);
+    EXPECT_EQ(writer.wait_for(kBlocked), std::future_status::timeout);
+  }
+  EXPECT_EQ(writer.wait_for(kUnblocked), std::future_status::ready);
+}
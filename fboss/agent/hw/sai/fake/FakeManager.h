@@ -80,6 +80,31 @@ class FakeManager {
 template <typename K, typename T>
 size_t FakeManager<K, T>::count_ = 0;
 
+/*
+ * Implements a SAI bulk function in terms of the corresponding single object
+ * function, where op(i) programs the i'th object of the batch.
+ */
+template <typename OpFn>
+sai_status_t fakeBulkOp(
+    uint32_t object_count,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses,
+    OpFn op) {
+  sai_status_t status = SAI_STATUS_SUCCESS;
+  for (uint32_t i = 0; i < object_count; ++i) {
+    if (status != SAI_STATUS_SUCCESS &&
+        mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) {
+      object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+      continue;
+    }
+    object_statuses[i] = op(i);
+    if (object_statuses[i] != SAI_STATUS_SUCCESS) {
+      status = SAI_STATUS_FAILURE;
+    }
+  }
+  return status;
+}
+
 /*
  * For managing fakes of sai apis that have a membership concept, we will
  * nest fake managers. In this class template, GroupT denotes an owning "group"
@@ -242,3 +242,45 @@ sai_object_type_t sai_object_type_query(sai_object_id_t /*object_id*/) {
   // FIXME: implement this
   return SAI_OBJECT_TYPE_NEXT_HOP;
 }
+
+/*
+ * Generic bulk functions, only implemented for next hops which have no bulk
+ * functions in their own API.
+ */
+sai_status_t sai_bulk_object_create(
+    sai_object_id_t switch_id,
+    sai_object_type_t object_type,
+    uint32_t object_count,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_object_id_t* object_id,
+    sai_status_t* object_statuses) {
+  if (object_type != SAI_OBJECT_TYPE_NEXT_HOP) {
+    return SAI_STATUS_NOT_IMPLEMENTED;
+  }
+  sai_next_hop_api_t* nextHopApi;
+  facebook::fboss::populate_next_hop_api(&nextHopApi);
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return nextHopApi->create_next_hop(
+            &object_id[i], switch_id, attr_count[i], attr_list[i]);
+      });
+}
+
+sai_status_t sai_bulk_object_remove(
+    uint32_t object_count,
+    const sai_object_id_t* object_id,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto fs = FakeSai::getInstance();
+  sai_next_hop_api_t* nextHopApi;
+  facebook::fboss::populate_next_hop_api(&nextHopApi);
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) -> sai_status_t {
+        if (!fs->nextHopManager.exists(object_id[i])) {
+          return SAI_STATUS_NOT_IMPLEMENTED;
+        }
+        return nextHopApi->remove_next_hop(object_id[i]);
+      });
+}
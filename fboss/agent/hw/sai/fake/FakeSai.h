@@ -97,3 +97,19 @@ sai_status_t sai_api_query(sai_api_t sai_api_id, void** api_method_table);
 sai_status_t sai_log_set(sai_api_t api, sai_log_level_t log_level);
 
 sai_status_t sai_dbg_generate_dump(const char* dump_file_name);
+
+sai_status_t sai_bulk_object_create(
+    sai_object_id_t switch_id,
+    sai_object_type_t object_type,
+    uint32_t object_count,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_object_id_t* object_id,
+    sai_status_t* object_statuses);
+
+sai_status_t sai_bulk_object_remove(
+    uint32_t object_count,
+    const sai_object_id_t* object_id,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses);
@@ -102,6 +102,44 @@ sai_status_t get_fdb_entry_attribute_fn(
   return SAI_STATUS_SUCCESS;
 }
 
+#if SAI_API_VERSION >= SAI_VERSION(1, 7, 0)
+sai_status_t create_fdb_entries_fn(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return create_fdb_entry_fn(&fdb_entry[i], attr_count[i], attr_list[i]);
+      });
+}
+
+sai_status_t remove_fdb_entries_fn(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return remove_fdb_entry_fn(&fdb_entry[i]);
+      });
+}
+
+sai_status_t set_fdb_entries_attribute_fn(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    const sai_attribute_t* attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return set_fdb_entry_attribute_fn(&fdb_entry[i], &attr_list[i]);
+      });
+}
+#endif
+
 namespace facebook::fboss {
 
 static sai_fdb_api_t _fdb_api;
@@ -111,6 +149,11 @@ void populate_fdb_api(sai_fdb_api_t** fdb_api) {
   _fdb_api.remove_fdb_entry = &remove_fdb_entry_fn;
   _fdb_api.set_fdb_entry_attribute = &set_fdb_entry_attribute_fn;
   _fdb_api.get_fdb_entry_attribute = &get_fdb_entry_attribute_fn;
+#if SAI_API_VERSION >= SAI_VERSION(1, 7, 0)
+  _fdb_api.create_fdb_entries = &create_fdb_entries_fn;
+  _fdb_api.remove_fdb_entries = &remove_fdb_entries_fn;
+  _fdb_api.set_fdb_entries_attribute = &set_fdb_entries_attribute_fn;
+#endif
   *fdb_api = &_fdb_api;
 }
 
@@ -98,6 +98,43 @@ sai_status_t get_route_entry_attribute_fn(
   return SAI_STATUS_SUCCESS;
 }
 
+sai_status_t create_route_entries_fn(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return create_route_entry_fn(
+            &route_entry[i], attr_count[i], attr_list[i]);
+      });
+}
+
+sai_status_t remove_route_entries_fn(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return remove_route_entry_fn(&route_entry[i]);
+      });
+}
+
+sai_status_t set_route_entries_attribute_fn(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    const sai_attribute_t* attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  return facebook::fboss::fakeBulkOp(
+      object_count, mode, object_statuses, [&](uint32_t i) {
+        return set_route_entry_attribute_fn(&route_entry[i], &attr_list[i]);
+      });
+}
+
 namespace facebook::fboss {
 
 static sai_route_api_t _route_api;
@@ -107,6 +144,9 @@ void populate_route_api(sai_route_api_t** route_api) {
   _route_api.remove_route_entry = &remove_route_entry_fn;
   _route_api.set_route_entry_attribute = &set_route_entry_attribute_fn;
   _route_api.get_route_entry_attribute = &get_route_entry_attribute_fn;
+  _route_api.create_route_entries = &create_route_entries_fn;
+  _route_api.remove_route_entries = &remove_route_entries_fn;
+  _route_api.set_route_entries_attribute = &set_route_entries_attribute_fn;
   *route_api = &_route_api;
 }
 
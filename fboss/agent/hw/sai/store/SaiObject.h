@@ -165,17 +165,19 @@ typename std::
  * moved from. If it is live, destroying the SaiObject removes the
  * corresponding object from SAI.
  *
- * A SaiObject can be constructed in three ways:
+ * A SaiObject can be constructed in four ways:
  * 1. By loading it from the SAI adapter using the AdapterKey. This can be
  *    thought of as the SaiObject taking control of an existing object in SAI.
  * 2. By creating a new object in the SAI adapter using the AdapterHostKey and
  *    CreateAttributes
- * 3. Moving from another SaiObject. If the moved-from SaiObject was live,
+ * 3. From the AdapterKey, AdapterHostKey and CreateAttributes of an object
+ *    which SaiObjectStore just created in the adapter as part of a batch.
+ * 4. Moving from another SaiObject. If the moved-from SaiObject was live,
  *    after the move, it is no longer live, so that at any point, only one
  *    SaiObject manages a given SAI object. (N.B., there is no general hard
  *    guarantee for this property -- a user could load the same SaiObject more
  *    than once).
- * In all three cases, (excepting the unlikely event of moving from a non-live
+ * In all four cases, (excepting the unlikely event of moving from a non-live
  * SaiObject), the newly constructed SaiObject is live and stores the
  * appropriate values of AdapterHostKey, AdapterKey, and CreateAttributes.
  *
@@ -234,6 +236,17 @@ class SaiObject {
     live_ = true;
   }
 
+  // Take over an object already created in the adapter by a bulk create
+  SaiObject(
+      const typename SaiObjectTraits::AdapterKey& adapterKey,
+      const typename SaiObjectTraits::AdapterHostKey& adapterHostKey,
+      const typename SaiObjectTraits::CreateAttributes& attributes)
+      : adapterKey_(adapterKey),
+        adapterHostKey_(adapterHostKey),
+        attributes_(attributes) {
+    live_ = true;
+  }
+
  public:
   // Forbid copy construction and copy assignment
   SaiObject(const SaiObject& other) = delete;
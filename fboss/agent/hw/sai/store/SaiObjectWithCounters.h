@@ -36,6 +36,13 @@ class SaiObjectWithCounters : public SaiObject<SaiObjectTraits> {
       sai_object_id_t switchId)
       : SaiObject<SaiObjectTraits>(adapterHostKey, attributes, switchId) {}
 
+  // Take over an object already created in the adapter by a bulk create
+  SaiObjectWithCounters(
+      const typename SaiObjectTraits::AdapterKey& adapterKey,
+      const typename SaiObjectTraits::AdapterHostKey& adapterHostKey,
+      const typename SaiObjectTraits::CreateAttributes& attributes)
+      : SaiObject<SaiObjectTraits>(adapterKey, adapterHostKey, attributes) {}
+
   using StatsMap = folly::F14FastMap<sai_stat_id_t, uint64_t>;
 
   template <typename T = SaiObjectTraits>
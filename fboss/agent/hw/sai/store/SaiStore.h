@@ -11,6 +11,7 @@
 
 #include "fboss/agent/hw/sai/api/AdapterKeySerializers.h"
 #include "fboss/agent/hw/sai/api/LoggingUtil.h"
+#include "fboss/agent/hw/sai/api/SaiApiError.h"
 #include "fboss/agent/hw/sai/api/SaiApiTable.h"
 #include "fboss/agent/hw/sai/api/SaiObjectApi.h"
 #include "fboss/agent/hw/sai/api/Traits.h"
@@ -22,9 +23,11 @@
 
 #include <folly/dynamic.h>
 
+#include <exception>
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <vector>
 #include <type_traits>
 
 extern "C" {
@@ -197,6 +200,130 @@ class SaiObjectStore {
     return object;
   }
 
+  /*
+   * Program a batch of objects, with the same result as calling setObject
+   * for each of them, but in a handful of bulk SAI calls: one per changed
+   * attribute type for objects which already exist and a single create for
+   * the others. If the adapter fails to create any object, SaiApiError is
+   * thrown for the first such failure, and as their references are dropped,
+   * the objects created in the same batch are removed again. Objects which
+   * already exist keep the attributes the adapter did set, even should it
+   * fail to set others.
+   */
+  std::vector<std::shared_ptr<ObjectType>> bulkSetObjects(
+      const std::vector<typename SaiObjectTraits::AdapterHostKey>&
+          adapterHostKeys,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          attributes,
+      bool notify = true) {
+    if constexpr (IsObjectPublisher<SaiObjectTraits>::value) {
+      static_assert(
+          !IsPublisherKeyCustomType<SaiObjectTraits>::value,
+          "method not available for objects with publisher attributes of custom types");
+    }
+    CHECK_EQ(adapterHostKeys.size(), attributes.size());
+    XLOGF(
+        DBG5,
+        "SaiStore bulk setting {} {} objects",
+        adapterHostKeys.size(),
+        objectTypeName());
+    std::vector<std::shared_ptr<ObjectType>> objects(adapterHostKeys.size());
+    std::vector<size_t> toUpdate;
+    std::vector<size_t> toCreate;
+    for (size_t i = 0; i < adapterHostKeys.size(); ++i) {
+      objects[i] = objects_.ref(adapterHostKeys[i]);
+      if (objects[i]) {
+        toUpdate.push_back(i);
+      } else {
+        toCreate.push_back(i);
+      }
+    }
+    bulkUpdate(toUpdate, attributes, objects);
+    bulkCreate(toCreate, adapterHostKeys, attributes, &objects);
+
+    if constexpr (IsObjectPublisher<SaiObjectTraits>::value) {
+      if (notify) {
+        for (auto i : toCreate) {
+          objects[i]->notifyAfterCreate(objects[i]);
+        }
+      }
+    }
+    for (auto i : toUpdate) {
+      auto iter = warmBootHandles_.find(adapterHostKeys[i]);
+      if (iter == warmBootHandles_.end()) {
+        continue;
+      }
+      warmBootHandles_.erase(iter);
+      if constexpr (IsObjectPublisher<SaiObjectTraits>::value) {
+        if (notify) {
+          objects[i]->notifyAfterCreate(objects[i]);
+        }
+      }
+    }
+    return objects;
+  }
+
+  /*
+   * Remove a batch of objects from the adapter with a single bulk SAI call.
+   *
+   * Only objects to which the caller holds the last reference are removed,
+   * any other object stays programmed for its remaining owners, just as if
+   * the caller had dropped its references one at a time. Either way, the
+   * reference in objects is reset. Objects the adapter fails to remove are
+   * left in objects, still programmed, after which SaiApiError is thrown for
+   * the first such failure.
+   */
+  void bulkRemove(std::vector<std::shared_ptr<ObjectType>>* objects) {
+    static_assert(
+        !IsSaiObjectOwnedByAdapter<SaiObjectTraits>::value,
+        "objects owned by the adapter can not be removed");
+    std::vector<size_t> toRemove;
+    std::vector<typename SaiObjectTraits::AdapterKey> adapterKeys;
+    for (size_t i = 0; i < objects->size(); ++i) {
+      auto& object = (*objects)[i];
+      if (object && object.use_count() == 1) {
+        if constexpr (IsObjectPublisher<SaiObjectTraits>::value) {
+          object->notifyBeforeDestroy();
+        }
+        adapterKeys.push_back(object->adapterKey());
+        toRemove.push_back(i);
+      } else {
+        object.reset();
+      }
+    }
+    XLOGF(
+        DBG5,
+        "SaiStore bulk removing {} {} objects",
+        adapterKeys.size(),
+        objectTypeName());
+
+    auto& api =
+        SaiApiTable::getInstance()->getApi<typename SaiObjectTraits::SaiApiT>();
+    auto statuses = api.bulkRemove(adapterKeys);
+    std::optional<size_t> firstFailure;
+    for (size_t j = 0; j < toRemove.size(); ++j) {
+      auto& object = (*objects)[toRemove[j]];
+      if (statuses[j] == SAI_STATUS_SUCCESS ||
+          (object->ignoreMissingInHwOnDelete_ &&
+           statuses[j] == SAI_STATUS_ITEM_NOT_FOUND)) {
+        // Gone from the adapter, so not to be removed again on release
+        object->release();
+        object.reset();
+        continue;
+      }
+      if (!firstFailure) {
+        firstFailure = j;
+      }
+    }
+    if (firstFailure) {
+      throw SaiApiError(
+          statuses[*firstFailure],
+          api.apiType(),
+          fmt::format(
+              "Failed to remove sai object : {}", adapterKeys[*firstFailure]));
+    }
+  }
+
   std::shared_ptr<ObjectType> get(
       const typename SaiObjectTraits::AdapterHostKey& adapterHostKey) {
     XLOGF(DBG5, "SaiStore get object {}", adapterHostKey);
@@ -355,6 +482,196 @@ class SaiObjectStore {
     return std::make_pair(ins.first, notify);
   }
 
+  void bulkUpdate(
+      const std::vector<size_t>& indices,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          attributes,
+      const std::vector<std::shared_ptr<ObjectType>>& objects) {
+    if (indices.empty()) {
+      return;
+    }
+    // Objects the adapter failed to set an attribute of, by index, which
+    // keep the attributes it did set, and the first such failure, thrown
+    // once every attribute type has been tried
+    std::vector<bool> failed(objects.size(), false);
+    std::exception_ptr error;
+    // Only the types of the elements of attrTypes matter
+    const typename SaiObjectTraits::CreateAttributes attrTypes{};
+    tupleForEach(
+        [&](const auto& attrType) {
+          bulkSetAttribute(
+              indices, attributes, objects, attrType, &failed, &error);
+        },
+        attrTypes);
+    for (auto i : indices) {
+      if (!failed[i]) {
+        objects[i]->attributes_ = attributes[i];
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Set the attribute of type AttrT on every object where it changed
+  template <typename AttrT>
+  void bulkSetAttribute(
+      const std::vector<size_t>& indices,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          attributes,
+      const std::vector<std::shared_ptr<ObjectType>>& objects,
+      const AttrT& /* attrType */,
+      std::vector<bool>* failed,
+      std::exception_ptr* error) {
+    std::vector<size_t> changed;
+    std::vector<typename SaiObjectTraits::AdapterKey> adapterKeys;
+    std::vector<AttrT> newAttrs;
+    for (auto i : indices) {
+      const auto& newAttr = std::get<AttrT>(attributes[i]);
+      if (std::get<AttrT>(objects[i]->attributes_) != newAttr) {
+        changed.push_back(i);
+        adapterKeys.push_back(objects[i]->adapterKey());
+        newAttrs.push_back(newAttr);
+      }
+    }
+    auto statuses = bulkSetAttributeHelper(adapterKeys, newAttrs, error);
+    for (size_t j = 0; j < statuses.size(); ++j) {
+      if (statuses[j] == SAI_STATUS_SUCCESS) {
+        std::get<AttrT>(objects[changed[j]]->attributes_) = newAttrs[j];
+      } else {
+        (*failed)[changed[j]] = true;
+      }
+    }
+  }
+
+  template <typename AttrT>
+  void bulkSetAttribute(
+      const std::vector<size_t>& indices,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          attributes,
+      const std::vector<std::shared_ptr<ObjectType>>& objects,
+      const std::optional<AttrT>& /* attrType */,
+      std::vector<bool>* failed,
+      std::exception_ptr* error) {
+    std::vector<size_t> changed;
+    std::vector<typename SaiObjectTraits::AdapterKey> adapterKeys;
+    std::vector<AttrT> newAttrs;
+    for (auto i : indices) {
+      const auto& newAttr = std::get<std::optional<AttrT>>(attributes[i]);
+      // As with SaiObject::setAttributes, unset optional attributes are
+      // left alone
+      if (newAttr &&
+          std::get<std::optional<AttrT>>(objects[i]->attributes_) !=
+              newAttr) {
+        changed.push_back(i);
+        adapterKeys.push_back(objects[i]->adapterKey());
+        newAttrs.push_back(newAttr.value());
+      }
+    }
+    auto statuses = bulkSetAttributeHelper(adapterKeys, newAttrs, error);
+    for (size_t j = 0; j < statuses.size(); ++j) {
+      if (statuses[j] == SAI_STATUS_SUCCESS) {
+        std::get<std::optional<AttrT>>(objects[changed[j]]->attributes_) =
+            newAttrs[j];
+      } else {
+        (*failed)[changed[j]] = true;
+      }
+    }
+  }
+
+  // Returns the status of each object, keeping the first failure in error
+  template <typename AttrT>
+  std::vector<sai_status_t> bulkSetAttributeHelper(
+      const std::vector<typename SaiObjectTraits::AdapterKey>& adapterKeys,
+      const std::vector<AttrT>& attrs,
+      std::exception_ptr* error) {
+    if (adapterKeys.empty()) {
+      return {};
+    }
+    auto& api =
+        SaiApiTable::getInstance()->getApi<typename SaiObjectTraits::SaiApiT>();
+    auto statuses = api.bulkSetAttribute(adapterKeys, attrs);
+    for (size_t i = 0; i < statuses.size(); ++i) {
+      if (statuses[i] != SAI_STATUS_SUCCESS && !*error) {
+        *error = std::make_exception_ptr(SaiApiError(
+            statuses[i],
+            api.apiType(),
+            fmt::format(
+                "Failed to set attribute {} to {}",
+                adapterKeys[i],
+                attrs[i])));
+      }
+    }
+    return statuses;
+  }
+
+  void bulkCreate(
+      const std::vector<size_t>& indices,
+      const std::vector<typename SaiObjectTraits::AdapterHostKey>&
+          adapterHostKeys,
+      const std::vector<typename SaiObjectTraits::CreateAttributes>&
+          attributes,
+      std::vector<std::shared_ptr<ObjectType>>* objects) {
+    if (indices.empty()) {
+      return;
+    }
+    std::vector<typename SaiObjectTraits::CreateAttributes> createAttributes;
+    createAttributes.reserve(indices.size());
+    for (auto i : indices) {
+      createAttributes.push_back(attributes[i]);
+    }
+    auto& api =
+        SaiApiTable::getInstance()->getApi<typename SaiObjectTraits::SaiApiT>();
+    std::vector<typename SaiObjectTraits::AdapterKey> adapterKeys;
+    std::vector<sai_status_t> statuses;
+    if constexpr (AdapterKeyIsEntryStruct<SaiObjectTraits>::value) {
+      static_assert(
+          std::is_same_v<
+              typename SaiObjectTraits::AdapterHostKey,
+              typename SaiObjectTraits::AdapterKey>,
+          "SAI objects which use an entry struct must have "
+          "AdapterKey == AdapterHostKey == entry struct");
+      adapterKeys.reserve(indices.size());
+      for (auto i : indices) {
+        adapterKeys.push_back(adapterHostKeys[i]);
+      }
+      statuses = api.template bulkCreate<SaiObjectTraits>(
+          adapterKeys, createAttributes);
+    } else {
+      statuses = api.template bulkCreate<SaiObjectTraits>(
+          createAttributes, switchId_.value(), &adapterKeys);
+    }
+
+    std::optional<size_t> firstFailure;
+    for (size_t j = 0; j < indices.size(); ++j) {
+      if (statuses[j] != SAI_STATUS_SUCCESS) {
+        if (!firstFailure) {
+          firstFailure = j;
+        }
+        continue;
+      }
+      auto i = indices[j];
+      (*objects)[i] = objects_
+                          .refOrInsert(
+                              adapterHostKeys[i],
+                              ObjectType(
+                                  adapterKeys[j],
+                                  adapterHostKeys[i],
+                                  createAttributes[j]),
+                              true /*force*/)
+                          .first;
+    }
+    if (firstFailure) {
+      throw SaiApiError(
+          statuses[*firstFailure],
+          api.apiType(),
+          fmt::format(
+              "Failed to create sai entity {}: {}",
+              adapterHostKeys[indices[*firstFailure]],
+              createAttributes[*firstFailure]));
+    }
+  }
+
   std::vector<typename SaiObjectTraits::AdapterKey> getAdapterKeys(
       const folly::dynamic* adapterKeysJson) const {
     return adapterKeysJson ? adapterKeysFromFollyDynamic(*adapterKeysJson)
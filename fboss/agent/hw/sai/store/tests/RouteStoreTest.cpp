@@ -15,6 +15,10 @@
 #include "fboss/agent/hw/sai/store/SaiStore.h"
 #include "fboss/agent/hw/sai/store/tests/SaiStoreTest.h"
 
+#include <folly/Format.h>
+
+#include <vector>
+
 using namespace facebook::fboss;
 
 TEST_F(SaiStoreTest, loadRoute) {
@@ -102,6 +106,67 @@ TEST_F(SaiStoreTest, routeSetToPunt) {
   */
 }
 
+TEST_F(SaiStoreTest, bulkSetAndRemoveRoutes) {
+  auto& routeApi = saiApiTable->routeApi();
+  std::shared_ptr<SaiStore> s = SaiStore::getInstance();
+  s->setSwitchId(0);
+  auto& store = s->get<SaiRouteTraits>();
+
+  std::vector<SaiRouteTraits::RouteEntry> entries;
+  std::vector<SaiRouteTraits::CreateAttributes> attributes;
+  for (auto i = 0; i < 4; ++i) {
+    folly::IPAddress ip4{folly::sformat("10.10.{}.0", i)};
+    entries.emplace_back(0, 0, folly::CIDRNetwork(ip4, 24));
+    attributes.push_back({SAI_PACKET_ACTION_FORWARD, 5, i});
+  }
+  auto routes = store.bulkSetObjects(entries, attributes);
+  ASSERT_EQ(routes.size(), entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(routes[i]->adapterKey(), entries[i]);
+    EXPECT_EQ(store.get(entries[i]), routes[i]);
+    EXPECT_EQ(
+        routeApi.getAttribute(
+            entries[i], SaiRouteTraits::Attributes::Metadata{}),
+        i);
+  }
+
+  // Update half of the routes and create a new one in the same batch
+  std::vector<SaiRouteTraits::RouteEntry> newEntries{entries[0], entries[1]};
+  std::vector<SaiRouteTraits::CreateAttributes> newAttributes{
+      {SAI_PACKET_ACTION_FORWARD, 6, 42}, {SAI_PACKET_ACTION_DROP, 0, 43}};
+  folly::CIDRNetwork dest(folly::IPAddress{"10.10.10.0"}, 24);
+  newEntries.emplace_back(0, 0, dest);
+  newAttributes.push_back({SAI_PACKET_ACTION_FORWARD, 5, 44});
+  auto newRoutes = store.bulkSetObjects(newEntries, newAttributes);
+  EXPECT_EQ(newRoutes[0], routes[0]);
+  EXPECT_EQ(newRoutes[1], routes[1]);
+  EXPECT_EQ(GET_OPT_ATTR(Route, NextHopId, routes[0]->attributes()), 6);
+  EXPECT_EQ(
+      routeApi.getAttribute(
+          entries[0], SaiRouteTraits::Attributes::NextHopId{}),
+      6);
+  EXPECT_EQ(
+      routeApi.getAttribute(
+          entries[1], SaiRouteTraits::Attributes::PacketAction{}),
+      SAI_PACKET_ACTION_DROP);
+  EXPECT_EQ(
+      routeApi.getAttribute(
+          newEntries[2], SaiRouteTraits::Attributes::Metadata{}),
+      44);
+
+  routes.insert(routes.end(), newRoutes[2]);
+  newRoutes.clear();
+  store.bulkRemove(&routes);
+  for (const auto& route : routes) {
+    EXPECT_FALSE(route);
+  }
+  for (const auto& entry : entries) {
+    EXPECT_FALSE(store.get(entry));
+  }
+  EXPECT_FALSE(store.get(newEntries[2]));
+  EXPECT_EQ(fs->routeManager.map().size(), 0);
+}
+
 TEST_F(SaiStoreTest, formatTest) {
   folly::IPAddress ip4{"10.10.10.1"};
   folly::CIDRNetwork dest(ip4, 24);
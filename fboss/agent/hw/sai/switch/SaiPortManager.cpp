@@ -548,17 +548,52 @@ const std::vector<sai_stat_id_t>& SaiPortManager::supportedStats() const {
 }
 
 void SaiPortManager::updateStats(PortID portId) {
-  auto handlesItr = handles_.find(portId);
-  if (handlesItr == handles_.end()) {
+  auto objects = getStatsObjects(portId);
+  if (!objects) {
     return;
   }
-  auto now = duration_cast<seconds>(system_clock::now().time_since_epoch());
+  readStats(*objects);
+  publishStats(portId, *objects);
+}
+
+std::optional<SaiPortManager::PortStatsObjects>
+SaiPortManager::getStatsObjects(PortID portId) const {
+  auto handlesItr = handles_.find(portId);
+  if (handlesItr == handles_.end() ||
+      portStats_.find(portId) == portStats_.end()) {
+    // We don't maintain port stats for disabled ports.
+    return std::nullopt;
+  }
   auto* handle = handlesItr->second.get();
+  PortStatsObjects objects;
+  objects.port = handle->port;
+  for (auto* queueHandle : handle->configuredQueues) {
+    objects.queues.emplace_back(
+        GET_ATTR(Queue, Index, queueHandle->queue->attributes()),
+        queueHandle->queue);
+  }
+  objects.counterIds = &supportedStats();
+  return objects;
+}
+
+void SaiPortManager::readStats(const PortStatsObjects& objects) {
+  objects.port->updateStats(*objects.counterIds, SAI_STATS_MODE_READ);
+  for (const auto& queue : objects.queues) {
+    queue.second->updateStats();
+  }
+}
+
+void SaiPortManager::publishStats(
+    PortID portId,
+    const PortStatsObjects& objects) {
+  auto handlesItr = handles_.find(portId);
   auto portStatItr = portStats_.find(portId);
-  if (portStatItr == portStats_.end()) {
-    // We don't maintain port stats for disabled ports.
+  if (handlesItr == handles_.end() || portStatItr == portStats_.end() ||
+      handlesItr->second->port != objects.port) {
+    // Port removed or recreated while its counters were read
     return;
   }
+  auto now = duration_cast<seconds>(system_clock::now().time_since_epoch());
   const auto& prevPortStats = portStatItr->second->portStats();
   HwPortStats curPortStats{prevPortStats};
   // All stats start with a unitialized (-1) value. If there are no in
@@ -569,8 +604,7 @@ void SaiPortManager::updateStats(PortID portId) {
       ? 0
       : *curPortStats.inDiscards__ref();
   curPortStats.timestamp__ref() = now.count();
-  handle->port->updateStats(supportedStats(), SAI_STATS_MODE_READ);
-  const auto& counters = handle->port->getStats();
+  const auto& counters = objects.port->getStats();
   fillHwPortStats(counters, managerTable_->debugCounterManager(), curPortStats);
   std::vector<utility::CounterPrevAndCur> toSubtractFromInDiscardsRaw = {
       {*prevPortStats.inDstNullDiscards__ref(),
@@ -579,9 +613,8 @@ void SaiPortManager::updateStats(PortID portId) {
   *curPortStats.inDiscards__ref() += utility::subtractIncrements(
       {*prevPortStats.inDiscardsRaw__ref(), *curPortStats.inDiscardsRaw__ref()},
       toSubtractFromInDiscardsRaw);
-  managerTable_->queueManager().updateStats(
-      handle->configuredQueues, curPortStats);
-  portStats_[portId]->updateStats(curPortStats, now);
+  managerTable_->queueManager().getStats(objects.queues, curPortStats);
+  portStatItr->second->updateStats(curPortStats, now);
 }
 
 std::map<PortID, HwPortStats> SaiPortManager::getPortStats() const {
@@ -103,6 +103,24 @@ class SaiPortManager {
 
   void updateStats(PortID portID);
 
+  /*
+   * Port stats may also be collected in three steps, so that the adapter
+   * reads counters without the SaiSwitch lock held:
+   *  - getStatsObjects(), under the lock, refs the objects to read
+   *  - readStats(), without the lock, reads their counters
+   *  - publishStats(), under the lock, publishes them and is where the
+   *    objects must be let go of, should the port have been removed since
+   */
+  struct PortStatsObjects {
+    std::shared_ptr<SaiPort> port;
+    // Configured queues of the port, by queue index
+    std::vector<std::pair<uint8_t, std::shared_ptr<SaiQueue>>> queues;
+    const std::vector<sai_stat_id_t>* counterIds;
+  };
+  std::optional<PortStatsObjects> getStatsObjects(PortID portID) const;
+  static void readStats(const PortStatsObjects& objects);
+  void publishStats(PortID portID, const PortStatsObjects& objects);
+
   void clearStats(PortID portID);
 
   std::optional<cfg::L2LearningMode> getL2LearningMode() const {
@@ -230,6 +230,14 @@ void SaiQueueManager::getStats(
   }
 }
 
+void SaiQueueManager::getStats(
+    const std::vector<std::pair<uint8_t, std::shared_ptr<SaiQueue>>>& queues,
+    HwPortStats& hwPortStats) const {
+  for (const auto& queue : queues) {
+    fillHwQueueStats(queue.first, queue.second->getStats(), hwPortStats);
+  }
+}
+
 QueueConfig SaiQueueManager::getQueueSettings(
     const SaiQueueHandles& queueHandles) const {
   QueueConfig queueConfig;
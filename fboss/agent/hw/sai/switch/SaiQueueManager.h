@@ -62,6 +62,10 @@ class SaiQueueManager {
       const std::vector<SaiQueueHandle*>& queues,
       HwPortStats& stats);
   void getStats(SaiQueueHandles& queueHandles, HwPortStats& hwPortStats);
+  // From the counters last read of queues, by queue index
+  void getStats(
+      const std::vector<std::pair<uint8_t, std::shared_ptr<SaiQueue>>>& queues,
+      HwPortStats& hwPortStats) const;
   QueueConfig getQueueSettings(const SaiQueueHandles& queueHandles) const;
 
  private:
@@ -21,7 +21,10 @@
 
 #include "fboss/agent/platforms/sai/SaiPlatform.h"
 
+#include <exception>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace facebook::fboss {
 
@@ -129,12 +132,11 @@ bool SaiRouteManager::validRoute(const std::shared_ptr<Route<AddrT>>& swRoute) {
 }
 
 template <typename AddrT>
-void SaiRouteManager::addOrUpdateRoute(
-    SaiRouteHandle* routeHandle,
-    RouterID routerId,
+SaiRouteTraits::CreateAttributes SaiRouteManager::routeAttributes(
+    const SaiRouteTraits::RouteEntry& entry,
     const std::shared_ptr<Route<AddrT>>& oldRoute,
-    const std::shared_ptr<Route<AddrT>>& newRoute) {
-  SaiRouteTraits::RouteEntry entry = routeEntryFromSwRoute(routerId, newRoute);
+    const std::shared_ptr<Route<AddrT>>& newRoute,
+    SaiRouteHandle::NextHopHandle* nextHopHandleOut) {
   auto fwd = newRoute->getForwardInfo();
   sai_int32_t packetAction;
   std::optional<SaiRouteTraits::CreateAttributes> attributes;
@@ -246,8 +248,21 @@ void SaiRouteManager::addOrUpdateRoute(
     attributes = SaiRouteTraits::CreateAttributes{
         packetAction, SAI_NULL_OBJECT_ID, metadata};
   }
+  *nextHopHandleOut = std::move(nextHopHandle);
+  return attributes.value();
+}
+
+template <typename AddrT>
+void SaiRouteManager::addOrUpdateRoute(
+    SaiRouteHandle* routeHandle,
+    RouterID routerId,
+    const std::shared_ptr<Route<AddrT>>& oldRoute,
+    const std::shared_ptr<Route<AddrT>>& newRoute) {
+  SaiRouteTraits::RouteEntry entry = routeEntryFromSwRoute(routerId, newRoute);
+  SaiRouteHandle::NextHopHandle nextHopHandle;
+  auto attributes = routeAttributes(entry, oldRoute, newRoute, &nextHopHandle);
   auto& store = SaiStore::getInstance()->get<SaiRouteTraits>();
-  auto route = store.setObject(entry, attributes.value());
+  auto route = store.setObject(entry, attributes);
   routeHandle->route = route;
   routeHandle->nexthopHandle_ = nextHopHandle;
 }
@@ -303,6 +318,121 @@ void SaiRouteManager::removeRoute(
   }
 }
 
+template <typename AddrT>
+void SaiRouteManager::addRoutes(
+    const std::vector<std::shared_ptr<Route<AddrT>>>& swRoutes,
+    RouterID routerId) {
+  std::vector<SaiRouteTraits::RouteEntry> entries;
+  std::vector<SaiRouteTraits::CreateAttributes> attributes;
+  std::vector<std::unique_ptr<SaiRouteHandle>> routeHandles;
+  for (const auto& swRoute : swRoutes) {
+    SaiRouteTraits::RouteEntry entry =
+        routeEntryFromSwRoute(routerId, swRoute);
+    if (handles_.find(entry) != handles_.end()) {
+      throw FbossError(
+          "Failure to add route. A route already exists to ",
+          swRoute->prefix().str());
+    }
+    if (!validRoute(swRoute)) {
+      continue;
+    }
+    auto routeHandle = std::make_unique<SaiRouteHandle>();
+    attributes.push_back(routeAttributes(
+        entry,
+        std::shared_ptr<Route<AddrT>>{},
+        swRoute,
+        &routeHandle->nexthopHandle_));
+    entries.push_back(std::move(entry));
+    routeHandles.push_back(std::move(routeHandle));
+  }
+  auto& store = SaiStore::getInstance()->get<SaiRouteTraits>();
+  auto routes = store.bulkSetObjects(entries, attributes);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    routeHandles[i]->route = std::move(routes[i]);
+    handles_.emplace(entries[i], std::move(routeHandles[i]));
+  }
+}
+
+template <typename AddrT>
+void SaiRouteManager::changeRoutes(
+    const std::vector<std::pair<
+        std::shared_ptr<Route<AddrT>>,
+        std::shared_ptr<Route<AddrT>>>>& swRoutes,
+    RouterID routerId) {
+  std::vector<SaiRouteTraits::RouteEntry> entries;
+  std::vector<SaiRouteTraits::CreateAttributes> attributes;
+  std::vector<SaiRouteHandle*> routeHandles;
+  std::vector<SaiRouteHandle::NextHopHandle> nextHopHandles;
+  for (const auto& [oldSwRoute, newSwRoute] : swRoutes) {
+    SaiRouteTraits::RouteEntry entry =
+        routeEntryFromSwRoute(routerId, newSwRoute);
+    auto itr = handles_.find(entry);
+    if (itr == handles_.end()) {
+      throw FbossError(
+          "Failure to update route. Route does not exist ",
+          newSwRoute->prefix().str());
+    }
+    if (!validRoute(newSwRoute)) {
+      continue;
+    }
+    nextHopHandles.emplace_back();
+    attributes.push_back(routeAttributes(
+        entry, oldSwRoute, newSwRoute, &nextHopHandles.back()));
+    entries.push_back(std::move(entry));
+    routeHandles.push_back(itr->second.get());
+  }
+  auto& store = SaiStore::getInstance()->get<SaiRouteTraits>();
+  auto routes = store.bulkSetObjects(entries, attributes);
+  // Old next hops are only released once routes have moved off them
+  for (size_t i = 0; i < entries.size(); ++i) {
+    routeHandles[i]->route = std::move(routes[i]);
+    routeHandles[i]->nexthopHandle_ = std::move(nextHopHandles[i]);
+  }
+}
+
+template <typename AddrT>
+void SaiRouteManager::removeRoutes(
+    const std::vector<std::shared_ptr<Route<AddrT>>>& swRoutes,
+    RouterID routerId) {
+  std::vector<SaiRouteTraits::RouteEntry> entries;
+  std::vector<std::shared_ptr<SaiRoute>> routes;
+  for (const auto& swRoute : swRoutes) {
+    SaiRouteTraits::RouteEntry entry =
+        routeEntryFromSwRoute(routerId, swRoute);
+    auto itr = handles_.find(entry);
+    if (itr == handles_.end()) {
+      throw FbossError(
+          "Failed to remove non-existent route to ", swRoute->prefix().str());
+    }
+    routes.push_back(std::move(itr->second->route));
+    entries.push_back(std::move(entry));
+  }
+  auto& store = SaiStore::getInstance()->get<SaiRouteTraits>();
+  std::exception_ptr error;
+  try {
+    store.bulkRemove(&routes);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  // Routes have to go before the next hops they point to, which are released
+  // along with their handles. Routes the adapter failed to remove are still
+  // programmed, so they keep their handles.
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto itr = handles_.find(entries[i]);
+    if (itr == handles_.end()) {
+      continue;
+    }
+    if (routes[i]) {
+      itr->second->route = std::move(routes[i]);
+    } else {
+      handles_.erase(itr);
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 SaiRouteHandle* SaiRouteManager::getRouteHandle(
     const SaiRouteTraits::RouteEntry& entry) {
   return getRouteHandleImpl(entry);
@@ -442,4 +572,29 @@ template void SaiRouteManager::removeRoute<folly::IPAddressV4>(
     const std::shared_ptr<Route<folly::IPAddressV4>>& swEntry,
     RouterID routerId);
 
+template void SaiRouteManager::addRoutes<folly::IPAddressV6>(
+    const std::vector<std::shared_ptr<Route<folly::IPAddressV6>>>& swEntries,
+    RouterID routerId);
+template void SaiRouteManager::addRoutes<folly::IPAddressV4>(
+    const std::vector<std::shared_ptr<Route<folly::IPAddressV4>>>& swEntries,
+    RouterID routerId);
+
+template void SaiRouteManager::changeRoutes<folly::IPAddressV6>(
+    const std::vector<std::pair<
+        std::shared_ptr<Route<folly::IPAddressV6>>,
+        std::shared_ptr<Route<folly::IPAddressV6>>>>& swEntries,
+    RouterID routerId);
+template void SaiRouteManager::changeRoutes<folly::IPAddressV4>(
+    const std::vector<std::pair<
+        std::shared_ptr<Route<folly::IPAddressV4>>,
+        std::shared_ptr<Route<folly::IPAddressV4>>>>& swEntries,
+    RouterID routerId);
+
+template void SaiRouteManager::removeRoutes<folly::IPAddressV6>(
+    const std::vector<std::shared_ptr<Route<folly::IPAddressV6>>>& swEntries,
+    RouterID routerId);
+template void SaiRouteManager::removeRoutes<folly::IPAddressV4>(
+    const std::vector<std::shared_ptr<Route<folly::IPAddressV4>>>& swEntries,
+    RouterID routerId);
+
 } // namespace facebook::fboss
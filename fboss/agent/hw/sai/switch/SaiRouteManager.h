@@ -22,6 +22,8 @@
 
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace facebook::fboss {
 
@@ -100,6 +102,28 @@ class SaiRouteManager {
       const std::shared_ptr<Route<AddrT>>& swRoute,
       RouterID routerId);
 
+  /*
+   * Batched variants of addRoute/changeRoute/removeRoute. All routes in the
+   * batch are programmed with a single bulk SAI call where the adapter
+   * supports it.
+   */
+  template <typename AddrT>
+  void addRoutes(
+      const std::vector<std::shared_ptr<Route<AddrT>>>& swRoutes,
+      RouterID routerId);
+
+  template <typename AddrT>
+  void changeRoutes(
+      const std::vector<std::pair<
+          std::shared_ptr<Route<AddrT>>,
+          std::shared_ptr<Route<AddrT>>>>& swRoutes,
+      RouterID routerId);
+
+  template <typename AddrT>
+  void removeRoutes(
+      const std::vector<std::shared_ptr<Route<AddrT>>>& swRoutes,
+      RouterID routerId);
+
   SaiRouteHandle* getRouteHandle(const SaiRouteTraits::RouteEntry& entry);
   const SaiRouteHandle* getRouteHandle(
       const SaiRouteTraits::RouteEntry& entry) const;
@@ -116,6 +140,13 @@ class SaiRouteManager {
       const std::shared_ptr<Route<AddrT>>& oldRoute,
       const std::shared_ptr<Route<AddrT>>& newRoute);
 
+  template <typename AddrT>
+  SaiRouteTraits::CreateAttributes routeAttributes(
+      const SaiRouteTraits::RouteEntry& entry,
+      const std::shared_ptr<Route<AddrT>>& oldRoute,
+      const std::shared_ptr<Route<AddrT>>& newRoute,
+      SaiRouteHandle::NextHopHandle* nextHopHandle);
+
   template <typename AddrT>
   bool validRoute(const std::shared_ptr<Route<AddrT>>& swRoute);
 
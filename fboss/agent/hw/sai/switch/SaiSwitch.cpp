@@ -20,6 +20,7 @@
 #include "fboss/agent/hw/sai/api/FdbApi.h"
 #include "fboss/agent/hw/sai/api/HostifApi.h"
 #include "fboss/agent/hw/sai/api/LoggingUtil.h"
+#include "fboss/agent/hw/sai/api/SaiApiLock.h"
 #include "fboss/agent/hw/sai/api/SaiApiTable.h"
 #include "fboss/agent/hw/sai/api/SaiObjectApi.h"
 #include "fboss/agent/hw/sai/api/Types.h"
@@ -56,8 +57,13 @@
 
 #include <folly/logging/xlog.h>
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 extern "C" {
 #include <sai.h>
@@ -83,6 +89,11 @@ DEFINE_bool(
     false,
     "Fail if any warm boot handles are left unclaimed.");
 
+DEFINE_int32(
+    sai_route_bulk_size,
+    1024,
+    "Max number of routes programmed with a single bulk SAI call");
+
 namespace {
 /*
  * For the devices/SDK we use, the only events we should get (and process)
@@ -485,23 +496,8 @@ std::shared_ptr<SwitchState> SaiSwitch::stateChangedImpl(
   for (const auto& routeDelta : delta.getRouteTablesDelta()) {
     auto routerID = routeDelta.getOld() ? routeDelta.getOld()->getID()
                                         : routeDelta.getNew()->getID();
-    processDelta(
-        routeDelta.getRoutesV4Delta(),
-        managerTable_->routeManager(),
-        lockPolicy,
-        &SaiRouteManager::changeRoute<folly::IPAddressV4>,
-        &SaiRouteManager::addRoute<folly::IPAddressV4>,
-        &SaiRouteManager::removeRoute<folly::IPAddressV4>,
-        routerID);
-
-    processDelta(
-        routeDelta.getRoutesV6Delta(),
-        managerTable_->routeManager(),
-        lockPolicy,
-        &SaiRouteManager::changeRoute<folly::IPAddressV6>,
-        &SaiRouteManager::addRoute<folly::IPAddressV6>,
-        &SaiRouteManager::removeRoute<folly::IPAddressV6>,
-        routerID);
+    processRoutesDelta(routeDelta.getRoutesV4Delta(), routerID, lockPolicy);
+    processRoutesDelta(routeDelta.getRoutesV6Delta(), routerID, lockPolicy);
   }
 
   {
@@ -667,11 +663,24 @@ bool SaiSwitch::sendPacketOutOfPortAsync(
 }
 
 void SaiSwitch::updateStatsImpl(SwitchStats* /* switchStats */) {
+  // Port counters, the bulk of stats, are read without saiSwitchMutex_ held,
+  // so that with adapters taking concurrent SAI calls, collecting them does
+  // not wait on state updates nor hold them up.
+  std::lock_guard<std::mutex> statsLock(statsMutex_);
+  auto& portManager = managerTable_->portManager();
   auto iter = concurrentIndices_->portIds.begin();
   while (iter != concurrentIndices_->portIds.end()) {
+    std::optional<SaiPortManager::PortStatsObjects> objects;
     {
       std::lock_guard<std::mutex> locked(saiSwitchMutex_);
-      managerTable_->portManager().updateStats(iter->second);
+      objects = portManager.getStatsObjects(iter->second);
+    }
+    if (objects) {
+      SaiPortManager::readStats(*objects);
+      std::lock_guard<std::mutex> locked(saiSwitchMutex_);
+      portManager.publishStats(iter->second, *objects);
+      // Removing the objects, were the port removed meanwhile, needs the lock
+      objects.reset();
     }
     ++iter;
   }
@@ -910,6 +919,8 @@ HwInitResult SaiSwitch::initLocked(
   std::unique_ptr<folly::dynamic> adapterKeysJson;
   std::unique_ptr<folly::dynamic> adapterKeys2AdapterHostKeysJson;
 
+  SaiApiLock::getInstance()->setConcurrency(
+      platform_->getSaiApiConcurrency());
   sai_api_initialize(0, platform_->getServiceMethodTable());
   SaiApiTable::getInstance()->queryApis();
   concurrentIndices_ = std::make_unique<ConcurrentIndices>();
@@ -919,23 +930,28 @@ HwInitResult SaiSwitch::initLocked(
   __gSaiSwitch = this;
   SaiApiTable::getInstance()->enableLogging(FLAGS_enable_sai_log);
   if (bootType_ == BootType::WARM_BOOT) {
-    auto switchStateJson = platform_->getWarmBootHelper()->getWarmBootState();
-    ret.switchState = SwitchState::fromFollyDynamic(switchStateJson[kSwSwitch]);
+    // Only load the parts of the warm boot state we use
+    auto wbHelper = platform_->getWarmBootHelper();
+    ret.switchState =
+        SwitchState::fromFollyDynamic(wbHelper->getWarmBootState(kSwSwitch));
     ret.switchState->publish();
     if (platform_->getAsic()->isSupported(HwAsic::Feature::OBJECT_KEY_CACHE)) {
-      adapterKeysJson = std::make_unique<folly::dynamic>(
-          switchStateJson[kHwSwitch][kAdapterKeys]);
+      auto adapterKeys = wbHelper->getWarmBootStateIf(kHwSwitch, kAdapterKeys);
+      CHECK(adapterKeys) << "No adapter keys in warm boot state";
+      adapterKeysJson =
+          std::make_unique<folly::dynamic>(std::move(*adapterKeys));
       const auto& switchKeysJson = (*adapterKeysJson)[saiObjectTypeToString(
           SaiSwitchTraits::ObjectType)];
       CHECK_EQ(1, switchKeysJson.size());
     }
     // adapter host keys may not be recoverable for all types of object, such
     // as next hop group.
-    if (switchStateJson[kHwSwitch].find(kAdapterKey2AdapterHostKey) !=
-        switchStateJson[kHwSwitch].items().end()) {
-      adapterKeys2AdapterHostKeysJson = std::make_unique<folly::dynamic>(
-          switchStateJson[kHwSwitch][kAdapterKey2AdapterHostKey]);
+    if (auto adapterHostKeys = wbHelper->getWarmBootStateIf(
+            kHwSwitch, kAdapterKey2AdapterHostKey)) {
+      adapterKeys2AdapterHostKeysJson =
+          std::make_unique<folly::dynamic>(std::move(*adapterHostKeys));
     }
+    wbHelper->releaseWarmBootState();
   }
   initStoreAndManagersLocked(
       lock,
@@ -1610,6 +1626,51 @@ void SaiSwitch::processRemovedDelta(
       });
 }
 
+template <typename Delta, typename LockPolicyT>
+void SaiSwitch::processRoutesDelta(
+    Delta delta,
+    RouterID routerID,
+    const LockPolicyT& lockPolicy) {
+  using RouteT = typename Delta::Node;
+  std::vector<std::shared_ptr<RouteT>> removedRoutes;
+  std::vector<std::pair<std::shared_ptr<RouteT>, std::shared_ptr<RouteT>>>
+      changedRoutes;
+  std::vector<std::shared_ptr<RouteT>> addedRoutes;
+  DeltaFunctions::forEachChanged(
+      delta,
+      [&](const std::shared_ptr<RouteT>& oldRoute,
+          const std::shared_ptr<RouteT>& newRoute) {
+        changedRoutes.emplace_back(oldRoute, newRoute);
+      },
+      [&](const std::shared_ptr<RouteT>& added) {
+        addedRoutes.push_back(added);
+      },
+      [&](const std::shared_ptr<RouteT>& removed) {
+        removedRoutes.push_back(removed);
+      });
+
+  /*
+   * Program routes in batches so that each batch is a single bulk SAI call.
+   * Removes go first to free up hardware resources for the adds.
+   */
+  auto& routeManager = managerTable_->routeManager();
+  auto processInBatches = [&](auto& routes, auto func) {
+    size_t batchSize = std::max(FLAGS_sai_route_bulk_size, 1);
+    for (size_t begin = 0; begin < routes.size(); begin += batchSize) {
+      auto end = std::min(begin + batchSize, routes.size());
+      std::remove_reference_t<decltype(routes)> batch(
+          std::make_move_iterator(routes.begin() + begin),
+          std::make_move_iterator(routes.begin() + end));
+      [[maybe_unused]] const auto& lock = lockPolicy.lock();
+      (routeManager.*func)(batch, routerID);
+    }
+  };
+  using AddrT = typename RouteT::Addr;
+  processInBatches(removedRoutes, &SaiRouteManager::removeRoutes<AddrT>);
+  processInBatches(changedRoutes, &SaiRouteManager::changeRoutes<AddrT>);
+  processInBatches(addedRoutes, &SaiRouteManager::addRoutes<AddrT>);
+}
+
 void SaiSwitch::dumpDebugState(const std::string& path) const {
   saiCheckError(sai_dbg_generate_dump(path.c_str()));
 }
@@ -350,6 +350,12 @@ class SaiSwitch : public HwSwitch {
       RemovedFunc removedFunc,
       Args... args);
 
+  template <typename Delta, typename LockPolicyT>
+  void processRoutesDelta(
+      Delta delta,
+      RouterID routerID,
+      const LockPolicyT& lockPolicy);
+
   template <typename LockPolicyT>
   void processSwitchSettingsChanged(
       const StateDelta& delta,
@@ -381,6 +387,9 @@ class SaiSwitch : public HwSwitch {
    * performance by 2000 pps.
    */
   mutable std::mutex saiSwitchMutex_;
+  // Serializes stats collection, which reads counters without
+  // saiSwitchMutex_ held
+  std::mutex statsMutex_;
   std::unique_ptr<ConcurrentIndices> concurrentIndices_;
 
   std::shared_ptr<SwitchState> getColdBootSwitchState();
@@ -9,6 +9,7 @@
  */
 
 #include "fboss/agent/hw/sai/tracer/FdbApiTracer.h"
+#include "fboss/agent/hw/sai/api/SaiVersion.h"
 #include "fboss/agent/hw/sai/tracer/Utils.h"
 
 namespace facebook::fboss {
@@ -51,6 +52,66 @@ sai_status_t wrap_get_fdb_entry_attribute(
       fdb_entry, attr_count, attr_list);
 }
 
+#if SAI_API_VERSION >= SAI_VERSION(1, 7, 0)
+// Bulk calls are logged as a call per fdb entry, objects the adapter did not
+// get to are left out
+sai_status_t wrap_create_fdb_entries(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->fdbApi_->create_fdb_entries(
+      object_count, fdb_entry, attr_count, attr_list, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logFdbEntryCreateFn(
+          &fdb_entry[i], attr_count[i], attr_list[i], status);
+    }
+  }
+  return rv;
+}
+
+sai_status_t wrap_remove_fdb_entries(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->fdbApi_->remove_fdb_entries(
+      object_count, fdb_entry, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logFdbEntryRemoveFn(&fdb_entry[i], status);
+    }
+  }
+  return rv;
+}
+
+sai_status_t wrap_set_fdb_entries_attribute(
+    uint32_t object_count,
+    const sai_fdb_entry_t* fdb_entry,
+    const sai_attribute_t* attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->fdbApi_->set_fdb_entries_attribute(
+      object_count, fdb_entry, attr_list, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logFdbEntrySetAttrFn(
+          &fdb_entry[i], &attr_list[i], status);
+    }
+  }
+  return rv;
+}
+#endif
+
 sai_fdb_api_t* wrappedFdbApi() {
   static sai_fdb_api_t fdbWrappers;
 
@@ -59,6 +120,19 @@ sai_fdb_api_t* wrappedFdbApi() {
   fdbWrappers.set_fdb_entry_attribute = &wrap_set_fdb_entry_attribute;
   fdbWrappers.get_fdb_entry_attribute = &wrap_get_fdb_entry_attribute;
 
+#if SAI_API_VERSION >= SAI_VERSION(1, 7, 0)
+  // Bulk functions are only wrapped if the adapter has them, FdbApi falls
+  // back to calls per fdb entry otherwise
+  auto fdbApi = SaiTracer::getInstance()->fdbApi_;
+  fdbWrappers.create_fdb_entries =
+      fdbApi->create_fdb_entries ? &wrap_create_fdb_entries : nullptr;
+  fdbWrappers.remove_fdb_entries =
+      fdbApi->remove_fdb_entries ? &wrap_remove_fdb_entries : nullptr;
+  fdbWrappers.set_fdb_entries_attribute =
+      fdbApi->set_fdb_entries_attribute ? &wrap_set_fdb_entries_attribute
+                                        : nullptr;
+#endif
+
   return &fdbWrappers;
 }
 
@@ -52,6 +52,64 @@ sai_status_t wrap_get_route_entry_attribute(
       route_entry, attr_count, attr_list);
 }
 
+// Bulk calls are logged as a call per route entry, objects the adapter did
+// not get to are left out
+sai_status_t wrap_create_route_entries(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    const uint32_t* attr_count,
+    const sai_attribute_t** attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->routeApi_->create_route_entries(
+      object_count, route_entry, attr_count, attr_list, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logRouteEntryCreateFn(
+          &route_entry[i], attr_count[i], attr_list[i], status);
+    }
+  }
+  return rv;
+}
+
+sai_status_t wrap_remove_route_entries(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->routeApi_->remove_route_entries(
+      object_count, route_entry, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logRouteEntryRemoveFn(&route_entry[i], status);
+    }
+  }
+  return rv;
+}
+
+sai_status_t wrap_set_route_entries_attribute(
+    uint32_t object_count,
+    const sai_route_entry_t* route_entry,
+    const sai_attribute_t* attr_list,
+    sai_bulk_op_error_mode_t mode,
+    sai_status_t* object_statuses) {
+  auto rv = SaiTracer::getInstance()->routeApi_->set_route_entries_attribute(
+      object_count, route_entry, attr_list, mode, object_statuses);
+
+  for (uint32_t i = 0; i < object_count; ++i) {
+    auto status = bulkObjectStatus(rv, object_statuses, i);
+    if (status != SAI_STATUS_NOT_EXECUTED) {
+      SaiTracer::getInstance()->logRouteEntrySetAttrFn(
+          &route_entry[i], &attr_list[i], status);
+    }
+  }
+  return rv;
+}
+
 sai_route_api_t* wrappedRouteApi() {
   static sai_route_api_t routeWrappers;
 
@@ -60,6 +118,17 @@ sai_route_api_t* wrappedRouteApi() {
   routeWrappers.set_route_entry_attribute = &wrap_set_route_entry_attribute;
   routeWrappers.get_route_entry_attribute = &wrap_get_route_entry_attribute;
 
+  // Bulk functions are only wrapped if the adapter has them, RouteApi falls
+  // back to calls per route entry otherwise
+  auto routeApi = SaiTracer::getInstance()->routeApi_;
+  routeWrappers.create_route_entries =
+      routeApi->create_route_entries ? &wrap_create_route_entries : nullptr;
+  routeWrappers.remove_route_entries =
+      routeApi->remove_route_entries ? &wrap_remove_route_entries : nullptr;
+  routeWrappers.set_route_entries_attribute =
+      routeApi->set_route_entries_attribute ? &wrap_set_route_entries_attribute
+                                            : nullptr;
+
   return &routeWrappers;
 }
 
@@ -0,0 +1,561 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/hw/sai/tracer/SaiBinaryTrace.h"
+
+#include <unistd.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <map>
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/SysError.h"
+
+#include <folly/Bits.h>
+#include <folly/FileUtil.h>
+#include <folly/String.h>
+#include <folly/MapUtil.h>
+#include <folly/logging/xlog.h>
+
+namespace {
+
+using facebook::fboss::SaiTraceListType;
+
+// Smallest ring, so that any record of a sane number of attributes fits
+constexpr uint64_t kMinRingSize = 1 << 20;
+// Set in the commit word of the entries padding the end of the ring
+constexpr uint64_t kPaddingEntry = 1ULL << 63;
+
+constexpr uint64_t alignUp(uint64_t size) {
+  return (size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+}
+
+// All sai_*_list_t are a count followed by a pointer to their elements
+struct SaiList {
+  uint32_t count;
+  void* list;
+};
+
+static_assert(
+    sizeof(SaiList) == sizeof(sai_object_list_t) &&
+        offsetof(SaiList, list) == offsetof(sai_object_list_t, list),
+    "Unexpected layout of SAI lists");
+
+SaiList* listOf(sai_attribute_t* attr, SaiTraceListType listType) {
+  if (listType == SaiTraceListType::ACL_ACTION_OBJECT_ID) {
+    return reinterpret_cast<SaiList*>(&attr->value.aclaction.parameter.objlist);
+  }
+  return reinterpret_cast<SaiList*>(&attr->value.objlist);
+}
+
+const SaiList* listOf(const sai_attribute_t* attr, SaiTraceListType listType) {
+  return listOf(const_cast<sai_attribute_t*>(attr), listType);
+}
+
+size_t listElementSize(SaiTraceListType listType) {
+  switch (listType) {
+    case SaiTraceListType::S8:
+      return sizeof(sai_int8_t);
+    case SaiTraceListType::S32:
+      return sizeof(sai_int32_t);
+    case SaiTraceListType::U32:
+      return sizeof(sai_uint32_t);
+    case SaiTraceListType::OBJECT_ID:
+    case SaiTraceListType::ACL_ACTION_OBJECT_ID:
+      return sizeof(sai_object_id_t);
+    case SaiTraceListType::QOS_MAP:
+      return sizeof(sai_qos_map_t);
+    case SaiTraceListType::NONE:
+      break;
+  }
+  return 0;
+}
+
+// Bytes the contents of the list attributes take in a record's payload
+uint64_t listPayloadSize(
+    sai_object_type_t objectType,
+    uint32_t attrCount,
+    const sai_attribute_t* attrList) {
+  uint64_t payloadSize = 0;
+  for (uint32_t i = 0; i < attrCount; ++i) {
+    auto listType =
+        facebook::fboss::saiTraceListType(objectType, attrList[i].id);
+    if (listType == SaiTraceListType::NONE) {
+      continue;
+    }
+    auto list = listOf(&attrList[i], listType);
+    if (list->list) {
+      payloadSize += alignUp(list->count * listElementSize(listType));
+    }
+  }
+  return payloadSize;
+}
+
+} // namespace
+
+namespace facebook::fboss {
+
+SaiTraceListType saiTraceListType(
+    sai_object_type_t objectType,
+    sai_attr_id_t attrId) {
+  switch (objectType) {
+    case SAI_OBJECT_TYPE_ACL_ENTRY:
+      switch (attrId) {
+        case SAI_ACL_ENTRY_ATTR_ACTION_MIRROR_INGRESS:
+        case SAI_ACL_ENTRY_ATTR_ACTION_MIRROR_EGRESS:
+          return SaiTraceListType::ACL_ACTION_OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_ACL_TABLE:
+      switch (attrId) {
+        case SAI_ACL_TABLE_ATTR_ACL_BIND_POINT_TYPE_LIST:
+        case SAI_ACL_TABLE_ATTR_ACL_ACTION_TYPE_LIST:
+          return SaiTraceListType::S32;
+        case SAI_ACL_TABLE_ATTR_ENTRY_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_ACL_TABLE_GROUP:
+      switch (attrId) {
+        case SAI_ACL_TABLE_GROUP_ATTR_ACL_BIND_POINT_TYPE_LIST:
+          return SaiTraceListType::S32;
+        case SAI_ACL_TABLE_GROUP_ATTR_MEMBER_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_BRIDGE:
+      switch (attrId) {
+        case SAI_BRIDGE_ATTR_PORT_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_HASH:
+      switch (attrId) {
+        case SAI_HASH_ATTR_NATIVE_HASH_FIELD_LIST:
+          return SaiTraceListType::S32;
+        case SAI_HASH_ATTR_UDF_GROUP_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_NEXT_HOP:
+      switch (attrId) {
+        case SAI_NEXT_HOP_ATTR_LABELSTACK:
+          return SaiTraceListType::U32;
+      }
+      break;
+    case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:
+      switch (attrId) {
+        case SAI_NEXT_HOP_GROUP_ATTR_NEXT_HOP_MEMBER_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_PORT:
+      switch (attrId) {
+        case SAI_PORT_ATTR_HW_LANE_LIST:
+        case SAI_PORT_ATTR_SERDES_PREEMPHASIS:
+          return SaiTraceListType::U32;
+        case SAI_PORT_ATTR_QOS_QUEUE_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    case SAI_OBJECT_TYPE_PORT_SERDES:
+      switch (attrId) {
+        case SAI_PORT_SERDES_ATTR_IDRIVER:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_PRE1:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_PRE2:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_MAIN:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_POST1:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_POST2:
+        case SAI_PORT_SERDES_ATTR_TX_FIR_POST3:
+          return SaiTraceListType::U32;
+      }
+      break;
+    case SAI_OBJECT_TYPE_QOS_MAP:
+      switch (attrId) {
+        case SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST:
+          return SaiTraceListType::QOS_MAP;
+      }
+      break;
+    case SAI_OBJECT_TYPE_SWITCH:
+      switch (attrId) {
+        case SAI_SWITCH_ATTR_PORT_LIST:
+        case SAI_SWITCH_ATTR_TAM_OBJECT_ID:
+          return SaiTraceListType::OBJECT_ID;
+        case SAI_SWITCH_ATTR_SWITCH_HARDWARE_INFO:
+          return SaiTraceListType::S8;
+      }
+      break;
+    case SAI_OBJECT_TYPE_VLAN:
+      switch (attrId) {
+        case SAI_VLAN_ATTR_MEMBER_LIST:
+          return SaiTraceListType::OBJECT_ID;
+      }
+      break;
+    default:
+      break;
+  }
+  return SaiTraceListType::NONE;
+}
+
+std::string saiTraceObjectName(sai_object_type_t objectType) {
+  static const std::map<sai_object_type_t, std::string> kObjectNames{
+      {SAI_OBJECT_TYPE_ACL_ENTRY, "acl_entry"},
+      {SAI_OBJECT_TYPE_ACL_TABLE, "acl_table"},
+      {SAI_OBJECT_TYPE_ACL_TABLE_GROUP, "acl_table_group"},
+      {SAI_OBJECT_TYPE_ACL_TABLE_GROUP_MEMBER, "acl_table_group_member"},
+      {SAI_OBJECT_TYPE_BRIDGE, "bridge"},
+      {SAI_OBJECT_TYPE_BRIDGE_PORT, "bridge_port"},
+      {SAI_OBJECT_TYPE_BUFFER_POOL, "buffer_pool"},
+      {SAI_OBJECT_TYPE_BUFFER_PROFILE, "buffer_profile"},
+      {SAI_OBJECT_TYPE_FDB_ENTRY, "fdb_entry"},
+      {SAI_OBJECT_TYPE_HASH, "hash"},
+      {SAI_OBJECT_TYPE_HOSTIF_TRAP, "hostif_trap"},
+      {SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP, "hostif_trap_group"},
+      {SAI_OBJECT_TYPE_INSEG_ENTRY, "inseg_entry"},
+      {SAI_OBJECT_TYPE_MIRROR_SESSION, "mirror_session"},
+      {SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, "neighbor_entry"},
+      {SAI_OBJECT_TYPE_NEXT_HOP, "next_hop"},
+      {SAI_OBJECT_TYPE_NEXT_HOP_GROUP, "next_hop_group"},
+      {SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, "next_hop_group_member"},
+      {SAI_OBJECT_TYPE_PORT, "port"},
+      {SAI_OBJECT_TYPE_PORT_SERDES, "port_serdes"},
+      {SAI_OBJECT_TYPE_QOS_MAP, "qos_map"},
+      {SAI_OBJECT_TYPE_QUEUE, "queue"},
+      {SAI_OBJECT_TYPE_ROUTE_ENTRY, "route_entry"},
+      {SAI_OBJECT_TYPE_ROUTER_INTERFACE, "router_interface"},
+      {SAI_OBJECT_TYPE_SAMPLEPACKET, "samplepacket"},
+      {SAI_OBJECT_TYPE_SCHEDULER, "scheduler"},
+      {SAI_OBJECT_TYPE_SWITCH, "switch"},
+      {SAI_OBJECT_TYPE_TAM_REPORT, "tam_report"},
+      {SAI_OBJECT_TYPE_TAM_EVENT_ACTION, "tam_event_action"},
+      {SAI_OBJECT_TYPE_TAM_EVENT, "tam_event"},
+      {SAI_OBJECT_TYPE_TAM, "tam"},
+      {SAI_OBJECT_TYPE_VIRTUAL_ROUTER, "virtual_router"},
+      {SAI_OBJECT_TYPE_VLAN, "vlan"},
+      {SAI_OBJECT_TYPE_VLAN_MEMBER, "vlan_member"}};
+  return folly::get_or_throw(
+      kObjectNames, objectType, "Unsupported Sai Object type in Sai Tracer");
+}
+
+SaiTraceRecorder::SaiTraceRecorder(
+    const std::string& filePath,
+    uint32_t flushTimeoutMsecs,
+    uint64_t bufferSize)
+    : ringSize_(folly::nextPowTwo(std::max(bufferSize, kMinRingSize))),
+      file_(filePath, O_WRONLY | O_CREAT | O_TRUNC),
+      flushTimeout_(flushTimeoutMsecs) {
+  // Zeroed, as the flush thread leaves the ring once it is done with it
+  ring_ = std::make_unique<uint64_t[]>(ringSize_ / sizeof(uint64_t));
+
+  SaiTraceFileHeader fileHeader{
+      kSaiTraceMagic, kSaiTraceVersion, sizeof(sai_attribute_t)};
+  if (folly::writeFull(file_.fd(), &fileHeader, sizeof(fileHeader)) < 0) {
+    throw SysError(errno, "error writing SAI trace header to ", filePath);
+  }
+  flushThread_ = std::thread(&SaiTraceRecorder::flushThread, this);
+}
+
+SaiTraceRecorder::~SaiTraceRecorder() {
+  running_ = false;
+  wakeFlushThread();
+  flushThread_.join();
+  fsync(file_.fd());
+}
+
+void SaiTraceRecorder::recordApiInitialize(
+    const char** variables,
+    const char** values,
+    int size) {
+  std::string profile;
+  for (int i = 0; i < size; ++i) {
+    profile.append(variables[i]).push_back('\0');
+    profile.append(values[i]).push_back('\0');
+  }
+  record(
+      SaiTraceOp::API_INITIALIZE,
+      SAI_OBJECT_TYPE_NULL,
+      SAI_STATUS_SUCCESS,
+      SAI_NULL_OBJECT_ID,
+      SAI_NULL_OBJECT_ID,
+      profile.data(),
+      profile.size(),
+      0,
+      nullptr);
+}
+
+void SaiTraceRecorder::recordApiQuery(
+    sai_api_t apiId,
+    const std::string& apiVar) {
+  record(
+      SaiTraceOp::API_QUERY,
+      static_cast<sai_object_type_t>(apiId),
+      SAI_STATUS_SUCCESS,
+      SAI_NULL_OBJECT_ID,
+      SAI_NULL_OBJECT_ID,
+      apiVar.data(),
+      apiVar.size(),
+      0,
+      nullptr);
+}
+
+void SaiTraceRecorder::record(
+    SaiTraceOp op,
+    sai_object_type_t objectType,
+    sai_status_t rv,
+    sai_object_id_t objectId,
+    sai_object_id_t switchId,
+    const void* key,
+    uint32_t keySize,
+    uint32_t attrCount,
+    const sai_attribute_t* attrList) {
+  auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::system_clock::now().time_since_epoch());
+  auto attrsSize = attrCount * sizeof(sai_attribute_t);
+  auto payloadSize = listPayloadSize(objectType, attrCount, attrList);
+  uint64_t recordSize =
+      sizeof(SaiTraceRecordHeader) + alignUp(keySize) + attrsSize + payloadSize;
+  if (recordSize > ringSize_ / 2) {
+    XLOG(ERR) << "Dropping SAI trace record of " << recordSize
+              << " bytes, more than half of the " << ringSize_
+              << " bytes of trace buffer";
+    return;
+  }
+
+  append(recordSize, [&](uint8_t* out) {
+    auto header = reinterpret_cast<SaiTraceRecordHeader*>(out);
+    header->size = recordSize;
+    header->op = op;
+    header->objectType = objectType;
+    header->rv = rv;
+    header->attrCount = attrCount;
+    header->keySize = keySize;
+    header->payloadSize = payloadSize;
+    header->timestampUsecs = timestamp.count();
+    header->objectId = objectId;
+    header->switchId = switchId;
+    out += sizeof(SaiTraceRecordHeader);
+
+    if (keySize) {
+      memcpy(out, key, keySize);
+    }
+    out += alignUp(keySize);
+
+    if (attrsSize == 0) {
+      return;
+    }
+    auto attrs = reinterpret_cast<sai_attribute_t*>(out);
+    memcpy(attrs, attrList, attrsSize);
+    auto payload = out + attrsSize;
+    uint64_t payloadOffset = 0;
+    for (uint32_t i = 0; i < attrCount; ++i) {
+      auto listType = saiTraceListType(objectType, attrs[i].id);
+      if (listType == SaiTraceListType::NONE) {
+        continue;
+      }
+      auto list = listOf(&attrs[i], listType);
+      if (!list->list) {
+        continue;
+      }
+      auto listSize = list->count * listElementSize(listType);
+      memcpy(payload + payloadOffset, list->list, listSize);
+      list->list = reinterpret_cast<void*>(payloadOffset + 1);
+      payloadOffset += alignUp(listSize);
+    }
+  });
+}
+
+template <typename FillFn>
+void SaiTraceRecorder::append(uint32_t recordSize, FillFn&& fill) {
+  uint64_t entrySize = sizeof(uint64_t) + recordSize;
+  uint64_t head = head_.load(std::memory_order_relaxed);
+  uint64_t offset;
+  uint64_t padding;
+  // Reserve the entry, lock free: threads only contend on head_
+  while (true) {
+    offset = head & (ringSize_ - 1);
+    // Entries are contiguous, so skip the end of the ring if too short
+    padding = offset + entrySize > ringSize_ ? ringSize_ - offset : 0;
+    auto used =
+        head + padding + entrySize - tail_.load(std::memory_order_acquire);
+    if (used > ringSize_) {
+      // Full, wait for the flush thread to make room
+      wakeFlushThread();
+      std::this_thread::yield();
+      head = head_.load(std::memory_order_relaxed);
+      continue;
+    }
+    if (head_.compare_exchange_weak(
+            head, head + padding + entrySize, std::memory_order_relaxed)) {
+      if (used > ringSize_ / 2) {
+        wakeFlushThread();
+      }
+      break;
+    }
+  }
+
+  if (padding) {
+    commitWord(offset)->store(
+        padding | kPaddingEntry, std::memory_order_release);
+    offset = 0;
+  }
+  fill(reinterpret_cast<uint8_t*>(ring_.get()) + offset + sizeof(uint64_t));
+  commitWord(offset)->store(entrySize, std::memory_order_release);
+}
+
+std::atomic<uint64_t>* SaiTraceRecorder::commitWord(uint64_t offset) {
+  return reinterpret_cast<std::atomic<uint64_t>*>(
+      ring_.get() + offset / sizeof(uint64_t));
+}
+
+void SaiTraceRecorder::wakeFlushThread() {
+  if (!wakeUp_.exchange(true)) {
+    // Notify under the lock, lest the flush thread miss the wake up in
+    // between checking wakeUp_ and waiting
+    std::lock_guard<std::mutex> lock(flushMutex_);
+    flushCv_.notify_one();
+  }
+}
+
+void SaiTraceRecorder::flushThread() {
+  while (running_) {
+    {
+      std::unique_lock<std::mutex> lock(flushMutex_);
+      flushCv_.wait_for(lock, flushTimeout_, [this] {
+        return wakeUp_.load() || !running_.load();
+      });
+    }
+    wakeUp_ = false;
+    flush();
+  }
+  // Callers are done with the recorder: write out what is left
+  while (flush() > 0) {
+  }
+}
+
+size_t SaiTraceRecorder::flush() {
+  auto ring = reinterpret_cast<uint8_t*>(ring_.get());
+  auto tail = tail_.load(std::memory_order_relaxed);
+  flushBuffer_.clear();
+  // Entries are flushed in order, up to the first one not yet committed
+  while (flushBuffer_.size() < ringSize_) {
+    auto offset = tail & (ringSize_ - 1);
+    auto word = commitWord(offset)->load(std::memory_order_acquire);
+    if (!word) {
+      break;
+    }
+    auto entrySize = word & ~kPaddingEntry;
+    auto record = ring + offset + sizeof(uint64_t);
+    if (!(word & kPaddingEntry)) {
+      flushBuffer_.append(
+          reinterpret_cast<const char*>(record),
+          entrySize - sizeof(uint64_t));
+    }
+    // Entries reserved next expect a zeroed ring, commit words included
+    commitWord(offset)->store(0, std::memory_order_relaxed);
+    memset(record, 0, entrySize - sizeof(uint64_t));
+    tail += entrySize;
+    tail_.store(tail, std::memory_order_release);
+  }
+
+  if (!flushBuffer_.empty() &&
+      folly::writeFull(file_.fd(), flushBuffer_.data(), flushBuffer_.size()) <
+          0) {
+    // Nobody to throw to on the flush thread: drop the records and keep
+    // going, callers must not stall on a full ring because of the file
+    auto error = errno;
+    failedBytes_ += flushBuffer_.size();
+    XLOG_EVERY_MS(ERR, 10000)
+        << "error writing " << flushBuffer_.size()
+        << " bytes to SAI trace: " << folly::errnoStr(error)
+        << ", failed to write " << failedBytes_ << " bytes so far";
+  }
+  return flushBuffer_.size();
+}
+
+SaiTraceReader::SaiTraceReader(const std::string& filePath) {
+  std::string contents;
+  if (!folly::readFile(filePath.c_str(), contents)) {
+    throw FbossError("Failed to read SAI trace ", filePath);
+  }
+  // Copy into 8 byte words, for the records to be aligned
+  size_ = contents.size();
+  buffer_.resize(alignUp(size_) / sizeof(uint64_t));
+  memcpy(buffer_.data(), contents.data(), size_);
+
+  if (size_ < sizeof(SaiTraceFileHeader)) {
+    throw FbossError(filePath, " is not a SAI trace");
+  }
+  auto fileHeader = reinterpret_cast<const SaiTraceFileHeader*>(buffer_.data());
+  if (fileHeader->magic != kSaiTraceMagic) {
+    throw FbossError(filePath, " is not a SAI trace");
+  }
+  if (fileHeader->version != kSaiTraceVersion) {
+    throw FbossError(
+        "Unsupported version ",
+        fileHeader->version,
+        " of SAI trace ",
+        filePath,
+        ", expected ",
+        kSaiTraceVersion);
+  }
+  if (fileHeader->attributeSize != sizeof(sai_attribute_t)) {
+    throw FbossError(
+        "SAI trace ",
+        filePath,
+        " was recorded with another SAI version: attributes of ",
+        fileHeader->attributeSize,
+        " bytes instead of ",
+        sizeof(sai_attribute_t));
+  }
+  offset_ = sizeof(SaiTraceFileHeader);
+}
+
+std::optional<SaiTraceReader::Record> SaiTraceReader::next() {
+  if (offset_ >= size_) {
+    return std::nullopt;
+  }
+  auto data = reinterpret_cast<uint8_t*>(buffer_.data()) + offset_;
+  auto header = reinterpret_cast<const SaiTraceRecordHeader*>(data);
+  if (size_ - offset_ < sizeof(SaiTraceRecordHeader) ||
+      header->size > size_ - offset_ ||
+      header->size != sizeof(SaiTraceRecordHeader) +
+              alignUp(header->keySize) +
+              header->attrCount * sizeof(sai_attribute_t) +
+              header->payloadSize) {
+    throw FbossError("Truncated or corrupt SAI trace record at ", offset_);
+  }
+
+  auto key = data + sizeof(SaiTraceRecordHeader);
+  auto attrList = reinterpret_cast<sai_attribute_t*>(
+      key + alignUp(header->keySize));
+  auto payload = reinterpret_cast<uint8_t*>(attrList + header->attrCount);
+  auto objectType = static_cast<sai_object_type_t>(header->objectType);
+  for (uint32_t i = 0; i < header->attrCount; ++i) {
+    auto listType = saiTraceListType(objectType, attrList[i].id);
+    if (listType == SaiTraceListType::NONE) {
+      continue;
+    }
+    auto list = listOf(&attrList[i], listType);
+    if (!list->list) {
+      continue;
+    }
+    auto listOffset = reinterpret_cast<uintptr_t>(list->list) - 1;
+    if (listOffset + list->count * listElementSize(listType) >
+        header->payloadSize) {
+      throw FbossError("Corrupt list in SAI trace record at ", offset_);
+    }
+    list->list = payload + listOffset;
+  }
+
+  offset_ += header->size;
+  return Record{header, key, attrList};
+}
+
+} // namespace facebook::fboss
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <folly/File.h>
+
+extern "C" {
+#include <sai.h>
+}
+
+namespace facebook::fboss {
+
+/*
+ * Compact binary trace of SAI calls, recorded by SaiTracer with
+ * --sai_binary_log instead of generating C source. Recording a call is a few
+ * memcpys into a ring buffer, rather than formatting every attribute as text,
+ * so that tracing can stay on in production. A trace is replayed directly
+ * with sai_trace_replayer, or converted to the C source of the sai_replayer
+ * with sai_trace_converter.
+ *
+ * A trace file is a SaiTraceFileHeader followed by records, each of them:
+ *  - a SaiTraceRecordHeader
+ *  - keySize bytes of key, padded to 8 bytes: the sai_*_entry_t of entry
+ *    objects, the packet of SEND_HOSTIF_PACKET, the API variable name of
+ *    API_QUERY, or the NUL separated profile variables and values of
+ *    API_INITIALIZE
+ *  - attrCount raw sai_attribute_t, whose list pointers are replaced by the
+ *    offset of the list in the payload plus one, or 0 for NULL
+ *  - payloadSize bytes of list contents, each padded to 8 bytes
+ *
+ * Traces are native endian and are only meant to be read with the SAI
+ * headers they were recorded with.
+ */
+
+// "SAITRACE" on little endian hosts
+constexpr uint64_t kSaiTraceMagic = 0x4543415254494153ULL;
+constexpr uint32_t kSaiTraceVersion = 1;
+
+enum class SaiTraceOp : uint8_t {
+  API_INITIALIZE,
+  API_QUERY,
+  CREATE,
+  REMOVE,
+  SET_ATTRIBUTE,
+  SEND_HOSTIF_PACKET,
+};
+
+struct SaiTraceFileHeader {
+  uint64_t magic;
+  uint32_t version;
+  // sizeof(sai_attribute_t) of the recording SAI headers
+  uint32_t attributeSize;
+};
+
+struct SaiTraceRecordHeader {
+  // Of the whole record, header and padding included
+  uint32_t size;
+  SaiTraceOp op;
+  uint8_t reserved[3];
+  // sai_object_type_t, or the sai_api_t of API_QUERY
+  int32_t objectType;
+  sai_status_t rv;
+  uint32_t attrCount;
+  uint32_t keySize;
+  uint32_t payloadSize;
+  uint32_t reserved2;
+  uint64_t timestampUsecs;
+  // Object created, removed or set, or hostif a packet was sent to
+  sai_object_id_t objectId;
+  // Switch an object is created on
+  sai_object_id_t switchId;
+};
+
+static_assert(
+    sizeof(SaiTraceRecordHeader) % sizeof(uint64_t) == 0,
+    "Records must stay 8 byte aligned");
+
+// Type of the elements of list attributes, which are deep copied
+enum class SaiTraceListType {
+  NONE,
+  S8,
+  S32,
+  U32,
+  OBJECT_ID,
+  QOS_MAP,
+  // value.aclaction.parameter.objlist
+  ACL_ACTION_OBJECT_ID,
+};
+
+/*
+ * List attributes the tracer knows of, as in the set*Attributes() functions
+ * of the *ApiTracer.cpp files, which a new list attribute is added to as
+ * well. Attributes not listed are recorded as their raw value.
+ */
+SaiTraceListType saiTraceListType(
+    sai_object_type_t objectType,
+    sai_attr_id_t attrId);
+
+// e.g. "acl_entry", used to name the API functions of an object type
+std::string saiTraceObjectName(sai_object_type_t objectType);
+
+/*
+ * Records SAI calls into a lock-free ring buffer, which any thread making
+ * SAI calls appends to, and a flush thread writes out to the trace file
+ * every flushTimeout, or as soon as the ring is half full. Should the ring
+ * fill up, callers wait for the flush thread rather than drop calls, since a
+ * trace missing calls cannot be replayed. Records that cannot be written to
+ * the file are however dropped, logged and counted in failedBytes().
+ */
+class SaiTraceRecorder {
+ public:
+  SaiTraceRecorder(
+      const std::string& filePath,
+      uint32_t flushTimeoutMsecs,
+      uint64_t bufferSize);
+
+  // Stops the flush thread once it has written out all records
+  ~SaiTraceRecorder();
+
+  void recordApiInitialize(
+      const char** variables,
+      const char** values,
+      int size);
+
+  void recordApiQuery(sai_api_t apiId, const std::string& apiVar);
+
+  void record(
+      SaiTraceOp op,
+      sai_object_type_t objectType,
+      sai_status_t rv,
+      sai_object_id_t objectId,
+      sai_object_id_t switchId,
+      const void* key,
+      uint32_t keySize,
+      uint32_t attrCount,
+      const sai_attribute_t* attrList);
+
+  // Bytes of records dropped because they could not be written to the file
+  uint64_t failedBytes() const {
+    return failedBytes_;
+  }
+
+ private:
+  // Forbidden copy constructor and assignment operator
+  SaiTraceRecorder(SaiTraceRecorder const&) = delete;
+  SaiTraceRecorder& operator=(SaiTraceRecorder const&) = delete;
+
+  template <typename FillFn>
+  void append(uint32_t recordSize, FillFn&& fill);
+
+  std::atomic<uint64_t>* commitWord(uint64_t offset);
+  void wakeFlushThread();
+  void flushThread();
+  // Write out the committed records, returns the number of bytes written
+  size_t flush();
+
+  // Ring of entries, each a commit word followed by a record. The commit
+  // word is 0 until the record is written, then the size of the entry.
+  std::unique_ptr<uint64_t[]> ring_;
+  uint64_t ringSize_;
+  // Positions in the ring, as the number of bytes appended or flushed ever
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> tail_{0};
+
+  folly::File file_;
+  std::string flushBuffer_;
+  std::chrono::milliseconds flushTimeout_;
+  std::atomic<bool> running_{true};
+  std::atomic<bool> wakeUp_{false};
+  std::mutex flushMutex_;
+  std::condition_variable flushCv_;
+  std::atomic<uint64_t> failedBytes_{0};
+  std::thread flushThread_;
+};
+
+/*
+ * Reads back a trace, with the attributes of its records ready to pass to
+ * SAI: list pointers point at the list contents again.
+ */
+class SaiTraceReader {
+ public:
+  struct Record {
+    const SaiTraceRecordHeader* header;
+    const uint8_t* key;
+    // Mutable, so that object ids can be rewritten for replay
+    sai_attribute_t* attrList;
+
+    SaiTraceOp op() const {
+      return header->op;
+    }
+    sai_object_type_t objectType() const {
+      return static_cast<sai_object_type_t>(header->objectType);
+    }
+    std::chrono::system_clock::time_point time() const {
+      return std::chrono::system_clock::time_point(
+          std::chrono::microseconds(header->timestampUsecs));
+    }
+  };
+
+  // Throws FbossError if the file is not a trace it can read
+  explicit SaiTraceReader(const std::string& filePath);
+
+  // Next record of the trace, or none at its end
+  std::optional<Record> next();
+
+ private:
+  std::vector<uint64_t> buffer_;
+  size_t size_{0};
+  size_t offset_{0};
+};
+
+} // namespace facebook::fboss
@@ -81,6 +81,20 @@ DEFINE_int32(
     "Log timeout value in milliseconds. Logger will periodically"
     "flush logs even if the buffer is not full");
 
+DEFINE_string(
+    sai_binary_log,
+    "",
+    "File path to record SAI calls to in the compact binary trace format, "
+    "instead of generating the C source of the SAI Replayer at --sai_log. "
+    "Binary traces are replayed with sai_trace_replayer, or converted to C "
+    "source with sai_trace_converter");
+
+DEFINE_int32(
+    sai_binary_log_buffer_mb,
+    16,
+    "Size of the ring buffer SAI calls are recorded into with "
+    "--sai_binary_log, in MB");
+
 using facebook::fboss::SaiTracer;
 using folly::to;
 using std::string;
@@ -293,7 +307,12 @@ inline void printHex(std::ostringstream& outStringStream, uint8_t u8) {
 namespace facebook::fboss {
 
 SaiTracer::SaiTracer() {
-  if (FLAGS_enable_replayer) {
+  if (FLAGS_enable_replayer && !FLAGS_sai_binary_log.empty()) {
+    binaryRecorder_ = std::make_unique<SaiTraceRecorder>(
+        FLAGS_sai_binary_log,
+        FLAGS_log_timeout,
+        static_cast<uint64_t>(FLAGS_sai_binary_log_buffer_mb) << 20);
+  } else if (FLAGS_enable_replayer) {
     asyncLogger_ =
         std::make_unique<AsyncLogger>(FLAGS_sai_log, FLAGS_log_timeout);
 
@@ -306,7 +325,10 @@ SaiTracer::SaiTracer() {
 }
 
 SaiTracer::~SaiTracer() {
-  if (FLAGS_enable_replayer) {
+  if (binaryRecorder_) {
+    // Write out all the calls recorded
+    binaryRecorder_.reset();
+  } else if (FLAGS_enable_replayer) {
     writeFooter();
     asyncLogger_->forceFlush();
     asyncLogger_->stopFlushThread();
@@ -332,6 +354,11 @@ void SaiTracer::logApiInitialize(
     const char** variables,
     const char** values,
     int size) {
+  if (binaryRecorder_) {
+    binaryRecorder_->recordApiInitialize(variables, values, size);
+    return;
+  }
+
   vector<string> lines;
 
   for (int i = 0; i < size; ++i) {
@@ -367,6 +394,11 @@ void SaiTracer::logApiQuery(sai_api_t api_id, const std::string& api_var) {
 
   init_api_.emplace(api_id, api_var);
 
+  if (binaryRecorder_) {
+    binaryRecorder_->recordApiQuery(api_id, api_var);
+    return;
+  }
+
   writeToFile(
       {to<string>("sai_", api_var, "_t* ", api_var),
        to<string>(
@@ -382,6 +414,17 @@ void SaiTracer::logSwitchCreateFn(
     return;
   }
 
+  if (recordCall(
+          SaiTraceOp::CREATE,
+          SAI_OBJECT_TYPE_SWITCH,
+          *switch_id,
+          SAI_NULL_OBJECT_ID,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_SWITCH);
@@ -424,6 +467,16 @@ void SaiTracer::logRouteEntryCreateFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::CREATE,
+          SAI_OBJECT_TYPE_ROUTE_ENTRY,
+          route_entry,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_ROUTE_ENTRY);
@@ -460,6 +513,16 @@ void SaiTracer::logNeighborEntryCreateFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::CREATE,
+          SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+          neighbor_entry,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
@@ -496,6 +559,16 @@ void SaiTracer::logFdbEntryCreateFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::CREATE,
+          SAI_OBJECT_TYPE_FDB_ENTRY,
+          fdb_entry,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_FDB_ENTRY);
@@ -532,6 +605,16 @@ void SaiTracer::logInsegEntryCreateFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::CREATE,
+          SAI_OBJECT_TYPE_INSEG_ENTRY,
+          inseg_entry,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_INSEG_ENTRY);
@@ -571,6 +654,17 @@ void SaiTracer::logCreateFn(
     return;
   }
 
+  if (recordCall(
+          SaiTraceOp::CREATE,
+          object_type,
+          *create_object_id,
+          switch_id,
+          attr_count,
+          attr_list,
+          rv)) {
+    return;
+  }
+
   // First fill in attribute list
   vector<string> lines = setAttrList(attr_list, attr_count, object_type);
 
@@ -600,6 +694,16 @@ void SaiTracer::logRouteEntryRemoveFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::REMOVE,
+          SAI_OBJECT_TYPE_ROUTE_ENTRY,
+          route_entry,
+          0,
+          nullptr,
+          rv)) {
+    return;
+  }
+
   vector<string> lines{};
   setRouteEntry(route_entry, lines);
 
@@ -627,6 +731,16 @@ void SaiTracer::logNeighborEntryRemoveFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::REMOVE,
+          SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+          neighbor_entry,
+          0,
+          nullptr,
+          rv)) {
+    return;
+  }
+
   vector<string> lines{};
   setNeighborEntry(neighbor_entry, lines);
 
@@ -654,6 +768,16 @@ void SaiTracer::logFdbEntryRemoveFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::REMOVE,
+          SAI_OBJECT_TYPE_FDB_ENTRY,
+          fdb_entry,
+          0,
+          nullptr,
+          rv)) {
+    return;
+  }
+
   vector<string> lines{};
   setFdbEntry(fdb_entry, lines);
 
@@ -681,6 +805,16 @@ void SaiTracer::logInsegEntryRemoveFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::REMOVE,
+          SAI_OBJECT_TYPE_INSEG_ENTRY,
+          inseg_entry,
+          0,
+          nullptr,
+          rv)) {
+    return;
+  }
+
   vector<string> lines{};
   setInsegEntry(inseg_entry, lines);
 
@@ -710,6 +844,17 @@ void SaiTracer::logRemoveFn(
     return;
   }
 
+  if (recordCall(
+          SaiTraceOp::REMOVE,
+          object_type,
+          remove_object_id,
+          SAI_NULL_OBJECT_ID,
+          0,
+          nullptr,
+          rv)) {
+    return;
+  }
+
   vector<string> lines{};
 
   // Log current timestamp, object id and return value
@@ -742,6 +887,16 @@ void SaiTracer::logRouteEntrySetAttrFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::SET_ATTRIBUTE,
+          SAI_OBJECT_TYPE_ROUTE_ENTRY,
+          route_entry,
+          1,
+          attr,
+          rv)) {
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_ROUTE_ENTRY);
 
@@ -773,6 +928,16 @@ void SaiTracer::logNeighborEntrySetAttrFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::SET_ATTRIBUTE,
+          SAI_OBJECT_TYPE_NEIGHBOR_ENTRY,
+          neighbor_entry,
+          1,
+          attr,
+          rv)) {
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY);
 
@@ -804,6 +969,16 @@ void SaiTracer::logFdbEntrySetAttrFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::SET_ATTRIBUTE,
+          SAI_OBJECT_TYPE_FDB_ENTRY,
+          fdb_entry,
+          1,
+          attr,
+          rv)) {
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_FDB_ENTRY);
 
@@ -835,6 +1010,16 @@ void SaiTracer::logInsegEntrySetAttrFn(
     return;
   }
 
+  if (recordEntryCall(
+          SaiTraceOp::SET_ATTRIBUTE,
+          SAI_OBJECT_TYPE_INSEG_ENTRY,
+          inseg_entry,
+          1,
+          attr,
+          rv)) {
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, SAI_OBJECT_TYPE_INSEG_ENTRY);
 
@@ -868,6 +1053,17 @@ void SaiTracer::logSetAttrFn(
     return;
   }
 
+  if (recordCall(
+          SaiTraceOp::SET_ATTRIBUTE,
+          object_type,
+          set_object_id,
+          SAI_NULL_OBJECT_ID,
+          1,
+          attr,
+          rv)) {
+    return;
+  }
+
   // Setup one attribute
   vector<string> lines = setAttrList(attr, 1, object_type);
 
@@ -901,6 +1097,19 @@ void SaiTracer::logSendHostifPacketFn(
     return;
   }
 
+  if (recordCall(
+          SaiTraceOp::SEND_HOSTIF_PACKET,
+          SAI_OBJECT_TYPE_HOSTIF_PACKET,
+          hostif_id,
+          SAI_NULL_OBJECT_ID,
+          attr_count,
+          attr_list,
+          rv,
+          buffer,
+          buffer_size)) {
+    return;
+  }
+
   vector<string> lines =
       setAttrList(attr_list, attr_count, SAI_OBJECT_TYPE_HOSTIF_PACKET);
 
@@ -1226,12 +1435,38 @@ void SaiTracer::setRouteEntry(
   }
 }
 
+bool SaiTracer::recordCall(
+    SaiTraceOp op,
+    sai_object_type_t object_type,
+    sai_object_id_t object_id,
+    sai_object_id_t switch_id,
+    uint32_t attr_count,
+    const sai_attribute_t* attr_list,
+    sai_status_t rv,
+    const void* key,
+    uint32_t key_size) {
+  if (!binaryRecorder_) {
+    return false;
+  }
+  binaryRecorder_->record(
+      op,
+      object_type,
+      rv,
+      object_id,
+      switch_id,
+      key,
+      key_size,
+      attr_count,
+      attr_list);
+  return true;
+}
+
 string SaiTracer::rvCheck(sai_status_t rv) {
   return to<string>("rvCheck(rv,", rv, ",", numCalls_++, ")");
 }
 
 string SaiTracer::logTimeAndRv(sai_status_t rv, sai_object_id_t object_id) {
-  auto now = std::chrono::system_clock::now();
+  auto now = logTime_.value_or(std::chrono::system_clock::now());
   auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
                     now.time_since_epoch()) %
       1000;
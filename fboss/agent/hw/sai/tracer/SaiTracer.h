@@ -9,11 +9,14 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <tuple>
 
 #include "fboss/agent/AsyncLogger.h"
+#include "fboss/agent/hw/sai/tracer/SaiBinaryTrace.h"
 
 #include <folly/File.h>
 #include <folly/String.h>
@@ -26,6 +29,8 @@ extern "C" {
 
 DECLARE_bool(enable_replayer);
 DECLARE_bool(enable_packet_log);
+DECLARE_string(sai_log);
+DECLARE_string(sai_binary_log);
 
 namespace facebook::fboss {
 
@@ -139,6 +144,11 @@ class SaiTracer {
   uint32_t
   checkListCount(uint32_t list_count, uint32_t elem_size, uint32_t elem_count);
 
+  // Time to log calls at, rather than now, when converting a binary trace
+  void setLogTime(std::optional<std::chrono::system_clock::time_point> time) {
+    logTime_ = time;
+  }
+
   sai_acl_api_t* aclApi_;
   sai_bridge_api_t* bridgeApi_;
   sai_buffer_api_t* bufferApi_;
@@ -200,6 +210,40 @@ class SaiTracer {
       const sai_route_entry_t* route_entry,
       std::vector<std::string>& lines);
 
+  // Record a call in the binary trace with --sai_binary_log, in which case
+  // no C code is generated for it. Returns whether the call was recorded.
+  bool recordCall(
+      SaiTraceOp op,
+      sai_object_type_t object_type,
+      sai_object_id_t object_id,
+      sai_object_id_t switch_id,
+      uint32_t attr_count,
+      const sai_attribute_t* attr_list,
+      sai_status_t rv,
+      const void* key = nullptr,
+      uint32_t key_size = 0);
+
+  // Calls on entry objects, which are keyed by their sai_*_entry_t
+  template <typename EntryT>
+  bool recordEntryCall(
+      SaiTraceOp op,
+      sai_object_type_t object_type,
+      const EntryT* entry,
+      uint32_t attr_count,
+      const sai_attribute_t* attr_list,
+      sai_status_t rv) {
+    return recordCall(
+        op,
+        object_type,
+        SAI_NULL_OBJECT_ID,
+        SAI_NULL_OBJECT_ID,
+        attr_count,
+        attr_list,
+        rv,
+        entry,
+        sizeof(*entry));
+  }
+
   std::string rvCheck(sai_status_t rv);
 
   std::string logTimeAndRv(
@@ -218,6 +262,9 @@ class SaiTracer {
   uint32_t maxListCount_;
   uint32_t numCalls_;
   std::unique_ptr<AsyncLogger> asyncLogger_;
+  // Records calls instead of asyncLogger_ with --sai_binary_log
+  std::unique_ptr<SaiTraceRecorder> binaryRecorder_;
+  std::optional<std::chrono::system_clock::time_point> logTime_;
 
   // Variables mappings in generated C code
   // varCounts map from object type to the current counter
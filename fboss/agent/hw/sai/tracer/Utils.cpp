@@ -486,4 +486,11 @@ void ipAttr(
   }
 }
 
+sai_status_t bulkObjectStatus(
+    sai_status_t rv,
+    const sai_status_t* object_statuses,
+    uint32_t i) {
+  return rv == SAI_STATUS_SUCCESS ? SAI_STATUS_SUCCESS : object_statuses[i];
+}
+
 } // namespace facebook::fboss
@@ -134,4 +134,11 @@ void ipAttr(
     int i,
     std::vector<std::string>& attrLines);
 
+// Status of the i-th object of a bulk call which returned rv: adapters only
+// set the status of every object when a bulk call fails
+sai_status_t bulkObjectStatus(
+    sai_status_t rv,
+    const sai_status_t* object_statuses,
+    uint32_t i);
+
 } // namespace facebook::fboss
@@ -0,0 +1,238 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/hw/sai/tracer/SaiBinaryTrace.h"
+#include "fboss/agent/hw/sai/tracer/SaiTracer.h"
+
+#include <folly/Singleton.h>
+#include <folly/init/Init.h>
+#include <folly/logging/xlog.h>
+#include <gflags/gflags.h>
+
+extern "C" {
+#include <sai.h>
+}
+
+DEFINE_string(
+    sai_trace,
+    "",
+    "Binary SAI trace to convert, as recorded by the SAI tracer with "
+    "--sai_binary_log");
+
+using namespace facebook::fboss;
+
+namespace {
+
+template <typename EntryT>
+const EntryT* entry(const SaiTraceReader::Record& record) {
+  if (record.header->keySize != sizeof(EntryT)) {
+    throw FbossError(
+        "Unexpected size of ",
+        saiTraceObjectName(record.objectType()),
+        ": ",
+        record.header->keySize);
+  }
+  return reinterpret_cast<const EntryT*>(record.key);
+}
+
+void convertApiInitialize(
+    SaiTracer* tracer,
+    const SaiTraceReader::Record& record) {
+  // NUL separated variables and values
+  std::vector<const char*> variables;
+  std::vector<const char*> values;
+  auto profile = reinterpret_cast<const char*>(record.key);
+  auto end = profile + record.header->keySize;
+  while (profile < end) {
+    variables.push_back(profile);
+    profile += strlen(profile) + 1;
+    values.push_back(profile);
+    profile += strlen(profile) + 1;
+  }
+  tracer->logApiInitialize(variables.data(), values.data(), variables.size());
+}
+
+void convertEntry(SaiTracer* tracer, const SaiTraceReader::Record& record) {
+  auto op = record.op();
+  auto rv = record.header->rv;
+  auto attrCount = record.header->attrCount;
+  auto attrList = record.attrList;
+  switch (record.objectType()) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY: {
+      auto routeEntry = entry<sai_route_entry_t>(record);
+      if (op == SaiTraceOp::CREATE) {
+        tracer->logRouteEntryCreateFn(routeEntry, attrCount, attrList, rv);
+      } else if (op == SaiTraceOp::REMOVE) {
+        tracer->logRouteEntryRemoveFn(routeEntry, rv);
+      } else {
+        tracer->logRouteEntrySetAttrFn(routeEntry, attrList, rv);
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY: {
+      auto neighborEntry = entry<sai_neighbor_entry_t>(record);
+      if (op == SaiTraceOp::CREATE) {
+        tracer->logNeighborEntryCreateFn(
+            neighborEntry, attrCount, attrList, rv);
+      } else if (op == SaiTraceOp::REMOVE) {
+        tracer->logNeighborEntryRemoveFn(neighborEntry, rv);
+      } else {
+        tracer->logNeighborEntrySetAttrFn(neighborEntry, attrList, rv);
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_FDB_ENTRY: {
+      auto fdbEntry = entry<sai_fdb_entry_t>(record);
+      if (op == SaiTraceOp::CREATE) {
+        tracer->logFdbEntryCreateFn(fdbEntry, attrCount, attrList, rv);
+      } else if (op == SaiTraceOp::REMOVE) {
+        tracer->logFdbEntryRemoveFn(fdbEntry, rv);
+      } else {
+        tracer->logFdbEntrySetAttrFn(fdbEntry, attrList, rv);
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_INSEG_ENTRY: {
+      auto insegEntry = entry<sai_inseg_entry_t>(record);
+      if (op == SaiTraceOp::CREATE) {
+        tracer->logInsegEntryCreateFn(insegEntry, attrCount, attrList, rv);
+      } else if (op == SaiTraceOp::REMOVE) {
+        tracer->logInsegEntryRemoveFn(insegEntry, rv);
+      } else {
+        tracer->logInsegEntrySetAttrFn(insegEntry, attrList, rv);
+      }
+      break;
+    }
+    default:
+      throw FbossError(
+          "Unexpected entry type in SAI trace: ", record.objectType());
+  }
+}
+
+/*
+ * Converts a record back into the calls of SaiTracer, which write it out as
+ * the C source of the SAI Replayer, exactly as if traced to --sai_log.
+ */
+void convert(SaiTracer* tracer, const SaiTraceReader::Record& record) {
+  auto header = record.header;
+  auto objectType = record.objectType();
+  tracer->setLogTime(record.time());
+
+  switch (record.op()) {
+    case SaiTraceOp::API_INITIALIZE:
+      convertApiInitialize(tracer, record);
+      return;
+    case SaiTraceOp::API_QUERY:
+      tracer->logApiQuery(
+          static_cast<sai_api_t>(header->objectType),
+          std::string(
+              reinterpret_cast<const char*>(record.key), header->keySize));
+      return;
+    case SaiTraceOp::SEND_HOSTIF_PACKET:
+      tracer->logSendHostifPacketFn(
+          header->objectId,
+          header->keySize,
+          record.key,
+          header->attrCount,
+          record.attrList,
+          header->rv);
+      return;
+    default:
+      break;
+  }
+
+  switch (objectType) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+    case SAI_OBJECT_TYPE_FDB_ENTRY:
+    case SAI_OBJECT_TYPE_INSEG_ENTRY:
+      convertEntry(tracer, record);
+      return;
+    default:
+      break;
+  }
+
+  auto objectName = saiTraceObjectName(objectType);
+  auto objectId = header->objectId;
+  switch (record.op()) {
+    case SaiTraceOp::CREATE:
+      if (objectType == SAI_OBJECT_TYPE_SWITCH) {
+        tracer->logSwitchCreateFn(
+            &objectId, header->attrCount, record.attrList, header->rv);
+      } else {
+        tracer->logCreateFn(
+            "create_" + objectName,
+            &objectId,
+            header->switchId,
+            header->attrCount,
+            record.attrList,
+            objectType,
+            header->rv);
+      }
+      break;
+    case SaiTraceOp::REMOVE:
+      tracer->logRemoveFn(
+          "remove_" + objectName, objectId, objectType, header->rv);
+      break;
+    case SaiTraceOp::SET_ATTRIBUTE:
+      tracer->logSetAttrFn(
+          "set_" + objectName + "_attribute",
+          objectId,
+          record.attrList,
+          objectType,
+          header->rv);
+      break;
+    default:
+      throw FbossError(
+          "Unexpected SAI trace op: ", static_cast<int>(record.op()));
+  }
+}
+
+} // namespace
+
+/*
+ * Converts a binary SAI trace, recorded with --sai_binary_log, into the C
+ * source of the SAI Replayer the tracer would have generated, written to
+ * --sai_log.
+ *
+ * CLI:
+ *   sai_trace_converter --sai_trace <trace> --sai_log <sai_replayer.cpp>
+ */
+int main(int argc, char* argv[]) {
+  folly::init(&argc, &argv, true);
+
+  if (FLAGS_sai_trace.empty()) {
+    XLOG(FATAL) << "--sai_trace is required";
+  }
+  // Generate the C source, including any packets the trace has
+  FLAGS_enable_replayer = true;
+  FLAGS_enable_packet_log = true;
+  FLAGS_sai_binary_log.clear();
+
+  SaiTraceReader reader(FLAGS_sai_trace);
+  uint64_t numRecords = 0;
+  {
+    auto tracer = SaiTracer::getInstance();
+    while (auto record = reader.next()) {
+      convert(tracer.get(), *record);
+      ++numRecords;
+    }
+  }
+  // Have the SaiTracer write out its footer
+  folly::SingletonVault::singleton()->destroyInstances();
+
+  XLOG(INFO) << "Converted " << numRecords << " records of " << FLAGS_sai_trace
+             << " into " << FLAGS_sai_log;
+  return 0;
+}
@@ -0,0 +1,506 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/hw/sai/tracer/SaiBinaryTrace.h"
+
+#include <folly/MapUtil.h>
+#include <folly/init/Init.h>
+#include <folly/logging/xlog.h>
+#include <gflags/gflags.h>
+
+extern "C" {
+#include <sai.h>
+}
+
+DEFINE_string(
+    sai_trace,
+    "",
+    "Binary SAI trace to replay, as recorded by the SAI tracer with "
+    "--sai_binary_log");
+
+using namespace facebook::fboss;
+
+namespace {
+
+std::unordered_map<std::string, std::string> kSaiProfileValues;
+
+const char* saiProfileGetValue(
+    sai_switch_profile_id_t /*profile_id*/,
+    const char* variable) {
+  auto saiProfileValItr = kSaiProfileValues.find(variable);
+  return saiProfileValItr != kSaiProfileValues.end()
+      ? saiProfileValItr->second.c_str()
+      : nullptr;
+}
+
+int saiProfileGetNextValue(
+    sai_switch_profile_id_t /* profile_id */,
+    const char** variable,
+    const char** value) {
+  static auto saiProfileValItr = kSaiProfileValues.begin();
+  if (!value) {
+    saiProfileValItr = kSaiProfileValues.begin();
+    return 0;
+  }
+  if (saiProfileValItr == kSaiProfileValues.end()) {
+    return -1;
+  }
+  *variable = saiProfileValItr->first.c_str();
+  *value = saiProfileValItr->second.c_str();
+  ++saiProfileValItr;
+  return 0;
+}
+
+sai_service_method_table_t kSaiServiceMethodTable = {
+    .profile_get_value = saiProfileGetValue,
+    .profile_get_next_value = saiProfileGetNextValue,
+};
+
+// API functions of the objects created, removed and set by object id
+struct ObjectApi {
+  sai_api_t api;
+  sai_status_t (*create)(
+      void* apiTable,
+      sai_object_id_t* objectId,
+      sai_object_id_t switchId,
+      uint32_t attrCount,
+      const sai_attribute_t* attrList);
+  sai_status_t (*remove)(void* apiTable, sai_object_id_t objectId);
+  sai_status_t (*set)(
+      void* apiTable,
+      sai_object_id_t objectId,
+      const sai_attribute_t* attr);
+};
+
+#define SAI_OBJECT_API(OBJECT_TYPE, API, api, object)                       \
+  {                                                                         \
+    SAI_OBJECT_TYPE_##OBJECT_TYPE, {                                        \
+      SAI_API_##API,                                                        \
+          [](void* apiTable,                                                \
+             sai_object_id_t* objectId,                                     \
+             sai_object_id_t switchId,                                      \
+             uint32_t attrCount,                                            \
+             const sai_attribute_t* attrList) {                             \
+            return static_cast<sai_##api##_api_t*>(apiTable)                \
+                ->create_##object(objectId, switchId, attrCount, attrList); \
+          },                                                                \
+          [](void* apiTable, sai_object_id_t objectId) {                    \
+            return static_cast<sai_##api##_api_t*>(apiTable)                \
+                ->remove_##object(objectId);                                \
+          },                                                                \
+          [](void* apiTable,                                                \
+             sai_object_id_t objectId,                                      \
+             const sai_attribute_t* attr) {                                 \
+            return static_cast<sai_##api##_api_t*>(apiTable)                \
+                ->set_##object##_attribute(objectId, attr);                 \
+          },                                                                \
+    }                                                                       \
+  }
+
+const std::map<sai_object_type_t, ObjectApi> kObjectApis{
+    SAI_OBJECT_API(ACL_ENTRY, ACL, acl, acl_entry),
+    SAI_OBJECT_API(ACL_TABLE, ACL, acl, acl_table),
+    SAI_OBJECT_API(ACL_TABLE_GROUP, ACL, acl, acl_table_group),
+    SAI_OBJECT_API(ACL_TABLE_GROUP_MEMBER, ACL, acl, acl_table_group_member),
+    SAI_OBJECT_API(BRIDGE, BRIDGE, bridge, bridge),
+    SAI_OBJECT_API(BRIDGE_PORT, BRIDGE, bridge, bridge_port),
+    SAI_OBJECT_API(BUFFER_POOL, BUFFER, buffer, buffer_pool),
+    SAI_OBJECT_API(BUFFER_PROFILE, BUFFER, buffer, buffer_profile),
+    SAI_OBJECT_API(HASH, HASH, hash, hash),
+    SAI_OBJECT_API(HOSTIF_TRAP, HOSTIF, hostif, hostif_trap),
+    SAI_OBJECT_API(HOSTIF_TRAP_GROUP, HOSTIF, hostif, hostif_trap_group),
+    SAI_OBJECT_API(MIRROR_SESSION, MIRROR, mirror, mirror_session),
+    SAI_OBJECT_API(NEXT_HOP, NEXT_HOP, next_hop, next_hop),
+    SAI_OBJECT_API(
+        NEXT_HOP_GROUP,
+        NEXT_HOP_GROUP,
+        next_hop_group,
+        next_hop_group),
+    SAI_OBJECT_API(
+        NEXT_HOP_GROUP_MEMBER,
+        NEXT_HOP_GROUP,
+        next_hop_group,
+        next_hop_group_member),
+    SAI_OBJECT_API(PORT, PORT, port, port),
+    SAI_OBJECT_API(PORT_SERDES, PORT, port, port_serdes),
+    SAI_OBJECT_API(QOS_MAP, QOS_MAP, qos_map, qos_map),
+    SAI_OBJECT_API(QUEUE, QUEUE, queue, queue),
+    SAI_OBJECT_API(
+        ROUTER_INTERFACE,
+        ROUTER_INTERFACE,
+        router_interface,
+        router_interface),
+    SAI_OBJECT_API(SAMPLEPACKET, SAMPLEPACKET, samplepacket, samplepacket),
+    SAI_OBJECT_API(SCHEDULER, SCHEDULER, scheduler, scheduler),
+    SAI_OBJECT_API(TAM_REPORT, TAM, tam, tam_report),
+    SAI_OBJECT_API(TAM_EVENT_ACTION, TAM, tam, tam_event_action),
+    SAI_OBJECT_API(TAM_EVENT, TAM, tam, tam_event),
+    SAI_OBJECT_API(TAM, TAM, tam, tam),
+    SAI_OBJECT_API(
+        VIRTUAL_ROUTER,
+        VIRTUAL_ROUTER,
+        virtual_router,
+        virtual_router),
+    SAI_OBJECT_API(VLAN, VLAN, vlan, vlan),
+    SAI_OBJECT_API(VLAN_MEMBER, VLAN, vlan, vlan_member),
+    // Switches are created without a switch id
+    {SAI_OBJECT_TYPE_SWITCH,
+     {SAI_API_SWITCH,
+      [](void* apiTable,
+         sai_object_id_t* objectId,
+         sai_object_id_t /* switchId */,
+         uint32_t attrCount,
+         const sai_attribute_t* attrList) {
+        return static_cast<sai_switch_api_t*>(apiTable)->create_switch(
+            objectId, attrCount, attrList);
+      },
+      [](void* apiTable, sai_object_id_t objectId) {
+        return static_cast<sai_switch_api_t*>(apiTable)->remove_switch(
+            objectId);
+      },
+      [](void* apiTable,
+         sai_object_id_t objectId,
+         const sai_attribute_t* attr) {
+        return static_cast<sai_switch_api_t*>(apiTable)->set_switch_attribute(
+            objectId, attr);
+      }}},
+};
+
+#undef SAI_OBJECT_API
+
+/*
+ * Replays the calls of a binary SAI trace against the SAI implementation it
+ * is linked with, e.g. FakeSai or a vendor SAI.
+ *
+ * Object ids differ from run to run, so ids of objects created earlier in
+ * the trace are translated to the ids of the objects created in the replay:
+ * in entries, object id lists and in any 8 bytes of the other attribute
+ * values. The latter is a heuristic, as traces do not know which attributes
+ * are object ids, which holds since object ids encode the object type in
+ * their upper bits, unlike the integers and addresses of other attributes.
+ */
+class SaiTraceReplayer {
+ public:
+  void replay(SaiTraceReader::Record& record);
+
+  uint64_t numCalls() const {
+    return numCalls_;
+  }
+  uint64_t numMismatches() const {
+    return numMismatches_;
+  }
+
+ private:
+  void apiInitialize(const SaiTraceReader::Record& record);
+  void apiQuery(const SaiTraceReader::Record& record);
+  sai_status_t call(const SaiTraceReader::Record& record);
+  sai_status_t callEntry(const SaiTraceReader::Record& record);
+
+  template <typename ApiT>
+  ApiT* api(sai_api_t apiId) const {
+    auto apiTable = folly::get_default(apis_, apiId, nullptr);
+    if (!apiTable) {
+      throw FbossError("SAI API ", apiId, " used before it was queried");
+    }
+    return static_cast<ApiT*>(apiTable);
+  }
+
+  template <typename EntryT>
+  EntryT entry(const SaiTraceReader::Record& record) const {
+    if (record.header->keySize != sizeof(EntryT)) {
+      throw FbossError(
+          "Unexpected size of ",
+          saiTraceObjectName(record.objectType()),
+          ": ",
+          record.header->keySize);
+    }
+    EntryT entry;
+    memcpy(&entry, record.key, sizeof(EntryT));
+    return entry;
+  }
+
+  sai_object_id_t translate(sai_object_id_t objectId) const {
+    return folly::get_default(objectIds_, objectId, objectId);
+  }
+  void translateAttributes(const SaiTraceReader::Record& record);
+
+  std::map<sai_api_t, void*> apis_;
+  // Object ids of the trace to those of the replay
+  std::unordered_map<sai_object_id_t, sai_object_id_t> objectIds_;
+  uint64_t numCalls_{0};
+  uint64_t numMismatches_{0};
+};
+
+void SaiTraceReplayer::replay(SaiTraceReader::Record& record) {
+  switch (record.op()) {
+    case SaiTraceOp::API_INITIALIZE:
+      apiInitialize(record);
+      return;
+    case SaiTraceOp::API_QUERY:
+      apiQuery(record);
+      return;
+    default:
+      break;
+  }
+
+  translateAttributes(record);
+  auto rv = call(record);
+  auto header = record.header;
+  if (rv != header->rv) {
+    XLOG(ERR) << "Unexpected rv at " << numCalls_ << " with status " << rv
+              << ", trace has " << header->rv;
+    ++numMismatches_;
+  }
+  ++numCalls_;
+}
+
+void SaiTraceReplayer::apiInitialize(const SaiTraceReader::Record& record) {
+  // NUL separated variables and values
+  auto profile = reinterpret_cast<const char*>(record.key);
+  auto end = profile + record.header->keySize;
+  while (profile < end) {
+    std::string variable(profile);
+    profile += variable.size() + 1;
+    std::string value(profile);
+    profile += value.size() + 1;
+    if (variable == SAI_KEY_WARM_BOOT_WRITE_FILE ||
+        variable == SAI_KEY_WARM_BOOT_READ_FILE) {
+      // Append '_replayer' suffix to sai adapter state file, as the
+      // replayer generated by SaiTracer does
+      value += "_replayer";
+    }
+    kSaiProfileValues.emplace(variable, value);
+  }
+  auto rv = sai_api_initialize(0, &kSaiServiceMethodTable);
+  if (rv != SAI_STATUS_SUCCESS) {
+    throw FbossError("Failed to initialize SAI: ", rv);
+  }
+}
+
+void SaiTraceReplayer::apiQuery(const SaiTraceReader::Record& record) {
+  auto apiId = static_cast<sai_api_t>(record.header->objectType);
+  void* apiTable = nullptr;
+  auto rv = sai_api_query(apiId, &apiTable);
+  if (rv != SAI_STATUS_SUCCESS) {
+    throw FbossError("Failed to query SAI API ", apiId, ": ", rv);
+  }
+  apis_[apiId] = apiTable;
+}
+
+sai_status_t SaiTraceReplayer::call(const SaiTraceReader::Record& record) {
+  auto header = record.header;
+  switch (record.objectType()) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+    case SAI_OBJECT_TYPE_FDB_ENTRY:
+    case SAI_OBJECT_TYPE_INSEG_ENTRY:
+      return callEntry(record);
+    case SAI_OBJECT_TYPE_HOSTIF_PACKET:
+      return api<sai_hostif_api_t>(SAI_API_HOSTIF)
+          ->send_hostif_packet(
+              translate(header->objectId),
+              header->keySize,
+              record.key,
+              header->attrCount,
+              record.attrList);
+    default:
+      break;
+  }
+
+  auto objectApi = folly::get_ptr(kObjectApis, record.objectType());
+  if (!objectApi) {
+    throw FbossError(
+        "Unsupported Sai Object type in Sai Trace: ", record.objectType());
+  }
+  auto apiTable = api<void>(objectApi->api);
+  sai_status_t rv;
+  switch (record.op()) {
+    case SaiTraceOp::CREATE: {
+      sai_object_id_t objectId;
+      rv = objectApi->create(
+          apiTable,
+          &objectId,
+          translate(header->switchId),
+          header->attrCount,
+          record.attrList);
+      if (rv == SAI_STATUS_SUCCESS && header->rv == SAI_STATUS_SUCCESS) {
+        objectIds_[header->objectId] = objectId;
+      }
+      break;
+    }
+    case SaiTraceOp::REMOVE:
+      rv = objectApi->remove(apiTable, translate(header->objectId));
+      objectIds_.erase(header->objectId);
+      break;
+    case SaiTraceOp::SET_ATTRIBUTE:
+      rv = objectApi->set(
+          apiTable, translate(header->objectId), record.attrList);
+      break;
+    default:
+      throw FbossError(
+          "Unexpected SAI trace op: ", static_cast<int>(record.op()));
+  }
+  return rv;
+}
+
+sai_status_t SaiTraceReplayer::callEntry(const SaiTraceReader::Record& record) {
+  auto attrCount = record.header->attrCount;
+  auto attrList = record.attrList;
+  switch (record.objectType()) {
+    case SAI_OBJECT_TYPE_ROUTE_ENTRY: {
+      auto routeEntry = entry<sai_route_entry_t>(record);
+      routeEntry.switch_id = translate(routeEntry.switch_id);
+      routeEntry.vr_id = translate(routeEntry.vr_id);
+      auto routeApi = api<sai_route_api_t>(SAI_API_ROUTE);
+      switch (record.op()) {
+        case SaiTraceOp::CREATE:
+          return routeApi->create_route_entry(
+              &routeEntry, attrCount, attrList);
+        case SaiTraceOp::REMOVE:
+          return routeApi->remove_route_entry(&routeEntry);
+        case SaiTraceOp::SET_ATTRIBUTE:
+          return routeApi->set_route_entry_attribute(&routeEntry, attrList);
+        default:
+          break;
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY: {
+      auto neighborEntry = entry<sai_neighbor_entry_t>(record);
+      neighborEntry.switch_id = translate(neighborEntry.switch_id);
+      neighborEntry.rif_id = translate(neighborEntry.rif_id);
+      auto neighborApi = api<sai_neighbor_api_t>(SAI_API_NEIGHBOR);
+      switch (record.op()) {
+        case SaiTraceOp::CREATE:
+          return neighborApi->create_neighbor_entry(
+              &neighborEntry, attrCount, attrList);
+        case SaiTraceOp::REMOVE:
+          return neighborApi->remove_neighbor_entry(&neighborEntry);
+        case SaiTraceOp::SET_ATTRIBUTE:
+          return neighborApi->set_neighbor_entry_attribute(
+              &neighborEntry, attrList);
+        default:
+          break;
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_FDB_ENTRY: {
+      auto fdbEntry = entry<sai_fdb_entry_t>(record);
+      fdbEntry.switch_id = translate(fdbEntry.switch_id);
+      fdbEntry.bv_id = translate(fdbEntry.bv_id);
+      auto fdbApi = api<sai_fdb_api_t>(SAI_API_FDB);
+      switch (record.op()) {
+        case SaiTraceOp::CREATE:
+          return fdbApi->create_fdb_entry(&fdbEntry, attrCount, attrList);
+        case SaiTraceOp::REMOVE:
+          return fdbApi->remove_fdb_entry(&fdbEntry);
+        case SaiTraceOp::SET_ATTRIBUTE:
+          return fdbApi->set_fdb_entry_attribute(&fdbEntry, attrList);
+        default:
+          break;
+      }
+      break;
+    }
+    case SAI_OBJECT_TYPE_INSEG_ENTRY: {
+      auto insegEntry = entry<sai_inseg_entry_t>(record);
+      insegEntry.switch_id = translate(insegEntry.switch_id);
+      auto mplsApi = api<sai_mpls_api_t>(SAI_API_MPLS);
+      switch (record.op()) {
+        case SaiTraceOp::CREATE:
+          return mplsApi->create_inseg_entry(
+              &insegEntry, attrCount, attrList);
+        case SaiTraceOp::REMOVE:
+          return mplsApi->remove_inseg_entry(&insegEntry);
+        case SaiTraceOp::SET_ATTRIBUTE:
+          return mplsApi->set_inseg_entry_attribute(&insegEntry, attrList);
+        default:
+          break;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  throw FbossError(
+      "Unexpected SAI trace op ",
+      static_cast<int>(record.op()),
+      " on ",
+      saiTraceObjectName(record.objectType()));
+}
+
+void SaiTraceReplayer::translateAttributes(
+    const SaiTraceReader::Record& record) {
+  for (uint32_t i = 0; i < record.header->attrCount; ++i) {
+    auto& attr = record.attrList[i];
+    auto listType = saiTraceListType(record.objectType(), attr.id);
+    switch (listType) {
+      case SaiTraceListType::OBJECT_ID:
+      case SaiTraceListType::ACL_ACTION_OBJECT_ID: {
+        auto& objectList = listType == SaiTraceListType::OBJECT_ID
+            ? attr.value.objlist
+            : attr.value.aclaction.parameter.objlist;
+        for (uint32_t j = 0; objectList.list && j < objectList.count; ++j) {
+          objectList.list[j] = translate(objectList.list[j]);
+        }
+        break;
+      }
+      case SaiTraceListType::NONE: {
+        std::array<uint64_t, sizeof(attr.value) / sizeof(uint64_t)> words;
+        memcpy(words.data(), &attr.value, sizeof(words));
+        for (auto& word : words) {
+          word = translate(word);
+        }
+        memcpy(&attr.value, words.data(), sizeof(words));
+        break;
+      }
+      default:
+        // Lists of integers
+        break;
+    }
+  }
+}
+
+} // namespace
+
+/*
+ * Replays a binary SAI trace, recorded with --sai_binary_log, as fast as the
+ * SAI implementation linked in allows.
+ *
+ * CLI:
+ *   sai_trace_replayer --sai_trace <trace>
+ */
+int main(int argc, char* argv[]) {
+  folly::init(&argc, &argv, true);
+
+  if (FLAGS_sai_trace.empty()) {
+    XLOG(FATAL) << "--sai_trace is required";
+  }
+  SaiTraceReader reader(FLAGS_sai_trace);
+  SaiTraceReplayer replayer;
+  auto start = std::chrono::steady_clock::now();
+  while (auto record = reader.next()) {
+    replayer.replay(*record);
+  }
+  auto msecs = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  XLOG(INFO) << "Replayed " << replayer.numCalls() << " SAI calls from "
+             << FLAGS_sai_trace << " in " << msecs.count() << " msecs, "
+             << replayer.numMismatches()
+             << " of which returned another status than in the trace";
+  return replayer.numMismatches() ? 1 : 0;
+}
@@ -0,0 +1,351 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/sai/tracer/SaiBinaryTrace.h"
+
+#include "fboss/agent/FbossError.h"
+
+#include <folly/FileUtil.h>
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define TEST_TRACE "/tmp/sai_binary_trace_test"
+
+using namespace facebook::fboss;
+
+namespace {
+// Smallest ring the recorder makes
+auto constexpr kRingSize = 1 << 20;
+auto constexpr kFlushTimeoutMsecs = 100;
+
+std::string testKey(uint32_t i) {
+  // Sizes that do not divide the ring, so that entries straddle its end
+  std::string key(1000 + i % 97, '\0');
+  for (size_t j = 0; j < key.size(); ++j) {
+    key[j] = static_cast<char>(i + j);
+  }
+  return key;
+}
+
+// Whether list, of size bytes, lies in the payload of record
+bool inPayload(
+    const SaiTraceReader::Record& record,
+    const void* list,
+    size_t size) {
+  auto payload = reinterpret_cast<const uint8_t*>(
+      record.attrList + record.header->attrCount);
+  auto end =
+      reinterpret_cast<const uint8_t*>(record.header) + record.header->size;
+  auto begin = static_cast<const uint8_t*>(list);
+  return begin >= payload && begin + size <= end;
+}
+} // namespace
+
+class SaiBinaryTraceTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    recorder =
+        std::make_unique<SaiTraceRecorder>(TEST_TRACE, kFlushTimeoutMsecs, 0);
+  }
+
+  void TearDown() override {
+    recorder.reset();
+    std::remove(TEST_TRACE);
+  }
+
+  // Stop recording, once all records are written out
+  void finishTrace() {
+    recorder.reset();
+  }
+
+  void recordVlan(sai_object_id_t vlanId, uint32_t memberCount) {
+    std::vector<sai_object_id_t> members(memberCount);
+    for (uint32_t i = 0; i < memberCount; ++i) {
+      members[i] = vlanId + i;
+    }
+    sai_attribute_t attr;
+    attr.id = SAI_VLAN_ATTR_MEMBER_LIST;
+    attr.value.objlist.count = members.size();
+    attr.value.objlist.list = members.data();
+    recorder->record(
+        SaiTraceOp::CREATE,
+        SAI_OBJECT_TYPE_VLAN,
+        SAI_STATUS_SUCCESS,
+        vlanId,
+        kSwitchId,
+        nullptr,
+        0,
+        1,
+        &attr);
+  }
+
+  static sai_object_id_t constexpr kSwitchId = 0x21000000000000;
+  std::unique_ptr<SaiTraceRecorder> recorder;
+};
+
+TEST_F(SaiBinaryTraceTest, wrapRingTest) {
+  // Records of several times the ring, each entry taking 8 bytes of commit
+  // word and 56 of header on top of its key: padding entries are written
+  // wherever an entry does not fit in the end of the ring
+  auto constexpr kNumRecords = kRingSize * 4 / 1000;
+  for (uint32_t i = 0; i < kNumRecords; ++i) {
+    auto key = testKey(i);
+    recorder->record(
+        SaiTraceOp::SEND_HOSTIF_PACKET,
+        SAI_OBJECT_TYPE_HOSTIF_PACKET,
+        SAI_STATUS_SUCCESS,
+        i,
+        SAI_NULL_OBJECT_ID,
+        key.data(),
+        key.size(),
+        0,
+        nullptr);
+  }
+  finishTrace();
+
+  SaiTraceReader reader(TEST_TRACE);
+  uint32_t numRecords = 0;
+  while (auto record = reader.next()) {
+    auto key = testKey(numRecords);
+    EXPECT_EQ(record->op(), SaiTraceOp::SEND_HOSTIF_PACKET);
+    EXPECT_EQ(record->header->objectId, numRecords);
+    ASSERT_EQ(record->header->keySize, key.size());
+    EXPECT_EQ(0, memcmp(record->key, key.data(), key.size()));
+    ++numRecords;
+  }
+  EXPECT_EQ(numRecords, kNumRecords);
+}
+
+TEST_F(SaiBinaryTraceTest, apiCallsTest) {
+  const char* variables[] = {"SAI_KEY_INIT_CONFIG_FILE", "SAI_KEY_BOOT_TYPE"};
+  const char* values[] = {"/tmp/config.yml", "0"};
+  recorder->recordApiInitialize(variables, values, 2);
+  recorder->recordApiQuery(SAI_API_VLAN, "vlan_api");
+  finishTrace();
+
+  SaiTraceReader reader(TEST_TRACE);
+  auto initialize = reader.next();
+  ASSERT_TRUE(initialize);
+  EXPECT_EQ(initialize->op(), SaiTraceOp::API_INITIALIZE);
+  std::string profile(
+      reinterpret_cast<const char*>(initialize->key),
+      initialize->header->keySize);
+  std::string expectedProfile;
+  for (auto i = 0; i < 2; ++i) {
+    expectedProfile.append(variables[i]).push_back('\0');
+    expectedProfile.append(values[i]).push_back('\0');
+  }
+  EXPECT_EQ(profile, expectedProfile);
+
+  auto query = reader.next();
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->op(), SaiTraceOp::API_QUERY);
+  EXPECT_EQ(query->header->objectType, SAI_API_VLAN);
+  EXPECT_EQ(
+      std::string(
+          reinterpret_cast<const char*>(query->key), query->header->keySize),
+      "vlan_api");
+  EXPECT_FALSE(reader.next());
+}
+
+TEST_F(SaiBinaryTraceTest, listAttributesTest) {
+  std::vector<sai_object_id_t> members{0x2a, 0x2b, 0x2c};
+  sai_attribute_t vlanAttrs[2];
+  vlanAttrs[0].id = SAI_VLAN_ATTR_MEMBER_LIST;
+  vlanAttrs[0].value.objlist.count = members.size();
+  vlanAttrs[0].value.objlist.list = members.data();
+  // NULL lists, as when querying the size of a list, stay NULL
+  vlanAttrs[1].id = SAI_VLAN_ATTR_MEMBER_LIST;
+  vlanAttrs[1].value.objlist.count = 0;
+  vlanAttrs[1].value.objlist.list = nullptr;
+  recorder->record(
+      SaiTraceOp::CREATE,
+      SAI_OBJECT_TYPE_VLAN,
+      SAI_STATUS_SUCCESS,
+      0x26,
+      kSwitchId,
+      nullptr,
+      0,
+      2,
+      vlanAttrs);
+
+  std::vector<sai_qos_map_t> qosMaps(5);
+  for (size_t i = 0; i < qosMaps.size(); ++i) {
+    memset(&qosMaps[i], 0, sizeof(sai_qos_map_t));
+    qosMaps[i].key.dscp = i * 8;
+    qosMaps[i].value.tc = i;
+  }
+  sai_attribute_t qosMapAttr;
+  qosMapAttr.id = SAI_QOS_MAP_ATTR_MAP_TO_VALUE_LIST;
+  qosMapAttr.value.qosmap.count = qosMaps.size();
+  qosMapAttr.value.qosmap.list = qosMaps.data();
+  recorder->record(
+      SaiTraceOp::CREATE,
+      SAI_OBJECT_TYPE_QOS_MAP,
+      SAI_STATUS_SUCCESS,
+      0x14,
+      kSwitchId,
+      nullptr,
+      0,
+      1,
+      &qosMapAttr);
+
+  std::vector<sai_object_id_t> mirrors{0x0e, 0x0f};
+  sai_attribute_t aclAttr;
+  aclAttr.id = SAI_ACL_ENTRY_ATTR_ACTION_MIRROR_INGRESS;
+  aclAttr.value.aclaction.enable = true;
+  aclAttr.value.aclaction.parameter.objlist.count = mirrors.size();
+  aclAttr.value.aclaction.parameter.objlist.list = mirrors.data();
+  recorder->record(
+      SaiTraceOp::SET_ATTRIBUTE,
+      SAI_OBJECT_TYPE_ACL_ENTRY,
+      SAI_STATUS_SUCCESS,
+      0x08,
+      SAI_NULL_OBJECT_ID,
+      nullptr,
+      0,
+      1,
+      &aclAttr);
+
+  // Lists are copied as they are recorded, not when they are written out
+  auto expectedMembers = members;
+  auto expectedQosMaps = qosMaps;
+  auto expectedMirrors = mirrors;
+  members.assign(members.size(), 0);
+  memset(qosMaps.data(), 0xff, qosMaps.size() * sizeof(sai_qos_map_t));
+  mirrors.assign(mirrors.size(), 0);
+  finishTrace();
+
+  SaiTraceReader reader(TEST_TRACE);
+  auto vlan = reader.next();
+  ASSERT_TRUE(vlan);
+  EXPECT_EQ(vlan->objectType(), SAI_OBJECT_TYPE_VLAN);
+  ASSERT_EQ(vlan->header->attrCount, 2);
+  auto& objlist = vlan->attrList[0].value.objlist;
+  ASSERT_EQ(objlist.count, expectedMembers.size());
+  EXPECT_TRUE(inPayload(
+      *vlan, objlist.list, objlist.count * sizeof(sai_object_id_t)));
+  EXPECT_EQ(
+      std::vector<sai_object_id_t>(
+          objlist.list, objlist.list + objlist.count),
+      expectedMembers);
+  EXPECT_EQ(vlan->attrList[1].value.objlist.list, nullptr);
+
+  auto qosMap = reader.next();
+  ASSERT_TRUE(qosMap);
+  EXPECT_EQ(qosMap->objectType(), SAI_OBJECT_TYPE_QOS_MAP);
+  ASSERT_EQ(qosMap->header->attrCount, 1);
+  auto& qosmap = qosMap->attrList[0].value.qosmap;
+  ASSERT_EQ(qosmap.count, expectedQosMaps.size());
+  EXPECT_TRUE(
+      inPayload(*qosMap, qosmap.list, qosmap.count * sizeof(sai_qos_map_t)));
+  EXPECT_EQ(
+      0,
+      memcmp(
+          qosmap.list,
+          expectedQosMaps.data(),
+          qosmap.count * sizeof(sai_qos_map_t)));
+
+  auto aclEntry = reader.next();
+  ASSERT_TRUE(aclEntry);
+  EXPECT_EQ(aclEntry->op(), SaiTraceOp::SET_ATTRIBUTE);
+  EXPECT_EQ(aclEntry->objectType(), SAI_OBJECT_TYPE_ACL_ENTRY);
+  ASSERT_EQ(aclEntry->header->attrCount, 1);
+  EXPECT_TRUE(aclEntry->attrList[0].value.aclaction.enable);
+  auto& mirrorList = aclEntry->attrList[0].value.aclaction.parameter.objlist;
+  ASSERT_EQ(mirrorList.count, expectedMirrors.size());
+  EXPECT_TRUE(inPayload(
+      *aclEntry,
+      mirrorList.list,
+      mirrorList.count * sizeof(sai_object_id_t)));
+  EXPECT_EQ(
+      std::vector<sai_object_id_t>(
+          mirrorList.list, mirrorList.list + mirrorList.count),
+      expectedMirrors);
+  EXPECT_FALSE(reader.next());
+}
+
+TEST_F(SaiBinaryTraceTest, concurrentRecordTest) {
+  // Threads recording concurrently, through several wraps of the ring, keep
+  // all of their records, each thread's in the order it recorded them
+  auto constexpr kNumThreads = 8;
+  auto constexpr kNumRecords = 10000;
+  std::vector<std::thread> threads;
+  for (uint64_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (uint64_t j = 0; j < kNumRecords; ++j) {
+        recordVlan(i << 32 | j, j % 7);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  finishTrace();
+
+  SaiTraceReader reader(TEST_TRACE);
+  std::vector<uint64_t> nextRecord(kNumThreads, 0);
+  while (auto record = reader.next()) {
+    auto vlanId = record->header->objectId;
+    auto thread = vlanId >> 32;
+    ASSERT_LT(thread, kNumThreads);
+    EXPECT_EQ(vlanId & 0xffffffff, nextRecord[thread]++);
+    auto& objlist = record->attrList[0].value.objlist;
+    ASSERT_EQ(objlist.count, (vlanId & 0xffffffff) % 7);
+    for (uint32_t k = 0; k < objlist.count; ++k) {
+      EXPECT_EQ(objlist.list[k], vlanId + k);
+    }
+  }
+  for (auto i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(nextRecord[i], kNumRecords);
+  }
+}
+
+TEST_F(SaiBinaryTraceTest, truncatedTraceTest) {
+  recordVlan(1, 3);
+  recordVlan(2, 3);
+  finishTrace();
+
+  std::string trace;
+  ASSERT_TRUE(folly::readFile(TEST_TRACE, trace));
+  // Cut the second record short
+  ASSERT_EQ(0, truncate(TEST_TRACE, trace.size() - sizeof(sai_object_id_t)));
+  SaiTraceReader reader(TEST_TRACE);
+  auto record = reader.next();
+  ASSERT_TRUE(record);
+  EXPECT_EQ(record->header->objectId, 1);
+  EXPECT_THROW(reader.next(), FbossError);
+
+  // Not even a file header
+  ASSERT_EQ(0, truncate(TEST_TRACE, sizeof(SaiTraceFileHeader) - 1));
+  EXPECT_THROW(SaiTraceReader{TEST_TRACE}, FbossError);
+}
+
+TEST_F(SaiBinaryTraceTest, attributeSizeTest) {
+  recordVlan(1, 3);
+  finishTrace();
+
+  // A trace recorded with SAI headers of another sai_attribute_t
+  std::string trace;
+  ASSERT_TRUE(folly::readFile(TEST_TRACE, trace));
+  uint32_t attributeSize = sizeof(sai_attribute_t) + sizeof(uint64_t);
+  memcpy(
+      &trace[offsetof(SaiTraceFileHeader, attributeSize)],
+      &attributeSize,
+      sizeof(attributeSize));
+  ASSERT_TRUE(folly::writeFile(trace, TEST_TRACE));
+  EXPECT_THROW(SaiTraceReader{TEST_TRACE}, FbossError);
+}
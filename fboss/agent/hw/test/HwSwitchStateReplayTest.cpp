@@ -12,6 +12,8 @@
 #include "fboss/agent/hw/test/HwTest.h"
 
 #include "fboss/agent/ApplyThriftConfig.h"
+#include "fboss/agent/Constants.h"
+#include "fboss/agent/hw/WarmBootStateFile.h"
 #include "fboss/agent/state/Port.h"
 #include "fboss/agent/state/SwitchState.h"
 
@@ -19,6 +21,7 @@
 
 #include <folly/FileUtil.h>
 #include <folly/dynamic.h>
+#include <folly/json.h>
 
 DEFINE_string(
     replay_switch_state_file,
@@ -31,6 +34,12 @@ namespace facebook::fboss {
 class HwSwitchStateReplayTest : public HwTest {
   std::shared_ptr<SwitchState> getWarmBootState() const {
     if (FLAGS_replay_switch_state_file.size()) {
+      // Agents store warm boot state in the binary format by default
+      if (WarmBootStateFile::isBinary(FLAGS_replay_switch_state_file)) {
+        return SwitchState::fromFollyDynamic(
+            WarmBootStateReader(FLAGS_replay_switch_state_file)
+                .getSubtree(kSwSwitch));
+      }
       std::string warmBootJson;
       auto ret =
           folly::readFile(FLAGS_replay_switch_state_file.c_str(), warmBootJson);
@@ -39,7 +48,7 @@ class HwSwitchStateReplayTest : public HwTest {
           "Unable to read switch state from : ",
           FLAGS_replay_switch_state_file);
       return SwitchState::fromFollyDynamic(
-          folly::parseJson(warmBootJson)["swSwitch"]);
+          folly::parseJson(warmBootJson)[kSwSwitch]);
     }
     // No file was given as input. This would happen when this gets
     // invoked as part of bcm_test test suite. In which case, just
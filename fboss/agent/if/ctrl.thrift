@@ -113,6 +113,40 @@ struct RouteDetails {
   7: list<NextHopThrift> nextHops,
 }
 
+struct RouteTableFilter {
+  // Only the routes of this VRF
+  1: optional i32 vrf,
+  // Only the routes within this prefix, including the prefix itself
+  2: optional IpPrefix prefix,
+  // Only the routes of this client, with the next hops it programmed
+  3: optional i16 clientId,
+}
+
+enum RouteChangeType {
+  ADDED = 1,
+  CHANGED = 2,
+  REMOVED = 3,
+}
+
+struct RouteChange {
+  1: RouteChangeType type,
+  2: i32 vrf,
+  // Only the destination is set for REMOVED changes
+  3: UnicastRoute route,
+}
+
+struct RouteUpdateBatch {
+  // Consecutive, starting at 0 for each subscription
+  1: i64 sequenceNumber,
+  // Forget all the routes received so far: this batch starts a snapshot of
+  // the route table, as ADDED changes. It is sent first, and again whenever
+  // the subscriber falls too far behind and its pending changes are dropped.
+  2: bool resync,
+  // This batch ends a snapshot: the following ones are incremental changes
+  3: bool snapshotDone,
+  4: list<RouteChange> changes,
+}
+
 struct MplsRouteDetails {
   1: mpls.MplsLabel topLabel
   2: string action
@@ -703,6 +737,26 @@ service FbossCtrl extends fb303.FacebookService {
     throws (1: fboss.FbossBaseError error)
   list<RouteDetails> getRouteTableDetails()
     throws (1: fboss.FbossBaseError error)
+  /*
+   * Streaming variants of getRouteTable, getRouteTableByClient and
+   * getRouteTableDetails. They send the routes of a snapshot of the route
+   * table matching the filter in chunks, instead of building the whole table
+   * in memory.
+   */
+  stream<list<UnicastRoute>> streamRouteTable(1: RouteTableFilter filter)
+    throws (1: fboss.FbossBaseError error)
+  stream<list<RouteDetails>> streamRouteTableDetails(
+    1: RouteTableFilter filter
+  ) throws (1: fboss.FbossBaseError error)
+  /*
+   * Subscribe to the changes of the routes matching the filter: a snapshot
+   * of the route table, then the routes added, changed and removed by each
+   * state update, as reported by streamRouteTable. A subscriber which falls
+   * behind gets a new snapshot (see RouteUpdateBatch.resync).
+   */
+  stream<RouteUpdateBatch> subscribeToRouteChanges(
+    1: RouteTableFilter filter
+  ) throws (1: fboss.FbossBaseError error)
   InterfaceDetail getInterfaceDetail(1: i32 interfaceId)
     throws (1: fboss.FbossBaseError error)
 
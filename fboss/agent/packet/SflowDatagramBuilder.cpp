@@ -0,0 +1,165 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/packet/SflowDatagramBuilder.h"
+
+#include <folly/io/Cursor.h>
+#include <glog/logging.h>
+
+using namespace folly;
+using namespace folly::io;
+
+namespace {
+
+// Compact data sources carry the ifIndex in their low 24 bits
+constexpr uint32_t kSflowIfIndexMask = 0x00ffffff;
+
+template <typename T>
+std::vector<facebook::fboss::sflow::byte> encode(
+    uint32_t size,
+    const T& structure) {
+  std::vector<facebook::fboss::sflow::byte> data(size);
+  auto buf = IOBuf::wrapBuffer(data.data(), size);
+  RWPrivateCursor cursor(buf.get());
+  structure.serialize(&cursor);
+  DCHECK_EQ(0, cursor.totalLength());
+  return data;
+}
+
+} // namespace
+
+namespace facebook::fboss {
+
+namespace sflow {
+
+SflowDatagramBuilder::SflowDatagramBuilder(
+    const folly::IPAddress& agentAddress,
+    uint32_t maxDatagramSize)
+    : agentAddress_(agentAddress),
+      maxDatagramSize_(maxDatagramSize),
+      start_(std::chrono::steady_clock::now()) {}
+
+void SflowDatagramBuilder::addFlowSample(const PacketSample& sample) {
+  SampledHeader hdr;
+  hdr.protocol = HeaderProtocol::ETHERNET_ISO88023;
+  hdr.frameLength = sample.frameLength;
+  hdr.stripped = sample.stripped;
+  hdr.headerLength = sample.header.size();
+  hdr.header = sample.header.data();
+  auto hdrData = encode(xdrPaddedSize(hdr.size()), hdr);
+
+  FlowRecord frecord;
+  frecord.flowFormat = kSampledHeaderFormat;
+  frecord.flowDataLen = hdrData.size();
+  frecord.flowData = hdrData.data();
+
+  SflowDataSource source = sample.sourceIfIndex & kSflowIfIndexMask;
+  auto& samplePool = samplePools_[source];
+  samplePool += sample.samplingRate;
+
+  FlowSample fsample;
+  fsample.sequenceNumber = ++flowSequenceNumbers_[source];
+  fsample.sourceID = source;
+  fsample.samplingRate = sample.samplingRate;
+  fsample.samplePool = samplePool;
+  fsample.drops = 0;
+  fsample.input = sample.input;
+  fsample.output = sample.output;
+  fsample.flowRecordsCnt = 1;
+  fsample.flowRecords = &frecord;
+  addSampleRecord(
+      kFlowSampleFormat, encode(fsample.size(frecord.size()), fsample));
+}
+
+void SflowDatagramBuilder::addCountersSample(const IfCounters& counters) {
+  auto counterData = encode(counters.size(), counters);
+
+  CounterRecord crecord;
+  crecord.counterFormat = kIfCountersFormat;
+  crecord.counterDataLen = counterData.size();
+  crecord.counterData = counterData.data();
+
+  SflowDataSource source = counters.ifIndex & kSflowIfIndexMask;
+  CountersSample csample;
+  csample.sequenceNumber = ++counterSequenceNumbers_[source];
+  csample.sourceID = source;
+  csample.counterRecordsCnt = 1;
+  csample.counterRecords = &crecord;
+  addSampleRecord(
+      kCountersSampleFormat, encode(csample.size(crecord.size()), csample));
+}
+
+void SflowDatagramBuilder::addSampleRecord(
+    DataFormat sampleType,
+    std::vector<byte> sampleData) {
+  uint32_t recordSize = 4 /* sampleType */ + 4 /* sampleDataLen */ +
+      xdrPaddedSize(sampleData.size());
+  // A record too large for any datagram still goes out, alone
+  if (!pendingSamples_.empty() &&
+      headerSize() + pendingSize_ + recordSize > maxDatagramSize_) {
+    finishDatagram();
+  }
+  pendingSamples_.push_back(PendingSample{sampleType, std::move(sampleData)});
+  pendingSize_ += recordSize;
+}
+
+uint32_t SflowDatagramBuilder::headerSize() const {
+  SampleDatagram datagram;
+  datagram.datagramV5.agentAddress = agentAddress_;
+  return datagram.size(0);
+}
+
+void SflowDatagramBuilder::finishDatagram() {
+  if (pendingSamples_.empty()) {
+    return;
+  }
+  std::vector<SampleRecord> records;
+  records.reserve(pendingSamples_.size());
+  for (auto& sample : pendingSamples_) {
+    SampleRecord record;
+    record.sampleType = sample.sampleType;
+    record.sampleDataLen = sample.sampleData.size();
+    record.sampleData = sample.sampleData.data();
+    records.push_back(record);
+  }
+
+  SampleDatagram datagram;
+  datagram.datagramV5.agentAddress = agentAddress_;
+  datagram.datagramV5.subAgentID = 0; // no sub agent
+  datagram.datagramV5.sequenceNumber = ++datagramSequenceNumber_;
+  datagram.datagramV5.uptime =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start_)
+          .count();
+  datagram.datagramV5.samplesCnt = records.size();
+  datagram.datagramV5.samples = records.data();
+
+  auto size = datagram.size(pendingSize_);
+  auto buf = IOBuf::create(size);
+  buf->append(size);
+  RWPrivateCursor cursor(buf.get());
+  datagram.serialize(&cursor);
+  DCHECK_EQ(0, cursor.totalLength());
+  datagrams_.push_back(std::move(buf));
+
+  pendingSamples_.clear();
+  pendingSize_ = 0;
+}
+
+std::vector<std::unique_ptr<folly::IOBuf>>
+SflowDatagramBuilder::takeDatagrams() {
+  finishDatagram();
+  std::vector<std::unique_ptr<folly::IOBuf>> datagrams;
+  datagrams.swap(datagrams_);
+  return datagrams;
+}
+
+} // namespace sflow
+
+} // namespace facebook::fboss
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include "fboss/agent/packet/SflowStructs.h"
+
+#include <folly/IPAddress.h>
+#include <folly/Range.h>
+#include <folly/io/IOBuf.h>
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::fboss {
+
+namespace sflow {
+
+/*
+ * A packet sampled on a port, see FlowSample and SampledHeader.
+ */
+struct PacketSample {
+  // ifIndex of the port the packet was sampled on
+  uint32_t sourceIfIndex{0};
+  // 1 in samplingRate packets are sampled on sourceIfIndex
+  uint32_t samplingRate{0};
+  SflowPort input{0};
+  SflowPort output{0};
+  uint32_t frameLength{0};
+  uint32_t stripped{0};
+  // The leading bytes of the frame
+  folly::ByteRange header;
+};
+
+/*
+ * SflowDatagramBuilder encodes flow and counter samples into sFlow v5
+ * datagrams, packing as many samples as fit in maxDatagramSize bytes into
+ * each datagram.
+ *
+ * The builder keeps the per data source sequence numbers and sample pools,
+ * and the datagram sequence number, so one builder should be used for all
+ * the samples of an agent. It does no I/O and no locking: samples are added
+ * and datagrams taken from whichever thread owns the builder.
+ */
+class SflowDatagramBuilder {
+ public:
+  // Fits in a 1500 byte MTU under IPv6 and UDP headers
+  static constexpr uint32_t kDefaultMaxDatagramSize = 1400;
+
+  explicit SflowDatagramBuilder(
+      const folly::IPAddress& agentAddress,
+      uint32_t maxDatagramSize = kDefaultMaxDatagramSize);
+
+  void setAgentAddress(const folly::IPAddress& agentAddress) {
+    agentAddress_ = agentAddress;
+  }
+
+  void addFlowSample(const PacketSample& sample);
+  void addCountersSample(const IfCounters& counters);
+
+  /*
+   * Number of complete datagrams, not counting the one still being filled.
+   */
+  size_t numFullDatagrams() const {
+    return datagrams_.size();
+  }
+  bool empty() const {
+    return datagrams_.empty() && pendingSamples_.empty();
+  }
+
+  /*
+   * Close the datagram being filled and return every datagram built so far.
+   * Each returned IOBuf holds exactly one datagram in a single buffer.
+   */
+  std::vector<std::unique_ptr<folly::IOBuf>> takeDatagrams();
+
+ private:
+  static constexpr DataFormat kFlowSampleFormat = 1;
+  static constexpr DataFormat kCountersSampleFormat = 2;
+  static constexpr DataFormat kSampledHeaderFormat = 1;
+  static constexpr DataFormat kIfCountersFormat = 1;
+
+  struct PendingSample {
+    DataFormat sampleType;
+    std::vector<byte> sampleData;
+  };
+
+  // Add sampleData to the datagram being filled, as a SampleRecord
+  void addSampleRecord(DataFormat sampleType, std::vector<byte> sampleData);
+  void finishDatagram();
+  uint32_t headerSize() const;
+
+  folly::IPAddress agentAddress_;
+  const uint32_t maxDatagramSize_;
+  const std::chrono::steady_clock::time_point start_;
+  uint32_t datagramSequenceNumber_{0};
+  std::unordered_map<SflowDataSource, uint32_t> flowSequenceNumbers_;
+  std::unordered_map<SflowDataSource, uint32_t> samplePools_;
+  std::unordered_map<SflowDataSource, uint32_t> counterSequenceNumbers_;
+
+  // Samples of the datagram being filled, and the size of their records
+  std::vector<PendingSample> pendingSamples_;
+  uint32_t pendingSize_{0};
+  std::vector<std::unique_ptr<folly::IOBuf>> datagrams_;
+};
+
+} // namespace sflow
+
+} // namespace facebook::fboss
@@ -17,17 +17,35 @@ namespace facebook::fboss {
 
 namespace sflow {
 
+namespace {
+
+void serializeXdrPadding(RWPrivateCursor* cursor, uint32_t len) {
+  if (len % XDR_BASIC_BLOCK_SIZE > 0) {
+    int fillCnt = XDR_BASIC_BLOCK_SIZE - len % XDR_BASIC_BLOCK_SIZE;
+    std::vector<byte> crud(XDR_BASIC_BLOCK_SIZE, 0);
+    cursor->push(crud.data(), fillCnt);
+  }
+}
+
+} // namespace
+
 void serializeIP(RWPrivateCursor* cursor, folly::IPAddress ip) {
   // We first push the address type
-  cursor->writeBE<uint32_t>(static_cast<uint32_t>(AddressType::IP_V6));
+  auto type = ip.isV4() ? AddressType::IP_V4 : AddressType::IP_V6;
+  cursor->writeBE<uint32_t>(static_cast<uint32_t>(type));
   // then push the address in bytes
   cursor->push(ip.bytes(), ip.byteCount());
 }
 
-uint32_t sizeIP(folly::IPAddress const& ip) {
+uint32_t sizeIP(const folly::IPAddress& ip) {
   return 4 + ip.byteCount();
 }
 
+uint32_t xdrPaddedSize(uint32_t len) {
+  return (len + XDR_BASIC_BLOCK_SIZE - 1) / XDR_BASIC_BLOCK_SIZE *
+      XDR_BASIC_BLOCK_SIZE;
+}
+
 void serializeDataFormat(RWPrivateCursor* cursor, DataFormat fmt) {
   cursor->writeBE<DataFormat>(fmt);
 }
@@ -72,6 +90,18 @@ void FlowSample::serialize(RWPrivateCursor* cursor) const {
   }
 }
 
+void CounterRecord::serialize(RWPrivateCursor* cursor) const {
+  serializeDataFormat(cursor, this->counterFormat);
+  // serialize XDR opaque sFlow counter_data
+  cursor->writeBE<uint32_t>(this->counterDataLen);
+  cursor->push(this->counterData, this->counterDataLen);
+  serializeXdrPadding(cursor, this->counterDataLen);
+}
+
+uint32_t CounterRecord::size() const {
+  return 4 /* counterFormat */ + 4 /* counterDataLen */ + this->counterDataLen;
+}
+
 uint32_t FlowSample::size(const uint32_t frecordsSize) const {
   // TODO infer the flow records size instead and remove the input param.
   return 4 /* sequenceNumber */ + 4 /* sourceId */ + 4 /* samplingRate */ +
@@ -79,6 +109,20 @@ uint32_t FlowSample::size(const uint32_t frecordsSize) const {
       4 /* flowRecordCnt */ + frecordsSize;
 }
 
+void CountersSample::serialize(RWPrivateCursor* cursor) const {
+  cursor->writeBE<uint32_t>(this->sequenceNumber);
+  serializeSflowDataSource(cursor, this->sourceID);
+  cursor->writeBE<uint32_t>(this->counterRecordsCnt);
+  for (int i = 0; i < this->counterRecordsCnt; i++) {
+    this->counterRecords[i].serialize(cursor);
+  }
+}
+
+uint32_t CountersSample::size(const uint32_t crecordsSize) const {
+  return 4 /* sequenceNumber */ + 4 /* sourceId */ +
+      4 /* counterRecordsCnt */ + crecordsSize;
+}
+
 void SampleRecord::serialize(RWPrivateCursor* cursor) const {
   serializeDataFormat(cursor, this->sampleType);
   cursor->writeBE<uint32_t>(this->sampleDataLen);
@@ -109,7 +153,7 @@ void SampleDatagramV5::serialize(RWPrivateCursor* cursor) const {
 }
 
 uint32_t SampleDatagramV5::size(const uint32_t recordsSize) const {
-  return this->agentAddress.byteCount() + 4 /* subAgentID */ +
+  return sizeIP(this->agentAddress) + 4 /* subAgentID */ +
       4 /*sequenceNumber */ + 4 /*uptime*/
       + 4 /*samplesCnt */ + recordsSize;
 }
@@ -142,6 +186,39 @@ uint32_t SampledHeader::size() const {
       4 /* headerLength */ + this->headerLength;
 }
 
+void IfCounters::serialize(RWPrivateCursor* cursor) const {
+  cursor->writeBE<uint32_t>(this->ifIndex);
+  cursor->writeBE<uint32_t>(this->ifType);
+  cursor->writeBE<uint64_t>(this->ifSpeed);
+  cursor->writeBE<uint32_t>(this->ifDirection);
+  cursor->writeBE<uint32_t>(this->ifStatus);
+  cursor->writeBE<uint64_t>(this->ifInOctets);
+  cursor->writeBE<uint32_t>(this->ifInUcastPkts);
+  cursor->writeBE<uint32_t>(this->ifInMulticastPkts);
+  cursor->writeBE<uint32_t>(this->ifInBroadcastPkts);
+  cursor->writeBE<uint32_t>(this->ifInDiscards);
+  cursor->writeBE<uint32_t>(this->ifInErrors);
+  cursor->writeBE<uint32_t>(this->ifInUnknownProtos);
+  cursor->writeBE<uint64_t>(this->ifOutOctets);
+  cursor->writeBE<uint32_t>(this->ifOutUcastPkts);
+  cursor->writeBE<uint32_t>(this->ifOutMulticastPkts);
+  cursor->writeBE<uint32_t>(this->ifOutBroadcastPkts);
+  cursor->writeBE<uint32_t>(this->ifOutDiscards);
+  cursor->writeBE<uint32_t>(this->ifOutErrors);
+  cursor->writeBE<uint32_t>(this->ifPromiscuousMode);
+}
+
+uint32_t IfCounters::size() const {
+  return 4 /* ifIndex */ + 4 /* ifType */ + 8 /* ifSpeed */ +
+      4 /* ifDirection */ + 4 /* ifStatus */ + 8 /* ifInOctets */ +
+      4 /* ifInUcastPkts */ + 4 /* ifInMulticastPkts */ +
+      4 /* ifInBroadcastPkts */ + 4 /* ifInDiscards */ + 4 /* ifInErrors */ +
+      4 /* ifInUnknownProtos */ + 8 /* ifOutOctets */ +
+      4 /* ifOutUcastPkts */ + 4 /* ifOutMulticastPkts */ +
+      4 /* ifOutBroadcastPkts */ + 4 /* ifOutDiscards */ +
+      4 /* ifOutErrors */ + 4 /* ifPromiscuousMode */;
+}
+
 } // namespace sflow
 
 } // namespace facebook::fboss
@@ -32,7 +32,10 @@ using byte = uint8_t;
 enum struct AddressType : uint32_t { UNKNOWN = 0, IP_V4 = 1, IP_V6 = 2 };
 
 void serializeIP(folly::io::RWPrivateCursor* cursor, folly::IPAddress ip);
-uint32_t sizeIP(folly::IPAddress ip);
+uint32_t sizeIP(const folly::IPAddress& ip);
+
+/* Size of an XDR opaque of the given length, including its padding */
+uint32_t xdrPaddedSize(uint32_t len);
 
 /* Data Format */
 using DataFormat = uint32_t;
@@ -60,8 +63,14 @@ struct FlowRecord {
   uint32_t size() const;
 };
 
-// TODO (sgwang)
-// struct counter_record {...}
+struct CounterRecord {
+  DataFormat counterFormat;
+  uint32_t counterDataLen;
+  byte* counterData;
+
+  void serialize(folly::io::RWPrivateCursor* cursor) const;
+  uint32_t size() const;
+};
 
 /* Compact Format Flow/Counter samples
  * If ifindex numbers are always < 2^24 then the compact must be used */
@@ -85,8 +94,15 @@ struct FlowSample {
 
 /* Format of a single counter sample */
 /* opaque = sample_data; enterprise = 0; format = 2 */
-// TODO (sgwang)
-// struct counters_sample {...}
+struct CountersSample {
+  uint32_t sequenceNumber;
+  SflowDataSource sourceID;
+  uint32_t counterRecordsCnt;
+  CounterRecord* counterRecords;
+
+  void serialize(folly::io::RWPrivateCursor* cursor) const;
+  uint32_t size(const uint32_t crecordsSize) const;
+};
 
 /* Extended Format Flow/Counter samples
  * If ifindex numbers may be >= 2^24 then the expanded must be used */
@@ -171,6 +187,33 @@ struct SampledHeader {
 
 // .. We omit the spec definition below (including) "Ethernet Frame Data" on p36
 
+/* Generic Interface Counters - see RFC 2233 */
+/* opaque = counter_data; enterprise = 0; format = 1 */
+struct IfCounters {
+  uint32_t ifIndex;
+  uint32_t ifType;
+  uint64_t ifSpeed;
+  uint32_t ifDirection;
+  uint32_t ifStatus;
+  uint64_t ifInOctets;
+  uint32_t ifInUcastPkts;
+  uint32_t ifInMulticastPkts;
+  uint32_t ifInBroadcastPkts;
+  uint32_t ifInDiscards;
+  uint32_t ifInErrors;
+  uint32_t ifInUnknownProtos;
+  uint64_t ifOutOctets;
+  uint32_t ifOutUcastPkts;
+  uint32_t ifOutMulticastPkts;
+  uint32_t ifOutBroadcastPkts;
+  uint32_t ifOutDiscards;
+  uint32_t ifOutErrors;
+  uint32_t ifPromiscuousMode;
+
+  void serialize(folly::io::RWPrivateCursor* cursor) const;
+  uint32_t size() const;
+};
+
 } // namespace sflow
 
 } // namespace facebook::fboss
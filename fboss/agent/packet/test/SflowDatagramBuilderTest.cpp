@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <folly/IPAddress.h>
+#include <folly/io/Cursor.h>
+
+#include "fboss/agent/packet/SflowDatagramBuilder.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::fboss;
+
+namespace {
+
+const folly::IPAddress kAgentIP("2401:db00:116:3016::1b");
+
+sflow::PacketSample makeSample(const std::vector<uint8_t>& header) {
+  sflow::PacketSample sample;
+  sample.sourceIfIndex = 56;
+  sample.samplingRate = 100;
+  sample.input = 56;
+  sample.output = 6;
+  sample.frameLength = 1500;
+  sample.header = folly::ByteRange(header.data(), header.size());
+  return sample;
+}
+
+} // namespace
+
+TEST(SflowDatagramBuilderTest, FlowSample) {
+  std::vector<uint8_t> header(11, 0x0f);
+  sflow::SflowDatagramBuilder builder(kAgentIP);
+  EXPECT_TRUE(builder.empty());
+  builder.addFlowSample(makeSample(header));
+  builder.addFlowSample(makeSample(header));
+  EXPECT_FALSE(builder.empty());
+  EXPECT_EQ(0, builder.numFullDatagrams());
+
+  auto datagrams = builder.takeDatagrams();
+  EXPECT_TRUE(builder.empty());
+  ASSERT_EQ(1, datagrams.size());
+  // 40 bytes of datagram header, then two 8 + 68 byte flow sample records
+  EXPECT_EQ(40 + 2 * 76, datagrams[0]->computeChainDataLength());
+
+  folly::io::Cursor cursor(datagrams[0].get());
+  EXPECT_EQ(5, cursor.readBE<uint32_t>()); // version
+  EXPECT_EQ(2, cursor.readBE<uint32_t>()); // ipv6 type
+  cursor.skip(16); // agent address
+  EXPECT_EQ(0, cursor.readBE<uint32_t>()); // sub agent
+  EXPECT_EQ(1, cursor.readBE<uint32_t>()); // datagram seq no.
+  cursor.skip(4); // uptime
+  EXPECT_EQ(2, cursor.readBE<uint32_t>()); // sample cnt
+  for (uint32_t seqNo = 1; seqNo <= 2; ++seqNo) {
+    EXPECT_EQ(1, cursor.readBE<uint32_t>()); // flow sample
+    EXPECT_EQ(68, cursor.readBE<uint32_t>()); // sample length
+    EXPECT_EQ(seqNo, cursor.readBE<uint32_t>()); // sample seq no.
+    EXPECT_EQ(56, cursor.readBE<uint32_t>()); // source ID
+    EXPECT_EQ(100, cursor.readBE<uint32_t>()); // sampling rate
+    EXPECT_EQ(100 * seqNo, cursor.readBE<uint32_t>()); // sample pool
+    EXPECT_EQ(0, cursor.readBE<uint32_t>()); // drops
+    EXPECT_EQ(56, cursor.readBE<uint32_t>()); // input port
+    EXPECT_EQ(6, cursor.readBE<uint32_t>()); // output port
+    EXPECT_EQ(1, cursor.readBE<uint32_t>()); // record cnt
+    EXPECT_EQ(1, cursor.readBE<uint32_t>()); // raw packet header
+    EXPECT_EQ(28, cursor.readBE<uint32_t>()); // record length
+    EXPECT_EQ(1, cursor.readBE<uint32_t>()); // ethernet
+    EXPECT_EQ(1500, cursor.readBE<uint32_t>()); // frame length
+    EXPECT_EQ(0, cursor.readBE<uint32_t>()); // stripped
+    EXPECT_EQ(11, cursor.readBE<uint32_t>()); // header length
+    for (int i = 0; i < 11; ++i) {
+      EXPECT_EQ(0x0f, cursor.read<uint8_t>());
+    }
+    EXPECT_EQ(0, cursor.read<uint8_t>()); // XDR padding
+  }
+  EXPECT_TRUE(cursor.isAtEnd());
+}
+
+TEST(SflowDatagramBuilderTest, CountersSample) {
+  sflow::SflowDatagramBuilder builder(folly::IPAddress("10.0.0.1"));
+  sflow::IfCounters counters{};
+  counters.ifIndex = 3;
+  counters.ifSpeed = 100000000000;
+  counters.ifInOctets = 1234;
+  counters.ifOutErrors = 7;
+  builder.addCountersSample(counters);
+  builder.addCountersSample(counters);
+
+  auto datagrams = builder.takeDatagrams();
+  ASSERT_EQ(1, datagrams.size());
+  // 28 bytes of datagram header, then two 8 + 108 byte counter sample records
+  EXPECT_EQ(28 + 2 * 116, datagrams[0]->computeChainDataLength());
+
+  folly::io::Cursor cursor(datagrams[0].get());
+  EXPECT_EQ(5, cursor.readBE<uint32_t>()); // version
+  EXPECT_EQ(1, cursor.readBE<uint32_t>()); // ipv4 type
+  EXPECT_EQ(0x0a000001, cursor.readBE<uint32_t>()); // agent address
+  cursor.skip(12); // sub agent, seq no., uptime
+  EXPECT_EQ(2, cursor.readBE<uint32_t>()); // sample cnt
+  cursor.skip(116); // first sample
+  EXPECT_EQ(2, cursor.readBE<uint32_t>()); // counters sample
+  EXPECT_EQ(108, cursor.readBE<uint32_t>()); // sample length
+  EXPECT_EQ(2, cursor.readBE<uint32_t>()); // sample seq no.
+  EXPECT_EQ(3, cursor.readBE<uint32_t>()); // source ID
+  EXPECT_EQ(1, cursor.readBE<uint32_t>()); // record cnt
+  EXPECT_EQ(1, cursor.readBE<uint32_t>()); // generic interface counters
+  EXPECT_EQ(88, cursor.readBE<uint32_t>()); // record length
+  EXPECT_EQ(3, cursor.readBE<uint32_t>()); // ifIndex
+  cursor.skip(4); // ifType
+  EXPECT_EQ(100000000000, cursor.readBE<uint64_t>()); // ifSpeed
+  cursor.skip(8); // ifDirection, ifStatus
+  EXPECT_EQ(1234, cursor.readBE<uint64_t>()); // ifInOctets
+  cursor.skip(48); // up to ifOutErrors
+  EXPECT_EQ(7, cursor.readBE<uint32_t>()); // ifOutErrors
+  cursor.skip(4); // ifPromiscuousMode
+  EXPECT_TRUE(cursor.isAtEnd());
+}
+
+TEST(SflowDatagramBuilderTest, SplitsAtMaxDatagramSize) {
+  std::vector<uint8_t> header(128, 0xab);
+  // Room for the 40 byte header and 5 records of 8 + 184 bytes
+  sflow::SflowDatagramBuilder builder(kAgentIP, 40 + 5 * 192);
+  for (int i = 0; i < 12; ++i) {
+    builder.addFlowSample(makeSample(header));
+  }
+  EXPECT_EQ(2, builder.numFullDatagrams());
+
+  auto datagrams = builder.takeDatagrams();
+  ASSERT_EQ(3, datagrams.size());
+  std::vector<uint32_t> expectedSamples{5, 5, 2};
+  for (int i = 0; i < datagrams.size(); ++i) {
+    EXPECT_FALSE(datagrams[i]->isChained());
+    EXPECT_EQ(
+        40 + expectedSamples[i] * 192, datagrams[i]->computeChainDataLength());
+    folly::io::Cursor cursor(datagrams[i].get());
+    cursor.skip(28);
+    EXPECT_EQ(i + 1, cursor.readBE<uint32_t>()); // datagram seq no.
+    cursor.skip(4);
+    EXPECT_EQ(expectedSamples[i], cursor.readBE<uint32_t>()); // sample cnt
+  }
+}
@@ -60,11 +60,39 @@ MultiPimPlatformMapping::MultiPimPlatformMapping(
   }
 }
 
+MultiPimPlatformMapping::MultiPimPlatformMapping(
+    const CompiledPlatformMapping& mapping) {
+  for (const auto& pim : mapping.pims) {
+    auto pimMapping = loadPimPlatformMapping(mapping, pim.first);
+    merge(pimMapping.get());
+    pims_[pim.first] = std::move(pimMapping);
+  }
+}
+
 PlatformMapping* MultiPimPlatformMapping::getPimPlatformMapping(uint8_t pimID) {
   if (auto itPim = pims_.find(pimID); itPim != pims_.end()) {
     return itPim->second.get();
   }
   throw FbossError("Invalid pim id:", static_cast<int>(pimID));
 }
+
+std::unique_ptr<PlatformMapping>
+MultiPimPlatformMapping::loadPimPlatformMapping(
+    const CompiledPlatformMapping& mapping,
+    uint8_t pimID) {
+  auto itPim = mapping.pims.find(pimID);
+  if (itPim == mapping.pims.end()) {
+    throw FbossError("Invalid pim id:", static_cast<int>(pimID));
+  }
+  return std::make_unique<PlatformMapping>(itPim->second);
+}
+
+std::vector<uint8_t> MultiPimPlatformMapping::getPimIDs() const {
+  std::vector<uint8_t> pimIDs;
+  for (const auto& pim : pims_) {
+    pimIDs.push_back(pim.first);
+  }
+  return pimIDs;
+}
 } // namespace fboss
 } // namespace facebook
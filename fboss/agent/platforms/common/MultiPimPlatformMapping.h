@@ -17,9 +17,24 @@ namespace fboss {
 class MultiPimPlatformMapping : public PlatformMapping {
  public:
   explicit MultiPimPlatformMapping(const std::string& jsonPlatformMappingStr);
+  /*
+   * Only the mapping of each PIM is compiled: the mapping of the platform is
+   * built by merging them, as they are deserialized.
+   */
+  explicit MultiPimPlatformMapping(const CompiledPlatformMapping& mapping);
 
   PlatformMapping* getPimPlatformMapping(uint8_t pimID);
 
+  /*
+   * Deserialize the mapping of a single PIM, for platforms merging those of
+   * the PIMs they support without building a MultiPimPlatformMapping.
+   */
+  static std::unique_ptr<PlatformMapping> loadPimPlatformMapping(
+      const CompiledPlatformMapping& mapping,
+      uint8_t pimID);
+
+  std::vector<uint8_t> getPimIDs() const;
+
  protected:
   std::map<uint8_t, std::unique_ptr<PlatformMapping>> pims_;
 
@@ -114,10 +114,17 @@ std::string PlatformPortProfileConfigMatcher::toString() const {
       .str();
 }
 
-PlatformMapping::PlatformMapping(const std::string& jsonPlatformMappingStr) {
-  auto mapping =
-      apache::thrift::SimpleJSONSerializer::deserialize<cfg::PlatformMapping>(
-          jsonPlatformMappingStr);
+PlatformMapping::PlatformMapping(const std::string& jsonPlatformMappingStr)
+    : PlatformMapping(
+          apache::thrift::SimpleJSONSerializer::deserialize<
+              cfg::PlatformMapping>(jsonPlatformMappingStr)) {}
+
+PlatformMapping::PlatformMapping(folly::ByteRange compactPlatformMapping)
+    : PlatformMapping(
+          apache::thrift::CompactSerializer::deserialize<cfg::PlatformMapping>(
+              compactPlatformMapping)) {}
+
+PlatformMapping::PlatformMapping(cfg::PlatformMapping mapping) {
   platformPorts_ = std::move(*mapping.ports_ref());
   platformSupportedProfiles_ =
       std::move(*mapping.platformSupportedProfiles_ref());
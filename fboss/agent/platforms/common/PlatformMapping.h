@@ -13,6 +13,8 @@
 #include "fboss/agent/types.h"
 #include "fboss/qsfp_service/if/gen-cpp2/transceiver_types.h"
 
+#include <folly/Range.h>
+
 DECLARE_bool(override_cmis_tx_setting);
 
 namespace facebook {
@@ -66,10 +68,23 @@ class PlatformPortProfileConfigMatcher {
   std::optional<TransceiverInfo> transceiverInfo_;
 };
 
+/*
+ * A platform mapping compiled at build time by platform_mapping_compiler, so
+ * that the agent doesn't parse megabytes of JSON at startup: the
+ * CompactSerializer encoding of the cfg::PlatformMapping or, for multi-PIM
+ * platforms, of the mapping of each PIM only.
+ */
+struct CompiledPlatformMapping {
+  folly::ByteRange mapping;
+  std::map<uint8_t, folly::ByteRange> pims;
+};
+
 class PlatformMapping {
  public:
   PlatformMapping() {}
   explicit PlatformMapping(const std::string& jsonPlatformMappingStr);
+  explicit PlatformMapping(folly::ByteRange compactPlatformMapping);
+  explicit PlatformMapping(cfg::PlatformMapping mapping);
   virtual ~PlatformMapping() = default;
 
   cfg::PlatformMapping toThrift() const;
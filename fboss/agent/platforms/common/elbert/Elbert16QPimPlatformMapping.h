@@ -13,6 +13,9 @@
 
 namespace facebook::fboss {
 
+// Compiled at build time from Elbert16QPimPlatformMapping.json
+CompiledPlatformMapping getElbert16QPimCompiledPlatformMapping();
+
 class Elbert16QPimPlatformMapping : public MultiPimPlatformMapping {
  public:
   Elbert16QPimPlatformMapping();
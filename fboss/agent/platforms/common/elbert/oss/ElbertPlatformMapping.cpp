@@ -15,9 +15,11 @@
 namespace facebook::fboss {
 ElbertPlatformMapping::ElbertPlatformMapping() {
   // current Elbert platform only supports 16Q pims
-  auto Elbert16Q = std::make_unique<Elbert16QPimPlatformMapping>();
+  auto Elbert16Q = getElbert16QPimCompiledPlatformMapping();
   for (uint8_t pimID = 2; pimID < 10; pimID++) {
-    this->merge(Elbert16Q->getPimPlatformMapping(pimID));
+    auto pim =
+        MultiPimPlatformMapping::loadPimPlatformMapping(Elbert16Q, pimID);
+    this->merge(pim.get());
   }
 }
 } // namespace facebook::fboss
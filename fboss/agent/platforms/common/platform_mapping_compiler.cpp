@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/platforms/common/MultiPimPlatformMapping.h"
+#include "fboss/agent/platforms/common/PlatformMapping.h"
+
+#include <folly/FileUtil.h>
+#include <folly/Format.h>
+#include <folly/String.h>
+#include <folly/init/Init.h>
+#include <folly/logging/xlog.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+DEFINE_string(json_file, "", "JSON platform mapping to compile");
+DEFINE_bool(
+    multi_pim,
+    false,
+    "Whether the platform has PIMs, in which case only the mapping of each "
+    "PIM is compiled, and the platform merges those of the PIMs it has");
+DEFINE_string(header, "", "Header declaring the generated function");
+DEFINE_string(function, "", "Name of the generated function");
+DEFINE_string(output, "", "C++ source file to generate");
+
+using namespace facebook::fboss;
+
+namespace {
+
+constexpr size_t kBytesPerLine = 16;
+
+std::string serialize(const PlatformMapping& mapping) {
+  return apache::thrift::CompactSerializer::serialize<std::string>(
+      mapping.toThrift());
+}
+
+std::string byteArray(const std::string& name, const std::string& bytes) {
+  std::string array = folly::sformat("const unsigned char {}[] = {{", name);
+  for (size_t i = 0; i < bytes.size(); ++i) {
+    array += i % kBytesPerLine ? " " : "\n    ";
+    array += folly::sformat("0x{:02x},", static_cast<uint8_t>(bytes[i]));
+  }
+  return array + "\n};\n";
+}
+
+} // namespace
+
+/*
+ * Compiles a JSON platform mapping into the CompactSerializer encoding the
+ * agent loads at startup, as a C++ source file defining
+ *   CompiledPlatformMapping <function>();
+ *
+ * CLI:
+ *   platform_mapping_compiler --json_file <mapping.json> [--multi_pim]
+ *     --header <header> --function <function> --output <output.cpp>
+ */
+int main(int argc, char* argv[]) {
+  folly::init(&argc, &argv, true);
+
+  if (FLAGS_json_file.empty() || FLAGS_header.empty() ||
+      FLAGS_function.empty() || FLAGS_output.empty()) {
+    XLOG(FATAL) << "--json_file, --header, --function and --output are "
+                << "required";
+  }
+  std::string json;
+  if (!folly::readFile(FLAGS_json_file.c_str(), json)) {
+    XLOG(FATAL) << "Failed to read " << FLAGS_json_file;
+  }
+
+  std::string mapping;
+  std::map<uint8_t, std::string> pims;
+  if (FLAGS_multi_pim) {
+    MultiPimPlatformMapping multiPimMapping(json);
+    for (auto pimID : multiPimMapping.getPimIDs()) {
+      pims[pimID] = serialize(*multiPimMapping.getPimPlatformMapping(pimID));
+    }
+  } else {
+    mapping = serialize(PlatformMapping(json));
+  }
+
+  auto source = folly::sformat(
+      "// @"
+      "generated by platform_mapping_compiler from {}\n\n"
+      "#include \"{}\"\n\n"
+      "namespace facebook::fboss {{\n\n"
+      "namespace {{\n\n",
+      FLAGS_json_file,
+      FLAGS_header);
+  std::vector<std::string> arrays;
+  if (!mapping.empty()) {
+    arrays.push_back(byteArray("kMapping", mapping));
+  }
+  for (const auto& [pimID, pimMapping] : pims) {
+    auto name = folly::sformat("kPim{}", static_cast<int>(pimID));
+    arrays.push_back(byteArray(name, pimMapping));
+  }
+  source += folly::join("\n", arrays);
+  source += folly::sformat(
+      "\n}} // namespace\n\n"
+      "CompiledPlatformMapping {}() {{\n"
+      "  CompiledPlatformMapping compiled;\n",
+      FLAGS_function);
+  if (!mapping.empty()) {
+    source +=
+        "  compiled.mapping = folly::ByteRange(kMapping, sizeof(kMapping));\n";
+  }
+  for (const auto& pim : pims) {
+    source += folly::sformat(
+        "  compiled.pims[{0}] = folly::ByteRange(kPim{0}, sizeof(kPim{0}));\n",
+        static_cast<int>(pim.first));
+  }
+  source +=
+      "  return compiled;\n"
+      "}\n\n"
+      "} // namespace facebook::fboss\n";
+
+  if (!folly::writeFile(source, FLAGS_output.c_str())) {
+    XLOG(FATAL) << "Failed to write " << FLAGS_output;
+  }
+  size_t compiledSize = mapping.size();
+  for (const auto& pim : pims) {
+    compiledSize += pim.second.size();
+  }
+  XLOG(INFO) << "Compiled " << json.size() << " bytes of JSON from "
+             << FLAGS_json_file << " into " << compiledSize << " bytes"
+             << (pims.empty() ? ""
+                              : folly::sformat(" for {} PIMs", pims.size()));
+  return 0;
+}
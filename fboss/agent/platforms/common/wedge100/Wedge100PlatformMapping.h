@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Wedge100PlatformMapping.json
+CompiledPlatformMapping getWedge100CompiledPlatformMapping();
+
 class Wedge100PlatformMapping : public PlatformMapping {
  public:
   Wedge100PlatformMapping();
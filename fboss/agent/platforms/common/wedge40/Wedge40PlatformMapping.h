@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Wedge40PlatformMapping.json
+CompiledPlatformMapping getWedge40CompiledPlatformMapping();
+
 class Wedge40PlatformMapping : public PlatformMapping {
  public:
   Wedge40PlatformMapping();
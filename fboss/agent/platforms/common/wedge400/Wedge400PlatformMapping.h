@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Wedge400PlatformMapping.json
+CompiledPlatformMapping getWedge400CompiledPlatformMapping();
+
 class Wedge400PlatformMapping : public PlatformMapping {
  public:
   Wedge400PlatformMapping();
@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Wedge400CPlatformMapping.json
+CompiledPlatformMapping getWedge400CCompiledPlatformMapping();
+
 class Wedge400CPlatformMapping : public PlatformMapping {
  public:
   Wedge400CPlatformMapping();
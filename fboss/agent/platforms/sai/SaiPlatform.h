@@ -18,6 +18,7 @@
 #include "fboss/agent/platforms/sai/SaiPlatformPort.h"
 #include "fboss/agent/platforms/tests/utils/TestPlatformTypes.h"
 
+#include "fboss/agent/hw/sai/api/SaiApiLock.h"
 #include "fboss/agent/hw/sai/api/SaiVersion.h"
 
 #include <memory>
@@ -100,6 +101,19 @@ class SaiPlatform : public Platform, public StateObserver {
 
   virtual void initLEDs() = 0;
 
+  /*
+   * Concurrent SAI calls the adapter supports. Unless declared otherwise,
+   * all SAI calls are serialized.
+   *
+   * No platform declares any yet: the fake SAI keeps its objects in
+   * unsynchronized maps shared across APIs, and the vendor adapters have
+   * not been qualified for concurrent calls. A platform opts in by
+   * overriding this once its adapter is.
+   */
+  virtual SaiApiLock::Concurrency getSaiApiConcurrency() const {
+    return SaiApiLock::Concurrency::NONE;
+  }
+
  private:
   void initImpl(uint32_t hwFeaturesDesired) override;
   void initSaiProfileValues();
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <thrift/lib/cpp2/protocol/Serializer.h>
+
+#include "fboss/agent/platforms/common/MultiPimPlatformMapping.h"
+#include "fboss/agent/platforms/common/PlatformMapping.h"
+#include "fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/common/elbert/ElbertPlatformMapping.h"
+#include "fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.h"
+#include "fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.h"
+#include "fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.h"
+#include "fboss/agent/platforms/common/wedge400c/Wedge400CPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/fuji/Fuji16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/fuji/FujiPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/minipack/Minipack16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/minipack/MinipackPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/yamp/Yamp16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/yamp/YampPlatformMapping.h"
+
+/*
+ * Time it takes each platform to load its platform mapping at startup, from
+ * the mapping compiled at build time, relative to parsing the same mapping
+ * from JSON as the agent used to.
+ */
+
+namespace facebook::fboss {
+
+namespace {
+
+std::string toJson(const CompiledPlatformMapping& compiled) {
+  // Multi-PIM platforms only have the mappings of their PIMs compiled
+  std::unique_ptr<PlatformMapping> mapping;
+  if (compiled.pims.empty()) {
+    mapping = std::make_unique<PlatformMapping>(compiled.mapping);
+  } else {
+    mapping = std::make_unique<MultiPimPlatformMapping>(compiled);
+  }
+  return apache::thrift::SimpleJSONSerializer::serialize<std::string>(
+      mapping->toThrift());
+}
+
+void loadJsonMapping(unsigned iters, const CompiledPlatformMapping& compiled) {
+  std::string json;
+  BENCHMARK_SUSPEND {
+    json = toJson(compiled);
+  }
+  for (unsigned i = 0; i < iters; ++i) {
+    if (compiled.pims.empty()) {
+      PlatformMapping mapping(json);
+      folly::doNotOptimizeAway(mapping.getPlatformPorts().size());
+    } else {
+      // As the multi-PIM platforms do, build the mapping of the chassis from
+      // those of its PIMs
+      MultiPimPlatformMapping multiPimMapping(json);
+      PlatformMapping mapping;
+      for (auto pimID : multiPimMapping.getPimIDs()) {
+        mapping.merge(multiPimMapping.getPimPlatformMapping(pimID));
+      }
+      folly::doNotOptimizeAway(mapping.getPlatformPorts().size());
+    }
+  }
+}
+
+template <typename PlatformMappingT, typename... Args>
+void loadCompiledMapping(unsigned iters, Args... args) {
+  for (unsigned i = 0; i < iters; ++i) {
+    PlatformMappingT mapping(args...);
+    folly::doNotOptimizeAway(mapping.getPlatformPorts().size());
+  }
+}
+
+} // namespace
+
+#define PLATFORM_MAPPING_BENCHMARK(NAME, COMPILED_MAPPING, ...)       \
+  BENCHMARK(NAME##JsonPlatformMapping, iters) {                       \
+    loadJsonMapping(iters, COMPILED_MAPPING());                       \
+  }                                                                   \
+  BENCHMARK_RELATIVE(NAME##CompiledPlatformMapping, iters) {          \
+    loadCompiledMapping<NAME##PlatformMapping>(iters, ##__VA_ARGS__); \
+  }                                                                   \
+  BENCHMARK_DRAW_LINE();
+
+PLATFORM_MAPPING_BENCHMARK(Wedge40, getWedge40CompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Wedge100, getWedge100CompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Wedge400, getWedge400CompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Wedge400C, getWedge400CCompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Elbert, getElbert16QPimCompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Yamp, getYamp16QPimCompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(Fuji, getFuji16QPimCompiledPlatformMapping)
+PLATFORM_MAPPING_BENCHMARK(
+    Minipack,
+    getMinipack16QPimMiln52CompiledPlatformMapping,
+    ExternalPhyVersion::MILN5_2)
+
+} // namespace facebook::fboss
+
+int main(int argc, char* argv[]) {
+  folly::init(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
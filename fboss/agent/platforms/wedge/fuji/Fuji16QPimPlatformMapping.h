@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Fuji16QPimPlatformMapping.json
+CompiledPlatformMapping getFuji16QPimCompiledPlatformMapping();
+
 class Fuji16QPimPlatformMapping : public MultiPimPlatformMapping {
  public:
   explicit Fuji16QPimPlatformMapping();
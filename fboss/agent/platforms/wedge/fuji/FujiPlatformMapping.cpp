@@ -15,9 +15,10 @@ namespace facebook {
 namespace fboss {
 FujiPlatformMapping::FujiPlatformMapping() {
   // current minipack platform only supports 16Q pims
-  auto fuji16Q = std::make_unique<Fuji16QPimPlatformMapping>();
+  auto fuji16Q = getFuji16QPimCompiledPlatformMapping();
   for (uint8_t pimID = 2; pimID < 10; pimID++) {
-    this->merge(fuji16Q->getPimPlatformMapping(pimID));
+    auto pim = MultiPimPlatformMapping::loadPimPlatformMapping(fuji16Q, pimID);
+    this->merge(pim.get());
   }
 }
 } // namespace fboss
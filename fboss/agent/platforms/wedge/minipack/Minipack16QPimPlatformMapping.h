@@ -15,6 +15,14 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Minipack16QPimMiln42PlatformMapping.json
+CompiledPlatformMapping getMinipack16QPimMiln42CompiledPlatformMapping();
+// Compiled at build time from Minipack16QPimMiln52PlatformMapping.json
+CompiledPlatformMapping getMinipack16QPimMiln52CompiledPlatformMapping();
+// Either of the above, for the xphy version of the PIMs
+CompiledPlatformMapping getMinipack16QPimCompiledPlatformMapping(
+    ExternalPhyVersion xphyVersion);
+
 class Minipack16QPimPlatformMapping : public MultiPimPlatformMapping {
  public:
   explicit Minipack16QPimPlatformMapping(ExternalPhyVersion xphyVersion);
@@ -17,10 +17,11 @@ namespace fboss {
 MinipackPlatformMapping::MinipackPlatformMapping(
     ExternalPhyVersion xphyVersion) {
   // current Minipack oss platform only supports 16Q pims
-  auto minipack16Q =
-      std::make_unique<Minipack16QPimPlatformMapping>(xphyVersion);
+  auto minipack16Q = getMinipack16QPimCompiledPlatformMapping(xphyVersion);
   for (uint8_t pimID = 2; pimID < 10; pimID++) {
-    this->merge(minipack16Q->getPimPlatformMapping(pimID));
+    auto pim =
+        MultiPimPlatformMapping::loadPimPlatformMapping(minipack16Q, pimID);
+    this->merge(pim.get());
   }
 }
 } // namespace fboss
@@ -11,6 +11,7 @@
 #include "fboss/agent/platforms/wedge/tests/PlatformMappingTest.h"
 
 #include "fboss/agent/FbossError.h"
+#include "fboss/agent/platforms/common/MultiPimPlatformMapping.h"
 #include "fboss/agent/platforms/common/PlatformMode.h"
 #include "fboss/agent/platforms/common/elbert/Elbert16QPimPlatformMapping.h"
 #include "fboss/agent/platforms/common/galaxy/GalaxyFCPlatformMapping.h"
@@ -18,11 +19,22 @@
 #include "fboss/agent/platforms/common/wedge100/Wedge100PlatformMapping.h"
 #include "fboss/agent/platforms/common/wedge40/Wedge40PlatformMapping.h"
 #include "fboss/agent/platforms/common/wedge400/Wedge400PlatformMapping.h"
+#include "fboss/agent/platforms/wedge/fuji/Fuji16QPimPlatformMapping.h"
 #include "fboss/agent/platforms/wedge/minipack/Minipack16QPimPlatformMapping.h"
+#include "fboss/agent/platforms/wedge/yamp/Yamp16QPimPlatformMapping.h"
 #include "fboss/agent/platforms/wedge/yamp/YampPlatformMapping.h"
 
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
+#include <gflags/gflags.h>
 #include <gtest/gtest.h>
 
+DEFINE_string(
+    platform_mapping_json_dir,
+    "fboss/agent/platforms",
+    "Directory of the source JSON platform mappings, which the compiled "
+    "mappings are checked against");
+
 namespace facebook::fboss::test {
 
 cfg::PlatformPortProfileConfigEntry createPlatformPortProfileConfigEntry(
@@ -811,6 +823,69 @@ TEST_F(PlatformMappingTest, VerifyElbert16QPlatformMapping) {
   verify(mapping.get());
 }
 
+TEST_F(PlatformMappingTest, VerifyCompiledPimPlatformMappings) {
+  // The PIMs compiled at build time must match those split from the source
+  // JSON mappings at runtime, as the agent used to
+  auto checkCompiledPims = [](MultiPimPlatformMapping* compiled,
+                              const std::string& jsonFile) {
+    auto path =
+        folly::to<std::string>(FLAGS_platform_mapping_json_dir, "/", jsonFile);
+    std::string json;
+    ASSERT_TRUE(folly::readFile(path.c_str(), json)) << "Failed to read "
+                                                     << path;
+    MultiPimPlatformMapping jsonMapping(json);
+    ASSERT_EQ(compiled->getPimIDs(), jsonMapping.getPimIDs()) << jsonFile;
+    for (auto pimID : jsonMapping.getPimIDs()) {
+      EXPECT_EQ(
+          compiled->getPimPlatformMapping(pimID)->toThrift(),
+          jsonMapping.getPimPlatformMapping(pimID)->toThrift())
+          << jsonFile << " PIM " << static_cast<int>(pimID);
+    }
+    // The platform merges the PIMs into the same ports as the JSON has
+    EXPECT_EQ(compiled->getPlatformPorts(), jsonMapping.getPlatformPorts())
+        << jsonFile;
+  };
+  checkCompiledPims(
+      std::make_unique<Elbert16QPimPlatformMapping>().get(),
+      "common/elbert/Elbert16QPimPlatformMapping.json");
+  checkCompiledPims(
+      std::make_unique<Fuji16QPimPlatformMapping>().get(),
+      "wedge/fuji/Fuji16QPimPlatformMapping.json");
+  checkCompiledPims(
+      std::make_unique<Yamp16QPimPlatformMapping>().get(),
+      "wedge/yamp/Yamp16QPimPlatformMapping.json");
+  checkCompiledPims(
+      std::make_unique<Minipack16QPimPlatformMapping>(
+          ExternalPhyVersion::MILN4_2)
+          .get(),
+      "wedge/minipack/Minipack16QPimMiln42PlatformMapping.json");
+  checkCompiledPims(
+      std::make_unique<Minipack16QPimPlatformMapping>(
+          ExternalPhyVersion::MILN5_2)
+          .get(),
+      "wedge/minipack/Minipack16QPimMiln52PlatformMapping.json");
+
+  auto mapping = std::make_unique<Elbert16QPimPlatformMapping>();
+  std::vector<uint8_t> expectedPimIDs = {2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(mapping->getPimIDs(), expectedPimIDs);
+  for (auto pimID : expectedPimIDs) {
+    auto pim = mapping->getPimPlatformMapping(pimID);
+    EXPECT_EQ(pim, mapping->getPimPlatformMapping(pimID));
+    EXPECT_FALSE(pim->getPlatformPorts().empty());
+    for (const auto& port : pim->getPlatformPorts()) {
+      EXPECT_EQ(pimID, mapping->getPimID(PortID(port.first)));
+    }
+  }
+  EXPECT_THROW(mapping->getPimPlatformMapping(10), FbossError);
+
+  // Only the PIMs are compiled
+  auto compiled = getElbert16QPimCompiledPlatformMapping();
+  EXPECT_TRUE(compiled.mapping.empty());
+  EXPECT_THROW(
+      MultiPimPlatformMapping::loadPimPlatformMapping(compiled, 10),
+      FbossError);
+}
+
 TEST_F(PlatformMappingTest, VerifyPlatformSupportedProfileMerge) {
   auto platformMapping = PlatformMapping();
   cfg::PlatformPortProfileConfigEntry configEntry1 =
@@ -14,6 +14,9 @@
 namespace facebook {
 namespace fboss {
 
+// Compiled at build time from Yamp16QPimPlatformMapping.json
+CompiledPlatformMapping getYamp16QPimCompiledPlatformMapping();
+
 class Yamp16QPimPlatformMapping : public MultiPimPlatformMapping {
  public:
   Yamp16QPimPlatformMapping();
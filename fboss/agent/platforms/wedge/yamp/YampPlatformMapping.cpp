@@ -16,9 +16,10 @@ namespace facebook {
 namespace fboss {
 YampPlatformMapping::YampPlatformMapping() {
   // current Yamp platform only supports 16Q pims
-  auto yamp16Q = std::make_unique<Yamp16QPimPlatformMapping>();
+  auto yamp16Q = getYamp16QPimCompiledPlatformMapping();
   for (uint8_t pimID = 2; pimID < 10; pimID++) {
-    this->merge(yamp16Q->getPimPlatformMapping(pimID));
+    auto pim = MultiPimPlatformMapping::loadPimPlatformMapping(yamp16Q, pimID);
+    this->merge(pim.get());
   }
 }
 } // namespace fboss
@@ -46,22 +46,84 @@ std::shared_ptr<SwitchState> ForwardingInformationBaseUpdater::operator()(
   auto nextFibContainer = previousFibContainer->modify(&nextState);
 
   nextFibContainer->writableFields()->fibV4 =
-      std::shared_ptr<ForwardingInformationBaseV4>(createUpdatedFib(
-          v4NetworkToRoute_, previousFibContainer->getFibV4()));
+      createUpdatedFib(v4NetworkToRoute_, previousFibContainer->getFibV4());
 
   nextFibContainer->writableFields()->fibV6 =
-      std::shared_ptr<ForwardingInformationBaseV6>(createUpdatedFib(
-          v6NetworkToRoute_, previousFibContainer->getFibV6()));
+      createUpdatedFib(v6NetworkToRoute_, previousFibContainer->getFibV6());
 
   return nextState;
 }
 
 template <typename AddressT>
-std::unique_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
 ForwardingInformationBaseUpdater::createUpdatedFib(
     const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
     const std::shared_ptr<facebook::fboss::ForwardingInformationBase<AddressT>>&
         fib) {
+  auto& syncState = rib.fibSyncState();
+
+  std::shared_ptr<facebook::fboss::ForwardingInformationBase<AddressT>>
+      updatedFib;
+  if (fib && syncState.lastSyncedFib.lock() == fib) {
+    updatedFib = applyChangedPrefixes(rib, fib);
+  } else {
+    updatedFib = rebuildFib(rib, fib);
+  }
+
+  syncState.changedPrefixes.clear();
+  syncState.lastSyncedFib = updatedFib;
+  return updatedFib;
+}
+
+template <typename AddressT>
+std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+ForwardingInformationBaseUpdater::applyChangedPrefixes(
+    const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
+    const std::shared_ptr<facebook::fboss::ForwardingInformationBase<AddressT>>&
+        fib) {
+  auto& changedPrefixes = rib.fibSyncState().changedPrefixes;
+  if (changedPrefixes.empty()) {
+    return fib;
+  }
+  std::sort(changedPrefixes.begin(), changedPrefixes.end());
+  changedPrefixes.erase(
+      std::unique(changedPrefixes.begin(), changedPrefixes.end()),
+      changedPrefixes.end());
+
+  // The clone shares its routes with fib, and each change below only copies
+  // the path to the changed route, so the update costs O(changes * log N)
+  auto updatedFib = fib->clone();
+  for (const auto& prefix : changedPrefixes) {
+    facebook::fboss::RoutePrefix<AddressT> fibPrefix{prefix.network,
+                                                     prefix.mask};
+    auto ribItr = rib.exactMatch(prefix.network, prefix.mask);
+    if (ribItr == rib.end() || !ribItr->value().isResolved()) {
+      updatedFib->removeNodeIf(fibPrefix);
+      continue;
+    }
+
+    const facebook::fboss::rib::Route<AddressT>& ribRoute = ribItr->value();
+    auto fibRoute = updatedFib->exactMatch(fibPrefix);
+    if (!fibRoute) {
+      updatedFib->addNode(toFibRoute(ribRoute));
+    } else if (
+        fibRoute->getClassID() != ribRoute.getClassID() ||
+        fibRoute->isConnected() != ribRoute.isConnected() ||
+        !(toFibNextHop(ribRoute.getForwardInfo()) ==
+          fibRoute->getForwardInfo())) {
+      updatedFib->updateNode(toFibRoute(ribRoute));
+    }
+  }
+
+  return updatedFib;
+}
+
+template <typename AddressT>
+std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+ForwardingInformationBaseUpdater::rebuildFib(
+    const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
+    const std::shared_ptr<facebook::fboss::ForwardingInformationBase<AddressT>>&
+        fib) {
   // TODO(samank): updateFib should have size equal to the number of resovled
   // routes in the rib
 
@@ -94,7 +156,7 @@ ForwardingInformationBaseUpdater::createUpdatedFib(
       fibRoute = toFibRoute(ribRoute);
     }
 
-    updatedFib.emplace_hint(updatedFib.cend(), fibPrefix, fibRoute);
+    updatedFib.insert(std::make_pair(fibPrefix, fibRoute));
   }
 
   DCHECK_EQ(
@@ -107,7 +169,7 @@ ForwardingInformationBaseUpdater::createUpdatedFib(
             return entry.value().isResolved();
           }));
 
-  return std::make_unique<ForwardingInformationBase<AddressT>>(
+  return std::make_shared<ForwardingInformationBase<AddressT>>(
       std::move(updatedFib));
 }
 
@@ -45,12 +45,30 @@ class ForwardingInformationBaseUpdater {
       const Route<AddrT>& ribRoute);
 
  private:
+  /*
+   * If `fib` is the FIB we derived from `rib` last time, only the prefixes
+   * marked as changed in `rib` since then are applied to a clone of it.
+   * Otherwise the FIB is rebuilt from scratch, reusing routes of `fib` which
+   * did not change.
+   */
   template <typename AddressT>
-  std::unique_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+  std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
   createUpdatedFib(
       const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
       const std::shared_ptr<
           facebook::fboss::ForwardingInformationBase<AddressT>>& fib);
+  template <typename AddressT>
+  std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+  applyChangedPrefixes(
+      const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
+      const std::shared_ptr<
+          facebook::fboss::ForwardingInformationBase<AddressT>>& fib);
+  template <typename AddressT>
+  std::shared_ptr<typename facebook::fboss::ForwardingInformationBase<AddressT>>
+  rebuildFib(
+      const facebook::fboss::rib::NetworkToRouteMap<AddressT>& rib,
+      const std::shared_ptr<
+          facebook::fboss::ForwardingInformationBase<AddressT>>& fib);
 
   RouterID vrf_;
   const IPv4NetworkToRouteMap& v4NetworkToRoute_;
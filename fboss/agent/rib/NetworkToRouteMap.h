@@ -15,10 +15,63 @@
 #include <folly/IPAddress.h>
 #include <folly/dynamic.h>
 
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace facebook::fboss {
+
+template <typename AddressT>
+class ForwardingInformationBase;
+
+} // namespace facebook::fboss
 
 namespace facebook::fboss::rib {
 
+/*
+ * Bookkeeping that lets ForwardingInformationBaseUpdater reprogram only the
+ * routes that changed since it last derived a FIB from a NetworkToRouteMap.
+ *
+ * changedPrefixes is only meaningful relative to lastSyncedFib: if the FIB
+ * being updated is not the one we produced last time (first sync, warm boot,
+ * a state update that was thrown away, ...) the whole FIB gets rebuilt.
+ * Prefixes may appear more than once.
+ */
+template <typename AddressT>
+struct FibSyncState {
+  std::vector<RoutePrefix<AddressT>> changedPrefixes;
+  std::weak_ptr<facebook::fboss::ForwardingInformationBase<AddressT>>
+      lastSyncedFib;
+};
+
+/*
+ * Reverse index used by RouteUpdater to re-resolve only the routes affected
+ * by an update rather than the whole table.
+ *
+ * nextHops is keyed by the next hops of this address family which routes
+ * (of either address family) are recursively resolved through. For each of
+ * them it holds the prefix of the route the next hop resolved via at the
+ * time, if any, and the routes that depend on it. routeNextHops is the
+ * other direction for the routes of this address family.
+ */
+template <typename AddressT>
+struct RouteResolutionState {
+  struct NextHopDependents {
+    std::optional<RoutePrefix<AddressT>> resolvedVia;
+    std::set<folly::CIDRNetwork> routes;
+  };
+
+  // Set once every route has been resolved with the index in place. Routes
+  // deserialized or inserted by other means are re-resolved from scratch.
+  bool indexed{false};
+  std::map<AddressT, NextHopDependents> nextHops;
+  std::map<RoutePrefix<AddressT>, std::vector<folly::IPAddress>> routeNextHops;
+  // Routes that were added, modified or removed since the last resolution
+  std::vector<RoutePrefix<AddressT>> changedRoutes;
+};
+
 template <typename AddressT>
 class NetworkToRouteMap
     : public facebook::network::RadixTree<AddressT, Route<AddressT>> {
@@ -48,6 +101,40 @@ class NetworkToRouteMap
 
     return networkToRouteMap;
   }
+
+  /*
+   * Anything that changes the resolved forwarding information or class ID
+   * of a route, or removes a resolved route, must record its prefix here.
+   */
+  void markChanged(const RoutePrefix<AddressT>& prefix) {
+    if (fibSyncState_.lastSyncedFib.expired()) {
+      // The next FIB sync is going to be a full one anyway
+      return;
+    }
+    if (fibSyncState_.changedPrefixes.size() >= this->size()) {
+      // Churn exceeds the table size, a full resync is cheaper
+      fibSyncState_.changedPrefixes.clear();
+      fibSyncState_.lastSyncedFib.reset();
+      return;
+    }
+    fibSyncState_.changedPrefixes.push_back(prefix);
+  }
+
+  /*
+   * The FIB is derived from a const NetworkToRouteMap, hence this is mutable
+   * in the same way a cache would be.
+   */
+  FibSyncState<AddressT>& fibSyncState() const {
+    return fibSyncState_;
+  }
+
+  RouteResolutionState<AddressT>& resolutionState() {
+    return resolutionState_;
+  }
+
+ private:
+  mutable FibSyncState<AddressT> fibSyncState_;
+  RouteResolutionState<AddressT> resolutionState_;
 };
 
 using IPv4NetworkToRouteMap = NetworkToRouteMap<folly::IPAddressV4>;
@@ -135,9 +135,11 @@ void Route<AddrT>::setUnresolvable() {
 }
 
 template <typename AddrT>
-void Route<AddrT>::clearForward() {
+RouteNextHopEntry Route<AddrT>::clearForward() {
+  RouteNextHopEntry previousFwd(std::move(fwd));
   fwd.reset();
   clearForwardInFlags();
+  return previousFwd;
 }
 
 template class Route<folly::IPAddressV4>;
@@ -109,7 +109,8 @@ class Route {
   }
   void setResolved(RouteNextHopEntry fwd);
   void setUnresolvable();
-  void clearForward();
+  // Returns the forwarding info the route had before it was cleared
+  RouteNextHopEntry clearForward();
 
   void update(ClientID clientId, RouteNextHopEntry entry);
 
@@ -11,6 +11,7 @@
 #include "RouteUpdater.h"
 
 #include <numeric>
+#include <vector>
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -40,6 +41,27 @@ RouteUpdater::RouteUpdater(
     IPv6NetworkToRouteMap* v6Routes)
     : v4Routes_(v4Routes), v6Routes_(v6Routes) {}
 
+template <>
+IPv4NetworkToRouteMap* RouteUpdater::getRoutes<IPAddressV4>() {
+  return v4Routes_;
+}
+
+template <>
+IPv6NetworkToRouteMap* RouteUpdater::getRoutes<IPAddressV6>() {
+  return v6Routes_;
+}
+
+template <typename AddressT>
+void RouteUpdater::routeChanged(
+    NetworkToRouteMap<AddressT>* routes,
+    const Prefix<AddressT>& prefix) {
+  routes->markChanged(prefix);
+  auto& resolutionState = routes->resolutionState();
+  if (resolutionState.indexed) {
+    resolutionState.changedRoutes.push_back(prefix);
+  }
+}
+
 template <typename AddressT>
 void RouteUpdater::addRouteImpl(
     const Prefix<AddressT>& prefix,
@@ -55,12 +77,14 @@ void RouteUpdater::addRouteImpl(
     }
 
     route->update(clientID, entry);
+    routeChanged(routes, prefix);
     return;
   }
 
   CHECK(it == routes->end());
   routes->insert(
       prefix.network, prefix.mask, Route<AddressT>(prefix, clientID, entry));
+  routeChanged(routes, prefix);
 }
 
 void RouteUpdater::addRoute(
@@ -129,6 +153,7 @@ void RouteUpdater::delRouteImpl(
     XLOG(DBG3) << "...and then deleted route " << route.str();
     routes->erase(it);
   }
+  routeChanged(routes, prefix);
 }
 
 void RouteUpdater::delRoute(
@@ -153,6 +178,9 @@ void RouteUpdater::removeAllRoutesFromClientImpl(
 
   for (auto it = routes->begin(); it != routes->end(); ++it) {
     auto& route = it->value();
+    if (route.getEntryForClient(clientID)) {
+      routeChanged(routes, route.prefix());
+    }
     route.delEntryForClient(clientID);
     if (route.hasNoEntry()) {
       // The nexthops we removed was the only one.  Delete the route.
@@ -385,10 +413,13 @@ void RouteUpdater::getFwdInfoFromNhop(
     NetworkToRouteMap<AddressT>* routes,
     const AddressT& nh,
     const std::optional<LabelForwardingAction>& labelAction,
+    const folly::CIDRNetwork& dependent,
     bool* hasToCpu,
     bool* hasDrop,
     RouteNextHopSet& fwd) {
   auto it = routes->longestMatch(nh, nh.bitCount());
+  addDependency(
+      routes, nh, it == routes->end() ? nullptr : &(it->value()), dependent);
   if (it == routes->end()) {
     XLOG(DBG3) << "Could not find subnet for next-hop:  " << nh;
     // Unresolvable next hop
@@ -442,6 +473,13 @@ void RouteUpdater::resolveOne(Route<AddressT>* route) {
   // in setUnresolvable() or setResolved()
   route->setProcessing();
 
+  // Next hops this route gets recursively resolved through are registered
+  // afresh below
+  removeDependencies(route->prefix());
+  const folly::CIDRNetwork dependent{
+      folly::IPAddress(route->prefix().network), route->prefix().mask};
+  std::vector<folly::IPAddress> resolvedThrough;
+
   bool hasToCpu{false};
   bool hasDrop{false};
   RouteNextHopSet fwd;
@@ -473,11 +511,13 @@ void RouteUpdater::resolveOne(Route<AddressT>* route) {
         continue;
       }
 
+      resolvedThrough.push_back(addr);
       if (addr.isV4()) {
         getFwdInfoFromNhop(
             v4Routes_,
             nh.addr().asV4(),
             nh.labelForwardingAction(),
+            dependent,
             &hasToCpu,
             &hasDrop,
             nhToFwds[nh]);
@@ -487,6 +527,7 @@ void RouteUpdater::resolveOne(Route<AddressT>* route) {
             v6Routes_,
             nh.addr().asV6(),
             nh.labelForwardingAction(),
+            dependent,
             &hasToCpu,
             &hasDrop,
             nhToFwds[nh]);
@@ -495,6 +536,10 @@ void RouteUpdater::resolveOne(Route<AddressT>* route) {
 
     fwd = mergeForwardInfos(nhToFwds, route->str());
   }
+  if (!resolvedThrough.empty()) {
+    getRoutes<AddressT>()->resolutionState().routeNextHops[route->prefix()] =
+        std::move(resolvedThrough);
+  }
 
   if (!fwd.empty()) {
     route->setResolved(
@@ -517,27 +562,218 @@ void RouteUpdater::resolveOne(Route<AddressT>* route) {
 }
 
 template <typename AddressT>
-void RouteUpdater::resolve(NetworkToRouteMap<AddressT>* routes) {
-  for (auto& entry : *routes) {
-    Route<AddressT>* route = &(entry.value());
-    if (route->needResolve()) {
-      resolveOne(route);
+void RouteUpdater::addDependency(
+    NetworkToRouteMap<AddressT>* routes,
+    const AddressT& nh,
+    const Route<AddressT>* resolvedVia,
+    const folly::CIDRNetwork& dependent) {
+  auto& dependents = routes->resolutionState().nextHops[nh];
+  if (resolvedVia) {
+    dependents.resolvedVia = resolvedVia->prefix();
+  } else {
+    dependents.resolvedVia.reset();
+  }
+  dependents.routes.insert(dependent);
+}
+
+template <typename AddressT>
+void RouteUpdater::removeDependencies(const Prefix<AddressT>& prefix) {
+  auto& routeNextHops = getRoutes<AddressT>()->resolutionState().routeNextHops;
+  auto it = routeNextHops.find(prefix);
+  if (it == routeNextHops.end()) {
+    return;
+  }
+
+  const folly::CIDRNetwork dependent{folly::IPAddress(prefix.network),
+                                     prefix.mask};
+  auto removeDependent = [&dependent](auto* routes, const auto& nh) {
+    auto& nextHops = routes->resolutionState().nextHops;
+    auto nhItr = nextHops.find(nh);
+    if (nhItr == nextHops.end()) {
+      return;
+    }
+    nhItr->second.routes.erase(dependent);
+    if (nhItr->second.routes.empty()) {
+      nextHops.erase(nhItr);
+    }
+  };
+  for (const auto& nh : it->second) {
+    if (nh.isV4()) {
+      removeDependent(v4Routes_, nh.asV4());
+    } else {
+      removeDependent(v6Routes_, nh.asV6());
     }
   }
+  routeNextHops.erase(it);
 }
 
 template <typename AddressT>
-void RouteUpdater::updateDoneImpl(NetworkToRouteMap<AddressT>* routes) {
-  for (auto& entry : *routes) {
-    Route<AddressT>& route = entry.value();
-    route.clearForward();
+void RouteUpdater::clearForward(
+    Route<AddressT>* route,
+    PriorResolutions<AddressT>* priorResolutions) {
+  // Hold on to what the route resolved to last time around so that only
+  // the routes whose forwarding information actually changed get marked
+  // for the next FIB sync.
+  bool resolved = route->isResolved();
+  bool connected = route->isConnected();
+  priorResolutions->push_back(
+      {route, resolved, connected, route->clearForward()});
+}
+
+template <typename AddressT>
+void RouteUpdater::resolve(
+    NetworkToRouteMap<AddressT>* routes,
+    const PriorResolutions<AddressT>& priorResolutions) {
+  for (const auto& prior : priorResolutions) {
+    if (prior.route->needResolve()) {
+      resolveOne(prior.route);
+    }
   }
-  resolve(routes);
+
+  for (const auto& prior : priorResolutions) {
+    const Route<AddressT>* route = prior.route;
+    if (prior.resolved != route->isResolved() ||
+        prior.connected != route->isConnected() ||
+        (route->isResolved() && !(prior.fwd == route->getForwardInfo()))) {
+      routes->markChanged(route->prefix());
+    }
+  }
+}
+
+template <typename AddressT>
+void RouteUpdater::resetResolutionState(NetworkToRouteMap<AddressT>* routes) {
+  routes->resolutionState() = RouteResolutionState<AddressT>();
+}
+
+void RouteUpdater::resolveAll() {
+  resetResolutionState(v4Routes_);
+  resetResolutionState(v6Routes_);
+
+  // Resolution recurses across address families, so forwarding information
+  // of all routes is cleared before any of them gets resolved
+  PriorResolutions<IPAddressV4> v4PriorResolutions;
+  v4PriorResolutions.reserve(v4Routes_->size());
+  for (auto& entry : *v4Routes_) {
+    clearForward(&(entry.value()), &v4PriorResolutions);
+  }
+  PriorResolutions<IPAddressV6> v6PriorResolutions;
+  v6PriorResolutions.reserve(v6Routes_->size());
+  for (auto& entry : *v6Routes_) {
+    clearForward(&(entry.value()), &v6PriorResolutions);
+  }
+
+  resolve(v4Routes_, v4PriorResolutions);
+  resolve(v6Routes_, v6PriorResolutions);
+
+  v4Routes_->resolutionState().indexed = true;
+  v6Routes_->resolutionState().indexed = true;
+}
+
+template <typename AddressT>
+void RouteUpdater::collectChangedRoutes(
+    NetworkToRouteMap<AddressT>* routes,
+    std::set<folly::CIDRNetwork>* toResolve,
+    std::vector<folly::CIDRNetwork>* toVisit) {
+  auto& changedRoutes = routes->resolutionState().changedRoutes;
+  for (const auto& prefix : changedRoutes) {
+    folly::CIDRNetwork network{folly::IPAddress(prefix.network), prefix.mask};
+    if (toResolve->insert(network).second) {
+      toVisit->push_back(network);
+    }
+  }
+  changedRoutes.clear();
+}
+
+template <typename AddressT>
+void RouteUpdater::collectDependents(
+    NetworkToRouteMap<AddressT>* routes,
+    const Prefix<AddressT>& prefix,
+    std::set<folly::CIDRNetwork>* toResolve,
+    std::vector<folly::CIDRNetwork>* toVisit) {
+  const auto& nextHops = routes->resolutionState().nextHops;
+  // Next hops covered by the prefix are contiguous in address order
+  for (auto it = nextHops.lower_bound(prefix.network);
+       it != nextHops.end() && it->first.inSubnet(prefix.network, prefix.mask);
+       ++it) {
+    const auto& nh = it->first;
+    const auto& dependents = it->second;
+    // A next hop is affected if it was resolved via this prefix, or if it
+    // would now be. Those resolved via a more specific route are not.
+    if (dependents.resolvedVia != prefix) {
+      auto lpmItr = routes->longestMatch(nh, nh.bitCount());
+      if (lpmItr == routes->end() || lpmItr->value().prefix() != prefix) {
+        continue;
+      }
+    }
+    for (const auto& dependent : dependents.routes) {
+      if (toResolve->insert(dependent).second) {
+        toVisit->push_back(dependent);
+      }
+    }
+  }
+}
+
+void RouteUpdater::resolveChanged() {
+  // Routes that changed, plus everything transitively resolved through them
+  std::set<folly::CIDRNetwork> toResolve;
+  std::vector<folly::CIDRNetwork> toVisit;
+  collectChangedRoutes(v4Routes_, &toResolve, &toVisit);
+  collectChangedRoutes(v6Routes_, &toResolve, &toVisit);
+  while (!toVisit.empty()) {
+    auto network = toVisit.back();
+    toVisit.pop_back();
+    if (network.first.isV4()) {
+      collectDependents(
+          v4Routes_,
+          PrefixV4{network.first.asV4(), network.second},
+          &toResolve,
+          &toVisit);
+    } else {
+      collectDependents(
+          v6Routes_,
+          PrefixV6{network.first.asV6(), network.second},
+          &toResolve,
+          &toVisit);
+    }
+  }
+
+  PriorResolutions<IPAddressV4> v4PriorResolutions;
+  PriorResolutions<IPAddressV6> v6PriorResolutions;
+  auto clearForwardIfPresent =
+      [this](auto* routes, const auto& prefix, auto* priorResolutions) {
+        auto it = routes->exactMatch(prefix.network, prefix.mask);
+        if (it == routes->end()) {
+          // The route was deleted, so it no longer depends on anything
+          removeDependencies(prefix);
+          return;
+        }
+        clearForward(&(it->value()), priorResolutions);
+      };
+  for (const auto& network : toResolve) {
+    if (network.first.isV4()) {
+      clearForwardIfPresent(
+          v4Routes_,
+          PrefixV4{network.first.asV4(), network.second},
+          &v4PriorResolutions);
+    } else {
+      clearForwardIfPresent(
+          v6Routes_,
+          PrefixV6{network.first.asV6(), network.second},
+          &v6PriorResolutions);
+    }
+  }
+
+  resolve(v4Routes_, v4PriorResolutions);
+  resolve(v6Routes_, v6PriorResolutions);
 }
 
 void RouteUpdater::updateDone() {
-  updateDoneImpl(v4Routes_);
-  updateDoneImpl(v6Routes_);
+  if (v4Routes_->resolutionState().indexed &&
+      v6Routes_->resolutionState().indexed) {
+    resolveChanged();
+  } else {
+    resolveAll();
+  }
 }
 
 } // namespace facebook::fboss::rib
@@ -20,6 +20,9 @@
 
 #include <folly/IPAddress.h>
 
+#include <set>
+#include <vector>
+
 namespace facebook::fboss::rib {
 
 /**
@@ -45,6 +48,10 @@ namespace facebook::fboss::rib {
  *    only IP nexthops will be in the final ECMP group.
  * 5. If and only if TO_CPU is the only nexthop (directly or indirectly) of
  *    a route, TO_CPU action will be only path in the resolved ECMP group.
+ *
+ * Once the whole table has been resolved, updateDone() only re-resolves the
+ * routes that were added, modified or deleted through this RouteUpdater and
+ * those transitively resolved through them. See RouteResolutionState.
  */
 class RouteUpdater {
  public:
@@ -97,18 +104,66 @@ class RouteUpdater {
       NetworkToRouteMap<AddressT>* routes,
       ClientID clientID);
   template <typename AddressT>
-  void updateDoneImpl(NetworkToRouteMap<AddressT>* routes);
+  struct PriorResolution {
+    Route<AddressT>* route;
+    bool resolved;
+    bool connected;
+    RouteNextHopEntry fwd;
+  };
+  template <typename AddressT>
+  using PriorResolutions = std::vector<PriorResolution<AddressT>>;
+
+  template <typename AddressT>
+  NetworkToRouteMap<AddressT>* getRoutes();
+
+  template <typename AddressT>
+  void routeChanged(
+      NetworkToRouteMap<AddressT>* routes,
+      const Prefix<AddressT>& prefix);
+
+  void resolveAll();
+  void resolveChanged();
 
   template <typename AddressT>
-  void resolve(NetworkToRouteMap<AddressT>* routes);
+  void resetResolutionState(NetworkToRouteMap<AddressT>* routes);
+  template <typename AddressT>
+  void collectChangedRoutes(
+      NetworkToRouteMap<AddressT>* routes,
+      std::set<folly::CIDRNetwork>* toResolve,
+      std::vector<folly::CIDRNetwork>* toVisit);
+  template <typename AddressT>
+  void collectDependents(
+      NetworkToRouteMap<AddressT>* routes,
+      const Prefix<AddressT>& prefix,
+      std::set<folly::CIDRNetwork>* toResolve,
+      std::vector<folly::CIDRNetwork>* toVisit);
+  template <typename AddressT>
+  void clearForward(
+      Route<AddressT>* route,
+      PriorResolutions<AddressT>* priorResolutions);
+  template <typename AddressT>
+  void resolve(
+      NetworkToRouteMap<AddressT>* routes,
+      const PriorResolutions<AddressT>& priorResolutions);
+
   template <typename AddressT>
   void resolveOne(Route<AddressT>* route);
 
+  template <typename AddressT>
+  void addDependency(
+      NetworkToRouteMap<AddressT>* routes,
+      const AddressT& nh,
+      const Route<AddressT>* resolvedVia,
+      const folly::CIDRNetwork& dependent);
+  template <typename AddressT>
+  void removeDependencies(const Prefix<AddressT>& prefix);
+
   template <typename AddressT>
   void getFwdInfoFromNhop(
       NetworkToRouteMap<AddressT>* routes,
       const AddressT& nh,
       const std::optional<LabelForwardingAction>& labelAction,
+      const folly::CIDRNetwork& dependent,
       bool* hasToCpu,
       bool* hasDrop,
       RouteNextHopSet& fwd);
@@ -18,9 +18,22 @@
 #include "fboss/agent/rib/RouteNextHopEntry.h"
 #include "fboss/agent/rib/RouteUpdater.h"
 
+#include <folly/Conv.h>
+#include <folly/ExceptionString.h>
+#include <folly/ScopeGuard.h>
+#include <folly/logging/xlog.h>
+#include <folly/synchronization/Baton.h>
+#include <gflags/gflags.h>
+
+#include <exception>
 #include <memory>
 #include <utility>
 
+DEFINE_int32(
+    rib_update_threads,
+    4,
+    "Number of threads RIB updates to different VRFs are spread across");
+
 namespace {
 class Timer {
  public:
@@ -41,17 +54,29 @@ class Timer {
 
 namespace facebook::fboss::rib {
 
-RoutingInformationBase::RoutingInformationBase() {
-  ribUpdateThread_ = std::make_unique<std::thread>([this] {
-    initThread("ribUpdateThread");
-    ribUpdateEventBase_.loopForever();
-  });
+RoutingInformationBase::RoutingInformationBase()
+    : RoutingInformationBase(FLAGS_rib_update_threads) {}
+
+RoutingInformationBase::RoutingInformationBase(size_t numUpdateThreads) {
+  CHECK_GT(numUpdateThreads, 0);
+  for (size_t i = 0; i < numUpdateThreads; ++i) {
+    ribUpdateEventBases_.push_back(std::make_unique<folly::EventBase>());
+    ribUpdateThreads_.emplace_back(
+        [evb = ribUpdateEventBases_.back().get(), i] {
+          initThread(folly::to<std::string>("ribUpdateThread", i));
+          evb->loopForever();
+        });
+  }
 }
 
 RoutingInformationBase::~RoutingInformationBase() {
-  ribUpdateEventBase_.runInEventBaseThread(
-      [this] { ribUpdateEventBase_.terminateLoopSoon(); });
-  ribUpdateThread_->join();
+  for (auto& ribUpdateEventBase : ribUpdateEventBases_) {
+    auto evb = ribUpdateEventBase.get();
+    evb->runInEventBaseThread([evb] { evb->terminateLoopSoon(); });
+  }
+  for (auto& ribUpdateThread : ribUpdateThreads_) {
+    ribUpdateThread.join();
+  }
 }
 
 void RoutingInformationBase::reconfigure(
@@ -61,64 +86,95 @@ void RoutingInformationBase::reconfigure(
     const std::vector<cfg::StaticRouteNoNextHops>& staticRoutesToCpu,
     FibUpdateFunction updateFibCallback,
     void* cookie) {
-  auto updateFn = [&] {
+  // Config application is accomplished in the following sequence of steps:
+  // 1. Update the VRFs held in RoutingInformationBase's
+  // SynchronizedRouteTables data-structure
+  //
+  // For each VRF specified in config:
+  //
+  // 2. Update all of RIB's static routes to be only those specified in
+  // config
+  //
+  // 3. Update all of RIB's interface routes to be only those specified in
+  // config
+  //
+  // 4. Re-resolve routes
+  //
+  // 5. Update FIB
+  //
+  // Steps 2-5 take place in ConfigApplier.
+  RouterIDToRouteTable routeTables;
+  {
     auto lockedRouteTables = synchronizedRouteTables_.wlock();
-
-    // Config application is accomplished in the following sequence of steps:
-    // 1. Update the VRFs held in RoutingInformationBase's
-    // SynchronizedRouteTables data-structure
-    //
-    // For each VRF specified in config:
-    //
-    // 2. Update all of RIB's static routes to be only those specified in
-    // config
-    //
-    // 3. Update all of RIB's interface routes to be only those specified in
-    // config
-    //
-    // 4. Re-resolve routes
-    //
-    // 5. Update FIB
-    //
-    // Steps 2-5 take place in ConfigApplier.
-
     *lockedRouteTables = constructRouteTables(
         lockedRouteTables, configRouterIDToInterfaceRoutes);
+    routeTables = *lockedRouteTables;
+  }
 
-    // Because of this sequential loop over each VRF, config application scales
-    // linearly with the number of VRFs. If FBOSS is run in a multi-VRF routing
-    // architecture in the future, this slow-down can be avoided by
-    // parallelizing this loop. Converting this loop to use task-level
-    // parallelism should be straightfoward because it has been written to avoid
-    // dependencies across different iterations of the loop.
-    for (auto& vrfAndRouteTable : *lockedRouteTables) {
-      auto vrf = vrfAndRouteTable.first;
-      const auto& interfaceRoutes = configRouterIDToInterfaceRoutes.at(vrf);
-
-      // A ConfigApplier object should be independent of the VRF whose routes it
-      // is processing. However, because interface and static routes for _all_
-      // VRFs are passed to ConfigApplier, the vrf argument is needed to
-      // identify the subset of those routes which should be processed.
-
-      // ConfigApplier can be made independent of the VRF whose routes it is
-      // processing by the use of boost::filter_iterator.
-      ConfigApplier configApplier(
-          vrf,
-          &(vrfAndRouteTable.second.v4NetworkToRoute),
-          &(vrfAndRouteTable.second.v6NetworkToRoute),
-          folly::range(interfaceRoutes.cbegin(), interfaceRoutes.cend()),
-          folly::range(staticRoutesToCpu.cbegin(), staticRoutesToCpu.cend()),
-          folly::range(staticRoutesToNull.cbegin(), staticRoutesToNull.cend()),
-          folly::range(
-              staticRoutesWithNextHops.cbegin(),
-              staticRoutesWithNextHops.cend()),
-          updateFibCallback,
-          cookie);
-
-      configApplier.updateRibAndFib();
+  // Config is applied to every VRF on the thread handling its updates, so
+  // that VRFs are processed concurrently while updates to each VRF remain
+  // ordered. The outer lock is not held meanwhile, which allows those
+  // threads to complete updates they are in the middle of.
+  std::vector<folly::Baton<>> done(routeTables.size());
+  std::vector<std::exception_ptr> errors(routeTables.size());
+  size_t i = 0;
+  for (const auto& vrfAndRouteTable : routeTables) {
+    auto vrf = vrfAndRouteTable.first;
+    auto routeTable = vrfAndRouteTable.second;
+    getUpdateEventBase(vrf)->runInEventBaseThread([&, vrf, routeTable, i] {
+      SCOPE_EXIT {
+        done[i].post();
+      };
+      try {
+        const auto& interfaceRoutes = configRouterIDToInterfaceRoutes.at(vrf);
+        auto lockedRouteTable = routeTable->wlock();
+
+        // A ConfigApplier object should be independent of the VRF whose
+        // routes it is processing. However, because interface and static
+        // routes for _all_ VRFs are passed to ConfigApplier, the vrf argument
+        // is needed to identify the subset of those routes which should be
+        // processed.
+
+        // ConfigApplier can be made independent of the VRF whose routes it
+        // is processing by the use of boost::filter_iterator.
+        ConfigApplier configApplier(
+            vrf,
+            &(lockedRouteTable->v4NetworkToRoute),
+            &(lockedRouteTable->v6NetworkToRoute),
+            folly::range(interfaceRoutes.cbegin(), interfaceRoutes.cend()),
+            folly::range(staticRoutesToCpu.cbegin(), staticRoutesToCpu.cend()),
+            folly::range(
+                staticRoutesToNull.cbegin(), staticRoutesToNull.cend()),
+            folly::range(
+                staticRoutesWithNextHops.cbegin(),
+                staticRoutesWithNextHops.cend()),
+            [this, &updateFibCallback](
+                RouterID rid,
+                const IPv4NetworkToRouteMap& v4NetworkToRoute,
+                const IPv6NetworkToRouteMap& v6NetworkToRoute,
+                void* fibCookie) {
+              std::lock_guard<std::mutex> guard(fibUpdateMutex_);
+              updateFibCallback(
+                  rid, v4NetworkToRoute, v6NetworkToRoute, fibCookie);
+            },
+            cookie);
+
+        configApplier.updateRibAndFib();
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+    ++i;
+  }
+
+  for (auto& vrfDone : done) {
+    vrfDone.wait();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
     }
-  };
-  ribUpdateEventBase_.runInEventBaseThreadAndWait(updateFn);
+  }
 }
 
 RoutingInformationBase::UpdateStatistics RoutingInformationBase::update(
@@ -133,18 +189,24 @@ RoutingInformationBase::UpdateStatistics RoutingInformationBase::update(
     void* cookie) {
   UpdateStatistics stats;
 
+  std::exception_ptr error;
   auto updateFn = [&]() {
     Timer updateTimer(&stats.duration);
 
-    auto lockedRouteTables = synchronizedRouteTables_.wlock();
-
-    auto it = lockedRouteTables->find(routerID);
-    if (it == lockedRouteTables->end()) {
-      throw FbossError("VRF ", routerID, " not configured");
+    // Look up the table on the VRF's thread, after any reconfiguration queued
+    // before this update, which may have replaced or removed it
+    std::shared_ptr<SynchronizedRouteTable> routeTable;
+    try {
+      routeTable = getRouteTable(routerID);
+    } catch (...) {
+      error = std::current_exception();
+      return;
     }
+    auto lockedRouteTable = routeTable->wlock();
 
     RouteUpdater updater(
-        &(it->second.v4NetworkToRoute), &(it->second.v6NetworkToRoute));
+        &(lockedRouteTable->v4NetworkToRoute),
+        &(lockedRouteTable->v6NetworkToRoute));
 
     if (resetClientsRoutes) {
       updater.removeAllRoutesForClient(clientID);
@@ -183,13 +245,12 @@ RoutingInformationBase::UpdateStatistics RoutingInformationBase::update(
 
     updater.updateDone();
 
-    fibUpdateCallback(
-        routerID,
-        it->second.v4NetworkToRoute,
-        it->second.v6NetworkToRoute,
-        cookie);
+    updateFib(fibUpdateCallback, routerID, *lockedRouteTable, cookie);
   };
-  ribUpdateEventBase_.runInEventBaseThreadAndWait(updateFn);
+  getUpdateEventBase(routerID)->runInEventBaseThreadAndWait(updateFn);
+  if (error) {
+    std::rethrow_exception(error);
+  }
 
   return stats;
 }
@@ -202,21 +263,22 @@ void RoutingInformationBase::setClassIDImpl(
     void* cookie,
     bool async) {
   auto updateFn = [=]() {
-    auto lockedRouteTables = synchronizedRouteTables_.wlock();
+    // Look up the table on the VRF's thread, as update() does
+    auto lockedRouteTable = getRouteTable(rid)->wlock();
 
-    auto it = lockedRouteTables->find(rid);
-    if (it == lockedRouteTables->end()) {
-      throw FbossError("VRF ", rid, " not configured");
-    }
     auto updateRoute = [&classId](auto& rib, auto ip, uint8_t mask) {
       auto ritr = rib.exactMatch(ip, mask);
       if (ritr == rib.end()) {
         return;
       }
+      if (ritr->value().getClassID() == classId) {
+        return;
+      }
       ritr->value().setClassID(classId);
+      rib.markChanged(ritr->value().prefix());
     };
-    auto& v4Rib = it->second.v4NetworkToRoute;
-    auto& v6Rib = it->second.v6NetworkToRoute;
+    auto& v4Rib = lockedRouteTable->v4NetworkToRoute;
+    auto& v6Rib = lockedRouteTable->v6NetworkToRoute;
     for (auto& prefix : prefixes) {
       if (prefix.first.isV4()) {
         updateRoute(v4Rib, prefix.first.asV4(), prefix.second);
@@ -224,14 +286,57 @@ void RoutingInformationBase::setClassIDImpl(
         updateRoute(v6Rib, prefix.first.asV6(), prefix.second);
       }
     }
-    fibUpdateCallback(
-        rid, it->second.v4NetworkToRoute, it->second.v6NetworkToRoute, cookie);
+    updateFib(fibUpdateCallback, rid, *lockedRouteTable, cookie);
   };
   if (async) {
-    ribUpdateEventBase_.runInEventBaseThread(updateFn);
+    getUpdateEventBase(rid)->runInEventBaseThread([=]() {
+      try {
+        updateFn();
+      } catch (const std::exception& ex) {
+        XLOG(ERR) << "Failed to set class ID of routes in VRF " << rid << ": "
+                  << folly::exceptionStr(ex);
+      }
+    });
   } else {
-    ribUpdateEventBase_.runInEventBaseThreadAndWait(updateFn);
+    std::exception_ptr error;
+    getUpdateEventBase(rid)->runInEventBaseThreadAndWait([&]() {
+      try {
+        updateFn();
+      } catch (...) {
+        error = std::current_exception();
+      }
+    });
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+std::shared_ptr<RoutingInformationBase::SynchronizedRouteTable>
+RoutingInformationBase::getRouteTable(RouterID rid) const {
+  auto lockedRouteTables = synchronizedRouteTables_.rlock();
+  auto it = lockedRouteTables->find(rid);
+  if (it == lockedRouteTables->end()) {
+    throw FbossError("VRF ", rid, " not configured");
   }
+  return it->second;
+}
+
+folly::EventBase* RoutingInformationBase::getUpdateEventBase(
+    RouterID rid) const {
+  return ribUpdateEventBases_[static_cast<uint32_t>(rid) %
+                              ribUpdateEventBases_.size()]
+      .get();
+}
+
+void RoutingInformationBase::updateFib(
+    const FibUpdateFunction& fibUpdateCallback,
+    RouterID rid,
+    const RouteTable& routeTable,
+    void* cookie) {
+  std::lock_guard<std::mutex> guard(fibUpdateMutex_);
+  fibUpdateCallback(
+      rid, routeTable.v4NetworkToRoute, routeTable.v6NetworkToRoute, cookie);
 }
 
 folly::dynamic RoutingInformationBase::toFollyDynamic() const {
@@ -241,12 +346,13 @@ folly::dynamic RoutingInformationBase::toFollyDynamic() const {
   for (const auto& routeTable : *lockedRouteTables) {
     auto routerIdStr =
         folly::to<std::string>(static_cast<uint32_t>(routeTable.first));
+    auto lockedRouteTable = routeTable.second->rlock();
     rib[routerIdStr] = folly::dynamic::object;
     rib[routerIdStr][kRouterId] = static_cast<uint32_t>(routeTable.first);
     rib[routerIdStr][kRibV4] =
-        routeTable.second.v4NetworkToRoute.toFollyDynamic();
+        lockedRouteTable->v4NetworkToRoute.toFollyDynamic();
     rib[routerIdStr][kRibV6] =
-        routeTable.second.v6NetworkToRoute.toFollyDynamic();
+        lockedRouteTable->v6NetworkToRoute.toFollyDynamic();
   }
 
   return rib;
@@ -260,10 +366,10 @@ RoutingInformationBase::fromFollyDynamic(const folly::dynamic& ribJson) {
   for (const auto& routeTable : ribJson.items()) {
     lockedRouteTables->insert(std::make_pair(
         RouterID(routeTable.first.asInt()),
-        RouteTable{
+        std::make_shared<SynchronizedRouteTable>(RouteTable{
             IPv4NetworkToRouteMap::fromFollyDynamic(routeTable.second[kRibV4]),
             IPv6NetworkToRouteMap::fromFollyDynamic(routeTable.second[kRibV6]),
-            UpdateStatistics{}}));
+            UpdateStatistics{}})));
   }
 
   return rib;
@@ -271,7 +377,8 @@ RoutingInformationBase::fromFollyDynamic(const folly::dynamic& ribJson) {
 
 void RoutingInformationBase::createVrf(RouterID rid) {
   auto lockedRouteTables = synchronizedRouteTables_.wlock();
-  lockedRouteTables->insert(std::make_pair(rid, RouteTable()));
+  lockedRouteTables->insert(
+      std::make_pair(rid, std::make_shared<SynchronizedRouteTable>()));
 }
 
 std::vector<RouterID> RoutingInformationBase::getVrfList() const {
@@ -286,19 +393,24 @@ std::vector<RouterID> RoutingInformationBase::getVrfList() const {
 std::vector<RouteDetails> RoutingInformationBase::getRouteTableDetails(
     RouterID rid) const {
   std::vector<RouteDetails> routeDetails;
+  std::shared_ptr<SynchronizedRouteTable> routeTable;
   SYNCHRONIZED_CONST(synchronizedRouteTables_) {
     const auto it = synchronizedRouteTables_.find(rid);
     if (it != synchronizedRouteTables_.end()) {
-      for (auto rit = it->second.v4NetworkToRoute.begin();
-           rit != it->second.v4NetworkToRoute.end();
-           ++rit) {
-        routeDetails.emplace_back(rit->value().toRouteDetails());
-      }
-      for (auto rit = it->second.v6NetworkToRoute.begin();
-           rit != it->second.v6NetworkToRoute.end();
-           ++rit) {
-        routeDetails.emplace_back(rit->value().toRouteDetails());
-      }
+      routeTable = it->second;
+    }
+  }
+  if (routeTable) {
+    auto lockedRouteTable = routeTable->rlock();
+    for (auto rit = lockedRouteTable->v4NetworkToRoute.begin();
+         rit != lockedRouteTable->v4NetworkToRoute.end();
+         ++rit) {
+      routeDetails.emplace_back(rit->value().toRouteDetails());
+    }
+    for (auto rit = lockedRouteTable->v6NetworkToRoute.begin();
+         rit != lockedRouteTable->v6NetworkToRoute.end();
+         ++rit) {
+      routeDetails.emplace_back(rit->value().toRouteDetails());
     }
   }
   return routeDetails;
@@ -311,24 +423,25 @@ RoutingInformationBase::constructRouteTables(
     const {
   RouterIDToRouteTable newRouteTables;
 
-  RouterIDToRouteTable::iterator newRouteTablesIter;
   for (const auto& routerIDAndInterfaceRoutes :
        configRouterIDToInterfaceRoutes) {
     const RouterID configVrf = routerIDAndInterfaceRoutes.first;
 
-    newRouteTablesIter = newRouteTables.emplace_hint(
-        newRouteTables.cend(), configVrf, RouteTable());
-
     auto oldRouteTablesIter = lockedRouteTables->find(configVrf);
     if (oldRouteTablesIter == lockedRouteTables->end()) {
-      // configVrf did not exist in the RIB, so it has been added to
+      // configVrf did not exist in the RIB, so it is added to
       // newRouteTables with an empty set of routes
+      newRouteTables.emplace_hint(
+          newRouteTables.cend(),
+          configVrf,
+          std::make_shared<SynchronizedRouteTable>());
       continue;
     }
 
-    // configVrf exists in the RIB, so it will be shallow copied into
+    // configVrf exists in the RIB, so its routes are shared with
     // newRouteTables.
-    newRouteTablesIter->second = std::move(oldRouteTablesIter->second);
+    newRouteTables.emplace_hint(
+        newRouteTables.cend(), configVrf, oldRouteTablesIter->second);
   }
 
   return newRouteTables;
@@ -339,7 +452,17 @@ bool RoutingInformationBase::operator==(
   const auto& routeTables = synchronizedRouteTables_.rlock();
   const auto& otherTables = other.synchronizedRouteTables_.rlock();
 
-  return *routeTables == *otherTables;
+  if (routeTables->size() != otherTables->size()) {
+    return false;
+  }
+  for (const auto& [rid, routeTable] : *routeTables) {
+    auto otherIt = otherTables->find(rid);
+    if (otherIt == otherTables->end() ||
+        *routeTable->rlock() != *otherIt->second->rlock()) {
+      return false;
+    }
+  }
+  return true;
 }
 
 } // namespace facebook::fboss::rib
@@ -15,9 +15,11 @@
 #include "fboss/agent/types.h"
 
 #include <folly/Synchronized.h>
+#include <folly/io/async/EventBase.h>
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -28,6 +30,12 @@ class RoutingInformationBase {
   RoutingInformationBase(const RoutingInformationBase& o) = delete;
   RoutingInformationBase& operator=(const RoutingInformationBase& o) = delete;
   RoutingInformationBase();
+  /*
+   * Updates to a given VRF are always executed, in order, on the same one of
+   * numUpdateThreads threads. Updates to VRFs handled by different threads
+   * run concurrently.
+   */
+  explicit RoutingInformationBase(size_t numUpdateThreads);
   ~RoutingInformationBase();
   using FibUpdateFunction = std::function<void(
       RouterID vrf,
@@ -44,8 +52,8 @@ class RoutingInformationBase {
   };
 
   /*
-   * `update()` first acquires exclusive ownership of the RIB and executes the
-   * following sequence of actions:
+   * `update()` first acquires exclusive ownership of the VRF's routes and
+   * executes the following sequence of actions:
    * 1. Injects and removes routes in `toAdd` and `toDelete`, respectively.
    * 2. Triggers recursive (IP) resolution.
    * 3. Updates the FIB synchronously.
@@ -56,6 +64,9 @@ class RoutingInformationBase {
    * this mapping is exposed via SwSwitch, which we can't a dependency on here.
    * The adminDistanceFromClientID allows callsites to propogate admin distances
    * per client.
+   *
+   * FIB update callbacks are never invoked concurrently, even for different
+   * VRFs, so they are free to read-modify-write shared switch state.
    */
   UpdateStatistics update(
       RouterID routerID,
@@ -124,7 +135,9 @@ class RoutingInformationBase {
   }
 
   void waitForRibUpdates() {
-    ribUpdateEventBase_.runInEventBaseThreadAndWait([] { return; });
+    for (auto& ribUpdateEventBase : ribUpdateEventBases_) {
+      ribUpdateEventBase->runInEventBaseThreadAndWait([] { return; });
+    }
   }
 
  private:
@@ -152,23 +165,34 @@ class RoutingInformationBase {
   };
 
   /*
-   * Currently, route updates to separate VRFs are made to be sequential. In the
-   * event FBOSS has to operate in a routing architecture with numerous VRFs,
-   * we can avoid a slow down by a factor of number of VRFs by parallelizing
-   * route updates across VRFs. This can be accomplished simply by associating
-   * the mutex implicit in folly::Synchronized with an individual RouteTable.
+   * Every VRF's routes are protected by their own lock, so that updates to
+   * separate VRFs only contend on the outer lock for as long as it takes to
+   * look the VRF up. Route tables are shared_ptrs so that they can be
+   * updated without holding the outer lock.
    */
-  using RouterIDToRouteTable = boost::container::flat_map<RouterID, RouteTable>;
+  using SynchronizedRouteTable = folly::Synchronized<RouteTable>;
+  using RouterIDToRouteTable = boost::container::
+      flat_map<RouterID, std::shared_ptr<SynchronizedRouteTable>>;
   using SynchronizedRouteTables = folly::Synchronized<RouterIDToRouteTable>;
 
+  std::shared_ptr<SynchronizedRouteTable> getRouteTable(RouterID rid) const;
+  folly::EventBase* getUpdateEventBase(RouterID rid) const;
+  void updateFib(
+      const FibUpdateFunction& fibUpdateCallback,
+      RouterID rid,
+      const RouteTable& routeTable,
+      void* cookie);
+
   RouterIDToRouteTable constructRouteTables(
       const SynchronizedRouteTables::WLockedPtr& lockedRouteTables,
       const RouterIDAndNetworkToInterfaceRoutes&
           configRouterIDToInterfaceRoutes) const;
 
   SynchronizedRouteTables synchronizedRouteTables_;
-  std::unique_ptr<std::thread> ribUpdateThread_;
-  folly::EventBase ribUpdateEventBase_;
+  // Serializes FIB update callbacks across VRFs
+  std::mutex fibUpdateMutex_;
+  std::vector<std::unique_ptr<folly::EventBase>> ribUpdateEventBases_;
+  std::vector<std::thread> ribUpdateThreads_;
 };
 
 } // namespace facebook::fboss::rib
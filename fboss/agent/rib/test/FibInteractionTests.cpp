@@ -18,6 +18,8 @@
 #include "fboss/agent/rib/RouteNextHop.h"
 #include "fboss/agent/rib/RouteNextHopEntry.h"
 #include "fboss/agent/rib/RouteTypes.h"
+#include "fboss/agent/rib/RouteUpdater.h"
+#include "fboss/agent/rib/RoutingInformationBase.h"
 #include "fboss/agent/state/ForwardingInformationBase.h"
 #include "fboss/agent/state/ForwardingInformationBaseContainer.h"
 #include "fboss/agent/state/ForwardingInformationBaseMap.h"
@@ -30,10 +32,12 @@
 #include "fboss/agent/test/TestUtils.h"
 #include "fboss/agent/types.h"
 
+#include <folly/Conv.h>
 #include <folly/IPAddress.h>
 #include <folly/functional/Partial.h>
 #include <gtest/gtest.h>
 #include <optional>
+#include <thread>
 
 using facebook::fboss::AdminDistance;
 using facebook::fboss::InterfaceID;
@@ -618,3 +622,215 @@ TEST(ForwardingInformationBaseUpdater, Deduplication) {
   ASSERT_TRUE(route3);
   EXPECT_NE(route, route3);
 }
+
+namespace {
+std::shared_ptr<facebook::fboss::SwitchState> createStateWithEmptyFib(
+    facebook::fboss::RouterID vrf) {
+  auto fibContainer =
+      std::make_shared<facebook::fboss::ForwardingInformationBaseContainer>(
+          vrf);
+  fibContainer->writableFields()->fibV4 =
+      std::make_shared<facebook::fboss::ForwardingInformationBaseV4>();
+  fibContainer->writableFields()->fibV6 =
+      std::make_shared<facebook::fboss::ForwardingInformationBaseV6>();
+
+  auto fibMap =
+      std::make_shared<facebook::fboss::ForwardingInformationBaseMap>();
+  fibMap->addNode(fibContainer);
+
+  auto state = std::make_shared<facebook::fboss::SwitchState>();
+  state->resetForwardingInformationBases(fibMap);
+  state->publish();
+  return state;
+}
+} // namespace
+
+// Only the prefixes touched since the last FIB sync should be reprogrammed,
+// routes which did not change must be carried over as is.
+TEST(ForwardingInformationBaseUpdater, IncrementalUpdate) {
+  using namespace facebook::fboss;
+
+  const RouterID vrfZero{0};
+  rib::IPv4NetworkToRouteMap v4NetworkToRouteMap;
+  rib::IPv6NetworkToRouteMap v6NetworkToRouteMap;
+  rib::RouteUpdater ribUpdater(&v4NetworkToRouteMap, &v6NetworkToRouteMap);
+
+  auto nextHop = [](const char* address) {
+    return rib::RouteNextHopEntry(
+        rib::UnresolvedNextHop(folly::IPAddress(address), rib::ECMP_WEIGHT),
+        kDefaultAdminDistance);
+  };
+
+  ribUpdater.addInterfaceRoute(
+      folly::IPAddress("10.0.0.0"),
+      24,
+      folly::IPAddress("10.0.0.1"),
+      InterfaceID(1));
+  ribUpdater.addRoute(
+      folly::IPAddress("1.1.0.0"), 16, ClientID(10), nextHop("10.0.0.11"));
+  ribUpdater.addRoute(
+      folly::IPAddress("2.2.0.0"), 16, ClientID(10), nextHop("10.0.0.22"));
+  // Unrelated routes, which the update below must leave untouched
+  constexpr auto kOtherRoutes = 64;
+  for (auto i = 0; i < kOtherRoutes; ++i) {
+    ribUpdater.addRoute(
+        folly::IPAddress(folly::to<std::string>("100.", i, ".0.0")),
+        16,
+        ClientID(10),
+        nextHop("10.0.0.100"));
+  }
+  ribUpdater.updateDone();
+
+  rib::ForwardingInformationBaseUpdater fibUpdater(
+      vrfZero, v4NetworkToRouteMap, v6NetworkToRouteMap);
+  auto firstState = fibUpdater(createStateWithEmptyFib(vrfZero));
+  firstState->publish();
+  EXPECT_FIB_SIZE(firstState, vrfZero, 3 + kOtherRoutes, 0);
+
+  auto unchangedRoute =
+      getRoute(firstState, vrfZero, folly::IPAddressV4("2.2.0.0"), 16);
+  ASSERT_NE(nullptr, unchangedRoute);
+
+  ribUpdater.delRoute(folly::IPAddress("1.1.0.0"), 16, ClientID(10));
+  ribUpdater.addRoute(
+      folly::IPAddress("3.3.0.0"), 16, ClientID(10), nextHop("10.0.0.33"));
+  ribUpdater.updateDone();
+
+  auto secondState = fibUpdater(firstState);
+  EXPECT_FIB_SIZE(secondState, vrfZero, 3 + kOtherRoutes, 0);
+  EXPECT_NO_ROUTE(secondState, vrfZero, folly::IPAddressV4("1.1.0.0"), 16);
+  EXPECT_ROUTE(secondState, vrfZero, folly::IPAddressV4("3.3.0.0"), 16);
+  EXPECT_EQ(
+      unchangedRoute,
+      getRoute(secondState, vrfZero, folly::IPAddressV4("2.2.0.0"), 16));
+
+  for (auto i = 0; i < kOtherRoutes; ++i) {
+    folly::IPAddressV4 network(folly::to<std::string>("100.", i, ".0.0"));
+    EXPECT_EQ(
+        getRoute(firstState, vrfZero, network, 16),
+        getRoute(secondState, vrfZero, network, 16));
+  }
+
+  auto fibV4 = secondState->getFibs()->getFibContainer(vrfZero)->getFibV4();
+  auto lpmRoute = fibV4->longestMatch(folly::IPAddressV4("3.3.3.3"));
+  ASSERT_NE(nullptr, lpmRoute);
+  EXPECT_EQ(lpmRoute->prefix().mask, 16);
+}
+
+// If the state the FIB is derived from is not the one produced by the last
+// sync, e.g. because that update was thrown away, the FIB must be rebuilt
+// rather than patched.
+TEST(ForwardingInformationBaseUpdater, DiscardedUpdateForcesFullSync) {
+  using namespace facebook::fboss;
+
+  const RouterID vrfZero{0};
+  rib::IPv4NetworkToRouteMap v4NetworkToRouteMap;
+  rib::IPv6NetworkToRouteMap v6NetworkToRouteMap;
+  rib::RouteUpdater ribUpdater(&v4NetworkToRouteMap, &v6NetworkToRouteMap);
+
+  ribUpdater.addInterfaceRoute(
+      folly::IPAddress("10.0.0.0"),
+      24,
+      folly::IPAddress("10.0.0.1"),
+      InterfaceID(1));
+  ribUpdater.addRoute(
+      folly::IPAddress("1.1.0.0"),
+      16,
+      ClientID(10),
+      rib::RouteNextHopEntry(
+          rib::UnresolvedNextHop(
+              folly::IPAddress("10.0.0.11"), rib::ECMP_WEIGHT),
+          kDefaultAdminDistance));
+  ribUpdater.updateDone();
+
+  rib::ForwardingInformationBaseUpdater fibUpdater(
+      vrfZero, v4NetworkToRouteMap, v6NetworkToRouteMap);
+  auto firstState = fibUpdater(createStateWithEmptyFib(vrfZero));
+  firstState->publish();
+  EXPECT_ROUTE(firstState, vrfZero, folly::IPAddressV4("1.1.0.0"), 16);
+
+  // This update never makes it into the switch state
+  ribUpdater.delRoute(folly::IPAddress("1.1.0.0"), 16, ClientID(10));
+  ribUpdater.updateDone();
+  fibUpdater(firstState);
+
+  // Patching firstState with only the changes made since the discarded
+  // update, i.e. 10.0.0.0/24 going away, would leave 1.1.0.0/16 behind
+  ribUpdater.delRoute(
+      folly::IPAddress("10.0.0.0"), 24, ClientID::INTERFACE_ROUTE);
+  ribUpdater.updateDone();
+
+  auto state = fibUpdater(firstState);
+  EXPECT_FIB_SIZE(state, vrfZero, 0, 0);
+}
+
+// Updates to different VRFs run on the RIB's worker threads concurrently, but
+// the FIB callbacks, which here read-modify-write a single SwitchState, must
+// still be serialized for no VRF's update to be lost.
+TEST(Rib, ConcurrentUpdatesToDifferentVrfs) {
+  using namespace facebook::fboss;
+
+  constexpr auto kVrfCount = 8;
+  constexpr auto kUpdatesPerVrf = 16;
+  constexpr auto kRoutesPerUpdate = 8;
+
+  rib::RoutingInformationBase rib(4);
+  auto fibMap = std::make_shared<ForwardingInformationBaseMap>();
+  for (auto vrf = 0; vrf < kVrfCount; ++vrf) {
+    rib.createVrf(RouterID(vrf));
+    fibMap->addNode(createStateWithEmptyFib(RouterID(vrf))
+                        ->getFibs()
+                        ->getFibContainer(RouterID(vrf)));
+  }
+  auto state = std::make_shared<SwitchState>();
+  state->resetForwardingInformationBases(fibMap);
+  state->publish();
+
+  auto fibUpdate = [](RouterID vrf,
+                      const rib::IPv4NetworkToRouteMap& v4NetworkToRoute,
+                      const rib::IPv6NetworkToRouteMap& v6NetworkToRoute,
+                      void* cookie) {
+    auto switchState = static_cast<std::shared_ptr<SwitchState>*>(cookie);
+    rib::ForwardingInformationBaseUpdater fibUpdater(
+        vrf, v4NetworkToRoute, v6NetworkToRoute);
+    *switchState = fibUpdater(*switchState);
+    (*switchState)->publish();
+  };
+
+  std::vector<std::thread> clients;
+  for (auto vrf = 0; vrf < kVrfCount; ++vrf) {
+    clients.emplace_back([&, vrf] {
+      for (auto i = 0; i < kUpdatesPerVrf; ++i) {
+        std::vector<UnicastRoute> routes;
+        for (auto j = 0; j < kRoutesPerUpdate; ++j) {
+          // No next-hops, i.e. DROP routes
+          UnicastRoute route;
+          route.dest_ref()->ip_ref() = facebook::network::toBinaryAddress(
+              folly::IPAddress(folly::to<std::string>("10.", i, ".", j, ".0")));
+          route.dest_ref()->prefixLength_ref() = 24;
+          routes.push_back(route);
+        }
+        rib.update(
+            RouterID(vrf),
+            ClientID(10),
+            kDefaultAdminDistance,
+            routes,
+            {},
+            false,
+            "concurrent VRF update",
+            fibUpdate,
+            &state);
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  for (auto vrf = 0; vrf < kVrfCount; ++vrf) {
+    EXPECT_FIB_SIZE(state, RouterID(vrf), kUpdatesPerVrf * kRoutesPerUpdate, 0);
+    EXPECT_EQ(
+        kUpdatesPerVrf * kRoutesPerUpdate,
+        rib.getRouteTableDetails(RouterID(vrf)).size());
+  }
+}
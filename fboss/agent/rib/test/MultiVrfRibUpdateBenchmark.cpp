@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "common/init/Init.h"
+#include "fboss/agent/AddressUtil.h"
+#include "fboss/agent/rib/ForwardingInformationBaseUpdater.h"
+#include "fboss/agent/rib/NetworkToRouteMap.h"
+#include "fboss/agent/rib/RouteNextHop.h"
+#include "fboss/agent/rib/RoutingInformationBase.h"
+#include "fboss/agent/state/ForwardingInformationBase.h"
+#include "fboss/agent/state/ForwardingInformationBaseContainer.h"
+#include "fboss/agent/state/ForwardingInformationBaseMap.h"
+#include "fboss/agent/state/SwitchState.h"
+
+#include <folly/Benchmark.h>
+#include <folly/IPAddressV4.h>
+
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace facebook::fboss;
+
+DEFINE_int32(vrf_count, 8, "Number of VRFs updated concurrently");
+DEFINE_int32(routes_per_vrf, 20000, "Number of routes added to each VRF");
+DEFINE_int32(routes_per_update, 1000, "Number of routes per RIB update");
+DEFINE_int32(parallel_rib_threads, 8, "RIB update threads when parallel");
+
+namespace {
+
+UnicastRoute createRoute(
+    const folly::IPAddressV4& network,
+    uint8_t mask,
+    std::optional<folly::IPAddressV4> nexthop) {
+  UnicastRoute route;
+  IpPrefix prefix;
+  prefix.ip_ref() = facebook::network::toBinaryAddress(network);
+  prefix.prefixLength_ref() = mask;
+  route.dest_ref() = prefix;
+
+  // Routes without a nexthop are programmed as DROP
+  if (nexthop) {
+    std::vector<NextHopThrift> nexthops(1);
+    nexthops.back().address_ref() =
+        facebook::network::toBinaryAddress(*nexthop);
+    nexthops.back().weight_ref() = static_cast<int32_t>(rib::ECMP_WEIGHT);
+    route.nextHops_ref() = std::move(nexthops);
+  }
+  return route;
+}
+
+// Apply FIB updates to a SwitchState holding every VRF's FIB, the way
+// SwSwitch's update thread would. The RIB never runs this concurrently.
+void fibUpdate(
+    RouterID vrf,
+    const rib::IPv4NetworkToRouteMap& v4NetworkToRoute,
+    const rib::IPv6NetworkToRouteMap& v6NetworkToRoute,
+    void* cookie) {
+  auto state = static_cast<std::shared_ptr<SwitchState>*>(cookie);
+  rib::ForwardingInformationBaseUpdater fibUpdater(
+      vrf, v4NetworkToRoute, v6NetworkToRoute);
+  *state = fibUpdater(*state);
+  (*state)->publish();
+}
+
+void runMultiVrfUpdates(size_t numRibThreads) {
+  folly::BenchmarkSuspender suspender;
+
+  rib::RoutingInformationBase rib(numRibThreads);
+  auto fibs = std::make_shared<ForwardingInformationBaseMap>();
+  for (auto vrf = 0; vrf < FLAGS_vrf_count; ++vrf) {
+    rib.createVrf(RouterID(vrf));
+    auto fibContainer =
+        std::make_shared<ForwardingInformationBaseContainer>(RouterID(vrf));
+    fibContainer->writableFields()->fibV4 =
+        std::make_shared<ForwardingInformationBaseV4>();
+    fibContainer->writableFields()->fibV6 =
+        std::make_shared<ForwardingInformationBaseV6>();
+    fibs->addNode(fibContainer);
+  }
+  auto state = std::make_shared<SwitchState>();
+  state->resetForwardingInformationBases(fibs);
+  state->publish();
+
+  // Every route is recursively resolved through 10/8
+  std::vector<std::vector<UnicastRoute>> updates;
+  updates.push_back(
+      {createRoute(folly::IPAddressV4("10.0.0.0"), 8, std::nullopt)});
+  for (auto i = 0; i < FLAGS_routes_per_vrf; i += FLAGS_routes_per_update) {
+    std::vector<UnicastRoute> routes;
+    for (auto j = i; j < i + FLAGS_routes_per_update; ++j) {
+      routes.push_back(createRoute(
+          folly::IPAddressV4::fromLongHBO(0x14000000 + (j << 8)),
+          24,
+          folly::IPAddressV4::fromLongHBO(0x0a000001 + j % 64)));
+    }
+    updates.push_back(std::move(routes));
+  }
+
+  suspender.dismiss();
+
+  // One client per VRF, as with a routing daemon per VRF
+  std::vector<std::thread> clients;
+  for (auto vrf = 0; vrf < FLAGS_vrf_count; ++vrf) {
+    clients.emplace_back([&, vrf] {
+      for (const auto& routes : updates) {
+        rib.update(
+            RouterID(vrf),
+            ClientID::BGPD,
+            AdminDistance::EBGP,
+            routes,
+            {},
+            false,
+            "multi VRF benchmark",
+            &fibUpdate,
+            &state);
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  suspender.rehire();
+}
+
+} // namespace
+
+BENCHMARK(RibMultiVrfUpdateSingleThread) {
+  runMultiVrfUpdates(1);
+}
+
+BENCHMARK_RELATIVE(RibMultiVrfUpdateParallel) {
+  runMultiVrfUpdates(FLAGS_parallel_rib_threads);
+}
+
+int main(int argc, char** argv) {
+  facebook::initFacebook(&argc, &argv);
+  folly::runBenchmarks();
+  return EXIT_SUCCESS;
+}
@@ -1621,6 +1621,100 @@ TEST(Route, withInvalidLabelForwardingAction) {
       FbossError);
 }
 
+// Only routes affected by an update get re-resolved, which has to give the
+// same result as resolving the whole table from scratch.
+TEST(Route, incrementalResolutionMatchesFullResolution) {
+  IPv4NetworkToRouteMap v4Routes;
+  IPv6NetworkToRouteMap v6Routes;
+
+  configRoutes(&v4Routes, &v6Routes);
+
+  auto expectMatchesFullResolution = [&]() {
+    // Deserialized routes carry no resolution index, so they get resolved
+    // from scratch
+    auto fullV4Routes =
+        IPv4NetworkToRouteMap::fromFollyDynamic(v4Routes.toFollyDynamic());
+    auto fullV6Routes =
+        IPv6NetworkToRouteMap::fromFollyDynamic(v6Routes.toFollyDynamic());
+    RouteUpdater(&fullV4Routes, &fullV6Routes).updateDone();
+
+    EXPECT_ROUTES_MATCH(&v4Routes, &fullV4Routes);
+    EXPECT_ROUTES_MATCH(&v6Routes, &fullV6Routes);
+  };
+
+  {
+    // 30/8 -> 20/8 -> 10/8 -> 1.1.1/24, and a v6 route resolved via v4
+    RouteUpdater u1(&v4Routes, &v6Routes);
+    u1.addRoute(
+        IPAddress("10.0.0.0"),
+        8,
+        kClientA,
+        RouteNextHopEntry(makeNextHops({"1.1.1.10"}), kDistance));
+    u1.addRoute(
+        IPAddress("20.0.0.0"),
+        8,
+        kClientA,
+        RouteNextHopEntry(makeNextHops({"10.1.1.1"}), kDistance));
+    u1.addRoute(
+        IPAddress("30.0.0.0"),
+        8,
+        kClientA,
+        RouteNextHopEntry(makeNextHops({"20.1.1.1"}), kDistance));
+    u1.addRoute(
+        IPAddress("5::"),
+        64,
+        kClientA,
+        RouteNextHopEntry(makeNextHops({"10.2.2.2"}), kDistance));
+    u1.updateDone();
+  }
+  EXPECT_FWD_INFO(getRoute(v4Routes, "30.0.0.0/8"), InterfaceID(1), "1.1.1.10");
+  EXPECT_FWD_INFO(getRoute(v6Routes, "5::/64"), InterfaceID(1), "1.1.1.10");
+  expectMatchesFullResolution();
+
+  {
+    // Taking the interface down makes the whole chain unresolvable
+    RouteUpdater u2(&v4Routes, &v6Routes);
+    u2.delRoute(IPAddress("1.1.1.0"), 24, ClientID::INTERFACE_ROUTE);
+    u2.updateDone();
+  }
+  EXPECT_FALSE(getRoute(v4Routes, "30.0.0.0/8")->isResolved());
+  EXPECT_FALSE(getRoute(v6Routes, "5::/64")->isResolved());
+  expectMatchesFullResolution();
+
+  {
+    // A more specific route takes over resolution of 20/8 only
+    RouteUpdater u3(&v4Routes, &v6Routes);
+    u3.addRoute(
+        IPAddress("10.1.0.0"),
+        16,
+        kClientA,
+        RouteNextHopEntry(makeNextHops({"2.2.2.10"}), kDistance));
+    u3.updateDone();
+  }
+  EXPECT_FWD_INFO(getRoute(v4Routes, "30.0.0.0/8"), InterfaceID(2), "2.2.2.10");
+  EXPECT_FALSE(getRoute(v6Routes, "5::/64")->isResolved());
+  expectMatchesFullResolution();
+
+  {
+    RouteUpdater u4(&v4Routes, &v6Routes);
+    u4.addInterfaceRoute(
+        IPAddress("1.1.1.1"), 24, IPAddress("1.1.1.1"), InterfaceID(1));
+    u4.updateDone();
+  }
+  EXPECT_FWD_INFO(getRoute(v4Routes, "30.0.0.0/8"), InterfaceID(2), "2.2.2.10");
+  EXPECT_FWD_INFO(getRoute(v6Routes, "5::/64"), InterfaceID(1), "1.1.1.10");
+  expectMatchesFullResolution();
+
+  {
+    // Back to resolving 20/8 via 10/8
+    RouteUpdater u5(&v4Routes, &v6Routes);
+    u5.delRoute(IPAddress("10.1.0.0"), 16, kClientA);
+    u5.updateDone();
+  }
+  EXPECT_FWD_INFO(getRoute(v4Routes, "30.0.0.0/8"), InterfaceID(1), "1.1.1.10");
+  expectMatchesFullResolution();
+}
+
 /*
  * Class that makes it easy to run tests with the following
  * configurable entities:
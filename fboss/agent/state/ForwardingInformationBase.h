@@ -10,17 +10,69 @@
 #pragma once
 
 #include "fboss/agent/state/NodeMap.h"
+#include "fboss/agent/state/PersistentNodeContainer.h"
 #include "fboss/agent/state/Route.h"
 #include "fboss/agent/state/RouteTypes.h"
+#include "fboss/lib/RadixTree.h"
 
 #include <folly/IPAddressV4.h>
 #include <folly/IPAddressV6.h>
 
 namespace facebook::fboss {
 
+/*
+ * Longest prefix match index over the routes of a ForwardingInformationBase.
+ *
+ * The index is a persistent radix tree: cloning a FIB copies its fields and
+ * hence shares the entire index with the original, while a modification of
+ * the clone only copies the tree nodes on the path to the modified prefix.
+ * NodeMapT keeps the index in sync with the routes as they are added,
+ * updated and removed, including when deserializing a FIB, so the index is
+ * not serialized.
+ */
+template <typename AddressT>
+struct ForwardingInformationBaseLpmIndex {
+  using Tree = facebook::network::
+      PersistentRadixTree<AddressT, std::shared_ptr<Route<AddressT>>>;
+
+  template <typename Fn>
+  void forEachChild(Fn /*fn*/) {
+    // Routes in the index are the same objects as the ones held in
+    // NodeMapFields::nodes, which takes care of visiting them.
+  }
+
+  folly::dynamic toFollyDynamic() const {
+    return folly::dynamic::object;
+  }
+
+  static ForwardingInformationBaseLpmIndex fromFollyDynamic(
+      const folly::dynamic& /*json*/) {
+    return ForwardingInformationBaseLpmIndex();
+  }
+
+  void nodeAdded(const std::shared_ptr<Route<AddressT>>& route) {
+    routes.insert(route->prefix().network, route->prefix().mask, route);
+  }
+  void nodeUpdated(const std::shared_ptr<Route<AddressT>>& route) {
+    routes.insertOrAssign(route->prefix().network, route->prefix().mask, route);
+  }
+  void nodeRemoved(const std::shared_ptr<Route<AddressT>>& route) {
+    routes.erase(route->prefix().network, route->prefix().mask);
+  }
+
+  Tree routes;
+};
+
+// Every route update clones the FIB, which thus shares its routes with the
+// previous one rather than copying them
 template <typename AddressT>
-using ForwardingInformationBaseTraits =
-    NodeMapTraits<RoutePrefix<AddressT>, Route<AddressT>>;
+using ForwardingInformationBaseTraits = NodeMapTraits<
+    RoutePrefix<AddressT>,
+    Route<AddressT>,
+    ForwardingInformationBaseLpmIndex<AddressT>,
+    PersistentNodeContainer<
+        RoutePrefix<AddressT>,
+        std::shared_ptr<Route<AddressT>>>>;
 
 template <typename AddressT>
 class ForwardingInformationBase
@@ -28,12 +80,14 @@ class ForwardingInformationBase
           ForwardingInformationBase<AddressT>,
           ForwardingInformationBaseTraits<AddressT>> {
  public:
-  ForwardingInformationBase();
-  ~ForwardingInformationBase() override;
-
   using Base = NodeMapT<
       ForwardingInformationBase<AddressT>,
       ForwardingInformationBaseTraits<AddressT>>;
+  using NodeContainer = typename Base::NodeContainer;
+
+  ForwardingInformationBase();
+  explicit ForwardingInformationBase(NodeContainer routes);
+  ~ForwardingInformationBase() override;
 
   std::shared_ptr<Route<AddressT>> exactMatch(
       const RoutePrefix<AddressT>& prefix) const;
@@ -42,9 +96,20 @@ class ForwardingInformationBase
     return exactMatch(prefix);
   }
 
+  /*
+   * Lookup is done against the LPM index and costs O(address bit count),
+   * independent of the number of routes in the FIB.
+   */
   std::shared_ptr<Route<AddressT>> longestMatch(const AddressT& address) const;
 
  private:
+  typename ForwardingInformationBaseLpmIndex<AddressT>::Tree& writableIndex() {
+    return this->writableExtraFields().routes;
+  }
+
+  // Direct modification of the routes would bypass the LPM index
+  using Base::writableNodes;
+
   // Inherit the constructors required for clone()
   using Base::Base;
   friend class CloneAllocator;
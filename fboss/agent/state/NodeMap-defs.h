@@ -47,35 +47,56 @@ std::shared_ptr<typename TraitsT::Node> NodeMapT<MapTypeT, TraitsT>::getNodeIf(
   return iter->second;
 }
 
+template <typename MapTypeT, typename TraitsT>
+typename NodeMapT<MapTypeT, TraitsT>::NodeContainer&
+NodeMapT<MapTypeT, TraitsT>::writableLoggedNodes(const KeyType& changedKey) {
+  auto fields = this->writableFields();
+  // Log the key even if the change ends up failing: the log only needs to be
+  // a superset of the changes.
+  fields->changeLog.recordChange(changedKey, fields->nodes.size());
+  fields->version = nextNodeMapVersion();
+  return fields->nodes;
+}
+
 template <typename MapTypeT, typename TraitsT>
 void NodeMapT<MapTypeT, TraitsT>::addNode(const std::shared_ptr<Node>& node) {
-  auto& nodes = writableNodes();
+  auto& nodes = writableLoggedNodes(TraitsT::getKey(node));
   auto ret = nodes.insert(std::make_pair(TraitsT::getKey(node), node));
   if (!ret.second) {
     throw FbossError("duplicate node ID ", TraitsT::getKey(node));
   }
+  if constexpr (ExtraFieldsTrackNodes<ExtraFields>::value) {
+    writableExtraFields().nodeAdded(node);
+  }
 }
 
 template <typename MapTypeT, typename TraitsT>
 void NodeMapT<MapTypeT, TraitsT>::updateNode(
     const std::shared_ptr<Node>& node) {
-  auto& nodes = writableNodes();
+  auto& nodes = writableLoggedNodes(TraitsT::getKey(node));
   auto it = nodes.find(TraitsT::getKey(node));
   if (it == nodes.end()) {
     throw FbossError("node ID ", TraitsT::getKey(node), " does not exist");
   }
   it->second = node;
+  if constexpr (ExtraFieldsTrackNodes<ExtraFields>::value) {
+    writableExtraFields().nodeUpdated(node);
+  }
 }
 
 template <typename MapTypeT, typename TraitsT>
 void NodeMapT<MapTypeT, TraitsT>::removeNode(
     const std::shared_ptr<Node>& node) {
-  auto& nodes = writableNodes();
+  auto& nodes = writableLoggedNodes(TraitsT::getKey(node));
   auto it = nodes.find(TraitsT::getKey(node));
   if (it == nodes.end()) {
     throw FbossError("node ID ", TraitsT::getKey(node), " does not exist");
   }
+  std::shared_ptr<Node> removed = it->second;
   nodes.erase(it);
+  if constexpr (ExtraFieldsTrackNodes<ExtraFields>::value) {
+    writableExtraFields().nodeRemoved(removed);
+  }
 }
 
 template <typename MapTypeT, typename TraitsT>
@@ -91,13 +112,16 @@ std::shared_ptr<typename TraitsT::Node> NodeMapT<MapTypeT, TraitsT>::removeNode(
 template <typename MapTypeT, typename TraitsT>
 std::shared_ptr<typename TraitsT::Node>
 NodeMapT<MapTypeT, TraitsT>::removeNodeIf(const KeyType& key) {
-  auto& nodes = writableNodes();
+  auto& nodes = writableLoggedNodes(key);
   auto it = nodes.find(key);
   if (it == nodes.end()) {
     return nullptr;
   }
   std::shared_ptr<Node> node = it->second;
   nodes.erase(it);
+  if constexpr (ExtraFieldsTrackNodes<ExtraFields>::value) {
+    writableExtraFields().nodeRemoved(node);
+  }
   return node;
 }
 
@@ -117,12 +141,14 @@ template <typename MapTypeT, typename TraitsT>
 std::shared_ptr<MapTypeT> NodeMapT<MapTypeT, TraitsT>::fromFollyDynamic(
     const folly::dynamic& nodesJson) {
   auto nodeMap = std::make_shared<MapTypeT>();
+  // Extra fields come first, so that any derived from the nodes are rebuilt
+  // as the nodes are added
+  nodeMap->writableExtraFields() =
+      ExtraFields::fromFollyDynamic(nodesJson[kExtraFields]);
   auto entries = nodesJson[kEntries];
   for (const auto& entry : entries) {
     nodeMap->addNode(Node::fromFollyDynamic(entry));
   }
-  nodeMap->writableExtraFields() =
-      ExtraFields::fromFollyDynamic(nodesJson[kExtraFields]);
   return nodeMap;
 }
 
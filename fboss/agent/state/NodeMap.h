@@ -12,10 +12,31 @@
 #include <boost/container/flat_map.hpp>
 
 #include "fboss/agent/state/NodeBase.h"
+#include "fboss/agent/state/NodeMapChangeLog.h"
 #include "fboss/agent/state/NodeMapIterator.h"
 
+#include <type_traits>
+
 namespace facebook::fboss {
 
+/*
+ * The container holding the children of a NodeMap: TraitsT::NodeContainer if
+ * the traits define one, a flat_map otherwise.
+ */
+template <typename TraitsT, typename = void>
+struct NodeMapContainer {
+  using type = boost::container::flat_map<
+      typename TraitsT::KeyType,
+      std::shared_ptr<typename TraitsT::Node>>;
+};
+
+template <typename TraitsT>
+struct NodeMapContainer<
+    TraitsT,
+    std::void_t<typename TraitsT::NodeContainer>> {
+  using type = typename TraitsT::NodeContainer;
+};
+
 /*
  * NodeMapFields defines the fields contained inside a NodeMapT instantiation
  */
@@ -24,13 +45,20 @@ struct NodeMapFields {
   using KeyType = typename TraitsT::KeyType;
   using Node = typename TraitsT::Node;
   using ExtraFields = typename TraitsT::ExtraFields;
-  using NodeContainer =
-      boost::container::flat_map<KeyType, std::shared_ptr<Node>>;
+  using NodeContainer = typename NodeMapContainer<TraitsT>::type;
 
   NodeMapFields() {}
   NodeMapFields(NodeContainer nodes) : nodes(std::move(nodes)) {}
   NodeMapFields(const NodeMapFields& other, NodeContainer nodes)
       : nodes(std::move(nodes)), extra(other.extra) {}
+  // Used by clone(): the copy logs the changes made since it was cloned
+  NodeMapFields(const NodeMapFields& other)
+      : nodes(other.nodes),
+        extra(other.extra),
+        changeLog(other.changeLog.derive(other.version)) {}
+  NodeMapFields(NodeMapFields&&) = default;
+  NodeMapFields& operator=(const NodeMapFields&) = default;
+  NodeMapFields& operator=(NodeMapFields&&) = default;
 
   template <typename Fn>
   void forEachChild(Fn fn) {
@@ -42,6 +70,8 @@ struct NodeMapFields {
 
   NodeContainer nodes;
   ExtraFields extra;
+  uint64_t version{nextNodeMapVersion()};
+  NodeMapChangeLog<KeyType> changeLog;
 };
 
 struct NodeMapNoExtraFields {
@@ -57,11 +87,38 @@ struct NodeMapNoExtraFields {
   }
 };
 
-template <typename KeyT, typename NodeT, typename ExtraT = NodeMapNoExtraFields>
+/*
+ * ExtraFields derived from the nodes of the map, such as an index over them,
+ * define nodeAdded(), nodeUpdated() and nodeRemoved(). NodeMapT calls them
+ * on every change made through its mutators, so that the extra fields stay
+ * in sync with the nodes whichever class the map is changed through.
+ * Changes made through writableNodes() bypass them.
+ */
+template <typename ExtraT, typename = void>
+struct ExtraFieldsTrackNodes : std::false_type {};
+
+template <typename ExtraT>
+struct ExtraFieldsTrackNodes<ExtraT, std::void_t<decltype(&ExtraT::nodeAdded)>>
+    : std::true_type {};
+
+/*
+ * NodeContainerT is a flat_map by default, which is the most compact and the
+ * fastest to iterate over, but every clone copies it and every change moves
+ * O(N) entries. Maps with many nodes that change often should use a
+ * PersistentNodeContainer instead, which clone and change in O(log N) and
+ * whose deltas are computed in time proportional to the number of changes.
+ */
+template <
+    typename KeyT,
+    typename NodeT,
+    typename ExtraT = NodeMapNoExtraFields,
+    typename NodeContainerT =
+        boost::container::flat_map<KeyT, std::shared_ptr<NodeT>>>
 struct NodeMapTraits {
   using KeyType = KeyT;
   using Node = NodeT;
   using ExtraFields = ExtraT;
+  using NodeContainer = NodeContainerT;
 
   static KeyType getKey(const std::shared_ptr<Node>& node) {
     return node->getID();
@@ -99,8 +156,31 @@ class NodeMapT : public NodeBaseT<MapTypeT, NodeMapFields<TraitsT>> {
   const NodeContainer& getAllNodes() const {
     return this->getFields()->nodes;
   }
+  /*
+   * Changes made through writableNodes() are not logged, so the deltas of
+   * this map and its clones fall back to walking all their nodes. Prefer
+   * addNode(), updateNode() and removeNode().
+   */
   NodeContainer& writableNodes() {
-    return this->writableFields()->nodes;
+    auto fields = this->writableFields();
+    fields->changeLog.stopTracking();
+    fields->version = nextNodeMapVersion();
+    return fields->nodes;
+  }
+
+  /*
+   * The version changes whenever the nodes of the map may have changed.
+   */
+  uint64_t getVersion() const {
+    return this->getFields()->version;
+  }
+  /*
+   * The keys of the nodes that may differ between this map and an ancestor
+   * with the given version, or nullptr if they are unknown.
+   */
+  std::shared_ptr<const std::set<KeyType>> getChangedKeysSince(
+      uint64_t ancestorVersion) const {
+    return this->getFields()->changeLog.changedSince(ancestorVersion, size());
   }
 
   const ExtraFields& getExtraFields() const {
@@ -152,6 +232,8 @@ class NodeMapT : public NodeBaseT<MapTypeT, NodeMapFields<TraitsT>> {
   static std::shared_ptr<MapTypeT> fromFollyDynamic(const folly::dynamic& json);
 
  private:
+  NodeContainer& writableLoggedNodes(const KeyType& changedKey);
+
   // Inherit the constructor required for clone()
   using NodeBaseT<MapTypeT, NodeMapFields<TraitsT>>::NodeBaseT;
   friend class CloneAllocator;
@@ -0,0 +1,132 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * Every NodeMap has a version number, unique across all the maps of the
+ * process. A map gets a new version when it is created, cloned or modified,
+ * so two maps with the same version always hold the same nodes.
+ */
+inline uint64_t nextNodeMapVersion() {
+  static std::atomic<uint64_t> nextVersion{1};
+  return nextVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+ * NodeMapChangeLog records the keys of the nodes added, updated or removed in
+ * a NodeMap since it was cloned, and inherits the logs of the maps it
+ * descends from. This lets NodeMapDelta enumerate only the keys that changed
+ * between a map and one of its recent ancestors, instead of walking both
+ * maps in full.
+ *
+ * The log is made of one segment per clone: the version of the map that was
+ * cloned, and the keys changed in the clone. Segments are shared with the
+ * descendants of a map, so cloning only copies up to kMaxSegments pointers.
+ * The log is only an upper bound of the changes: a key may be logged even
+ * though its node ended up unchanged.
+ *
+ * A log stops tracking changes, and falls back to a full walk of the maps,
+ * when a map logs more than kMinTrackedChanges changes and more than
+ * 1/kMaxTrackedFraction of its size, or when its nodes are modified without
+ * going through the NodeMap API.
+ */
+template <typename KeyT>
+class NodeMapChangeLog {
+ public:
+  using ChangedKeys = std::set<KeyT>;
+
+  static constexpr size_t kMaxSegments = 8;
+  static constexpr size_t kMinTrackedChanges = 64;
+  static constexpr size_t kMaxTrackedFraction = 8;
+
+  NodeMapChangeLog() {}
+
+  /*
+   * The log of a map cloned from the map with parentVersion and this log.
+   */
+  NodeMapChangeLog derive(uint64_t parentVersion) const {
+    NodeMapChangeLog log;
+    auto first = segments_.size() < kMaxSegments
+        ? segments_.begin()
+        : segments_.end() - (kMaxSegments - 1);
+    log.segments_.assign(first, segments_.end());
+    log.segments_.push_back(
+        Segment{parentVersion, std::make_shared<ChangedKeys>()});
+    return log;
+  }
+
+  void recordChange(const KeyT& key, size_t mapSize) {
+    if (segments_.empty()) {
+      return;
+    }
+    auto& keys = *segments_.back().keys;
+    keys.insert(key);
+    if (keys.size() > maxTrackedChanges(mapSize)) {
+      stopTracking();
+    }
+  }
+
+  void stopTracking() {
+    segments_.clear();
+  }
+
+  /*
+   * The keys of every node that may differ between the map with version
+   * ancestorVersion and the map owning this log, or nullptr if they were not
+   * tracked.
+   */
+  std::shared_ptr<const ChangedKeys> changedSince(
+      uint64_t ancestorVersion,
+      size_t mapSize) const {
+    auto it = std::find_if(
+        segments_.begin(), segments_.end(), [=](const Segment& segment) {
+          return segment.baseVersion == ancestorVersion;
+        });
+    if (it == segments_.end()) {
+      return nullptr;
+    }
+    if (it + 1 == segments_.end()) {
+      return it->keys;
+    }
+    auto keys = std::make_shared<ChangedKeys>();
+    for (; it != segments_.end(); ++it) {
+      keys->insert(it->keys->begin(), it->keys->end());
+      if (keys->size() > maxTrackedChanges(mapSize)) {
+        return nullptr;
+      }
+    }
+    return keys;
+  }
+
+ private:
+  struct Segment {
+    uint64_t baseVersion;
+    // Shared with the descendants of the map this segment was created for
+    std::shared_ptr<ChangedKeys> keys;
+  };
+
+  static size_t maxTrackedChanges(size_t mapSize) {
+    return std::max(kMinTrackedChanges, mapSize / kMaxTrackedFraction);
+  }
+
+  // Oldest first. Empty if changes are not being tracked.
+  std::vector<Segment> segments_;
+};
+
+} // namespace facebook::fboss
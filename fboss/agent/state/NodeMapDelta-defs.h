@@ -32,12 +32,42 @@ NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::Iterator(
   // Advance to the first difference
   while (oldIt_ != oldMap_->end() && newIt_ != newMap_->end() &&
          *oldIt_ == *newIt_) {
-    ++oldIt_;
-    ++newIt_;
+    oldIt_.advancePastShared(newIt_);
   }
   updateValue();
 }
 
+template <typename MAP, typename VALUE, typename MAPPOINTERTRAITS>
+NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::Iterator(
+    const MapType* oldMap,
+    const MapType* newMap,
+    std::shared_ptr<const ChangedKeys> changedKeys,
+    typename ChangedKeys::const_iterator keyIt)
+    : oldIt_(),
+      newIt_(),
+      oldMap_(oldMap),
+      newMap_(newMap),
+      changedKeys_(std::move(changedKeys)),
+      keyIt_(keyIt),
+      value_(nullNode_, nullNode_) {
+  skipUnchangedKeys();
+}
+
+template <typename MAP, typename VALUE, typename MAPPOINTERTRAITS>
+void NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::skipUnchangedKeys() {
+  // The log may contain keys whose node ended up unchanged, or which were
+  // added and then removed again.
+  for (; keyIt_ != changedKeys_->end(); ++keyIt_) {
+    auto oldNode = oldMap_->getNodeIf(*keyIt_);
+    auto newNode = newMap_->getNodeIf(*keyIt_);
+    if (oldNode != newNode) {
+      value_.reset(oldNode, newNode);
+      return;
+    }
+  }
+  value_.reset(nullNode_, nullNode_);
+}
+
 template <typename MAP, typename VALUE, typename MAPPOINTERTRAITS>
 NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::Iterator()
     : oldIt_(),
@@ -73,6 +103,14 @@ void NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::updateValue() {
 
 template <typename MAP, typename VALUE, typename MAPPOINTERTRAITS>
 void NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::advance() {
+  if (changedKeys_) {
+    // advance() shouldn't be called if we are already at the end
+    CHECK(keyIt_ != changedKeys_->end());
+    ++keyIt_;
+    skipUnchangedKeys();
+    return;
+  }
+
   // If we have already hit the end of one side, advance the other.
   // We are immediately done after this.
   if (oldIt_ == oldMap_->end()) {
@@ -103,8 +141,7 @@ void NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator::advance() {
   // Advance past any unchanged nodes.
   while (oldIt_ != oldMap_->end() && newIt_ != newMap_->end() &&
          *oldIt_ == *newIt_) {
-    ++oldIt_;
-    ++newIt_;
+    oldIt_.advancePastShared(newIt_);
   }
   updateValue();
 }
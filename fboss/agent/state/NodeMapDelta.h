@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <set>
 #include <type_traits>
 
 #include <folly/functional/ApplyTuple.h>
@@ -55,6 +56,11 @@ class MapUniquePointerTraits {
  *
  * The main function of this class is the Iterator that it provides.  This
  * allows caller to walk over the changed, added, and removed nodes.
+ *
+ * When the new map descends from the old one and logged the keys it changed
+ * (see NodeMapChangeLog), the Iterator only visits those keys, so walking the
+ * delta costs O(changes) rather than O(size of the maps). Otherwise it walks
+ * both maps in lockstep.
  */
 template <
     typename MAP,
@@ -65,6 +71,7 @@ class NodeMapDelta {
   using MapPointerType = typename MAPPOINTERTRAITS::MapPointerType;
   using RawConstPointerType = typename MAPPOINTERTRAITS::RawConstPointerType;
   using Node = typename MAP::Node;
+  using ChangedKeys = std::set<typename MAP::KeyType>;
   class Iterator;
 
   NodeMapDelta(MapPointerType&& oldMap, MapPointerType&& newMap)
@@ -88,6 +95,12 @@ class NodeMapDelta {
   Iterator end() const;
 
  private:
+  /*
+   * The keys changed between the old and new map if the new map logged them,
+   * nullptr otherwise.
+   */
+  const std::shared_ptr<const ChangedKeys>& getChangedKeys() const;
+
   /*
    * NodeMapDelta is used by StateDelta.  StateDelta holds a shared_ptr to
    * the old and new SwitchState objects, which in turn holds
@@ -100,6 +113,9 @@ class NodeMapDelta {
    */
   MapPointerType old_;
   MapPointerType new_;
+  // Computed on the first call to begin() or end()
+  mutable bool changedKeysLookedUp_{false};
+  mutable std::shared_ptr<const ChangedKeys> changedKeys_;
 };
 
 template <typename NODE>
@@ -156,6 +172,11 @@ class NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator {
       typename MapType::Iterator oldIt,
       const MapType* newMap,
       typename MapType::Iterator newIt);
+  Iterator(
+      const MapType* oldMap,
+      const MapType* newMap,
+      std::shared_ptr<const ChangedKeys> changedKeys,
+      typename ChangedKeys::const_iterator keyIt);
   Iterator();
 
   const value_type& operator*() const {
@@ -176,6 +197,9 @@ class NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator {
   }
 
   bool operator==(const Iterator& other) const {
+    if (changedKeys_) {
+      return keyIt_ == other.keyIt_;
+    }
     return oldIt_ == other.oldIt_ && newIt_ == other.newIt_;
   }
   bool operator!=(const Iterator& other) const {
@@ -188,11 +212,15 @@ class NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::Iterator {
 
   void advance();
   void updateValue();
+  void skipUnchangedKeys();
 
   InnerIter oldIt_{nullptr};
   InnerIter newIt_{nullptr};
   const MapType* oldMap_{nullptr};
   const MapType* newMap_{nullptr};
+  // Only set when iterating over the keys logged by the new map
+  std::shared_ptr<const ChangedKeys> changedKeys_;
+  typename ChangedKeys::const_iterator keyIt_;
   VALUE value_;
 
   static std::shared_ptr<Node> nullNode_;
@@ -214,6 +242,9 @@ NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::begin() const {
   if (!new_) {
     return Iterator(getOld(), old_->begin(), getOld(), old_->end());
   }
+  if (const auto& changedKeys = getChangedKeys()) {
+    return Iterator(getOld(), getNew(), changedKeys, changedKeys->begin());
+  }
   return Iterator(getOld(), old_->begin(), getNew(), new_->begin());
 }
 
@@ -226,7 +257,23 @@ NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::end() const {
   if (!new_) {
     return Iterator(getOld(), old_->end(), getOld(), old_->end());
   }
+  if (const auto& changedKeys = getChangedKeys()) {
+    return Iterator(getOld(), getNew(), changedKeys, changedKeys->end());
+  }
   return Iterator(getOld(), old_->end(), getNew(), new_->end());
 }
 
+template <typename MAP, typename VALUE, typename MAPPOINTERTRAITS>
+const std::shared_ptr<
+    const typename NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::ChangedKeys>&
+NodeMapDelta<MAP, VALUE, MAPPOINTERTRAITS>::getChangedKeys() const {
+  if (!changedKeysLookedUp_) {
+    changedKeysLookedUp_ = true;
+    if (old_ && new_ && old_ != new_) {
+      changedKeys_ = getNew()->getChangedKeysSince(getOld()->getVersion());
+    }
+  }
+  return changedKeys_;
+}
+
 } // namespace facebook::fboss
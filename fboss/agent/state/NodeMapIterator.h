@@ -12,7 +12,20 @@
 #include <boost/container/flat_map.hpp>
 
 /*
- * NodeMapIterator is a very small wrapper around flat_map::const_iterator.
+ * Advance lhs and rhs, which point at the same node of two NodeMap
+ * containers, past that node. Containers that share storage between maps,
+ * like PersistentNodeContainer, overload this to also skip the nodes after it
+ * that both maps share.
+ */
+template <typename ContainerIterator>
+void advancePastSharedNodes(ContainerIterator& lhs, ContainerIterator& rhs) {
+  ++lhs;
+  ++rhs;
+}
+
+/*
+ * NodeMapIterator is a very small wrapper around the const_iterator of the
+ * NodeMap container.
  *
  * The main difference is that dereferencing it returns only the Node,
  * and not a pair of (_Id, _Node)
@@ -52,6 +65,14 @@ class NodeMapIterator
     return it_ != other.it_;
   }
 
+  /*
+   * Advance this and other, which must point at the same node, at least past
+   * that node. See advancePastSharedNodes().
+   */
+  void advancePastShared(NodeMapIterator& other) {
+    advancePastSharedNodes(it_, other.it_);
+  }
+
  private:
   typename NodeContainer::const_iterator it_;
 };
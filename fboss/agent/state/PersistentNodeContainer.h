@@ -0,0 +1,472 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace facebook::fboss {
+
+/*
+ * PersistentNodeContainer is a sorted map implemented as a copy-on-write
+ * B+tree. It can be used in place of boost::container::flat_map to hold the
+ * children of large NodeMaps (see NodeMapTraits).
+ *
+ * Copying the container is O(1): the copy shares every tree node with the
+ * original. A modification only copies the nodes on the path to the changed
+ * entry that are still shared, so cloning a map of N nodes and changing one
+ * of them costs O(log N) node copies instead of copying N shared_ptrs and
+ * moving up to N entries.
+ *
+ * Two containers that were derived from one another keep sharing the
+ * subtrees neither of them modified. advancePastSharedNodes() uses this to
+ * skip those subtrees when walking two containers side by side, which lets
+ * NodeMapDelta iterate over a delta in time proportional to the number of
+ * changes.
+ *
+ * Differences from flat_map:
+ * - begin() and end() only return const iterators.
+ * - find() on a non-const container unshares the path to the entry, so that
+ *   the entry can be modified through the returned iterator. Only the mapped
+ *   value may be changed that way, never the key.
+ * - Iterators are invalidated by any modification, including find() on a
+ *   non-const container.
+ * - erase(pos) does not return an iterator.
+ *
+ * Like the NodeMap it backs, a container may be read from several threads,
+ * but must only be modified while it is visible to a single thread.
+ */
+template <
+    typename KeyT,
+    typename ValueT,
+    size_t kMaxLeafSize = 64,
+    size_t kMaxBranchSize = 32>
+class PersistentNodeContainer {
+  static_assert(kMaxLeafSize >= 2, "leaves must be able to split");
+  static_assert(kMaxBranchSize >= 2, "branches must be able to split");
+
+ public:
+  using key_type = KeyT;
+  using mapped_type = ValueT;
+  using value_type = std::pair<KeyT, ValueT>;
+  using size_type = size_t;
+
+ private:
+  struct TreeNode {
+    bool isLeaf() const {
+      return children.empty();
+    }
+    bool empty() const {
+      return entries.empty() && children.empty();
+    }
+    const KeyT& firstKey() const {
+      return isLeaf() ? entries.front().first : firstKeys.front();
+    }
+    // Index of the child whose subtree key belongs to
+    size_t childIndex(const KeyT& key) const {
+      auto it = std::upper_bound(firstKeys.begin(), firstKeys.end(), key);
+      return it == firstKeys.begin() ? 0 : it - firstKeys.begin() - 1;
+    }
+
+    // Only set in leaves, sorted by key
+    std::vector<value_type> entries;
+    // Only set in branches, with the smallest key of each child subtree
+    std::vector<std::shared_ptr<TreeNode>> children;
+    std::vector<KeyT> firstKeys;
+  };
+
+  // A node on the path of an iterator, and the index of the child or entry
+  // the path goes through
+  struct Frame {
+    TreeNode* node;
+    size_t index;
+  };
+
+  template <bool kConst>
+  class IteratorImpl {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = PersistentNodeContainer::value_type;
+    using difference_type = ptrdiff_t;
+    using reference =
+        std::conditional_t<kConst, const value_type&, value_type&>;
+    using pointer = std::conditional_t<kConst, const value_type*, value_type*>;
+
+    IteratorImpl() {}
+    IteratorImpl(std::nullptr_t) {}
+    // Mutable iterators convert to const ones
+    template <
+        bool kOtherConst,
+        bool kIsConst = kConst,
+        typename = std::enable_if_t<kIsConst>>
+    IteratorImpl(const IteratorImpl<kOtherConst>& other)
+        : root_(other.root_), path_(other.path_) {}
+
+    reference operator*() const {
+      const auto& frame = path_.back();
+      return frame.node->entries[frame.index];
+    }
+    pointer operator->() const {
+      return &operator*();
+    }
+
+    IteratorImpl& operator++() {
+      CHECK(!path_.empty());
+      if (++path_.back().index < path_.back().node->entries.size()) {
+        return *this;
+      }
+      path_.pop_back();
+      while (!path_.empty()) {
+        auto& frame = path_.back();
+        if (++frame.index < frame.node->children.size()) {
+          descendLeftmost(frame.node->children[frame.index].get());
+          return *this;
+        }
+        path_.pop_back();
+      }
+      return *this;
+    }
+    IteratorImpl operator++(int) {
+      IteratorImpl tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    IteratorImpl& operator--() {
+      if (path_.empty()) {
+        CHECK(root_);
+        descendRightmost(root_);
+        return *this;
+      }
+      while (!path_.empty() && path_.back().index == 0) {
+        path_.pop_back();
+      }
+      CHECK(!path_.empty());
+      auto& frame = path_.back();
+      --frame.index;
+      if (!frame.node->isLeaf()) {
+        descendRightmost(frame.node->children[frame.index].get());
+      }
+      return *this;
+    }
+    IteratorImpl operator--(int) {
+      IteratorImpl tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    template <bool kOtherConst>
+    bool operator==(const IteratorImpl<kOtherConst>& other) const {
+      if (path_.empty() || other.path_.empty()) {
+        return path_.empty() && other.path_.empty();
+      }
+      return path_.back().node == other.path_.back().node &&
+          path_.back().index == other.path_.back().index;
+    }
+    template <bool kOtherConst>
+    bool operator!=(const IteratorImpl<kOtherConst>& other) const {
+      return !operator==(other);
+    }
+
+    /*
+     * Advance lhs and rhs, which point at the same entry of two containers,
+     * past that entry and every entry after it that lives in a subtree the
+     * two containers share.
+     */
+    friend void advancePastSharedNodes(IteratorImpl& lhs, IteratorImpl& rhs) {
+      DCHECK(!lhs.path_.empty() && !rhs.path_.empty());
+      // Find the largest subtree holding the entry that both share. The
+      // entry is at the same position of a shared subtree in both, so the
+      // paths below it are the same.
+      size_t shared = 0;
+      auto height = std::min(lhs.path_.size(), rhs.path_.size());
+      while (shared < height &&
+             lhs.path_[lhs.path_.size() - 1 - shared].node ==
+                 rhs.path_[rhs.path_.size() - 1 - shared].node) {
+        ++shared;
+      }
+      if (shared > 0) {
+        lhs.moveToLastInSubtree(lhs.path_.size() - shared);
+        rhs.moveToLastInSubtree(rhs.path_.size() - shared);
+      }
+      ++lhs;
+      ++rhs;
+    }
+
+   private:
+    friend class PersistentNodeContainer;
+
+    explicit IteratorImpl(TreeNode* root) : root_(root) {}
+
+    void descendLeftmost(TreeNode* node) {
+      while (!node->isLeaf()) {
+        path_.push_back(Frame{node, 0});
+        node = node->children.front().get();
+      }
+      path_.push_back(Frame{node, 0});
+    }
+    void descendRightmost(TreeNode* node) {
+      while (!node->isLeaf()) {
+        path_.push_back(Frame{node, node->children.size() - 1});
+        node = node->children.back().get();
+      }
+      path_.push_back(Frame{node, node->entries.size() - 1});
+    }
+    // Move to the last entry of the subtree rooted at path_[depth]
+    void moveToLastInSubtree(size_t depth) {
+      auto node = path_[depth].node;
+      path_.resize(depth);
+      descendRightmost(node);
+    }
+
+    template <bool>
+    friend class IteratorImpl;
+
+    TreeNode* root_{nullptr};
+    // From the root down to the leaf holding the entry, empty for end()
+    std::vector<Frame> path_;
+  };
+
+ public:
+  using iterator = IteratorImpl<false>;
+  using const_iterator = IteratorImpl<true>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  PersistentNodeContainer() {}
+
+  size_type size() const {
+    return size_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+  void clear() {
+    root_.reset();
+    size_ = 0;
+  }
+
+  const_iterator begin() const {
+    const_iterator it(root_.get());
+    if (root_) {
+      it.descendLeftmost(root_.get());
+    }
+    return it;
+  }
+  const_iterator end() const {
+    return const_iterator(root_.get());
+  }
+  const_iterator cbegin() const {
+    return begin();
+  }
+  const_iterator cend() const {
+    return end();
+  }
+  const_reverse_iterator rbegin() const {
+    return const_reverse_iterator(end());
+  }
+  const_reverse_iterator rend() const {
+    return const_reverse_iterator(begin());
+  }
+
+  const_iterator find(const KeyT& key) const {
+    return findImpl<true>(key);
+  }
+  iterator find(const KeyT& key) {
+    if (findImpl<true>(key) == end()) {
+      return iterator(root_.get());
+    }
+    unsharePath(key);
+    return findImpl<false>(key);
+  }
+  size_type count(const KeyT& key) const {
+    return find(key) == end() ? 0 : 1;
+  }
+
+  std::pair<iterator, bool> insert(value_type value) {
+    auto key = value.first;
+    if (findImpl<true>(key) != end()) {
+      return std::make_pair(find(key), false);
+    }
+    if (!root_) {
+      root_ = std::make_shared<TreeNode>();
+    }
+    auto sibling = insertInto(&root_, std::move(value));
+    if (sibling) {
+      auto root = std::make_shared<TreeNode>();
+      root->firstKeys = {root_->firstKey(), sibling->firstKey()};
+      root->children = {std::move(root_), std::move(sibling)};
+      root_ = std::move(root);
+    }
+    ++size_;
+    return std::make_pair(find(key), true);
+  }
+
+  size_type erase(const KeyT& key) {
+    if (findImpl<true>(key) == end()) {
+      return 0;
+    }
+    eraseFrom(&root_, key);
+    if (root_->empty()) {
+      root_.reset();
+    }
+    // Keep the tree no taller than needed
+    while (root_ && root_->children.size() == 1) {
+      auto child = root_->children.front();
+      root_ = std::move(child);
+    }
+    --size_;
+    return 1;
+  }
+  template <bool kConst>
+  void erase(const IteratorImpl<kConst>& pos) {
+    auto key = pos->first;
+    erase(key);
+  }
+
+  bool operator==(const PersistentNodeContainer& other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+  }
+  bool operator!=(const PersistentNodeContainer& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  template <bool kConst>
+  IteratorImpl<kConst> findImpl(const KeyT& key) const {
+    IteratorImpl<kConst> it(root_.get());
+    if (!root_) {
+      return it;
+    }
+    auto node = root_.get();
+    while (!node->isLeaf()) {
+      auto index = node->childIndex(key);
+      it.path_.push_back({node, index});
+      node = node->children[index].get();
+    }
+    auto entry = std::lower_bound(
+        node->entries.begin(),
+        node->entries.end(),
+        key,
+        [](const value_type& entry, const KeyT& k) { return entry.first < k; });
+    if (entry == node->entries.end() || key < entry->first) {
+      return IteratorImpl<kConst>(root_.get());
+    }
+    it.path_.push_back({node, size_t(entry - node->entries.begin())});
+    return it;
+  }
+
+  // Make sure *node is referenced by this container only
+  static void unshare(std::shared_ptr<TreeNode>* node) {
+    if (node->use_count() > 1) {
+      *node = std::make_shared<TreeNode>(**node);
+    }
+  }
+
+  void unsharePath(const KeyT& key) {
+    auto node = &root_;
+    unshare(node);
+    while (!(*node)->isLeaf()) {
+      node = &(*node)->children[(*node)->childIndex(key)];
+      unshare(node);
+    }
+  }
+
+  // Returns the new right sibling of *node if it had to be split
+  static std::shared_ptr<TreeNode> insertInto(
+      std::shared_ptr<TreeNode>* node,
+      value_type value) {
+    unshare(node);
+    auto& current = **node;
+    if (current.isLeaf()) {
+      auto pos = std::lower_bound(
+          current.entries.begin(),
+          current.entries.end(),
+          value.first,
+          [](const value_type& entry, const KeyT& k) {
+            return entry.first < k;
+          });
+      current.entries.insert(pos, std::move(value));
+      if (current.entries.size() <= kMaxLeafSize) {
+        return nullptr;
+      }
+      auto sibling = std::make_shared<TreeNode>();
+      auto mid = current.entries.begin() + current.entries.size() / 2;
+      sibling->entries.assign(
+          std::make_move_iterator(mid),
+          std::make_move_iterator(current.entries.end()));
+      current.entries.erase(mid, current.entries.end());
+      return sibling;
+    }
+
+    auto index = current.childIndex(value.first);
+    auto childSibling = insertInto(&current.children[index], std::move(value));
+    current.firstKeys[index] = current.children[index]->firstKey();
+    if (!childSibling) {
+      return nullptr;
+    }
+    current.firstKeys.insert(
+        current.firstKeys.begin() + index + 1, childSibling->firstKey());
+    current.children.insert(
+        current.children.begin() + index + 1, std::move(childSibling));
+    if (current.children.size() <= kMaxBranchSize) {
+      return nullptr;
+    }
+    auto sibling = std::make_shared<TreeNode>();
+    auto half = current.children.size() / 2;
+    sibling->children.assign(
+        std::make_move_iterator(current.children.begin() + half),
+        std::make_move_iterator(current.children.end()));
+    sibling->firstKeys.assign(
+        current.firstKeys.begin() + half, current.firstKeys.end());
+    current.children.resize(half);
+    current.firstKeys.resize(half);
+    return sibling;
+  }
+
+  // Nodes left empty are removed from their parent. Underfull nodes are not
+  // merged: lookups stay O(log N) of the largest size the tree ever had.
+  static void eraseFrom(std::shared_ptr<TreeNode>* node, const KeyT& key) {
+    unshare(node);
+    auto& current = **node;
+    if (current.isLeaf()) {
+      auto pos = std::lower_bound(
+          current.entries.begin(),
+          current.entries.end(),
+          key,
+          [](const value_type& entry, const KeyT& k) {
+            return entry.first < k;
+          });
+      DCHECK(pos != current.entries.end() && !(key < pos->first));
+      current.entries.erase(pos);
+      return;
+    }
+
+    auto index = current.childIndex(key);
+    eraseFrom(&current.children[index], key);
+    if (current.children[index]->empty()) {
+      current.children.erase(current.children.begin() + index);
+      current.firstKeys.erase(current.firstKeys.begin() + index);
+    } else {
+      current.firstKeys[index] = current.children[index]->firstKey();
+    }
+  }
+
+  std::shared_ptr<TreeNode> root_;
+  size_type size_{0};
+};
+
+} // namespace facebook::fboss
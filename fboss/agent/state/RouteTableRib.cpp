@@ -64,7 +64,6 @@ std::shared_ptr<RouteTableRib<AddrT>> RouteTableRib<AddrT>::fromFollyDynamic(
   for (const auto& routeJson : routesJson) {
     auto route = Route<AddrT>::fromFollyDynamic(routeJson);
     rib->addRoute(route);
-    rib->addRouteInRadixTree(route);
   }
   return rib;
 }
@@ -81,17 +80,10 @@ RouteTableRib<AddrT>* RouteTableRib<AddrT>::modify(
       (*state)->getRouteTables()->getRouteTable(id);
   RouteTable* clonedRouteTable = routeTable->modify(state);
 
+  // The clone shares radixTree_ with this rib, so radixTree_ and nodeMap_
+  // are in sync without rebuilding the tree. Remember, we haven't cloned
+  // every route yet, so both still hold the old route pointers.
   auto clonedRib = this->clone();
-  // Generate the radix tree from the cloned nodeMap_. Remember, we haven't
-  // clone every route yet. So we will still use the old route pointer.
-  // Right now only revertNewRouteEntry() needs modify(). The expected result of
-  // modify() is that we have a cloned RouteTableRib return if the current one
-  // is published. To make sure the cloned RouteTableRib works, we need to
-  // ensure radixTree_ and nodeMap_ in sync before we return a newly cloned rib.
-  for (const auto& node : nodeMap_->getAllNodes()) {
-    clonedRib->radixTree_.insert(
-        node.first.network, node.first.mask, node.second);
-  }
   CHECK_EQ(clonedRib->size(), clonedRib->radixTree_.size());
 
   auto clonedRibPtr = clonedRib.get();
@@ -104,18 +96,24 @@ template <typename AddrT>
 void RouteTableRib<AddrT>::addRoute(
     const std::shared_ptr<Route<AddrT>>& route) {
   nodeMap_->addRoute(route);
+  addRouteInRadixTree(route);
+  changedPrefixes_.insert(route->prefix().network, route->prefix().mask, true);
 }
 
 template <typename AddrT>
 void RouteTableRib<AddrT>::updateRoute(
     const std::shared_ptr<Route<AddrT>>& route) {
   nodeMap_->updateRoute(route);
+  updateRouteInRadixTree(route);
+  changedPrefixes_.insert(route->prefix().network, route->prefix().mask, true);
 }
 
 template <typename AddrT>
 void RouteTableRib<AddrT>::removeRoute(
     const std::shared_ptr<Route<AddrT>>& route) {
   nodeMap_->removeRoute(route);
+  removeRouteInRadixTree(route);
+  changedPrefixes_.insert(route->prefix().network, route->prefix().mask, true);
 }
 
 template class RouteTableRib<folly::IPAddressV4>;
@@ -77,8 +77,11 @@ class RouteTableRib : public NodeBase {
 
   using Prefix = RoutePrefix<AddrT>;
   using RouteType = Route<AddrT>;
-  using RoutesRadixTree =
-      facebook::network::RadixTree<AddrT, std::shared_ptr<Route<AddrT>>>;
+  // Persistent, so a cloned rib shares the tree with the one it was cloned
+  // from until it is changed, and then only copies the paths to the changed
+  // prefixes.
+  using RoutesRadixTree = facebook::network::
+      PersistentRadixTree<AddrT, std::shared_ptr<Route<AddrT>>>;
 
   bool empty() const {
     return nodeMap_->empty();
@@ -99,6 +102,8 @@ class RouteTableRib : public NodeBase {
   void publish() override {
     // We should expect radixTree_ and nodeMap_ in sync before we publish rib
     CHECK_EQ(size(), radixTree_.size());
+    // Changes are only tracked until the rib is published
+    changedPrefixes_.clear();
     nodeMap_->publish();
     NodeBase::publish();
   }
@@ -109,15 +114,16 @@ class RouteTableRib : public NodeBase {
     // In this clone(), we make sure the root RouteTableRib version increased by
     // 1. And then we use the default NodeMap clone() to clone the childNode
     // `nodeMap_`, so we don't have to clone every route in `nodeMap_`.
-    // Besides, we don't clone the RadixTree. So that, we can just add/update/
-    // remove routes on nodeMap_ and then call
-    // `cloneToRadixTreeWithForwardClear()` to build the whole radixTree_
-    // after all the changes.
+    // The RadixTree is shared with this rib rather than copied. Adding,
+    // updating or removing a route path copies it, and
+    // `cloneToRadixTreeWithForwardClear()` swaps in copies of the routes to
+    // resolve again once all the changes are done.
     auto routeTableRib =
         std::make_shared<RouteTableRib>(getNodeID(), getGeneration() + 1);
     // Note: this is the default NodeMap clone(), only the nodeMap pointer is
     // cloned, while all the routes are still the old route pointer.
     routeTableRib->nodeMap_ = nodeMap_->clone();
+    routeTableRib->radixTree_ = radixTree_;
     return routeTableRib;
   }
 
@@ -143,7 +149,8 @@ class RouteTableRib : public NodeBase {
    * The following functions modify the static state.
    * These should only be called on unpublished objects which are only visible
    * to a single thread.
-   * To add/update/remove a route, we only do it on nodeMap_
+   * Each of them keeps radixTree_ in sync with nodeMap_, path copying it,
+   * and records the prefix as changed since the rib was cloned.
    */
   void addRoute(const std::shared_ptr<Route<AddrT>>& route);
   void updateRoute(const std::shared_ptr<Route<AddrT>>& route);
@@ -152,19 +159,53 @@ class RouteTableRib : public NodeBase {
     return nodeMap_->getRouteIf(prefix);
   }
 
-  void cloneToRadixTreeWithForwardClear() {
+  /*
+   * Whether the route addr resolves through, i.e. its longest match, may
+   * differ from when the rib was cloned: the longest match was added or
+   * updated since, or a more specific prefix covering addr was removed.
+   */
+  bool longestMatchChanged(const AddrT& addr) const {
+    auto changed = changedPrefixes_.longestMatch(addr, addr.bitCount());
+    if (changed == changedPrefixes_.end()) {
+      return false;
+    }
+    // A changed prefix less specific than the longest match was not the
+    // longest match before the change either
+    auto match = radixTree_.longestMatch(addr, addr.bitCount());
+    return !match || changed->masklen() >= match->masklen();
+  }
+
+  /*
+   * Swap a copy of each route to resolve again, with its forwarding info
+   * cleared, into radixTree_: the routes changed since the rib was cloned,
+   * and those for which dependsOnChange(route) is true, i.e. which resolve
+   * through a changed route. Every other route keeps its forwarding info
+   * and stays shared with the rib this one was cloned from, as do the
+   * subtrees of radixTree_ holding only such routes.
+   */
+  template <typename DependsOnChangeFn>
+  void cloneToRadixTreeWithForwardClear(DependsOnChangeFn dependsOnChange) {
     // We should expect this function is called only before we publish the rib
     CHECK(!isPublished());
-    radixTree_.clear();
-    for (const auto& node : nodeMap_->getAllNodes()) {
-      auto route = node.second;
+    CHECK_EQ(size(), radixTree_.size());
+    std::vector<std::shared_ptr<Route<AddrT>>> toResolve;
+    radixTree_.forEach([&](const auto& node) {
+      const auto& route = node.value();
+      auto mask = static_cast<uint8_t>(node.masklen());
+      if (changedPrefixes_.exactMatch(node.ipAddress(), mask) !=
+              changedPrefixes_.end() ||
+          dependsOnChange(*route)) {
+        toResolve.push_back(route);
+      }
+    });
+    for (auto& route : toResolve) {
       if (route->isPublished()) {
         route = route->clone(RouteType::Fields::COPY_PREFIX_AND_NEXTHOPS);
       }
       route->clearForward();
-      radixTree_.insert(node.first.network, node.first.mask, route);
+      radixTree_.insertOrAssign(
+          route->prefix().network, route->prefix().mask, route);
     }
-    CHECK_EQ(size(), radixTree_.size());
   }
 
   // STRONGLY RECOMMEND to use routes() which returns the NodeMap
@@ -179,20 +220,19 @@ class RouteTableRib : public NodeBase {
   }
 
   std::shared_ptr<Route<AddrT>> longestMatch(const AddrT& nexthop) const {
-    auto citr = radixTree_.longestMatch(nexthop, nexthop.bitCount());
-    if (citr == radixTree_.end()) {
+    auto match = radixTree_.longestMatch(nexthop, nexthop.bitCount());
+    if (!match) {
       return nullptr;
     }
     // FIXME - we must return the nodemap route node as we don;t
     // reflect classID updates into RIB nodes. We should actually
     // reflect the classIDs back
-    return exactMatch(citr->value()->prefix());
+    return exactMatch(match->value()->prefix());
   }
 
   void addRouteInRadixTree(const std::shared_ptr<Route<AddrT>>& route) {
     auto inserted =
-        radixTree_.insert(route->prefix().network, route->prefix().mask, route)
-            .second;
+        radixTree_.insert(route->prefix().network, route->prefix().mask, route);
     if (!inserted) {
       throw FbossError(
           "Add failed, prefix for: ",
@@ -201,15 +241,15 @@ class RouteTableRib : public NodeBase {
     }
   }
   void updateRouteInRadixTree(const std::shared_ptr<Route<AddrT>>& route) {
-    auto itr =
-        radixTree_.exactMatch(route->prefix().network, route->prefix().mask);
-    if (itr == radixTree_.end()) {
+    if (!radixTree_.exactMatch(
+            route->prefix().network, route->prefix().mask)) {
       throw FbossError(
           "Update failed, prefix for: ",
           route->str(),
           " not present in RadixTree");
     }
-    itr->value() = route;
+    radixTree_.insertOrAssign(
+        route->prefix().network, route->prefix().mask, route);
   }
   void removeRouteInRadixTree(const std::shared_ptr<Route<AddrT>>& route) {
     auto erased =
@@ -225,6 +265,8 @@ class RouteTableRib : public NodeBase {
  private:
   RoutesRadixTree radixTree_;
   std::shared_ptr<RoutesNodeMap> nodeMap_;
+  // Prefixes added, updated or removed since the rib was cloned
+  facebook::network::RadixTree<AddrT, bool> changedPrefixes_;
 };
 
 } // namespace facebook::fboss
@@ -123,11 +123,11 @@ void RouteUpdater::addRouteImpl(
     if (old->isPublished()) {
       newRoute = old->clone(
           RouteFields<typename PrefixT::AddressT>::COPY_PREFIX_AND_NEXTHOPS);
-      rib->updateRoute(newRoute);
     } else {
       newRoute = old;
     }
     newRoute->update(clientId, std::move(entry));
+    rib->updateRoute(newRoute);
     XLOG(DBG3) << "Updated route " << newRoute->str();
   } else {
     auto newRoute = make_shared<RouteT>(prefix, clientId, std::move(entry));
@@ -197,7 +197,6 @@ void RouteUpdater::delRouteImpl(
   // directly.
   if (old->isPublished()) {
     old = old->clone();
-    rib->updateRoute(old);
   }
   old->delEntryForClient(clientId);
   // TODO Do I need to publish the change??
@@ -206,6 +205,8 @@ void RouteUpdater::delRouteImpl(
   if (old->hasNoEntry()) {
     rib->removeRoute(old);
     XLOG(DBG3) << "...and then deleted route " << prefix.str();
+  } else {
+    rib->updateRoute(old);
   }
 }
 
@@ -229,27 +230,28 @@ void RouteUpdater::removeAllRoutesForClientImpl(
     ClientID clientId) {
   auto rib = makeClone(ribCloned);
 
-  std::vector<std::shared_ptr<Route<AddrT>>> routesToDelete;
-
   // make sure rib is cloned before any change
   CHECK(ribCloned->cloned);
-  for (auto& routeNode : rib->writableRoutes()->writableNodes()) {
-    auto route = routeNode.second;
+  // Only the routes of the client change, the others stay shared with the
+  // rib this one was cloned from
+  std::vector<std::shared_ptr<Route<AddrT>>> clientRoutes;
+  for (const auto& route : *rib->routes()) {
+    if (route->getEntryForClient(clientId)) {
+      clientRoutes.push_back(route);
+    }
+  }
+  for (auto& route : clientRoutes) {
     if (route->isPublished()) {
       route = route->clone();
-      routeNode.second = route;
     }
     route->delEntryForClient(clientId);
     if (route->hasNoEntry()) {
       // The nexthops we removed was the only one.  Delete the route.
-      routesToDelete.push_back(routeNode.second);
+      rib->removeRoute(route);
+    } else {
+      rib->updateRoute(route);
     }
   }
-
-  // Now, delete whatever routes went from 1 nexthoplist to 0.
-  for (std::shared_ptr<Route<AddrT>>& route : routesToDelete) {
-    rib->removeRoute(route);
-  }
 }
 
 void RouteUpdater::removeAllRoutesForClient(RouterID rid, ClientID clientId) {
@@ -604,43 +606,64 @@ void RouteUpdater::resolveOne(RouteT* route, ClonedRib* ribCloned) {
              << " route " << route->str();
 }
 
+bool RouteUpdater::dependsOnChange(
+    const ClonedRib& ribCloned,
+    const RouteNextHopEntry& entry) {
+  for (const auto& nh : entry.getNextHopSet()) {
+    // Next hops with an interface are resolved without any lookup
+    if (nh.intfID().has_value()) {
+      continue;
+    }
+    const auto& addr = nh.addr();
+    if (addr.isV4()) {
+      if (ribCloned.v4.cloned &&
+          ribCloned.v4.rib->longestMatchChanged(addr.asV4())) {
+        return true;
+      }
+    } else if (
+        ribCloned.v6.cloned &&
+        ribCloned.v6.rib->longestMatchChanged(addr.asV6())) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void RouteUpdater::resolve() {
-  // First, we need to make sure every route of the changed rib is cloned
-  // and the RadixTree of this changed rib is also generated.
+  // First, we need to make sure every route to resolve of the changed rib is
+  // cloned into the RadixTree of this changed rib: the changed routes, and
+  // those whose next hops resolve through a changed prefix. Resolving a
+  // route looks its next hops up in the routes of the rib, which are left
+  // as they were for every other route, so resolving any other route again
+  // would give the same result.
   // The reason why we have to do the same for-loop separately is because the
   // resolveOne needs radixTree_ to find nexthop, so we have to build the tree
   // before resolveOne().
   for (auto& ribCloned : clonedRibs_) {
-    if (ribCloned.second.v4.cloned) {
-      ribCloned.second.v4.rib->cloneToRadixTreeWithForwardClear();
+    const auto& rib = ribCloned.second;
+    auto dependsOnChangeFn = [&rib](const auto& route) {
+      return dependsOnChange(rib, *route.getBestEntry().second);
+    };
+    if (rib.v4.cloned) {
+      rib.v4.rib->cloneToRadixTreeWithForwardClear(dependsOnChangeFn);
     }
-    if (ribCloned.second.v6.cloned) {
-      ribCloned.second.v6.rib->cloneToRadixTreeWithForwardClear();
+    if (rib.v6.cloned) {
+      rib.v6.rib->cloneToRadixTreeWithForwardClear(dependsOnChangeFn);
     }
   }
 
-  // Ideally, just need to resolve the routes that is changed or impacted by
-  // the changed routes.
-  // However, Without copy-on-write RadixTree, it is O(n) to find out the
-  // routes that are changed. In this case, we just simply loop through all
-  // routes and resolve those that are not resolved yet.
-  // TODO(joseph5wu) T23364375 will try to improve it in the future.
+  // Resolve the routes cloned above, which are not resolved yet.
   for (auto& ribCloned : clonedRibs_) {
-    if (ribCloned.second.v4.cloned) {
-      auto rib = ribCloned.second.v4.rib.get();
-      for (auto& routeNode : rib->writableRoutesRadixTree()) {
-        if (routeNode.value()->needResolve()) {
-          resolveOne(routeNode.value().get(), &ribCloned.second);
-        }
+    auto resolveNode = [this, &ribCloned](const auto& routeNode) {
+      if (routeNode.value()->needResolve()) {
+        resolveOne(routeNode.value().get(), &ribCloned.second);
       }
+    };
+    if (ribCloned.second.v4.cloned) {
+      ribCloned.second.v4.rib->routesRadixTree().forEach(resolveNode);
     }
     if (ribCloned.second.v6.cloned) {
-      auto rib = ribCloned.second.v6.rib.get();
-      for (auto& routeNode : rib->writableRoutesRadixTree()) {
-        if (routeNode.value()->needResolve()) {
-          resolveOne(routeNode.value().get(), &ribCloned.second);
-        }
-      }
+      ribCloned.second.v6.rib->routesRadixTree().forEach(resolveNode);
     }
   }
 }
@@ -723,41 +746,58 @@ bool RouteUpdater::dedupRoutes(const RibT* oldRib, RibT* newRib) {
     return isSame;
   }
   const auto oldRoutes = oldRib->routes();
-  auto& newRoutes = newRib->writableRoutesRadixTree();
+  const auto& newRoutes = newRib->routesRadixTree();
   // make sure radixTree_ and nodeMap_ has the same size in newRib
   CHECK_EQ(newRib->size(), newRoutes.size());
+  // Derive the new radix tree from the old one rather than keeping the one
+  // built for resolution, so that it shares every subtree whose routes did
+  // not change with the old generation.
+  auto dedupedRoutes = oldRib->routesRadixTree();
+  size_t numMatched = 0;
+  // Only the routes of newRib are updated below, its tree is replaced by
+  // dedupedRoutes once done
+  auto newRibRoutes = newRib->writableRoutes();
   // Copy routes from old route table if they are
   // same. For matching prefixes, which don't have
   // same attributes inherit the generation number
   for (const auto& oldRoute : *oldRoutes) {
-    auto newIter = newRoutes.exactMatch(
-        oldRoute->prefix().network, oldRoute->prefix().mask);
-    if (newIter == newRoutes.end()) {
+    const auto& prefix = oldRoute->prefix();
+    auto newMatch = newRoutes.exactMatch(prefix.network, prefix.mask);
+    if (!newMatch) {
       isSame = false;
+      dedupedRoutes.erase(prefix.network, prefix.mask);
+      continue;
+    }
+    ++numMatched;
+    const auto& newRoute = newMatch->value();
+    if (newRoute == oldRoute) {
+      // Not resolved again, so still shared with the old route table
       continue;
     }
-    auto& newRoute = newIter->value();
     if (oldRoute->isSame(newRoute.get())) {
       // both routes are completely same, instead of using the new route,
-      // we re-use the old route. First update oldRoute to radixTree_
-      newIter->value() = oldRoute;
-      // we also need to update the nodeMap_
-      newRib->updateRoute(oldRoute);
+      // we re-use the old route.
+      newRibRoutes->updateRoute(oldRoute);
     } else {
       isSame = false;
       newRoute->inheritGeneration(*oldRoute);
-      newRib->updateRoute(newRoute);
+      newRibRoutes->updateRoute(newRoute);
+      dedupedRoutes.insertOrAssign(prefix.network, prefix.mask, newRoute);
     }
   }
-  if (newRoutes.size() != oldRoutes->size()) {
+  if (numMatched != newRoutes.size()) {
+    // Some routes are only in the new route table
     isSame = false;
-  } else {
-    // If sizes are same we would have already caught any
-    // difference while looking up all routes from oldRoutes
-    // in newRoutes, so do nothing
+    newRoutes.forEach([&](const auto& routeNode) {
+      const auto& prefix = routeNode.value()->prefix();
+      if (!oldRoutes->getRouteIf(prefix)) {
+        dedupedRoutes.insert(prefix.network, prefix.mask, routeNode.value());
+      }
+    });
   }
+  newRib->writableRoutesRadixTree() = std::move(dedupedRoutes);
   // make sure after change nodeMap_ and radixTree_ size still match
-  CHECK_EQ(newRib->size(), newRoutes.size());
+  CHECK_EQ(newRib->size(), newRib->routesRadixTree().size());
   return isSame;
 }
 
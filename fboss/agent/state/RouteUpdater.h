@@ -130,7 +130,12 @@ class RouteUpdater {
   template <typename AddrT, typename RibT>
   void removeAllRoutesForClientImpl(RibT* ribCloned, ClientID clientId);
 
-  // resolve all routes that are not resolved yet
+  // Whether a route with entry resolves through a prefix changed in any
+  // rib of ribCloned
+  static bool dependsOnChange(
+      const ClonedRib& ribCloned,
+      const RouteNextHopEntry& entry);
+  // resolve all changed routes and those depending on them
   void resolve();
   template <typename RouteT>
   void resolveOne(RouteT* route, ClonedRib* clonedRib);
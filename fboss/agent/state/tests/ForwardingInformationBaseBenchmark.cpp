@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "common/init/Init.h"
+#include "fboss/agent/state/ForwardingInformationBase.h"
+#include "fboss/agent/state/Route.h"
+#include "fboss/agent/state/RouteTypes.h"
+
+#include <folly/Benchmark.h>
+#include <folly/IPAddressV6.h>
+#include <folly/Random.h>
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace facebook::fboss;
+
+DEFINE_int32(fib_size, 100000, "Number of routes in the benchmarked FIB");
+DEFINE_int32(lookup_count, 1000, "Number of lookups per benchmark iteration");
+
+namespace {
+
+std::shared_ptr<ForwardingInformationBaseV6> fib;
+std::vector<folly::IPAddressV6> lookups;
+
+folly::IPAddressV6 randomAddress() {
+  std::array<uint8_t, 16> bytes;
+  for (auto i = 0; i < bytes.size(); i += 4) {
+    auto word = folly::Random::rand32();
+    memcpy(&bytes[i], &word, sizeof(word));
+  }
+  return folly::IPAddressV6::fromBinary(
+      folly::ByteRange(bytes.data(), bytes.size()));
+}
+
+void setupFib() {
+  ForwardingInformationBaseV6::NodeContainer routes;
+  std::vector<folly::IPAddressV6> networks;
+  while (routes.size() < FLAGS_fib_size) {
+    // Mostly /64s and /48s with some shorter prefixes sprinkled in, roughly
+    // what a large v6 table looks like.
+    static const std::array<uint8_t, 4> kMasks = {64, 64, 48, 32};
+    auto mask = kMasks[folly::Random::rand32(kMasks.size())];
+    RoutePrefixV6 prefix{randomAddress().mask(mask), mask};
+    auto route = std::make_shared<RouteV6>(RouteFields(prefix));
+    if (routes.insert(std::make_pair(prefix, route)).second) {
+      networks.push_back(prefix.network);
+    }
+  }
+  fib = std::make_shared<ForwardingInformationBaseV6>(std::move(routes));
+  fib->publish();
+  for (auto i = 0; i < FLAGS_lookup_count; ++i) {
+    // Pick addresses covered by a route so that lookups do not bail early
+    lookups.push_back(networks[folly::Random::rand32(networks.size())]);
+  }
+}
+
+// What ForwardingInformationBase::longestMatch used to do before it had an
+// LPM index.
+std::shared_ptr<RouteV6> linearScanLongestMatch(
+    const ForwardingInformationBaseV6& fib,
+    const folly::IPAddressV6& address) {
+  std::shared_ptr<RouteV6> longestMatchRoute;
+  int16_t longestMatchLength = -1;
+  for (const auto& prefixAndRoute : fib.getAllNodes()) {
+    const auto& prefix = prefixAndRoute.first;
+    if (prefix.mask > longestMatchLength &&
+        address.inSubnet(prefix.network, prefix.mask)) {
+      longestMatchLength = prefix.mask;
+      longestMatchRoute = prefixAndRoute.second;
+    }
+  }
+  return longestMatchRoute;
+}
+
+} // namespace
+
+BENCHMARK(FibLongestMatchLinearScan) {
+  for (const auto& address : lookups) {
+    folly::doNotOptimizeAway(linearScanLongestMatch(*fib, address));
+  }
+}
+
+BENCHMARK_RELATIVE(FibLongestMatchLpmIndex) {
+  for (const auto& address : lookups) {
+    folly::doNotOptimizeAway(fib->longestMatch(address));
+  }
+}
+
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(FibCloneAndAddRoute) {
+  auto newFib = fib->clone();
+  RoutePrefixV6 prefix{randomAddress().mask(64), 64};
+  if (!newFib->exactMatch(prefix)) {
+    newFib->addNode(std::make_shared<RouteV6>(RouteFields(prefix)));
+  }
+  folly::doNotOptimizeAway(newFib);
+}
+
+int main(int argc, char** argv) {
+  facebook::initFacebook(&argc, &argv);
+  setupFib();
+  folly::runBenchmarks();
+  return EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@
 
 #include <folly/IPAddressV4.h>
 #include <folly/IPAddressV6.h>
+#include <folly/json.h>
 #include <gtest/gtest.h>
 #include <array>
 #include <memory>
@@ -189,6 +190,106 @@ TEST_F(ForwardingInformationBaseV6Test, DecreasingLPMSequence) {
   }
 }
 
+TEST_F(ForwardingInformationBaseV4Test, LPMAfterRemoveAndUpdate) {
+  fib.removeNode(RoutePrefixV4{ip4_0, 4});
+  // Candidate prefixes: 0/1
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV4("0.0.0.0")), ip4_0, 1);
+
+  auto route = createRouteFromPrefix(ip4_64, 3);
+  fib.updateNode(route);
+  EXPECT_EQ(route, fib.longestMatch(folly::IPAddressV4("64.1.0.1")));
+
+  EXPECT_NE(nullptr, fib.removeNodeIf(RoutePrefixV4{ip4_128, 2}));
+  EXPECT_EQ(nullptr, fib.removeNodeIf(RoutePrefixV4{ip4_128, 2}));
+  EXPECT_EQ(nullptr, fib.longestMatch(folly::IPAddressV4("128.0.0.1")));
+}
+
+TEST_F(ForwardingInformationBaseV6Test, LPMAfterRemoveAndUpdate) {
+  fib.removeNode(RoutePrefixV6{ip6_0, 4});
+  // Candidate prefixes: ::/1
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("::")), ip6_0, 1);
+
+  auto route = createRouteFromPrefix(ip6_64, 3);
+  fib.updateNode(route);
+  EXPECT_EQ(route, fib.longestMatch(folly::IPAddressV6("4001:1::")));
+
+  EXPECT_NE(nullptr, fib.removeNodeIf(RoutePrefixV6{ip6_128, 2}));
+  EXPECT_EQ(nullptr, fib.removeNodeIf(RoutePrefixV6{ip6_128, 2}));
+  EXPECT_EQ(nullptr, fib.longestMatch(folly::IPAddressV6("8000::1")));
+}
+
+TEST(ForwardingInformationBaseV4, CloneKeepsLPMIndexIndependent) {
+  auto fib = std::make_shared<ForwardingInformationBaseV4>();
+  fib->addNode(createRouteFromPrefix(ip4_0, 1));
+  fib->addNode(createRouteFromPrefix(ip4_64, 3));
+  fib->publish();
+
+  auto clonedFib = fib->clone();
+  clonedFib->removeNode(RoutePrefixV4{ip4_64, 3});
+  clonedFib->addNode(createRouteFromPrefix(ip4_72, 6));
+
+  // The original FIB is unaffected by changes to its clone
+  CHECK_LPM(fib->longestMatch(folly::IPAddressV4("72.0.0.1")), ip4_64, 3);
+  CHECK_LPM(
+      clonedFib->longestMatch(folly::IPAddressV4("72.0.0.1")), ip4_72, 6);
+  CHECK_LPM(
+      clonedFib->longestMatch(folly::IPAddressV4("64.1.0.1")), ip4_0, 1);
+}
+
+TEST(ForwardingInformationBaseV6, LPMIndexBuiltFromNodeContainer) {
+  ForwardingInformationBaseV6::NodeContainer routes;
+  for (auto mask : {1, 3, 6}) {
+    RoutePrefixV6 prefix{ip6_72.mask(mask), static_cast<uint8_t>(mask)};
+    routes.insert(std::make_pair(prefix, createRouteFromPrefix(prefix)));
+  }
+  ForwardingInformationBaseV6 fib(std::move(routes));
+
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("4801::")), ip6_72, 6);
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("4001::")), ip6_64, 3);
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("1::")), ip6_0, 1);
+}
+
+TEST_F(ForwardingInformationBaseV4Test, LPMIndexRebuiltWhenDeserialized) {
+  // Routes need an entry to be serialized
+  for (const auto& prefixAndRoute : fib.getAllNodes()) {
+    prefixAndRoute.second->update(
+        ClientID::STATIC_ROUTE,
+        RouteNextHopEntry(
+            RouteForwardAction::DROP, AdminDistance::STATIC_ROUTE));
+  }
+  auto json = fib.toFollyDynamic();
+
+  for (const auto& restored :
+       {ForwardingInformationBaseV4::fromFollyDynamic(json),
+        ForwardingInformationBaseV4::fromJson(folly::toJson(json))}) {
+    EXPECT_EQ(restored->size(), fib.size());
+    CHECK_LPM(
+        restored->longestMatch(folly::IPAddressV4("0.0.0.0")), ip4_0, 4);
+    CHECK_LPM(
+        restored->longestMatch(folly::IPAddressV4("72.1.0.1")), ip4_72, 6);
+    CHECK_LPM(
+        restored->longestMatch(folly::IPAddressV4("161.16.8.1")), ip4_160, 3);
+  }
+}
+
+TEST_F(ForwardingInformationBaseV6Test, LPMIndexFollowsNodeMapMutators) {
+  // Changes made through the NodeMapT interface update the LPM index as well
+  ForwardingInformationBaseV6::Base& nodeMap = fib;
+  nodeMap.removeNode(RoutePrefixV6{ip6_72, 6});
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("4801::")), ip6_64, 3);
+
+  nodeMap.addNode(createRouteFromPrefix(ip6_72, 5));
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("4801::")), ip6_72, 5);
+
+  auto updated = createRouteFromPrefix(ip6_72, 5);
+  nodeMap.updateNode(updated);
+  EXPECT_EQ(fib.longestMatch(folly::IPAddressV6("4801::")), updated);
+
+  EXPECT_NE(nodeMap.removeNodeIf(RoutePrefixV6{ip6_72, 5}), nullptr);
+  nodeMap.removeNode(fib.getRouteIf(RoutePrefixV6{ip6_64, 3}));
+  CHECK_LPM(fib.longestMatch(folly::IPAddressV6("4801::")), ip6_0, 1);
+}
+
 TEST(ForwardingInformationBaseV4, IPv4DefaultPrefixComparesSmallest) {
   ForwardingInformationBaseV4 oldFib;
   ForwardingInformationBaseV4 newFib;
@@ -0,0 +1,191 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/state/NodeMapChangeLog.h"
+
+#include "fboss/agent/state/MacTable.h"
+#include "fboss/agent/state/NodeMapDelta-defs.h"
+#include "fboss/agent/state/Port.h"
+#include "fboss/agent/state/PortMap.h"
+
+#include <folly/Conv.h>
+#include <folly/MacAddress.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace facebook::fboss;
+
+namespace {
+using ChangeLog = NodeMapChangeLog<uint64_t>;
+constexpr size_t kMapSize = 1000;
+
+std::shared_ptr<Port> makeNode(PortMap* /*map*/, uint64_t key) {
+  return std::make_shared<Port>(PortID(key), folly::to<std::string>(key));
+}
+
+std::shared_ptr<MacEntry> makeNode(MacTable* /*map*/, uint64_t key) {
+  return std::make_shared<MacEntry>(
+      folly::MacAddress::fromHBO(key), PortDescriptor(PortID(1)));
+}
+
+// The changes of a delta, as (old node, new node) pairs in delta order
+template <typename MapT>
+std::vector<std::tuple<const void*, const void*>> deltaChanges(
+    const std::shared_ptr<MapT>& oldMap,
+    const std::shared_ptr<MapT>& newMap) {
+  std::vector<std::tuple<const void*, const void*>> changes;
+  for (const auto& change : NodeMapDelta<MapT>(oldMap.get(), newMap.get())) {
+    changes.emplace_back(change.getOld().get(), change.getNew().get());
+  }
+  return changes;
+}
+
+// A copy of map sharing its nodes but not its change log, whose deltas are
+// thus computed by walking both maps in lockstep
+template <typename MapT>
+std::shared_ptr<MapT> untrackedCopy(const std::shared_ptr<MapT>& map) {
+  auto copy = std::make_shared<MapT>();
+  for (const auto& node : *map) {
+    copy->addNode(node);
+  }
+  return copy;
+}
+
+/*
+ * Build a chain of clones with random adds, removes and updates, and check
+ * that the delta between any two maps of the chain is the same whether it is
+ * computed from the change log or by walking the maps.
+ */
+template <typename MapT>
+void checkChangeLogMatchesWalk() {
+  std::mt19937_64 rng(1);
+  constexpr uint64_t kKeySpace = 512;
+  constexpr size_t kChangesPerClone = 16;
+  auto map = std::make_shared<MapT>();
+  for (uint64_t key = 0; key < kKeySpace; key += 2) {
+    map->addNode(makeNode(map.get(), key));
+  }
+  map->publish();
+
+  std::vector<std::shared_ptr<MapT>> chain{map};
+  for (size_t clone = 0; clone < ChangeLog::kMaxSegments + 2; ++clone) {
+    map = map->clone();
+    for (size_t change = 0; change < kChangesPerClone; ++change) {
+      auto key = rng() % kKeySpace;
+      auto newNode = makeNode(map.get(), key);
+      auto node = map->getNodeIf(MapT::Traits::getKey(newNode));
+      switch (rng() % 4) {
+        case 0:
+          // Remove and add back the same node: logged, but unchanged
+          if (node) {
+            map->removeNode(node);
+            map->addNode(node);
+          }
+          break;
+        case 1:
+          if (node) {
+            map->removeNode(node);
+          } else {
+            map->addNode(newNode);
+          }
+          break;
+        default:
+          if (node) {
+            map->updateNode(newNode);
+          } else {
+            map->addNode(newNode);
+          }
+      }
+    }
+    map->publish();
+    chain.push_back(map);
+  }
+
+  for (size_t newer = 1; newer < chain.size(); ++newer) {
+    for (size_t older = 0; older < newer; ++older) {
+      const auto& oldMap = chain[older];
+      const auto& newMap = chain[newer];
+      // Recent ancestors are within the reach of the change log
+      if ((newer - older) * kChangesPerClone <= ChangeLog::kMinTrackedChanges) {
+        EXPECT_NE(nullptr, newMap->getChangedKeysSince(oldMap->getVersion()));
+      }
+      EXPECT_EQ(
+          deltaChanges(untrackedCopy(oldMap), untrackedCopy(newMap)),
+          deltaChanges(oldMap, newMap))
+          << "delta from clone " << older << " to clone " << newer;
+    }
+  }
+}
+} // namespace
+
+TEST(NodeMapChangeLog, untrackedUntilDerived) {
+  ChangeLog log;
+  log.recordChange(1, kMapSize);
+  EXPECT_EQ(nullptr, log.changedSince(0, kMapSize));
+}
+
+TEST(NodeMapChangeLog, changesSinceAncestors) {
+  ChangeLog root;
+  auto first = root.derive(1);
+  first.recordChange(10, kMapSize);
+  first.recordChange(20, kMapSize);
+  auto second = first.derive(2);
+  second.recordChange(30, kMapSize);
+
+  EXPECT_EQ((ChangeLog::ChangedKeys{10, 20}), *first.changedSince(1, kMapSize));
+  EXPECT_EQ(
+      (ChangeLog::ChangedKeys{10, 20, 30}), *second.changedSince(1, kMapSize));
+  EXPECT_EQ(ChangeLog::ChangedKeys{30}, *second.changedSince(2, kMapSize));
+  // Not an ancestor
+  EXPECT_EQ(nullptr, second.changedSince(3, kMapSize));
+}
+
+TEST(NodeMapChangeLog, forgetsOldAncestors) {
+  ChangeLog log;
+  for (uint64_t version = 1; version <= ChangeLog::kMaxSegments + 1;
+       ++version) {
+    log = log.derive(version);
+    log.recordChange(version, kMapSize);
+  }
+  EXPECT_EQ(nullptr, log.changedSince(1, kMapSize));
+  EXPECT_EQ(ChangeLog::kMaxSegments, log.changedSince(2, kMapSize)->size());
+}
+
+TEST(NodeMapChangeLog, stopsTrackingLargeChanges) {
+  auto log = ChangeLog().derive(1);
+  auto maxChanges = kMapSize / ChangeLog::kMaxTrackedFraction;
+  for (uint64_t key = 0; key <= maxChanges; ++key) {
+    ASSERT_NE(nullptr, log.changedSince(1, kMapSize));
+    log.recordChange(key, kMapSize);
+  }
+  EXPECT_EQ(nullptr, log.changedSince(1, kMapSize));
+
+  // The changes since an ancestor are also bounded
+  ChangeLog chain;
+  for (uint64_t version = 1; version <= 4; ++version) {
+    chain = chain.derive(version);
+    for (uint64_t key = 0; key < ChangeLog::kMinTrackedChanges; ++key) {
+      chain.recordChange(version * 1000 + key, 0);
+    }
+  }
+  EXPECT_NE(nullptr, chain.changedSince(4, 0));
+  EXPECT_EQ(nullptr, chain.changedSince(3, 0));
+}
+
+TEST(NodeMapChangeLog, deltaMatchesWalk) {
+  checkChangeLogMatchesWalk<PortMap>();
+}
+
+TEST(NodeMapChangeLog, persistentDeltaMatchesWalk) {
+  checkChangeLogMatchesWalk<MacTable>();
+}
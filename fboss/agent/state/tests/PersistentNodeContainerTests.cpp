@@ -0,0 +1,163 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/state/PersistentNodeContainer.h"
+
+#include <folly/Random.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <utility>
+
+using namespace facebook::fboss;
+
+namespace {
+// Small nodes, so that the trees under test are several levels deep
+using Container = PersistentNodeContainer<int, std::shared_ptr<int>, 4, 3>;
+using Map = std::map<int, std::shared_ptr<int>>;
+
+void expectSame(const Map& expected, const Container& container) {
+  auto sameEntry = [](const auto& lhs, const auto& rhs) {
+    return lhs.first == rhs.first && lhs.second == rhs.second;
+  };
+  EXPECT_EQ(expected.size(), container.size());
+  EXPECT_TRUE(std::equal(
+      expected.begin(),
+      expected.end(),
+      container.begin(),
+      container.end(),
+      sameEntry));
+  EXPECT_TRUE(std::equal(
+      expected.rbegin(),
+      expected.rend(),
+      container.rbegin(),
+      container.rend(),
+      sameEntry));
+}
+
+// Keys of the entries that differ between lhs and rhs, walking them the way
+// NodeMapDelta does
+std::vector<int> changedKeys(
+    const Container& lhs,
+    const Container& rhs,
+    size_t* steps) {
+  std::vector<int> changed;
+  auto lhsIt = lhs.begin();
+  auto rhsIt = rhs.begin();
+  *steps = 0;
+  while (lhsIt != lhs.end() || rhsIt != rhs.end()) {
+    ++*steps;
+    if (lhsIt != lhs.end() && rhsIt != rhs.end() && *lhsIt == *rhsIt) {
+      advancePastSharedNodes(lhsIt, rhsIt);
+    } else if (
+        rhsIt == rhs.end() ||
+        (lhsIt != lhs.end() && lhsIt->first < rhsIt->first)) {
+      changed.push_back((lhsIt++)->first);
+    } else if (lhsIt == lhs.end() || rhsIt->first < lhsIt->first) {
+      changed.push_back((rhsIt++)->first);
+    } else {
+      changed.push_back(lhsIt->first);
+      ++lhsIt;
+      ++rhsIt;
+    }
+  }
+  return changed;
+}
+} // namespace
+
+TEST(PersistentNodeContainer, matchesStdMap) {
+  Container container;
+  Map expected;
+  for (int i = 0; i < 5000; ++i) {
+    int key = folly::Random::rand32(300);
+    auto value = std::make_shared<int>(i);
+    switch (folly::Random::rand32(3)) {
+      case 0:
+        EXPECT_EQ(
+            expected.insert(std::make_pair(key, value)).second,
+            container.insert(std::make_pair(key, value)).second);
+        break;
+      case 1:
+        EXPECT_EQ(expected.erase(key), container.erase(key));
+        break;
+      case 2: {
+        auto it = container.find(key);
+        auto expectedIt = expected.find(key);
+        ASSERT_EQ(expectedIt == expected.end(), it == container.end());
+        if (it != container.end()) {
+          it->second = expectedIt->second = value;
+        }
+        break;
+      }
+    }
+  }
+  expectSame(expected, container);
+  for (const auto& entry : expected) {
+    auto it = std::as_const(container).find(entry.first);
+    ASSERT_NE(container.end(), it);
+    EXPECT_EQ(entry.second, it->second);
+  }
+}
+
+TEST(PersistentNodeContainer, copiesAreIndependent) {
+  Container original;
+  Map expected;
+  for (int i = 0; i < 1000; ++i) {
+    auto value = std::make_shared<int>(i);
+    original.insert(std::make_pair(i, value));
+    expected.emplace(i, value);
+  }
+
+  auto copy = original;
+  copy.erase(10);
+  copy.insert(std::make_pair(1000, nullptr));
+  copy.find(500)->second = nullptr;
+  expectSame(expected, original);
+
+  EXPECT_EQ(0, copy.count(10));
+  EXPECT_EQ(nullptr, copy.find(500)->second);
+  EXPECT_NE(nullptr, original.find(500)->second);
+  EXPECT_NE(original, copy);
+}
+
+TEST(PersistentNodeContainer, deltaSkipsSharedSubtrees) {
+  Container original;
+  for (int i = 0; i < 100000; ++i) {
+    original.insert(std::make_pair(i, std::make_shared<int>(i)));
+  }
+  auto modified = original;
+  modified.erase(5000);
+  modified.find(70000)->second = nullptr;
+  modified.insert(std::make_pair(100000, nullptr));
+
+  size_t steps{0};
+  EXPECT_EQ(
+      (std::vector<int>{5000, 70000, 100000}),
+      changedKeys(original, modified, &steps));
+  // Walking the delta only visits the modified paths of the trees
+  EXPECT_LT(steps, 200);
+
+  EXPECT_TRUE(changedKeys(original, original, &steps).empty());
+  EXPECT_EQ(1, steps);
+}
+
+TEST(PersistentNodeContainer, emptyContainer) {
+  Container container;
+  EXPECT_TRUE(container.empty());
+  EXPECT_EQ(container.begin(), container.end());
+  EXPECT_EQ(container.rbegin(), container.rend());
+  EXPECT_EQ(container.end(), container.find(1));
+
+  container.insert(std::make_pair(1, nullptr));
+  EXPECT_EQ(1, container.erase(1));
+  EXPECT_EQ(0, container.erase(1));
+  EXPECT_TRUE(container.empty());
+  EXPECT_EQ(container.begin(), container.end());
+}
@@ -106,7 +106,7 @@ void EXPECT_NODEMAP_MATCH(const std::shared_ptr<RouteTableRib<AddrT>>& rib) {
   for (const auto& route : *(rib->routes())) {
     auto match =
         radixTree.exactMatch(route->prefix().network, route->prefix().mask);
-    ASSERT_NE(match, radixTree.end());
+    ASSERT_NE(nullptr, match);
     // should be the same shared_ptr
     EXPECT_EQ(route, match->value());
   }
@@ -274,6 +274,19 @@ TEST(RouteUpdater, dedup) {
   EXPECT_EQ(t2r2->getGeneration() + 1, t4r2->getGeneration());
   EXPECT_EQ(t2r3, t4r3);
   EXPECT_EQ(t2r4, t4r4);
+
+  // The radix tree of the new generation is derived from the old one, so
+  // only the nodes on the path to the changed route are copied.
+  const auto& t2tree4 =
+      tables2->getRouteTable(rid)->getRibV4()->routesRadixTree();
+  const auto& t4tree4 =
+      tables4->getRouteTable(rid)->getRibV4()->routesRadixTree();
+  EXPECT_EQ(
+      t2tree4.exactMatch(r1.network, r1.mask),
+      t4tree4.exactMatch(r1.network, r1.mask));
+  EXPECT_NE(
+      t2tree4.exactMatch(r2.network, r2.mask),
+      t4tree4.exactMatch(r2.network, r2.mask));
 }
 
 TEST(Route, resolve) {
@@ -421,6 +434,94 @@ TEST(Route, resolve) {
   }
 }
 
+TEST(Route, resolveDependentsOfChangedRoutes) {
+  auto stateV1 = applyInitConfig();
+  ASSERT_NE(nullptr, stateV1);
+
+  auto rid = RouterID(0);
+  RouteUpdater u1(stateV1->getRouteTables());
+  u1.addRoute(
+      rid,
+      IPAddress("1.1.3.0"),
+      24,
+      CLIENT_A,
+      RouteNextHopEntry(makeNextHops({"1.1.1.10"}), DISTANCE));
+  // Resolved through 1.1.3.0/24
+  u1.addRoute(
+      rid,
+      IPAddress("8.8.8.0"),
+      24,
+      CLIENT_A,
+      RouteNextHopEntry(makeNextHops({"1.1.3.10"}), DISTANCE));
+  // Resolved through interface 2 only
+  u1.addRoute(
+      rid,
+      IPAddress("9.9.9.0"),
+      24,
+      CLIENT_A,
+      RouteNextHopEntry(makeNextHops({"2.2.2.10"}), DISTANCE));
+  auto tables2 = u1.updateDone();
+  ASSERT_NE(nullptr, tables2);
+  tables2->publish();
+
+  auto expectForwardedVia =
+      [&](const std::shared_ptr<RouteTableMap>& tables,
+          const std::string& prefix,
+          const std::string& nexthop,
+          InterfaceID intf) {
+        auto route = GET_ROUTE_V4(tables, rid, prefix);
+        EXPECT_RESOLVED(route);
+        RouteNextHopSet expFwd;
+        expFwd.emplace(ResolvedNextHop(IPAddress(nexthop), intf, ECMP_WEIGHT));
+        EXPECT_EQ(expFwd, route->getForwardInfo().getNextHopSet());
+      };
+  expectForwardedVia(tables2, "8.8.8.0/24", "1.1.1.10", InterfaceID(1));
+
+  // Changing 1.1.3.0/24 resolves 8.8.8.0/24 again, while 9.9.9.0/24, which
+  // does not depend on it, is left as it was
+  RouteUpdater u2(tables2);
+  u2.addRoute(
+      rid,
+      IPAddress("1.1.3.0"),
+      24,
+      CLIENT_A,
+      RouteNextHopEntry(makeNextHops({"3.3.3.10"}), DISTANCE));
+  auto tables3 = u2.updateDone();
+  ASSERT_NE(nullptr, tables3);
+  EXPECT_NODEMAP_MATCH(tables3);
+  tables3->publish();
+  expectForwardedVia(tables3, "8.8.8.0/24", "3.3.3.10", InterfaceID(3));
+  EXPECT_EQ(
+      GET_ROUTE_V4(tables2, rid, "9.9.9.0/24"),
+      GET_ROUTE_V4(tables3, rid, "9.9.9.0/24"));
+
+  // A more specific route takes over resolving 8.8.8.0/24
+  RouteUpdater u3(tables3);
+  u3.addRoute(
+      rid,
+      IPAddress("1.1.3.0"),
+      25,
+      CLIENT_A,
+      RouteNextHopEntry(makeNextHops({"2.2.2.10"}), DISTANCE));
+  auto tables4 = u3.updateDone();
+  ASSERT_NE(nullptr, tables4);
+  EXPECT_NODEMAP_MATCH(tables4);
+  tables4->publish();
+  expectForwardedVia(tables4, "8.8.8.0/24", "2.2.2.10", InterfaceID(2));
+
+  // And hands it back once removed
+  RouteUpdater u4(tables4);
+  u4.delRoute(rid, IPAddress("1.1.3.0"), 25, CLIENT_A);
+  auto tables5 = u4.updateDone();
+  ASSERT_NE(nullptr, tables5);
+  EXPECT_NODEMAP_MATCH(tables5);
+  tables5->publish();
+  expectForwardedVia(tables5, "8.8.8.0/24", "3.3.3.10", InterfaceID(3));
+  EXPECT_EQ(
+      GET_ROUTE_V4(tables2, rid, "9.9.9.0/24"),
+      GET_ROUTE_V4(tables5, rid, "9.9.9.0/24"));
+}
+
 TEST(Route, resolveDropToCPUMix) {
   auto stateV1 = applyInitConfig();
   ASSERT_NE(nullptr, stateV1);
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <folly/Benchmark.h>
+#include <folly/logging/xlog.h>
+#include "fboss/agent/AsyncLogger.h"
+
+#include <stdio.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace facebook::fboss;
+
+namespace {
+
+#define BENCHMARK_LOG "/tmp/async_logger_benchmark"
+
+// Roughly the size of a traced SAI call
+constexpr auto kRecordSize = 256;
+constexpr uint32_t kLogTimeout = 100;
+
+/*
+ * Append iters records in total, split across numThreads threads appending
+ * concurrently, as when SAI calls are traced from several threads.
+ */
+void appendLog(unsigned iters, unsigned numThreads) {
+  std::unique_ptr<AsyncLogger> asyncLogger;
+  std::string record(kRecordSize - 1, '.');
+  record += '\n';
+  BENCHMARK_SUSPEND {
+    asyncLogger = std::make_unique<AsyncLogger>(BENCHMARK_LOG, kLogTimeout);
+    asyncLogger->startFlushThread();
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      auto numRecords = iters / numThreads + (i < iters % numThreads ? 1 : 0);
+      for (unsigned j = 0; j < numRecords; ++j) {
+        asyncLogger->appendLog(record.c_str(), record.size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BENCHMARK_SUSPEND {
+    asyncLogger->forceFlush();
+    asyncLogger->stopFlushThread();
+    if (auto dropped = asyncLogger->getDroppedCount()) {
+      XLOG(WARN) << "Dropped " << dropped << " of " << iters << " records";
+    }
+    asyncLogger.reset();
+    std::remove(BENCHMARK_LOG);
+  }
+}
+
+} // namespace
+
+BENCHMARK_NAMED_PARAM(appendLog, 1_thread, 1)
+BENCHMARK_NAMED_PARAM(appendLog, 2_threads, 2)
+BENCHMARK_NAMED_PARAM(appendLog, 4_threads, 4)
+BENCHMARK_NAMED_PARAM(appendLog, 8_threads, 8)
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
@@ -10,8 +10,13 @@
 
 #include "fboss/agent/AsyncLogger.h"
 
+#include <folly/Conv.h>
+#include <folly/FileUtil.h>
 #include <gtest/gtest.h>
 #include <stdio.h>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #define TEST_LOG "/tmp/sai_logger_test"
 
@@ -97,28 +102,73 @@ TEST_F(AsyncLoggerTest, emptyBufferTest) {
   EXPECT_EQ(asyncLogger->flushCount_, 0);
 }
 
-TEST_F(AsyncLoggerTest, concurrentWaitTest) {
-  std::string str(kTestStringSize, '.');
-  asyncLogger->appendLog(str.c_str(), str.size());
+TEST_F(AsyncLoggerTest, appendOrderTest) {
+  // Records are written in the order they were appended, across threads
+  std::string logs;
+  for (auto i = 0; i < 3; ++i) {
+    std::thread t([&, i]() {
+      auto str = folly::to<std::string>("thread", i, ";");
+      asyncLogger->appendLog(str.c_str(), str.size());
+    });
+    t.join();
+    auto str = folly::to<std::string>("main", i, ";");
+    asyncLogger->appendLog(str.c_str(), str.size());
+  }
 
-  // The first string will fill up the empty buffer, causing the next two
-  // appends to wait for buffer to be swapped. When they finish waiting, logger
-  // should realize that the buffer can only accept one. So it will immediately
-  // flush one more time, rather than waiting for the next timeout to flush the
-  // other string.
-  std::thread t([&]() { asyncLogger->appendLog(str.c_str(), str.size()); });
+  asyncLogger->forceFlush();
+  EXPECT_TRUE(folly::readFile(TEST_LOG, logs));
+  EXPECT_EQ(logs, "thread0;main0;thread1;main1;thread2;main2;");
+}
 
-  asyncLogger->appendLog(str.c_str(), str.size());
-  t.join();
+TEST_F(AsyncLoggerTest, concurrentAppendTest) {
+  // Threads appending concurrently keep all of their records, each thread's in
+  // the order it appended them
+  auto constexpr kNumThreads = 8;
+  auto constexpr kNumRecords = 10000;
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() {
+      for (auto j = 0; j < kNumRecords; ++j) {
+        auto str = folly::to<std::string>(i, " ", j, "\n");
+        asyncLogger->appendLog(str.c_str(), str.size());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
 
-  // When the third append finished, the logger should have swapped the buffer
-  // and potentially still writing into the buffer. Therefore, we wait for a bit
-  // here to let the flush happen and increase the flush count.
-  std::unique_lock<std::mutex> lock(latch);
-  cv.wait_for(lock, std::chrono::milliseconds(20));
+  asyncLogger->forceFlush();
+  std::string logs;
+  EXPECT_TRUE(folly::readFile(TEST_LOG, logs));
+  std::vector<int> nextRecord(kNumThreads, 0);
+  std::istringstream lines(logs);
+  int thread, record;
+  while (lines >> thread >> record) {
+    ASSERT_LT(thread, kNumThreads);
+    EXPECT_EQ(record, nextRecord[thread]++);
+  }
+  for (auto i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(nextRecord[i], kNumRecords);
+  }
+  EXPECT_EQ(asyncLogger->getDroppedCount(), 0);
+}
 
-  // Without triggering a timeout, logger should flush str0, and one of
-  // str1 or str2. The other unflushed string should be in the current buffer.
-  // Therefore, the flush count should be equal or greater than two.
-  EXPECT_GE(asyncLogger->flushCount_, 2);
+TEST_F(AsyncLoggerTest, fullBufferTest) {
+  // Appending more than a buffer holds does not wait for the flush thread
+  std::string str(kTestStringSize, '.');
+  auto constexpr kNumRecords = 8;
+  for (auto i = 0; i < kNumRecords; ++i) {
+    asyncLogger->appendLog(str.c_str(), str.size());
+  }
+  // Nor do records larger than a buffer
+  std::string largeStr(AsyncLogger::kBufferSize * 2, '.');
+  asyncLogger->appendLog(largeStr.c_str(), largeStr.size());
+
+  asyncLogger->forceFlush();
+  std::string logs;
+  EXPECT_TRUE(folly::readFile(TEST_LOG, logs));
+  EXPECT_EQ(logs.size(), str.size() * kNumRecords + largeStr.size());
+  EXPECT_GE(asyncLogger->flushCount_, 1);
+  EXPECT_EQ(asyncLogger->getDroppedCount(), 0);
 }
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <folly/Benchmark.h>
+#include <folly/Format.h>
+#include <folly/IPAddress.h>
+#include <folly/MacAddress.h>
+#include "fboss/agent/SwSwitch.h"
+#include "fboss/agent/hw/benchmarks/ControlPathTimer.h"
+#include "fboss/agent/hw/sim/SimPlatform.h"
+#include "fboss/agent/hw/sim/SimSwitch.h"
+#include "fboss/agent/state/Interface.h"
+#include "fboss/agent/state/Port.h"
+#include "fboss/agent/state/RouteUpdater.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/Vlan.h"
+#include "fboss/agent/test/RouteScaleGenerators.h"
+
+/*
+ * The route scale and init benchmarks of fboss/agent/hw/benchmarks, run
+ * against SimSwitch rather than an ASIC, so that the SwSwitch side of the
+ * control path can be measured anywhere. With --json, the time spent in
+ * SwSwitch and processing state deltas is reported for each run.
+ */
+
+using namespace facebook::fboss;
+using folly::IPAddress;
+using folly::MacAddress;
+using std::make_shared;
+using std::make_unique;
+using std::shared_ptr;
+using std::unique_ptr;
+using utility::ControlPathTimer;
+
+namespace {
+
+const MacAddress kLocalMac("02:00:01:00:00:01");
+constexpr int kNumPorts = 16;
+// As in utility::onePortPerVlanConfig
+constexpr int kBaseVlanId = 1000;
+
+/*
+ * A VLAN and interface per port, with a v4 and a v6 subnet each, as the
+ * ensemble of the hw benchmarks is configured with
+ */
+shared_ptr<SwitchState> onePortPerVlanState(
+    const shared_ptr<SwitchState>& oldState) {
+  auto state = oldState->clone();
+  for (int idx = 0; idx < kNumPorts; ++idx) {
+    PortID portID(idx + 1);
+    VlanID vlanID(kBaseVlanId + idx);
+    InterfaceID intfID(kBaseVlanId + idx);
+
+    auto vlan =
+        make_shared<Vlan>(vlanID, folly::sformat("vlan{}", kBaseVlanId + idx));
+    state->addVlan(vlan);
+    vlan->addPort(portID, false);
+    vlan->setInterfaceID(intfID);
+
+    auto port = state->getPorts()->getPort(portID)->modify(&state);
+    port->setVlans({{vlanID, Port::VlanInfo(false)}});
+    port->setIngressVlan(vlanID);
+
+    auto intf = make_shared<Interface>(
+        intfID,
+        RouterID(0),
+        vlanID,
+        folly::sformat("interface{}", kBaseVlanId + idx),
+        kLocalMac,
+        9000,
+        false, /* is virtual */
+        false /* is state_sync disabled */);
+    Interface::Addresses addrs;
+    addrs.emplace(IPAddress(folly::sformat("{}.0.0.0", idx + 1)), 24);
+    addrs.emplace(IPAddress(folly::sformat("{}::", idx + 1)), 64);
+    intf->setAddresses(addrs);
+    state->addIntf(intf);
+  }
+  RouteUpdater updater(state->getRouteTables());
+  updater.addInterfaceAndLinkLocalRoutes(state->getInterfaces());
+  auto routeTables = updater.updateDone();
+  if (routeTables) {
+    state->resetRouteTables(routeTables);
+  }
+  return state;
+}
+
+unique_ptr<SwSwitch> setupSwitch(ControlPathTimer* timer = nullptr) {
+  auto sw = make_unique<SwSwitch>(make_unique<SimPlatform>(kLocalMac, 64));
+  sw->init(nullptr /* No custom TunManager */);
+  auto initState = sw->getState();
+  auto configure = [&]() {
+    sw->updateStateBlocking("configure", onePortPerVlanState);
+  };
+  if (timer) {
+    timer->timeSwSwitch(configure);
+    timer->timeStateDeltas(initState, {sw->getState()});
+  } else {
+    configure();
+  }
+  return sw;
+}
+
+void applyStates(SwSwitch* sw, const ControlPathTimer::SwitchStates& states) {
+  for (const auto& state : states) {
+    sw->updateStateBlocking(
+        "apply route scale state",
+        [&state](const shared_ptr<SwitchState>& /* oldState */) {
+          return state;
+        });
+  }
+}
+
+template <typename RouteScaleGeneratorT>
+void routeAddDelBenchmarker(bool measureAdd) {
+  folly::BenchmarkSuspender suspender;
+  auto sw = setupSwitch();
+  auto initState = sw->getState();
+  auto states = RouteScaleGeneratorT(initState).getSwitchStates();
+
+  ControlPathTimer controlPathTimer(measureAdd ? "route_add" : "route_del");
+  if (measureAdd) {
+    controlPathTimer.timeStateDeltas(initState, states);
+    suspender.dismiss();
+    controlPathTimer.timeSwSwitch([&]() { applyStates(sw.get(), states); });
+    suspender.rehire();
+  } else {
+    applyStates(sw.get(), states);
+    // Delete all the routes, by going back to the state they were added to
+    controlPathTimer.timeStateDeltas(sw->getState(), {initState});
+    suspender.dismiss();
+    controlPathTimer.timeSwSwitch(
+        [&]() { applyStates(sw.get(), {initState}); });
+    suspender.rehire();
+  }
+}
+
+} // unnamed namespace
+
+#define SIM_ROUTE_ADD_DEL_BENCHMARKS(name, RouteScaleGeneratorT) \
+  BENCHMARK(SimSwitch##name##RouteAdd) {                         \
+    routeAddDelBenchmarker<RouteScaleGeneratorT>(true);          \
+  }                                                              \
+  BENCHMARK(SimSwitch##name##RouteDel) {                         \
+    routeAddDelBenchmarker<RouteScaleGeneratorT>(false);         \
+  }
+
+SIM_ROUTE_ADD_DEL_BENCHMARKS(FswScale, utility::FSWRouteScaleGenerator)
+SIM_ROUTE_ADD_DEL_BENCHMARKS(ThAlpmScale, utility::THAlpmRouteScaleGenerator)
+SIM_ROUTE_ADD_DEL_BENCHMARKS(HgridDUScale, utility::HgridDuRouteScaleGenerator)
+SIM_ROUTE_ADD_DEL_BENCHMARKS(HgridUUScale, utility::HgridUuRouteScaleGenerator)
+
+/*
+ * Init, configure and program FSW route scale, then exit: what the
+ * init_and_exit hw benchmarks measure, less the ASIC.
+ */
+BENCHMARK(SimSwitchInitAndExit) {
+  ControlPathTimer controlPathTimer("init_to_configured");
+  auto sw = setupSwitch(&controlPathTimer);
+  applyStates(
+      sw.get(),
+      utility::FSWRouteScaleGenerator(sw->getState()).getSwitchStates());
+  sw.reset();
+}
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  folly::runBenchmarks();
+  return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include <folly/Benchmark.h>
+#include <folly/MacAddress.h>
+#include "fboss/agent/L2Entry.h"
+#include "fboss/agent/MacTableManager.h"
+#include "fboss/agent/SwSwitch.h"
+#include "fboss/agent/hw/sim/SimPlatform.h"
+#include "fboss/agent/hw/sim/SimSwitch.h"
+#include "fboss/agent/state/MacTable.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/state/Vlan.h"
+#include "fboss/agent/state/VlanMap.h"
+
+using namespace facebook::fboss;
+using folly::MacAddress;
+using std::make_shared;
+using std::make_unique;
+using std::shared_ptr;
+using std::unique_ptr;
+
+namespace {
+
+const VlanID kVlan(1);
+constexpr int kNumPorts = 10;
+
+// Global state used by the benchmarks
+unique_ptr<SwSwitch> sw;
+uint64_t nextMac = 0;
+
+unique_ptr<SwSwitch> setupSwitch() {
+  MacAddress localMac("02:00:01:00:00:01");
+  auto sw = make_unique<SwSwitch>(make_unique<SimPlatform>(localMac, 10));
+  sw->init(nullptr /* No custom TunManager */);
+
+  auto updateFn = [&](const shared_ptr<SwitchState>& oldState) {
+    auto state = oldState->clone();
+    auto vlan1 = make_shared<Vlan>(kVlan, "Vlan1");
+    state->addVlan(vlan1);
+    for (int idx = 1; idx < kNumPorts; ++idx) {
+      vlan1->addPort(PortID(idx), false);
+    }
+    return state;
+  };
+
+  sw->updateStateBlocking("setup", updateFn);
+  return sw;
+}
+
+void l2Update(MacAddress mac, int port, L2EntryUpdateType updateType) {
+  sw->l2LearningUpdateReceived(
+      L2Entry(
+          mac,
+          kVlan,
+          PortDescriptor(PortID(port)),
+          L2Entry::L2EntryType::L2_ENTRY_TYPE_VALIDATED),
+      updateType);
+}
+
+// Wait for the learning updates received so far to be applied
+void waitForL2Updates() {
+  sw->updateStateBlocking(
+      "wait for L2 learning updates",
+      [](const shared_ptr<SwitchState>& /* state */) { return nullptr; });
+}
+
+// Age all the MACs learned, outside of the measurements
+void clearMacTable() {
+  auto updateFn = [](const shared_ptr<SwitchState>& oldState) {
+    auto state = oldState->clone();
+    auto vlan = state->getVlans()->getVlan(kVlan)->modify(&state);
+    vlan->setMacTable(make_shared<MacTable>());
+    return state;
+  };
+  sw->updateStateBlocking("clear MAC table", updateFn);
+}
+
+/*
+ * A learning storm, such as a rack of servers rebooting: numIters MACs are
+ * learned at once, spread across the ports.
+ */
+void learningStorm(size_t numIters, int32_t maxBatchUpdates) {
+  BENCHMARK_SUSPEND {
+    FLAGS_l2_learning_batch_max_updates = maxBatchUpdates;
+  }
+  for (size_t n = 0; n < numIters; ++n) {
+    l2Update(
+        MacAddress::fromHBO(0x020000000000 + nextMac++),
+        static_cast<int>(1 + n % (kNumPorts - 1)),
+        L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD);
+  }
+  waitForL2Updates();
+
+  BENCHMARK_SUSPEND {
+    auto vlan = sw->getState()->getVlans()->getVlan(kVlan);
+    CHECK_EQ(vlan->getMacTable()->size(), numIters);
+    clearMacTable();
+  }
+}
+
+} // unnamed namespace
+
+BENCHMARK(L2LearningStormBatched, numIters) {
+  learningStorm(numIters, 10000);
+}
+
+// One state update per learned MAC
+BENCHMARK_RELATIVE(L2LearningStormUnbatched, numIters) {
+  learningStorm(numIters, 1);
+}
+
+/*
+ * A MAC moving back and forth between two ports, such as a flapping VM
+ * migration or a loop: each iteration ages and relearns it on the other port.
+ */
+BENCHMARK(L2LearningMacMoveFlaps, numIters) {
+  MacAddress mac("02:00:00:00:ff:ff");
+  for (size_t n = 0; n < numIters; ++n) {
+    auto port = static_cast<int>(1 + n % 2);
+    l2Update(mac, port, L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_DELETE);
+    l2Update(mac, port, L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD);
+  }
+  waitForL2Updates();
+
+  BENCHMARK_SUSPEND {
+    clearMacTable();
+  }
+}
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  // Setting up the switch is fairly expensive, so do it once before running
+  // the benchmark functions.
+  sw = setupSwitch();
+
+  folly::runBenchmarks();
+  return 0;
+}
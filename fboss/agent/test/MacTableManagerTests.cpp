@@ -11,6 +11,7 @@
 #include <gtest/gtest.h>
 
 #include "fboss/agent/L2Entry.h"
+#include "fboss/agent/MacTableManager.h"
 #include "fboss/agent/state/Port.h"
 #include "fboss/agent/state/SwitchState.h"
 #include "fboss/agent/state/Vlan.h"
@@ -77,6 +78,25 @@ class MacTableManagerTest : public ::testing::Test {
     });
   }
 
+  void triggerMacCb(
+      folly::MacAddress mac,
+      L2EntryUpdateType l2EntryUpdateType,
+      std::optional<cfg::AclLookupClass> classID = std::nullopt) {
+    sw_->l2LearningUpdateReceived(
+        L2Entry(
+            mac,
+            kVlan(),
+            PortDescriptor(kPortID()),
+            L2Entry::L2EntryType::L2_ENTRY_TYPE_PENDING,
+            classID),
+        l2EntryUpdateType);
+  }
+
+  void waitForMacCbs() {
+    waitForBackgroundThread(sw_);
+    waitForStateUpdates(sw_);
+  }
+
   void verifyMacIsDeleted() {
     verifyStateUpdate([=]() {
       auto vlan = sw_->getState()->getVlans()->getVlan(kVlan());
@@ -142,4 +162,91 @@ TEST_F(MacTableManagerTest, SameMacAgedCbTwice) {
   verifyMacIsDeleted();
 }
 
+TEST_F(MacTableManagerTest, LearningStorm) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_l2_learning_batch_max_updates = 16;
+  constexpr uint64_t kNumMacs = 1000;
+  auto stormMac = [](uint64_t i) {
+    return folly::MacAddress::fromHBO(0x020000000000 + i);
+  };
+
+  for (uint64_t i = 0; i < kNumMacs; ++i) {
+    triggerMacCb(stormMac(i), L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD);
+  }
+  // A flap ending with the MAC learned
+  for (int i = 0; i < 10; ++i) {
+    triggerMacLearnedCb();
+    triggerMacAgedCb();
+  }
+  triggerMacLearnedCb();
+  waitForMacCbs();
+
+  verifyMacIsAdded();
+  verifyStateUpdate([=]() {
+    auto vlan = sw_->getState()->getVlans()->getVlan(kVlan());
+    for (uint64_t i = 0; i < kNumMacs; ++i) {
+      EXPECT_NE(nullptr, vlan->getMacTable()->getNodeIf(stormMac(i)));
+    }
+  });
+}
+
+namespace {
+
+L2Entry l2Entry(
+    folly::StringPiece mac,
+    std::optional<cfg::AclLookupClass> classID = std::nullopt) {
+  return L2Entry(
+      folly::MacAddress(mac),
+      VlanID(1),
+      PortDescriptor(PortID(1)),
+      L2Entry::L2EntryType::L2_ENTRY_TYPE_VALIDATED,
+      classID);
+}
+
+constexpr auto kAdd = L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_ADD;
+constexpr auto kDelete = L2EntryUpdateType::L2_ENTRY_UPDATE_TYPE_DELETE;
+
+} // namespace
+
+TEST(L2LearningUpdateBuffer, coalescesRepeatedUpdates) {
+  L2LearningUpdateBuffer buffer;
+  EXPECT_TRUE(buffer.add(l2Entry("02:00:00:00:00:01"), kAdd));
+  EXPECT_FALSE(buffer.add(l2Entry("02:00:00:00:00:01"), kAdd));
+  EXPECT_TRUE(buffer.add(l2Entry("02:00:00:00:00:02"), kAdd));
+  EXPECT_EQ(2, buffer.size());
+}
+
+TEST(L2LearningUpdateBuffer, coalescesFlaps) {
+  L2LearningUpdateBuffer buffer;
+  for (int i = 0; i < 5; ++i) {
+    buffer.add(l2Entry("02:00:00:00:00:01"), kAdd);
+    buffer.add(l2Entry("02:00:00:00:00:01"), kDelete);
+  }
+  auto updates = buffer.take(100);
+  ASSERT_EQ(2, updates.size());
+  EXPECT_EQ(kAdd, updates[0].second);
+  EXPECT_EQ(kDelete, updates[1].second);
+  EXPECT_TRUE(buffer.empty());
+
+  // Aging an entry with a classID after learning it is not idempotent
+  auto classID = cfg::AclLookupClass::CLASS_QUEUE_PER_HOST_QUEUE_1;
+  for (int i = 0; i < 2; ++i) {
+    buffer.add(l2Entry("02:00:00:00:00:01"), kAdd);
+    buffer.add(l2Entry("02:00:00:00:00:01", classID), kDelete);
+  }
+  EXPECT_EQ(4, buffer.size());
+}
+
+TEST(L2LearningUpdateBuffer, takesWholeMacs) {
+  L2LearningUpdateBuffer buffer;
+  buffer.add(l2Entry("02:00:00:00:00:01"), kAdd);
+  buffer.add(l2Entry("02:00:00:00:00:01"), kDelete);
+  buffer.add(l2Entry("02:00:00:00:00:02"), kAdd);
+
+  EXPECT_EQ(2, buffer.take(1).size());
+  EXPECT_EQ(1, buffer.size());
+  EXPECT_EQ(1, buffer.take(1).size());
+  EXPECT_TRUE(buffer.take(1).empty());
+}
+
 } // namespace facebook::fboss
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/NeighborTimerWheel.h"
+
+#include <folly/io/async/EventBase.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+
+using namespace facebook::fboss;
+using namespace std::chrono_literals;
+using std::chrono::steady_clock;
+
+namespace {
+
+class TestOwner : public NeighborTimerWheel::Owner {
+ public:
+  using Batch = std::vector<std::shared_ptr<NeighborTimerWheel::Timeout>>;
+  using Callback = std::function<void(const Batch&)>;
+
+  explicit TestOwner(Callback callback = nullptr)
+      : callback_(std::move(callback)) {}
+
+  void timeoutsExpired(const Batch& expired) noexcept override {
+    for (const auto& timeout : expired) {
+      EXPECT_FALSE(timeout->isScheduled());
+    }
+    batches.push_back(expired);
+    times.push_back(steady_clock::now());
+    if (callback_) {
+      callback_(expired);
+    }
+  }
+
+  std::vector<Batch> batches;
+  std::vector<steady_clock::time_point> times;
+
+ private:
+  Callback callback_;
+};
+
+std::shared_ptr<NeighborTimerWheel::Timeout> makeTimeout(TestOwner* owner) {
+  return std::make_shared<NeighborTimerWheel::Timeout>(owner);
+}
+
+} // namespace
+
+TEST(NeighborTimerWheel, batchesTimeoutsExpiringTogether) {
+  folly::EventBase evb;
+  NeighborTimerWheel wheel(&evb, 10ms);
+  TestOwner owner, otherOwner;
+  auto a = makeTimeout(&owner);
+  auto b = makeTimeout(&owner);
+  auto c = makeTimeout(&owner);
+  auto d = makeTimeout(&otherOwner);
+
+  auto start = steady_clock::now();
+  wheel.scheduleTimeout(a.get(), 30ms);
+  wheel.scheduleTimeout(b.get(), 30ms);
+  wheel.scheduleTimeout(c.get(), 200ms);
+  wheel.scheduleTimeout(d.get(), 30ms);
+  EXPECT_TRUE(a->isScheduled());
+  EXPECT_EQ(4, wheel.numRecords());
+  // The loop exits once the wheel has no timeouts left
+  evb.loop();
+
+  ASSERT_EQ(2, owner.batches.size());
+  EXPECT_EQ((TestOwner::Batch{a, b}), owner.batches[0]);
+  EXPECT_EQ(TestOwner::Batch{c}, owner.batches[1]);
+  EXPECT_GE(owner.times[0] - start, 30ms);
+  EXPECT_GE(owner.times[1] - start, 200ms);
+  ASSERT_EQ(1, otherOwner.batches.size());
+  EXPECT_EQ(TestOwner::Batch{d}, otherOwner.batches[0]);
+  EXPECT_EQ(0, wheel.numRecords());
+}
+
+TEST(NeighborTimerWheel, rescheduleReplacesPreviousSchedule) {
+  folly::EventBase evb;
+  NeighborTimerWheel wheel(&evb, 10ms);
+  TestOwner owner;
+  auto timeout = makeTimeout(&owner);
+
+  auto start = steady_clock::now();
+  wheel.scheduleTimeout(timeout.get(), 20ms);
+  wheel.scheduleTimeout(timeout.get(), 100ms);
+  evb.loop();
+
+  ASSERT_EQ(1, owner.batches.size());
+  EXPECT_GE(owner.times[0] - start, 100ms);
+}
+
+TEST(NeighborTimerWheel, destroyedTimeoutsAreSkipped) {
+  folly::EventBase evb;
+  NeighborTimerWheel wheel(&evb, 10ms);
+  TestOwner owner;
+  auto kept = makeTimeout(&owner);
+  auto destroyed = makeTimeout(&owner);
+
+  wheel.scheduleTimeout(kept.get(), 20ms);
+  wheel.scheduleTimeout(destroyed.get(), 20ms);
+  destroyed.reset();
+  evb.loop();
+
+  ASSERT_EQ(1, owner.batches.size());
+  EXPECT_EQ(TestOwner::Batch{kept}, owner.batches[0]);
+}
+
+TEST(NeighborTimerWheel, rescheduleFromCallback) {
+  folly::EventBase evb;
+  NeighborTimerWheel wheel(&evb, 10ms);
+  int fired = 0;
+  TestOwner owner([&](const TestOwner::Batch& expired) {
+    if (++fired < 3) {
+      wheel.scheduleTimeout(expired[0].get(), 20ms);
+      EXPECT_TRUE(expired[0]->isScheduled());
+    }
+  });
+  auto timeout = makeTimeout(&owner);
+
+  wheel.scheduleTimeout(timeout.get(), 20ms);
+  evb.loop();
+
+  EXPECT_EQ(3, fired);
+  EXPECT_FALSE(timeout->isScheduled());
+}
+
+TEST(NeighborTimerWheel, timeoutsPastOneRevolution) {
+  folly::EventBase evb;
+  // One revolution of the wheel is 8ms
+  NeighborTimerWheel wheel(&evb, 1ms, 8);
+  TestOwner owner;
+  auto early = makeTimeout(&owner);
+  auto late = makeTimeout(&owner);
+
+  auto start = steady_clock::now();
+  wheel.scheduleTimeout(early.get(), 5ms);
+  wheel.scheduleTimeout(late.get(), 50ms);
+  evb.loop();
+
+  ASSERT_EQ(2, owner.batches.size());
+  EXPECT_EQ(TestOwner::Batch{early}, owner.batches[0]);
+  EXPECT_EQ(TestOwner::Batch{late}, owner.batches[1]);
+  EXPECT_GE(owner.times[1] - start, 50ms);
+}
@@ -0,0 +1,167 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/RouteChangePublisher.h"
+
+#include "fboss/agent/AddressUtil.h"
+#include "fboss/agent/RouteTableChunker.h"
+#include "fboss/agent/state/StateDelta.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/test/HwTestHandle.h"
+#include "fboss/agent/test/TestUtils.h"
+
+#include <folly/IPAddress.h>
+#include <gtest/gtest.h>
+
+#if FOLLY_HAS_COROUTINES
+#include <folly/experimental/coro/BlockingWait.h>
+
+using namespace facebook::fboss;
+using facebook::network::toBinaryAddress;
+
+namespace {
+
+using Batches = folly::coro::AsyncGenerator<RouteUpdateBatch&&>;
+
+RouteUpdateBatch nextBatch(Batches& batches) {
+  auto batch = folly::coro::blockingWait(batches.next());
+  EXPECT_TRUE(batch.has_value());
+  return batch ? std::move(*batch) : RouteUpdateBatch();
+}
+
+std::vector<UnicastRoute> allUnicastRoutes(
+    const std::shared_ptr<SwitchState>& state,
+    const RouteTableFilter& filter) {
+  std::vector<UnicastRoute> routes;
+  RouteTableChunker chunker(state, filter, 1000);
+  while (!chunker.done()) {
+    auto chunk = chunker.nextUnicastRoutes();
+    routes.insert(routes.end(), chunk.begin(), chunk.end());
+  }
+  return routes;
+}
+
+void checkChanges(
+    const std::vector<RouteChange>& changes,
+    RouteChangeType type,
+    const std::vector<UnicastRoute>& routes) {
+  ASSERT_EQ(routes.size(), changes.size());
+  for (size_t i = 0; i < routes.size(); ++i) {
+    EXPECT_EQ(type, *changes[i].type_ref());
+    EXPECT_EQ(0, *changes[i].vrf_ref());
+    if (type == RouteChangeType::REMOVED) {
+      EXPECT_EQ(routes[i].dest, changes[i].route_ref()->dest);
+      EXPECT_TRUE(changes[i].route_ref()->nextHops_ref()->empty());
+    } else {
+      EXPECT_EQ(routes[i], *changes[i].route_ref());
+    }
+  }
+}
+
+class RouteChangePublisherTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    handle = createTestHandle();
+    sw = handle->getSw();
+    initState = sw->getState();
+    stateA = testStateA();
+    publisher = std::make_unique<RouteChangePublisher>(sw);
+    ASSERT_TRUE(allUnicastRoutes(initState, RouteTableFilter()).empty());
+  }
+
+  // Subscribe and check the initial, empty snapshot
+  Batches subscribe(const RouteTableFilter& filter, size_t chunkSize) {
+    auto batches = publisher->subscribe(filter, chunkSize);
+    auto snapshot = nextBatch(batches);
+    EXPECT_EQ(0, *snapshot.sequenceNumber_ref());
+    EXPECT_TRUE(*snapshot.resync_ref());
+    EXPECT_TRUE(*snapshot.snapshotDone_ref());
+    EXPECT_TRUE(snapshot.changes_ref()->empty());
+    return batches;
+  }
+
+  std::unique_ptr<HwTestHandle> handle;
+  SwSwitch* sw;
+  std::shared_ptr<SwitchState> initState;
+  std::shared_ptr<SwitchState> stateA;
+  std::unique_ptr<RouteChangePublisher> publisher;
+};
+
+} // namespace
+
+TEST_F(RouteChangePublisherTest, snapshotThenChanges) {
+  auto batches = subscribe(RouteTableFilter(), 1000);
+  auto routes = allUnicastRoutes(stateA, RouteTableFilter());
+  ASSERT_FALSE(routes.empty());
+
+  publisher->stateUpdated(StateDelta(initState, stateA));
+  auto added = nextBatch(batches);
+  EXPECT_EQ(1, *added.sequenceNumber_ref());
+  EXPECT_FALSE(*added.resync_ref());
+  checkChanges(*added.changes_ref(), RouteChangeType::ADDED, routes);
+
+  // No route changes, no batch
+  publisher->stateUpdated(StateDelta(stateA, stateA->clone()));
+  publisher->stateUpdated(StateDelta(stateA, initState));
+  auto removed = nextBatch(batches);
+  EXPECT_EQ(2, *removed.sequenceNumber_ref());
+  checkChanges(*removed.changes_ref(), RouteChangeType::REMOVED, routes);
+}
+
+TEST_F(RouteChangePublisherTest, filteredChanges) {
+  RouteTableFilter filter;
+  filter.clientId_ref() = 1001;
+  auto batches = subscribe(filter, 1000);
+
+  publisher->stateUpdated(StateDelta(initState, stateA));
+  auto added = nextBatch(batches);
+  ASSERT_EQ(1, added.changes_ref()->size());
+  const auto& change = added.changes_ref()->front();
+  EXPECT_EQ(RouteChangeType::ADDED, *change.type_ref());
+  EXPECT_EQ(
+      toBinaryAddress(folly::IPAddress("10.1.1.0")),
+      change.route_ref()->dest.ip);
+  EXPECT_EQ(3, change.route_ref()->nextHops_ref()->size());
+}
+
+TEST_F(RouteChangePublisherTest, chunkedChanges) {
+  auto batches = subscribe(RouteTableFilter(), 1);
+  auto routes = allUnicastRoutes(stateA, RouteTableFilter());
+
+  publisher->stateUpdated(StateDelta(initState, stateA));
+  for (size_t i = 0; i < routes.size(); ++i) {
+    auto batch = nextBatch(batches);
+    EXPECT_EQ(static_cast<int64_t>(i + 1), *batch.sequenceNumber_ref());
+    checkChanges(*batch.changes_ref(), RouteChangeType::ADDED, {routes[i]});
+  }
+}
+
+TEST_F(RouteChangePublisherTest, resyncOnOverflow) {
+  gflags::FlagSaver flagSaver;
+  FLAGS_route_change_subscription_max_pending = 1;
+  auto batches = subscribe(RouteTableFilter(), 1000);
+  auto routes = allUnicastRoutes(stateA, RouteTableFilter());
+  ASSERT_GT(routes.size(), 1);
+
+  // Too many changes: the subscriber gets a snapshot of stateA instead
+  publisher->stateUpdated(StateDelta(initState, stateA));
+  auto snapshot = nextBatch(batches);
+  EXPECT_EQ(1, *snapshot.sequenceNumber_ref());
+  EXPECT_TRUE(*snapshot.resync_ref());
+  EXPECT_TRUE(*snapshot.snapshotDone_ref());
+  checkChanges(*snapshot.changes_ref(), RouteChangeType::ADDED, routes);
+}
+
+TEST_F(RouteChangePublisherTest, endsWithPublisher) {
+  auto batches = subscribe(RouteTableFilter(), 1000);
+  publisher.reset();
+  EXPECT_FALSE(folly::coro::blockingWait(batches.next()).has_value());
+}
+
+#endif
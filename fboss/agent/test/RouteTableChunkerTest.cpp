@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/agent/RouteTableChunker.h"
+
+#include "fboss/agent/AddressUtil.h"
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/state/Route.h"
+#include "fboss/agent/state/SwitchState.h"
+#include "fboss/agent/test/TestUtils.h"
+
+#include <folly/IPAddress.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::fboss;
+using facebook::network::toBinaryAddress;
+using facebook::network::toIPAddress;
+using folly::IPAddress;
+
+namespace {
+
+IpPrefix ipPrefix(folly::StringPiece ip, int length) {
+  IpPrefix result;
+  result.ip = toBinaryAddress(IPAddress(ip));
+  result.prefixLength = length;
+  return result;
+}
+
+folly::CIDRNetwork toCIDR(const IpPrefix& prefix) {
+  return folly::CIDRNetwork(toIPAddress(prefix.ip), prefix.prefixLength);
+}
+
+// Drain the chunker, checking the size of each chunk
+template <typename NextChunkFn>
+auto allChunks(RouteTableChunker* chunker, size_t chunkSize, NextChunkFn next) {
+  decltype(next(chunker)) all;
+  for (auto chunk = next(chunker); !chunk.empty(); chunk = next(chunker)) {
+    EXPECT_LE(chunk.size(), chunkSize);
+    all.insert(all.end(), chunk.begin(), chunk.end());
+  }
+  EXPECT_TRUE(chunker->done());
+  return all;
+}
+
+std::vector<UnicastRoute> allUnicastRoutes(
+    const std::shared_ptr<SwitchState>& state,
+    const RouteTableFilter& filter,
+    size_t chunkSize) {
+  RouteTableChunker chunker(state, filter, chunkSize);
+  return allChunks(&chunker, chunkSize, [](RouteTableChunker* c) {
+    return c->nextUnicastRoutes();
+  });
+}
+
+} // namespace
+
+TEST(RouteTableChunker, chunksMatchFullWalk) {
+  auto state = testStateA();
+  std::vector<folly::CIDRNetwork> resolved;
+  size_t numRoutes = 0;
+  for (const auto& table : *state->getRouteTables()) {
+    for (const auto& route : *table->getRibV4()->routes()) {
+      ++numRoutes;
+      if (route->isResolved()) {
+        resolved.emplace_back(route->prefix().network, route->prefix().mask);
+      }
+    }
+    for (const auto& route : *table->getRibV6()->routes()) {
+      ++numRoutes;
+      if (route->isResolved()) {
+        resolved.emplace_back(route->prefix().network, route->prefix().mask);
+      }
+    }
+  }
+  ASSERT_GT(resolved.size(), 2);
+
+  for (size_t chunkSize : {1, 2, 1000}) {
+    auto routes = allUnicastRoutes(state, RouteTableFilter(), chunkSize);
+    ASSERT_EQ(resolved.size(), routes.size());
+    for (size_t i = 0; i < routes.size(); ++i) {
+      EXPECT_EQ(resolved[i], toCIDR(routes[i].dest));
+      EXPECT_FALSE(routes[i].nextHops_ref()->empty());
+    }
+
+    RouteTableChunker chunker(state, RouteTableFilter(), chunkSize);
+    auto details = allChunks(&chunker, chunkSize, [](RouteTableChunker* c) {
+      return c->nextRouteDetails();
+    });
+    EXPECT_EQ(numRoutes, details.size());
+  }
+}
+
+TEST(RouteTableChunker, filterByClient) {
+  RouteTableFilter filter;
+  filter.clientId_ref() = 1001;
+  auto routes = allUnicastRoutes(testStateA(), filter, 10);
+  ASSERT_EQ(1, routes.size());
+  EXPECT_EQ(ipPrefix("10.1.1.0", 24), routes[0].dest);
+  // All the next hops of the client, including the unresolvable one
+  EXPECT_EQ(3, routes[0].nextHops_ref()->size());
+  EXPECT_EQ(3, routes[0].nextHopAddrs_ref()->size());
+}
+
+TEST(RouteTableChunker, filterByPrefix) {
+  RouteTableFilter filter;
+  filter.prefix_ref() = ipPrefix("10.0.0.0", 8);
+  auto routes = allUnicastRoutes(testStateA(), filter, 1);
+  ASSERT_FALSE(routes.empty());
+  bool foundClientRoute = false;
+  for (const auto& route : routes) {
+    auto cidr = toCIDR(route.dest);
+    EXPECT_TRUE(cidr.first.isV4());
+    EXPECT_TRUE(cidr.first.inSubnet(IPAddress("10.0.0.0"), 8));
+    EXPECT_GE(cidr.second, 8);
+    foundClientRoute |= route.dest == ipPrefix("10.1.1.0", 24);
+  }
+  EXPECT_TRUE(foundClientRoute);
+
+  filter.prefix_ref() = ipPrefix("10.1.1.0", 25);
+  EXPECT_TRUE(allUnicastRoutes(testStateA(), filter, 1).empty());
+}
+
+TEST(RouteTableChunker, invalidPrefixLength) {
+  RouteTableFilter filter;
+  for (const auto& prefix :
+       {ipPrefix("10.0.0.0", -1),
+        ipPrefix("10.0.0.0", 33),
+        ipPrefix("2401::", 129),
+        ipPrefix("2401::", 256)}) {
+    filter.prefix_ref() = prefix;
+    EXPECT_THROW(RouteTableChunker(testStateA(), filter, 1), FbossError);
+  }
+  filter.prefix_ref() = ipPrefix("2401::", 128);
+  EXPECT_NO_THROW(RouteTableChunker(testStateA(), filter, 1));
+}
+
+TEST(RouteTableChunker, filterByVrf) {
+  RouteTableFilter filter;
+  filter.vrf_ref() = 0;
+  EXPECT_EQ(
+      allUnicastRoutes(testStateA(), RouteTableFilter(), 10).size(),
+      allUnicastRoutes(testStateA(), filter, 10).size());
+
+  filter.vrf_ref() = 1;
+  RouteTableChunker chunker(testStateA(), filter, 10);
+  EXPECT_TRUE(chunker.done());
+  EXPECT_TRUE(chunker.nextUnicastRoutes().empty());
+}
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/RxPacketDispatcher.h"
+#include "fboss/agent/hw/mock/MockRxPacket.h"
+
+#include <folly/Format.h>
+#include <folly/io/Cursor.h>
+#include <folly/synchronization/Baton.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace facebook::fboss;
+using Queue = RxPacketDispatcher::Queue;
+
+namespace {
+
+std::unique_ptr<MockRxPacket> makePacket(uint16_t ethertype, uint8_t seq) {
+  // dst mac, src mac, ethertype, payload[0] = seq
+  auto pkt = MockRxPacket::fromHex(folly::sformat(
+      "02 00 00 00 00 01 02 00 00 00 00 02 {:02x} {:02x} {:02x}",
+      ethertype >> 8,
+      ethertype & 0xff,
+      seq));
+  pkt->padToLength(64);
+  return pkt;
+}
+
+uint8_t getSeq(const RxPacket* pkt) {
+  folly::io::Cursor c(pkt->buf());
+  c.skip(14);
+  return c.read<uint8_t>();
+}
+
+} // namespace
+
+TEST(RxPacketDispatcherTest, classify) {
+  std::vector<std::pair<uint16_t, Queue>> expected = {
+      {0x0806, Queue::ARP},
+      {0x0800, Queue::IPV4},
+      {0x86DD, Queue::IPV6},
+      {0x88CC, Queue::LLDP},
+      {0x8809, Queue::LACP},
+      {0x888E, Queue::EAPOL},
+      {0x1234, Queue::OTHER},
+  };
+  for (const auto& [ethertype, queue] : expected) {
+    auto pkt = makePacket(ethertype, 0);
+    EXPECT_EQ(queue, RxPacketDispatcher::classify(pkt.get()));
+  }
+
+  // 802.1Q tagged ARP
+  auto tagged = MockRxPacket::fromHex(
+      "02 00 00 00 00 01 02 00 00 00 00 02 81 00 00 05 08 06");
+  tagged->padToLength(64);
+  EXPECT_EQ(Queue::ARP, RxPacketDispatcher::classify(tagged.get()));
+
+  // Runt frames go to the catch-all queue
+  auto runt = MockRxPacket::fromHex("02 00 00 00 00 01");
+  EXPECT_EQ(Queue::OTHER, RxPacketDispatcher::classify(runt.get()));
+}
+
+TEST(RxPacketDispatcherTest, perQueueOrdering) {
+  constexpr int kNumPkts = 200;
+  std::mutex lock;
+  std::vector<uint8_t> arpSeqs;
+  std::vector<uint8_t> ndpSeqs;
+  folly::Baton<> done;
+  int processed = 0;
+  RxPacketDispatcher dispatcher(
+      [&](std::unique_ptr<RxPacket> pkt) {
+        std::lock_guard<std::mutex> g(lock);
+        auto queue = RxPacketDispatcher::classify(pkt.get());
+        (queue == Queue::ARP ? arpSeqs : ndpSeqs).push_back(getSeq(pkt.get()));
+        if (++processed == 2 * kNumPkts) {
+          done.post();
+        }
+      },
+      2,
+      1024);
+  for (int i = 0; i < kNumPkts; ++i) {
+    EXPECT_TRUE(dispatcher.enqueue(makePacket(0x0806, i)));
+    EXPECT_TRUE(dispatcher.enqueue(makePacket(0x86DD, i)));
+  }
+  done.wait();
+
+  ASSERT_EQ(kNumPkts, arpSeqs.size());
+  ASSERT_EQ(kNumPkts, ndpSeqs.size());
+  for (int i = 0; i < kNumPkts; ++i) {
+    EXPECT_EQ(static_cast<uint8_t>(i), arpSeqs[i]);
+    EXPECT_EQ(static_cast<uint8_t>(i), ndpSeqs[i]);
+  }
+  EXPECT_EQ(kNumPkts, dispatcher.getEnqueued(Queue::ARP));
+  EXPECT_EQ(kNumPkts, dispatcher.getProcessed(Queue::IPV6));
+  EXPECT_EQ(0, dispatcher.getDropped(Queue::ARP));
+}
+
+TEST(RxPacketDispatcherTest, slowHandlerDoesNotBlockOtherQueues) {
+  folly::Baton<> unblockArp;
+  folly::Baton<> ndpHandled;
+  // ARP and IPv6 are on different workers with 2 threads
+  RxPacketDispatcher dispatcher(
+      [&](std::unique_ptr<RxPacket> pkt) {
+        if (RxPacketDispatcher::classify(pkt.get()) == Queue::ARP) {
+          unblockArp.wait();
+        } else {
+          ndpHandled.post();
+        }
+      },
+      2,
+      16);
+  EXPECT_TRUE(dispatcher.enqueue(makePacket(0x0806, 0)));
+  EXPECT_TRUE(dispatcher.enqueue(makePacket(0x86DD, 0)));
+  EXPECT_TRUE(ndpHandled.try_wait_for(std::chrono::seconds(5)));
+  unblockArp.post();
+}
+
+TEST(RxPacketDispatcherTest, dropAndBackpressureWhenFull) {
+  constexpr int kQueueSize = 8;
+  std::atomic<int> handled{0};
+  folly::Baton<> handlerEntered;
+  folly::Baton<> unblock;
+  RxPacketDispatcher dispatcher(
+      [&](std::unique_ptr<RxPacket> /*pkt*/) {
+        if (handled++ == 0) {
+          handlerEntered.post();
+        }
+        unblock.wait();
+      },
+      1,
+      kQueueSize);
+  // First packet is dequeued and parks the worker in the handler
+  EXPECT_TRUE(dispatcher.enqueue(makePacket(0x0806, 0)));
+  handlerEntered.wait();
+  for (int i = 0; i < kQueueSize; ++i) {
+    EXPECT_TRUE(dispatcher.enqueue(makePacket(0x0806, i + 1)));
+  }
+  EXPECT_FALSE(dispatcher.enqueue(makePacket(0x0806, 0)));
+  EXPECT_EQ(1, dispatcher.getDropped(Queue::ARP));
+  EXPECT_EQ(0, dispatcher.getDropped(Queue::IPV6));
+  // Queue depth 7 and 8 are above 75% of 8
+  EXPECT_EQ(2, dispatcher.getBackpressured(Queue::ARP));
+  unblock.post();
+  dispatcher.stop();
+  EXPECT_FALSE(dispatcher.enqueue(makePacket(0x0806, 0)));
+  EXPECT_EQ(2, dispatcher.getDropped(Queue::ARP));
+}
@@ -0,0 +1,222 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/StateObserverNotifier.h"
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/StateObserver.h"
+#include "fboss/agent/state/SwitchState.h"
+
+#include <folly/synchronization/Baton.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace facebook::fboss;
+using std::make_shared;
+using std::shared_ptr;
+
+namespace {
+
+class TestObserver : public StateObserver {
+ public:
+  using Callback = std::function<void(const StateDelta&)>;
+  explicit TestObserver(Callback callback = nullptr)
+      : callback_(std::move(callback)) {}
+
+  void stateUpdated(const StateDelta& delta) override {
+    if (callback_) {
+      callback_(delta);
+    }
+    threadId_ = std::this_thread::get_id();
+    std::lock_guard<std::mutex> guard(mutex_);
+    seen_.push_back(delta.newState());
+  }
+
+  std::vector<shared_ptr<SwitchState>> seen() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return seen_;
+  }
+  std::thread::id threadId() const {
+    return threadId_;
+  }
+
+ private:
+  Callback callback_;
+  std::atomic<std::thread::id> threadId_;
+  mutable std::mutex mutex_;
+  std::vector<shared_ptr<SwitchState>> seen_;
+};
+
+StateObserverOptions options(
+    StateObserverMode mode,
+    std::vector<std::string> dependencies = {}) {
+  return StateObserverOptions{mode, std::move(dependencies)};
+}
+
+} // namespace
+
+TEST(StateObserverNotifier, serialObserversRunInOrder) {
+  StateObserverNotifier notifier(2);
+  std::vector<std::string> order;
+  TestObserver first([&order](const StateDelta&) { order.push_back("first"); });
+  TestObserver second(
+      [&order](const StateDelta&) { order.push_back("second"); });
+  notifier.addObserver(&first, "first", StateObserverOptions());
+  notifier.addObserver(&second, "second", StateObserverOptions());
+
+  auto state = make_shared<SwitchState>();
+  notifier.notify(StateDelta(make_shared<SwitchState>(), state));
+  EXPECT_EQ((std::vector<std::string>{"first", "second"}), order);
+  EXPECT_EQ(std::this_thread::get_id(), first.threadId());
+  EXPECT_EQ(std::this_thread::get_id(), second.threadId());
+  EXPECT_EQ(std::vector<shared_ptr<SwitchState>>{state}, first.seen());
+}
+
+TEST(StateObserverNotifier, parallelObserversRunConcurrently) {
+  StateObserverNotifier notifier(2);
+  folly::Baton<> aStarted, bStarted;
+  std::atomic<bool> sawEachOther{true};
+  TestObserver a([&](const StateDelta&) {
+    aStarted.post();
+    if (!bStarted.try_wait_for(std::chrono::seconds(5))) {
+      sawEachOther = false;
+    }
+  });
+  TestObserver b([&](const StateDelta&) {
+    bStarted.post();
+    if (!aStarted.try_wait_for(std::chrono::seconds(5))) {
+      sawEachOther = false;
+    }
+  });
+  notifier.addObserver(&a, "a", options(StateObserverMode::PARALLEL));
+  notifier.addObserver(&b, "b", options(StateObserverMode::PARALLEL));
+
+  notifier.notify(
+      StateDelta(make_shared<SwitchState>(), make_shared<SwitchState>()));
+  EXPECT_TRUE(sawEachOther);
+  // Parallel observers are done by the time notify() returns
+  EXPECT_EQ(1, a.seen().size());
+  EXPECT_EQ(1, b.seen().size());
+  EXPECT_NE(std::this_thread::get_id(), a.threadId());
+}
+
+TEST(StateObserverNotifier, dependenciesRunFirst) {
+  StateObserverNotifier notifier(4);
+  std::atomic<int> done{0};
+  std::atomic<int> doneBeforeDependent{-1};
+  std::atomic<int> doneBeforeSerial{-1};
+  TestObserver a([&](const StateDelta&) { ++done; });
+  TestObserver b([&](const StateDelta&) { ++done; });
+  TestObserver dependent([&](const StateDelta&) {
+    doneBeforeDependent = done.load();
+    ++done;
+  });
+  TestObserver serial(
+      [&](const StateDelta&) { doneBeforeSerial = done.load(); });
+  // Register the dependent observers first; dependencies are resolved by
+  // name whenever observers are added.
+  notifier.addObserver(
+      &serial, "serial", options(StateObserverMode::SERIAL, {"dependent"}));
+  notifier.addObserver(
+      &dependent,
+      "dependent",
+      options(StateObserverMode::PARALLEL, {"a", "b", "missing"}));
+  notifier.addObserver(&a, "a", options(StateObserverMode::PARALLEL));
+  notifier.addObserver(&b, "b", options(StateObserverMode::PARALLEL));
+
+  for (int i = 0; i < 10; ++i) {
+    done = 0;
+    notifier.notify(
+        StateDelta(make_shared<SwitchState>(), make_shared<SwitchState>()));
+    EXPECT_EQ(2, doneBeforeDependent);
+    EXPECT_EQ(3, doneBeforeSerial);
+  }
+}
+
+TEST(StateObserverNotifier, asyncObserversKeepOrder) {
+  StateObserverNotifier notifier(2);
+  folly::Baton<> release;
+  TestObserver slow([&release](const StateDelta&) { release.wait(); });
+  TestObserver follower;
+  notifier.addObserver(&slow, "slow", options(StateObserverMode::ASYNC));
+  notifier.addObserver(
+      &follower, "follower", options(StateObserverMode::ASYNC, {"slow"}));
+
+  std::vector<shared_ptr<SwitchState>> states;
+  auto oldState = make_shared<SwitchState>();
+  for (int i = 0; i < 100; ++i) {
+    auto newState = make_shared<SwitchState>();
+    // Returns even though slow is still blocked on the first delta
+    notifier.notify(StateDelta(oldState, newState));
+    states.push_back(newState);
+    oldState = newState;
+  }
+  EXPECT_TRUE(follower.seen().empty());
+  release.post();
+  notifier.waitForAsyncObservers();
+  EXPECT_EQ(states, slow.seen());
+  EXPECT_EQ(states, follower.seen());
+}
+
+TEST(StateObserverNotifier, removeWaitsForAsyncObserver) {
+  StateObserverNotifier notifier(1);
+  std::atomic<int> updates{0};
+  TestObserver observer([&updates](const StateDelta&) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ++updates;
+  });
+  notifier.addObserver(&observer, "async", options(StateObserverMode::ASYNC));
+  for (int i = 0; i < 10; ++i) {
+    notifier.notify(
+        StateDelta(make_shared<SwitchState>(), make_shared<SwitchState>()));
+  }
+  notifier.removeObserver(&observer);
+  EXPECT_EQ(10, updates);
+  EXPECT_FALSE(notifier.isRegistered(&observer));
+}
+
+TEST(StateObserverNotifier, noThreads) {
+  StateObserverNotifier notifier(0);
+  TestObserver parallel, async;
+  notifier.addObserver(
+      &parallel, "parallel", options(StateObserverMode::PARALLEL));
+  notifier.addObserver(&async, "async", options(StateObserverMode::ASYNC));
+  notifier.notify(
+      StateDelta(make_shared<SwitchState>(), make_shared<SwitchState>()));
+  EXPECT_EQ(1, async.seen().size());
+  EXPECT_EQ(std::this_thread::get_id(), parallel.threadId());
+  EXPECT_EQ(std::this_thread::get_id(), async.threadId());
+}
+
+TEST(StateObserverNotifier, invalidRegistrations) {
+  StateObserverNotifier notifier(2);
+  TestObserver a, b, c, async;
+  notifier.addObserver(&a, "a", options(StateObserverMode::SERIAL, {"b"}));
+  EXPECT_THROW(
+      notifier.addObserver(&a, "a", StateObserverOptions()), FbossError);
+  EXPECT_THROW(
+      notifier.addObserver(&b, "b", options(StateObserverMode::SERIAL, {"a"})),
+      FbossError);
+  EXPECT_FALSE(notifier.isRegistered(&b));
+
+  notifier.addObserver(&async, "async", options(StateObserverMode::ASYNC));
+  EXPECT_THROW(
+      notifier.addObserver(
+          &c, "c", options(StateObserverMode::PARALLEL, {"async"})),
+      FbossError);
+  EXPECT_FALSE(notifier.isRegistered(&c));
+
+  EXPECT_THROW(notifier.removeObserver(&c), FbossError);
+  notifier.removeObserver(&a);
+  notifier.removeObserver(&async);
+}
@@ -20,6 +20,8 @@
 #include <folly/IPAddressV4.h>
 #include <folly/IPAddressV6.h>
 #include <folly/MacAddress.h>
+#include <folly/synchronization/Baton.h>
+#include <gflags/gflags.h>
 
 #include <algorithm>
 
@@ -28,6 +30,7 @@ using std::string;
 using ::testing::_;
 using ::testing::ByRef;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::Return;
 
 class SwSwitchUpdateProcessingTest : public ::testing::TestWithParam<bool> {
@@ -208,3 +211,92 @@ INSTANTIATE_TEST_CASE_P(
     SwSwitchUpdateProcessingTest,
     SwSwitchUpdateProcessingTest,
     ::testing::Values(true, false));
+
+class SwSwitchPipelinedUpdateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    FLAGS_pipelined_state_updates = true;
+    auto state = testStateA();
+    state->publish();
+    handle = createTestHandle(state);
+    sw = handle->getSw();
+    sw->initialConfigApplied(std::chrono::steady_clock::now());
+    waitForStateUpdates(sw);
+  }
+
+  void TearDown() override {
+    sw = nullptr;
+    handle.reset();
+  }
+
+ protected:
+  gflags::FlagSaver flagSaver;
+  SwSwitch* sw{nullptr};
+  std::unique_ptr<HwTestHandle> handle{nullptr};
+};
+
+TEST_F(SwSwitchPipelinedUpdateTest, PrepareWhileHwBusy) {
+  auto startState = sw->getState();
+  auto firstState = bringAllPortsUp(startState->clone());
+  firstState->publish();
+  auto secondState = firstState->clone();
+  folly::Baton<> hwStarted, releaseHw, secondPrepared;
+  EXPECT_HW_CALL(sw, stateChanged(_))
+      .WillOnce(Invoke([&](const StateDelta& delta) {
+        hwStarted.post();
+        releaseHw.wait();
+        return delta.newState();
+      }))
+      .WillOnce(Invoke([](const StateDelta& delta) {
+        return delta.newState();
+      }));
+
+  sw->updateState(
+      "first", [=](const std::shared_ptr<SwitchState>& /*state*/) {
+        return firstState;
+      });
+  ASSERT_TRUE(hwStarted.try_wait_for(std::chrono::seconds(5)));
+  std::shared_ptr<SwitchState> secondInput;
+  sw->updateState("second", [&](const std::shared_ptr<SwitchState>& state) {
+    secondInput = state;
+    secondPrepared.post();
+    return secondState;
+  });
+  // The second update is prepared on top of the first one while HW is still
+  // programming it
+  EXPECT_TRUE(secondPrepared.try_wait_for(std::chrono::seconds(5)));
+  EXPECT_EQ(firstState, secondInput);
+  EXPECT_EQ(startState, sw->getState());
+
+  releaseHw.post();
+  waitForStateUpdates(sw);
+  EXPECT_EQ(secondState, sw->getState());
+}
+
+TEST_F(SwSwitchPipelinedUpdateTest, ProtectedUpdateDrainsPipeline) {
+  auto startState = sw->getState();
+  auto firstState = bringAllPortsUp(startState->clone());
+  firstState->publish();
+  auto protectedState = firstState->clone();
+  // HW rejects the protected update, which must roll back to the state the
+  // earlier update left HW in
+  EXPECT_HW_CALL(sw, stateChanged(_))
+      .WillOnce(Invoke([](const StateDelta& delta) {
+        return delta.newState();
+      }))
+      .WillOnce(Invoke([](const StateDelta& delta) {
+        return delta.oldState();
+      }));
+  sw->updateState(
+      "first", [=](const std::shared_ptr<SwitchState>& /*state*/) {
+        return firstState;
+      });
+  auto protectedFn = [=](const std::shared_ptr<SwitchState>& state) {
+    EXPECT_EQ(firstState, state);
+    return protectedState;
+  };
+  EXPECT_THROW(
+      sw->updateStateWithHwFailureProtection("protected", protectedFn),
+      FbossHwUpdateError);
+  EXPECT_EQ(firstState, sw->getState());
+}
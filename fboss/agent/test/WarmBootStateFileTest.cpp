@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/agent/hw/WarmBootStateFile.h"
+#include "fboss/agent/FbossError.h"
+
+#include <folly/FileUtil.h>
+#include <folly/Format.h>
+#include <folly/experimental/TestUtil.h>
+#include <folly/json.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::fboss;
+
+namespace {
+
+folly::dynamic makeState() {
+  folly::dynamic routes = folly::dynamic::array;
+  for (int i = 0; i < 1000; ++i) {
+    folly::dynamic route = folly::dynamic::object;
+    route["prefix"] = folly::sformat("10.{}.{}.0/24", i / 256, i % 256);
+    route["nexthops"] = folly::dynamic::array("1.1.1.1", "2.2.2.2");
+    route["weight"] = i;
+    routes.push_back(std::move(route));
+  }
+  folly::dynamic swSwitch = folly::dynamic::object;
+  swSwitch["routeTables"] = std::move(routes);
+  swSwitch["ports"] = folly::dynamic::object("1", "eth1/1/1")("2", "eth1/2/1");
+  swSwitch["emptyMap"] = folly::dynamic::object;
+  swSwitch["defaultVlan"] = 4094;
+
+  folly::dynamic hwSwitch = folly::dynamic::object;
+  hwSwitch["adapterKeys"] = folly::dynamic::object(
+      "SAI_OBJECT_TYPE_SWITCH", folly::dynamic::array(1));
+
+  folly::dynamic state = folly::dynamic::object;
+  state["swSwitch"] = std::move(swSwitch);
+  state["hwSwitch"] = std::move(hwSwitch);
+  state["emptyTop"] = folly::dynamic::object;
+  state["scalarTop"] = "value";
+  return state;
+}
+
+class WarmBootStateFileTest : public ::testing::Test {
+ public:
+  std::string path() const {
+    return (tmpDir_.path() / "switch_state").string();
+  }
+
+ private:
+  folly::test::TemporaryDirectory tmpDir_;
+};
+
+} // namespace
+
+TEST_F(WarmBootStateFileTest, roundTrip) {
+  auto state = makeState();
+  WarmBootStateFile::write(path(), state);
+  EXPECT_TRUE(WarmBootStateFile::isBinary(path()));
+
+  WarmBootStateReader reader(path());
+  EXPECT_EQ(state, reader.getAll());
+  std::vector<std::string> expectedKeys{
+      "emptyTop", "hwSwitch", "scalarTop", "swSwitch"};
+  EXPECT_EQ(expectedKeys, reader.topLevelKeys());
+}
+
+TEST_F(WarmBootStateFileTest, loadSubtrees) {
+  auto state = makeState();
+  WarmBootStateFile::write(path(), state);
+
+  WarmBootStateReader reader(path());
+  EXPECT_EQ(state["swSwitch"], reader.getSubtree("swSwitch"));
+  EXPECT_EQ(
+      state["hwSwitch"]["adapterKeys"],
+      reader.getSubtree("hwSwitch", "adapterKeys"));
+  EXPECT_EQ(
+      state["swSwitch"]["emptyMap"], reader.getSubtree("swSwitch", "emptyMap"));
+  EXPECT_EQ(state["emptyTop"], reader.getSubtree("emptyTop"));
+  EXPECT_EQ(state["scalarTop"], reader.getSubtree("scalarTop"));
+
+  EXPECT_TRUE(reader.hasSubtree("hwSwitch", "adapterKeys"));
+  EXPECT_FALSE(reader.hasSubtree("hwSwitch", "adapterKey2AdapterHostKey"));
+  EXPECT_FALSE(reader.hasSubtree("missing"));
+  EXPECT_THROW(reader.getSubtree("missing"), FbossError);
+  EXPECT_THROW(reader.getSubtree("swSwitch", "missing"), FbossError);
+}
+
+TEST_F(WarmBootStateFileTest, jsonIsNotBinary) {
+  folly::writeFile(folly::toPrettyJson(makeState()), path().c_str());
+  EXPECT_FALSE(WarmBootStateFile::isBinary(path()));
+  EXPECT_THROW(WarmBootStateReader{path()}, FbossError);
+}
+
+TEST_F(WarmBootStateFileTest, truncatedFile) {
+  WarmBootStateFile::write(path(), makeState());
+  std::string contents;
+  ASSERT_TRUE(folly::readFile(path().c_str(), contents));
+  contents.resize(contents.size() / 2);
+  ASSERT_TRUE(folly::writeFile(contents, path().c_str()));
+  EXPECT_TRUE(WarmBootStateFile::isBinary(path()));
+  EXPECT_THROW(WarmBootStateReader{path()}, FbossError);
+}
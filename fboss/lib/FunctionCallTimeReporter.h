@@ -28,6 +28,16 @@ class FunctionCallTimeReporter {
   ~FunctionCallTimeReporter() = default;
   void start();
   void end();
+  bool isOn() const {
+    return isOn_;
+  }
+  /*
+   * Cumulative time spent in the calls timed on this thread, while the
+   * reporter was on
+   */
+  std::chrono::duration<double, std::micro> getCallTime() const {
+    return tracker_.cumalativeUsecs_;
+  }
   void callStart() {
     if (UNLIKELY(isOn_)) {
       tracker_.callStart();
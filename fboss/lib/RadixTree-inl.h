@@ -423,6 +423,257 @@ RadixTree<IPADDRTYPE, T, TreeTraits>::cloneSubTree(const TreeNode* node) {
   return copy;
 }
 
+template <typename IPADDRTYPE, typename T>
+typename PersistentRadixTreeNode<IPADDRTYPE, T>::TreeDirection
+PersistentRadixTreeNode<IPADDRTYPE, T>::searchDirection(
+    const IPADDRTYPE& toSearch,
+    uint8_t toSearchMasklen) const {
+  if (masklen_ < toSearchMasklen) {
+    if (toSearch.mask(masklen_) == ipAddress_) {
+      return toSearch.getNthMSBit(masklen_) == 1 ? TreeDirection::RIGHT
+                                                 : TreeDirection::LEFT;
+    }
+    return TreeDirection::PARENT;
+  }
+  if (masklen_ == toSearchMasklen && ipAddress_ == toSearch) {
+    return TreeDirection::THIS_NODE;
+  }
+  return TreeDirection::PARENT;
+}
+
+template <typename IPADDRTYPE, typename T>
+const typename PersistentRadixTree<IPADDRTYPE, T>::TreeNode*
+PersistentRadixTree<IPADDRTYPE, T>::longestMatchImpl(
+    const IPADDRTYPE& ipaddr,
+    uint8_t masklen,
+    bool& foundExact) const {
+  // Can't trust the clients to have 0s in all bits after mask length
+  const auto toMatch = ipaddr.mask(masklen);
+  const TreeNode* lastValueNodeSeen = nullptr;
+  auto curNode = root_.get();
+  while (curNode) {
+    auto searchDirection = curNode->searchDirection(toMatch, masklen);
+    if (searchDirection == TreeDirection::PARENT) {
+      break;
+    }
+    if (curNode->isValueNode()) {
+      lastValueNodeSeen = curNode;
+    }
+    if (searchDirection == TreeDirection::THIS_NODE) {
+      foundExact = curNode->isValueNode();
+      break;
+    }
+    curNode = searchDirection == TreeDirection::LEFT ? curNode->left().get()
+                                                     : curNode->right().get();
+  }
+  return lastValueNodeSeen;
+}
+
+template <typename IPADDRTYPE, typename T>
+template <typename VALUE>
+bool PersistentRadixTree<IPADDRTYPE, T>::insertImpl(
+    const IPADDRTYPE& ipaddr,
+    uint8_t masklen,
+    VALUE&& value,
+    bool overwrite) {
+  auto inserted = false;
+  root_ = insertInSubTree(
+      root_,
+      ipaddr.mask(masklen),
+      masklen,
+      std::forward<VALUE>(value),
+      overwrite,
+      inserted);
+  if (inserted) {
+    ++size_;
+  }
+  return inserted;
+}
+
+/*
+ * Returns the root of the subtree resulting from inserting toAdd/masklen
+ * in the subtree rooted at node. Only nodes on the path to the inserted
+ * prefix are copied, if nothing changes node itself is returned.
+ */
+template <typename IPADDRTYPE, typename T>
+template <typename VALUE>
+typename PersistentRadixTree<IPADDRTYPE, T>::NodePtr
+PersistentRadixTree<IPADDRTYPE, T>::insertInSubTree(
+    const NodePtr& node,
+    const IPADDRTYPE& toAdd,
+    uint8_t masklen,
+    VALUE&& value,
+    bool overwrite,
+    bool& inserted) {
+  if (!node) {
+    inserted = true;
+    return std::make_shared<const TreeNode>(
+        toAdd, masklen, std::forward<VALUE>(value), nullptr, nullptr);
+  }
+  switch (node->searchDirection(toAdd, masklen)) {
+    case TreeDirection::THIS_NODE:
+      if (node->isValueNode() && !overwrite) {
+        return node;
+      }
+      inserted = node->isNonValueNode();
+      return std::make_shared<const TreeNode>(
+          toAdd,
+          masklen,
+          std::forward<VALUE>(value),
+          node->left(),
+          node->right());
+    case TreeDirection::LEFT: {
+      auto newLeft = insertInSubTree(
+          node->left(),
+          toAdd,
+          masklen,
+          std::forward<VALUE>(value),
+          overwrite,
+          inserted);
+      if (newLeft == node->left()) {
+        return node;
+      }
+      return std::make_shared<const TreeNode>(
+          node->ipAddress(),
+          node->masklen(),
+          node->optionalValue(),
+          std::move(newLeft),
+          node->right());
+    }
+    case TreeDirection::RIGHT: {
+      auto newRight = insertInSubTree(
+          node->right(),
+          toAdd,
+          masklen,
+          std::forward<VALUE>(value),
+          overwrite,
+          inserted);
+      if (newRight == node->right()) {
+        return node;
+      }
+      return std::make_shared<const TreeNode>(
+          node->ipAddress(),
+          node->masklen(),
+          node->optionalValue(),
+          node->left(),
+          std::move(newRight));
+    }
+    case TreeDirection::PARENT:
+      break;
+  }
+  // toAdd does not lie under node. It either becomes the new parent of
+  // node or the two become siblings under a non value node holding their
+  // longest common prefix. Either way node's subtree is shared as is.
+  inserted = true;
+  auto prefix = IPADDRTYPE::longestCommonPrefix(
+      {node->ipAddress(), static_cast<uint8_t>(node->masklen())},
+      {toAdd, masklen});
+  if (prefix.first == toAdd && prefix.second == masklen) {
+    TreeNode parentProbe(toAdd, masklen, std::nullopt, nullptr, nullptr);
+    auto nodeDirection = parentProbe.searchDirection(*node);
+    CHECK(
+        nodeDirection == TreeDirection::LEFT ||
+        nodeDirection == TreeDirection::RIGHT);
+    return std::make_shared<const TreeNode>(
+        toAdd,
+        masklen,
+        std::forward<VALUE>(value),
+        nodeDirection == TreeDirection::LEFT ? node : nullptr,
+        nodeDirection == TreeDirection::RIGHT ? node : nullptr);
+  }
+  auto newNode = std::make_shared<const TreeNode>(
+      toAdd, masklen, std::forward<VALUE>(value), nullptr, nullptr);
+  TreeNode internalProbe(
+      prefix.first, prefix.second, std::nullopt, nullptr, nullptr);
+  auto nodeDirection = internalProbe.searchDirection(*node);
+  CHECK(
+      nodeDirection == TreeDirection::LEFT ||
+      nodeDirection == TreeDirection::RIGHT);
+  if (nodeDirection == TreeDirection::LEFT) {
+    return std::make_shared<const TreeNode>(
+        prefix.first, prefix.second, std::nullopt, node, std::move(newNode));
+  }
+  return std::make_shared<const TreeNode>(
+      prefix.first, prefix.second, std::nullopt, std::move(newNode), node);
+}
+
+template <typename IPADDRTYPE, typename T>
+bool PersistentRadixTree<IPADDRTYPE, T>::erase(
+    const IPADDRTYPE& ipaddr,
+    uint8_t masklen) {
+  auto erased = false;
+  auto newRoot =
+      eraseFromSubTree(root_, ipaddr.mask(masklen), masklen, erased);
+  if (erased) {
+    root_ = std::move(newRoot);
+    --size_;
+  }
+  return erased;
+}
+
+template <typename IPADDRTYPE, typename T>
+typename PersistentRadixTree<IPADDRTYPE, T>::NodePtr
+PersistentRadixTree<IPADDRTYPE, T>::eraseFromSubTree(
+    const NodePtr& node,
+    const IPADDRTYPE& toErase,
+    uint8_t masklen,
+    bool& erased) {
+  if (!node) {
+    return node;
+  }
+  switch (node->searchDirection(toErase, masklen)) {
+    case TreeDirection::THIS_NODE:
+      if (node->isNonValueNode()) {
+        return node;
+      }
+      erased = true;
+      if (node->left() && node->right()) {
+        // Keep the node as a non value branch point for its children
+        return std::make_shared<const TreeNode>(
+            node->ipAddress(),
+            node->masklen(),
+            std::nullopt,
+            node->left(),
+            node->right());
+      }
+      // Zero or one child, let the parent adopt it (if any)
+      return node->left() ? node->left() : node->right();
+    case TreeDirection::LEFT: {
+      auto newLeft = eraseFromSubTree(node->left(), toErase, masklen, erased);
+      return erased ? withChildren(*node, std::move(newLeft), node->right())
+                    : node;
+    }
+    case TreeDirection::RIGHT: {
+      auto newRight =
+          eraseFromSubTree(node->right(), toErase, masklen, erased);
+      return erased ? withChildren(*node, node->left(), std::move(newRight))
+                    : node;
+    }
+    case TreeDirection::PARENT:
+      break;
+  }
+  return node;
+}
+
+template <typename IPADDRTYPE, typename T>
+typename PersistentRadixTree<IPADDRTYPE, T>::NodePtr
+PersistentRadixTree<IPADDRTYPE, T>::withChildren(
+    const TreeNode& node,
+    NodePtr newLeft,
+    NodePtr newRight) {
+  if (node.isNonValueNode() && (!newLeft || !newRight)) {
+    // Non value nodes must have 2 children, drop this one in favor of
+    // its only remaining child.
+    return newLeft ? std::move(newLeft) : std::move(newRight);
+  }
+  return std::make_shared<const TreeNode>(
+      node.ipAddress(),
+      node.masklen(),
+      node.optionalValue(),
+      std::move(newLeft),
+      std::move(newRight));
+}
+
 template <typename IterType>
 typename std::vector<IterType> pathFromRoot(
     IterType itr,
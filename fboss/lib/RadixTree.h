@@ -1207,6 +1207,264 @@ class RadixTree<folly::IPAddress, T> {
   RadixTree<folly::IPAddressV4, T, V4TreeInCompositeTreeTraits<T>> ipv4Tree_;
 };
 
+/*
+ * Immutable node of a PersistentRadixTree. Nodes are never modified once
+ * created, which allows them to be shared between different versions
+ * (generations) of a tree. As with RadixTreeNode, all non value nodes
+ * must have 2 children.
+ */
+template <typename IPADDRTYPE, typename T>
+class PersistentRadixTreeNode {
+ public:
+  typedef std::shared_ptr<const PersistentRadixTreeNode> NodePtr;
+  typedef typename RadixTreeNode<IPADDRTYPE, T>::TreeDirection TreeDirection;
+
+  PersistentRadixTreeNode(
+      const IPADDRTYPE& ipAddr,
+      uint8_t mlen,
+      std::optional<T> val,
+      NodePtr left,
+      NodePtr right)
+      : ipAddress_(ipAddr),
+        masklen_(mlen),
+        value_(std::move(val)),
+        left_(std::move(left)),
+        right_(std::move(right)) {}
+
+  const IPADDRTYPE& ipAddress() const {
+    return ipAddress_;
+  }
+  uint32_t masklen() const {
+    return masklen_;
+  }
+  bool isValueNode() const {
+    return value_.has_value();
+  }
+  bool isNonValueNode() const {
+    return !isValueNode();
+  }
+  const T& value() const {
+    return value_.value();
+  }
+  const std::optional<T>& optionalValue() const {
+    return value_;
+  }
+  const NodePtr& left() const {
+    return left_;
+  }
+  const NodePtr& right() const {
+    return right_;
+  }
+  bool isLeaf() const {
+    return left_ == nullptr && right_ == nullptr;
+  }
+
+  // Same semantics as RadixTreeNode::searchDirection
+  TreeDirection searchDirection(const IPADDRTYPE& toSearch, uint8_t masklen)
+      const;
+
+  TreeDirection searchDirection(const PersistentRadixTreeNode& node) const {
+    return searchDirection(node.ipAddress_, node.masklen_);
+  }
+
+ private:
+  const IPADDRTYPE ipAddress_;
+  const uint32_t masklen_{0};
+  const std::optional<T> value_;
+  const NodePtr left_;
+  const NodePtr right_;
+};
+
+/*
+ * Persistent (path copying) radix tree.
+ *
+ * Unlike RadixTree, copying a PersistentRadixTree is O(1): the copy shares
+ * all nodes with the original. Modifications (insert, erase) copy only the
+ * nodes on the path from the root to the modified prefix, so a new version
+ * of the tree shares all untouched subtrees with the version it was copied
+ * from. Lookups cost O(address bit count).
+ *
+ * Since nodes are immutable, a tree may be read concurrently from multiple
+ * threads as long as no thread modifies that particular tree object. This
+ * makes it suitable for indexing published (read only) SwitchState nodes.
+ *
+ * Values are only ever returned as const. To change a value re-insert it
+ * with insertOrAssign.
+ */
+template <typename IPADDRTYPE, typename T>
+class PersistentRadixTree {
+ public:
+  typedef PersistentRadixTreeNode<IPADDRTYPE, T> TreeNode;
+  typedef typename TreeNode::NodePtr NodePtr;
+  typedef typename TreeNode::TreeDirection TreeDirection;
+
+  PersistentRadixTree() {}
+
+  // Copies share all nodes and are thus cheap.
+  PersistentRadixTree(const PersistentRadixTree& r) = default;
+  PersistentRadixTree& operator=(const PersistentRadixTree& r) = default;
+  PersistentRadixTree(PersistentRadixTree&& r) noexcept
+      : root_(std::move(r.root_)), size_(r.size_) {
+    r.size_ = 0;
+  }
+  PersistentRadixTree& operator=(PersistentRadixTree&& r) noexcept {
+    root_ = std::move(r.root_);
+    size_ = r.size_;
+    r.size_ = 0;
+    return *this;
+  }
+
+  /*
+   * Insert a IP, mask, value in tree. Returns true if a node was
+   * inserted, false if the prefix already existed (in which case the
+   * existing value is left untouched).
+   */
+  template <typename VALUE>
+  bool insert(const IPADDRTYPE& ipaddr, uint8_t masklen, VALUE&& value) {
+    return insertImpl(
+        ipaddr, masklen, std::forward<VALUE>(value), false /* overwrite */);
+  }
+
+  /*
+   * Insert a IP, mask, value in tree, replacing the value if the prefix
+   * already exists. Returns true if a new prefix was added.
+   */
+  template <typename VALUE>
+  bool
+  insertOrAssign(const IPADDRTYPE& ipaddr, uint8_t masklen, VALUE&& value) {
+    return insertImpl(
+        ipaddr, masklen, std::forward<VALUE>(value), true /* overwrite */);
+  }
+
+  // Erase a IP, mask. Returns true if the prefix was found and erased.
+  bool erase(const IPADDRTYPE& ipaddr, uint8_t masklen);
+
+  // Free all nodes (not shared with other trees) and clear the tree.
+  void clear() {
+    root_.reset();
+    size_ = 0;
+  }
+
+  // Given a IP, mask return the value node with longest match for it,
+  // nullptr if none match.
+  const TreeNode* longestMatch(const IPADDRTYPE& ipaddr, uint8_t masklen)
+      const {
+    auto foundExact = false;
+    return longestMatchImpl(ipaddr, masklen, foundExact);
+  }
+
+  // Given a IP, mask return the value node matching it exactly, nullptr if
+  // no such node exists.
+  const TreeNode* exactMatch(const IPADDRTYPE& ipaddr, uint8_t masklen) const {
+    auto foundExact = false;
+    auto match = longestMatchImpl(ipaddr, masklen, foundExact);
+    return foundExact ? match : nullptr;
+  }
+
+  /*
+   * Call fn on every value node, in the same (preorder) order as
+   * RadixTree iteration.
+   */
+  template <typename Fn>
+  void forEach(Fn fn) const {
+    forEachImpl(root_.get(), fn);
+  }
+
+  /*
+   * Return a tree with the same prefixes, holding fn(node) in place of the
+   * value of every value node. Each node is copied once and no lookups are
+   * done, which is cheaper than inserting every prefix in a new tree.
+   */
+  template <typename Fn>
+  PersistentRadixTree transformValues(Fn fn) const {
+    PersistentRadixTree transformed;
+    transformed.root_ = transformSubTree(root_.get(), fn);
+    transformed.size_ = size_;
+    return transformed;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+  const TreeNode* root() const {
+    return root_.get();
+  }
+  // Whether both trees are the same version, i.e. share their root.
+  bool sharesRootWith(const PersistentRadixTree& r) const {
+    return root_ == r.root_;
+  }
+
+ private:
+  template <typename VALUE>
+  bool insertImpl(
+      const IPADDRTYPE& ipaddr,
+      uint8_t masklen,
+      VALUE&& value,
+      bool overwrite);
+
+  template <typename VALUE>
+  static NodePtr insertInSubTree(
+      const NodePtr& node,
+      const IPADDRTYPE& toAdd,
+      uint8_t masklen,
+      VALUE&& value,
+      bool overwrite,
+      bool& inserted);
+
+  static NodePtr eraseFromSubTree(
+      const NodePtr& node,
+      const IPADDRTYPE& toErase,
+      uint8_t masklen,
+      bool& erased);
+
+  // Copy node with new children, collapsing non value nodes left with
+  // fewer than 2 children.
+  static NodePtr withChildren(
+      const TreeNode& node,
+      NodePtr newLeft,
+      NodePtr newRight);
+
+  const TreeNode* longestMatchImpl(
+      const IPADDRTYPE& ipaddr,
+      uint8_t masklen,
+      bool& foundExact) const;
+
+  template <typename Fn>
+  static NodePtr transformSubTree(const TreeNode* node, Fn& fn) {
+    if (!node) {
+      return nullptr;
+    }
+    // Call fn in preorder, same as forEach
+    std::optional<T> value;
+    if (node->isValueNode()) {
+      value = fn(*node);
+    }
+    auto left = transformSubTree(node->left().get(), fn);
+    auto right = transformSubTree(node->right().get(), fn);
+    return std::make_shared<const TreeNode>(
+        node->ipAddress(),
+        node->masklen(),
+        std::move(value),
+        std::move(left),
+        std::move(right));
+  }
+
+  template <typename Fn>
+  static void forEachImpl(const TreeNode* node, Fn& fn) {
+    if (!node) {
+      return;
+    }
+    if (node->isValueNode()) {
+      fn(*node);
+    }
+    forEachImpl(node->left().get(), fn);
+    forEachImpl(node->right().get(), fn);
+  }
+
+  NodePtr root_{nullptr};
+  size_t size_{0};
+};
+
 // Free standing helper functions
 
 // Given a radix tree iterator get its path from root
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#pragma once
+
+#include <folly/synchronization/Rcu.h>
+
+#include <atomic>
+#include <memory>
+
+namespace facebook::fboss {
+
+/*
+ * RcuSharedPtr holds a shared_ptr which is read much more often than it is
+ * replaced, such as the current SwitchState.
+ *
+ * Copying a shared_ptr out from under a lock makes every reader write to the
+ * lock and to the reference count of the object, two cache lines shared by
+ * all the reader threads. Instead, RcuSharedPtr publishes the shared_ptr with
+ * RCU:
+ *  - read() returns a ReadGuard which gives access to the current object for
+ *    its lifetime, without any write to shared memory.
+ *  - load() copies the current shared_ptr, for readers who need to keep the
+ *    object beyond a short critical section. It only pays for the reference
+ *    count.
+ *  - store() replaces the shared_ptr. The previous one is released once all
+ *    the readers who may still be using it are done.
+ *
+ * ReadGuards should be short lived and must not be held across blocking
+ * calls, since they delay the release of the objects replaced in the
+ * meantime. A thread holding a ReadGuard must not call
+ * folly::synchronize_rcu() or folly::rcu_barrier().
+ */
+template <typename T>
+class RcuSharedPtr {
+ public:
+  class ReadGuard {
+   public:
+    ReadGuard(ReadGuard&&) = default;
+    ReadGuard& operator=(ReadGuard&&) = default;
+
+    const T* get() const {
+      return ptr_;
+    }
+    const T* operator->() const {
+      return ptr_;
+    }
+    const T& operator*() const {
+      return *ptr_;
+    }
+    explicit operator bool() const {
+      return ptr_ != nullptr;
+    }
+
+   private:
+    friend class RcuSharedPtr;
+
+    explicit ReadGuard(const RcuSharedPtr& rcuPtr)
+        : ptr_(rcuPtr.holder_.load(std::memory_order_acquire)->get()) {}
+
+    // Must be initialized before ptr_ is loaded
+    folly::rcu_reader reader_;
+    const T* ptr_;
+  };
+
+  explicit RcuSharedPtr(std::shared_ptr<T> ptr = nullptr)
+      : holder_(new std::shared_ptr<T>(std::move(ptr))) {}
+
+  ~RcuSharedPtr() {
+    delete holder_.load(std::memory_order_acquire);
+  }
+
+  ReadGuard read() const {
+    return ReadGuard(*this);
+  }
+
+  std::shared_ptr<T> load() const {
+    folly::rcu_reader reader;
+    return *holder_.load(std::memory_order_acquire);
+  }
+
+  void store(std::shared_ptr<T> ptr) {
+    auto oldHolder = holder_.exchange(
+        new std::shared_ptr<T>(std::move(ptr)), std::memory_order_acq_rel);
+    folly::rcu_retire(oldHolder);
+  }
+
+ private:
+  // Forbidden copy constructor and assignment operator
+  RcuSharedPtr(RcuSharedPtr const&) = delete;
+  RcuSharedPtr& operator=(RcuSharedPtr const&) = delete;
+
+  // Only replaced, never modified in place: readers may still be using the
+  // previous holders.
+  std::atomic<std::shared_ptr<T>*> holder_;
+};
+
+} // namespace facebook::fboss
@@ -97,6 +97,7 @@ void FbFpgaI2c::read(
 
   // Increment the counter for I2C read tranbsaction issued
   incrReadTotal();
+  BusyTimeGuard busyTime(this);
 
   uint32_t readBlockAddr =
       getRegAddr(kFacebookFpgaRTCReadBlock, getRTCIOBlockSize());
@@ -139,6 +140,7 @@ void FbFpgaI2c::write(uint8_t channel, uint8_t offset, folly::ByteRange buf) {
 
   // Increment the counter for write transaction issued
   incrWriteTotal();
+  BusyTimeGuard busyTime(this);
 
   uint32_t writeBlockAddr =
       getRegAddr(kFacebookFpgaRTCWriteBlock, getRTCIOBlockSize());
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <chrono>
 #include "fboss/lib/i2c/gen-cpp2/i2c_controller_stats_types.h"
 
 namespace facebook::fboss {
@@ -31,6 +32,7 @@ class I2cController {
     *i2cControllerPlatformStats_.writeTotal__ref() = 0;
     *i2cControllerPlatformStats_.writeFailed__ref() = 0;
     *i2cControllerPlatformStats_.writeBytes__ref() = 0;
+    *i2cControllerPlatformStats_.busyTimeUsec__ref() = 0;
   }
   // Total number of reads
   void incrReadTotal(uint32_t count = 1) {
@@ -56,6 +58,29 @@ class I2cController {
   void incrWriteBytes(uint32_t count = 1) {
     *i2cControllerPlatformStats_.writeBytes__ref() += count;
   }
+  // Time spent with a transaction in flight, used to derive bus utilization
+  void incrBusyTimeUsec(uint64_t usec) {
+    *i2cControllerPlatformStats_.busyTimeUsec__ref() += usec;
+  }
+
+  /* Adds the lifetime of the guard to the controller busy time. Declare one
+   * at the top of each transaction so failed transactions are counted too.
+   */
+  class BusyTimeGuard {
+   public:
+    explicit BusyTimeGuard(I2cController* controller)
+        : controller_(controller), start_(std::chrono::steady_clock::now()) {}
+    ~BusyTimeGuard() {
+      controller_->incrBusyTimeUsec(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start_)
+              .count());
+    }
+
+   private:
+    I2cController* controller_;
+    std::chrono::steady_clock::time_point start_;
+  };
 
   /* Get the I2c transaction stats from the i2c controller
    */
@@ -11,4 +11,6 @@ struct I2cControllerStats {
   5: i64 writeTotal_ = STAT_UNINITIALIZED
   6: i64 writeFailed_ = STAT_UNINITIALIZED
   7: i64 writeBytes_ = STAT_UNINITIALIZED
+  # Time the controller spent with a transaction in flight
+  8: i64 busyTimeUsec_ = STAT_UNINITIALIZED
 }
@@ -38,6 +38,35 @@ set<Prefix6> exactMatchSet6;
 set<Prefix6> longestMatchSet6;
 vector<int> valueSet;
 
+// A new generation of a copy on write tree, e.g. a RouteTableRib clone, is a
+// copy of the previous one with a few changes made to it.
+template <typename IPADDR>
+RadixTree<IPADDR, int> newGeneration(const RadixTree<IPADDR, int>& tree) {
+  return tree.clone();
+}
+
+template <typename IPADDR>
+PersistentRadixTree<IPADDR, int> newGeneration(
+    const PersistentRadixTree<IPADDR, int>& tree) {
+  return tree;
+}
+
+template <typename TREE, typename PREFIXES>
+void cloneAndErase(const TREE& tree, const PREFIXES& toErase) {
+  for (const auto& pfx : toErase) {
+    auto next = newGeneration(tree);
+    next.erase(pfx.ip, pfx.mask);
+  }
+}
+
+template <typename TREE, typename PREFIXES>
+void cloneAndInsert(const TREE& tree, const PREFIXES& toInsert) {
+  for (const auto& pfx : toInsert) {
+    auto next = newGeneration(tree);
+    next.insert(pfx.ip, pfx.mask, 0);
+  }
+}
+
 // V4 Benchmarks
 template <typename TREE>
 void setupTree4(TREE& tree) {
@@ -117,6 +146,46 @@ BENCHMARK_RELATIVE(RadixTreeLongestMatch4) {
   }
 }
 
+// Each iteration creates one new generation per prefix in eraseSet4, from
+// the same base tree.
+BENCHMARK(RadixTreeCloneAndErase4) {
+  RadixTree<IPAddressV4, int> rtree;
+  BENCHMARK_SUSPEND {
+    setupTree4(rtree);
+  }
+  cloneAndErase(rtree, eraseSet4);
+}
+
+BENCHMARK_RELATIVE(PersistentRadixTreeCopyAndErase4) {
+  PersistentRadixTree<IPAddressV4, int> ptree;
+  BENCHMARK_SUSPEND {
+    setupTree4(ptree);
+  }
+  cloneAndErase(ptree, eraseSet4);
+}
+
+BENCHMARK(RadixTreeCloneAndInsert4) {
+  RadixTree<IPAddressV4, int> rtree;
+  BENCHMARK_SUSPEND {
+    setupTree4(rtree);
+    for (auto pfx : eraseSet4) {
+      rtree.erase(pfx.ip, pfx.mask);
+    }
+  }
+  cloneAndInsert(rtree, eraseSet4);
+}
+
+BENCHMARK_RELATIVE(PersistentRadixTreeCopyAndInsert4) {
+  PersistentRadixTree<IPAddressV4, int> ptree;
+  BENCHMARK_SUSPEND {
+    setupTree4(ptree);
+    for (auto pfx : eraseSet4) {
+      ptree.erase(pfx.ip, pfx.mask);
+    }
+  }
+  cloneAndInsert(ptree, eraseSet4);
+}
+
 // V6 benchmarks
 
 template <typename TREE>
@@ -197,6 +266,46 @@ BENCHMARK_RELATIVE(RadixTreeLongestMatch6) {
   }
 }
 
+// Each iteration creates one new generation per prefix in eraseSet6, from
+// the same base tree.
+BENCHMARK(RadixTreeCloneAndErase6) {
+  RadixTree<IPAddressV6, int> rtree;
+  BENCHMARK_SUSPEND {
+    setupTree6(rtree);
+  }
+  cloneAndErase(rtree, eraseSet6);
+}
+
+BENCHMARK_RELATIVE(PersistentRadixTreeCopyAndErase6) {
+  PersistentRadixTree<IPAddressV6, int> ptree;
+  BENCHMARK_SUSPEND {
+    setupTree6(ptree);
+  }
+  cloneAndErase(ptree, eraseSet6);
+}
+
+BENCHMARK(RadixTreeCloneAndInsert6) {
+  RadixTree<IPAddressV6, int> rtree;
+  BENCHMARK_SUSPEND {
+    setupTree6(rtree);
+    for (auto pfx : eraseSet6) {
+      rtree.erase(pfx.ip, pfx.mask);
+    }
+  }
+  cloneAndInsert(rtree, eraseSet6);
+}
+
+BENCHMARK_RELATIVE(PersistentRadixTreeCopyAndInsert6) {
+  PersistentRadixTree<IPAddressV6, int> ptree;
+  BENCHMARK_SUSPEND {
+    setupTree6(ptree);
+    for (auto pfx : eraseSet6) {
+      ptree.erase(pfx.ip, pfx.mask);
+    }
+  }
+  cloneAndInsert(ptree, eraseSet6);
+}
+
 } // namespace
 
 int main(int /*argc*/, char* /*argv*/[]) {
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <tuple>
 
 #include <folly/IPAddressV4.h>
 #include <folly/IPAddressV6.h>
@@ -1527,3 +1528,138 @@ TEST(RadixTree, SubTreeIterator) {
   }
   EXPECT_EQ(rtree.end().subTreeIterator(), rtree.end());
 }
+
+namespace {
+template <typename IPAddrType>
+void checkPersistentTreeMatches(
+    const PersistentRadixTree<IPAddrType, int>& ptree,
+    const RadixTree<IPAddrType, int>& rtree) {
+  EXPECT_EQ(rtree.size(), ptree.size());
+  // Iteration order must be the same as that of RadixTree
+  std::vector<std::tuple<IPAddrType, uint8_t, int>> rtreeNodes, ptreeNodes;
+  for (const auto& node : rtree) {
+    rtreeNodes.emplace_back(node.ipAddress(), node.masklen(), node.value());
+  }
+  ptree.forEach([&ptreeNodes](const auto& node) {
+    ptreeNodes.emplace_back(node.ipAddress(), node.masklen(), node.value());
+  });
+  EXPECT_EQ(rtreeNodes, ptreeNodes);
+  for (const auto& node : rtree) {
+    auto match = ptree.exactMatch(node.ipAddress(), node.masklen());
+    ASSERT_NE(nullptr, match);
+    EXPECT_EQ(node.value(), match->value());
+  }
+}
+} // namespace
+
+TEST(PersistentRadixTree, CompareWithRadixTree4) {
+  RadixTree<IPAddressV4, int> rtree;
+  PersistentRadixTree<IPAddressV4, int> ptree;
+  std::vector<std::pair<IPAddressV4, uint8_t>> inserted;
+  auto const kInsertCount = 1000;
+  for (auto i = 0; i < kInsertCount; ++i) {
+    auto mask = folly::Random::rand32(33);
+    auto ip = IPAddressV4::fromLongHBO(folly::Random::rand32()).mask(mask);
+    EXPECT_EQ(rtree.insert(ip, mask, i).second, ptree.insert(ip, mask, i));
+    inserted.emplace_back(ip, mask);
+  }
+  checkPersistentTreeMatches(ptree, rtree);
+
+  for (auto i = 0; i < 1000; ++i) {
+    auto ip = IPAddressV4::fromLongHBO(folly::Random::rand32());
+    auto rmatch = rtree.longestMatch(ip, 32);
+    auto pmatch = ptree.longestMatch(ip, 32);
+    if (rmatch == rtree.end()) {
+      EXPECT_EQ(nullptr, pmatch);
+    } else {
+      ASSERT_NE(nullptr, pmatch);
+      EXPECT_EQ(rmatch->value(), pmatch->value());
+    }
+  }
+
+  for (auto i = 0; i < kInsertCount / 2; ++i) {
+    auto erase = folly::Random::rand32(inserted.size());
+    EXPECT_EQ(
+        rtree.erase(inserted[erase].first, inserted[erase].second),
+        ptree.erase(inserted[erase].first, inserted[erase].second));
+  }
+  checkPersistentTreeMatches(ptree, rtree);
+}
+
+TEST(PersistentRadixTree, CompareWithRadixTree6) {
+  RadixTree<IPAddressV6, int> rtree;
+  PersistentRadixTree<IPAddressV6, int> ptree;
+  setupTestTree6(rtree);
+  for (const auto& node : rtree) {
+    ptree.insert(node.ipAddress(), node.masklen(), node.value());
+  }
+  checkPersistentTreeMatches(ptree, rtree);
+  std::vector<std::pair<IPAddressV6, uint8_t>> prefixes;
+  for (const auto& node : rtree) {
+    prefixes.emplace_back(node.ipAddress(), node.masklen());
+  }
+  for (const auto& prefix : prefixes) {
+    EXPECT_TRUE(rtree.erase(prefix.first, prefix.second));
+    EXPECT_TRUE(ptree.erase(prefix.first, prefix.second));
+    checkPersistentTreeMatches(ptree, rtree);
+  }
+  EXPECT_EQ(nullptr, ptree.root());
+}
+
+TEST(PersistentRadixTree, CopiesAreIndependent) {
+  PersistentRadixTree<IPAddressV4, int> ptree;
+  ptree.insert(IPAddressV4("10.0.0.0"), 8, 1);
+  ptree.insert(IPAddressV4("10.1.0.0"), 16, 2);
+  ptree.insert(IPAddressV4("20.0.0.0"), 8, 3);
+
+  auto copy = ptree;
+  EXPECT_TRUE(copy.sharesRootWith(ptree));
+  EXPECT_TRUE(copy.insertOrAssign(IPAddressV4("10.1.1.0"), 24, 4));
+  EXPECT_FALSE(copy.insertOrAssign(IPAddressV4("20.0.0.0"), 8, 5));
+  EXPECT_TRUE(copy.erase(IPAddressV4("10.0.0.0"), 8));
+  EXPECT_FALSE(copy.sharesRootWith(ptree));
+
+  // Original is untouched
+  EXPECT_EQ(3, ptree.size());
+  EXPECT_EQ(1, ptree.longestMatch(IPAddressV4("10.2.0.1"), 32)->value());
+  EXPECT_EQ(2, ptree.longestMatch(IPAddressV4("10.1.1.1"), 32)->value());
+  EXPECT_EQ(3, ptree.exactMatch(IPAddressV4("20.0.0.0"), 8)->value());
+
+  EXPECT_EQ(3, copy.size());
+  EXPECT_EQ(nullptr, copy.longestMatch(IPAddressV4("10.2.0.1"), 32));
+  EXPECT_EQ(4, copy.longestMatch(IPAddressV4("10.1.1.1"), 32)->value());
+  EXPECT_EQ(5, copy.exactMatch(IPAddressV4("20.0.0.0"), 8)->value());
+}
+
+TEST(PersistentRadixTree, TransformValues) {
+  PersistentRadixTree<IPAddressV4, int> ptree;
+  ptree.insert(IPAddressV4("10.0.0.0"), 8, 1);
+  ptree.insert(IPAddressV4("10.1.0.0"), 16, 2);
+  ptree.insert(IPAddressV4("20.0.0.0"), 8, 3);
+
+  std::vector<int> visited;
+  auto transformed = ptree.transformValues([&visited](const auto& node) {
+    visited.push_back(node.value());
+    return node.value() * 10;
+  });
+  // Values are visited in the same order as forEach
+  std::vector<int> expected;
+  ptree.forEach([&expected](const auto& node) {
+    expected.push_back(node.value());
+  });
+  EXPECT_EQ(expected, visited);
+
+  EXPECT_EQ(3, transformed.size());
+  EXPECT_FALSE(transformed.sharesRootWith(ptree));
+  EXPECT_EQ(10, transformed.exactMatch(IPAddressV4("10.0.0.0"), 8)->value());
+  EXPECT_EQ(20, transformed.longestMatch(IPAddressV4("10.1.1.1"), 32)->value());
+  EXPECT_EQ(30, transformed.exactMatch(IPAddressV4("20.0.0.0"), 8)->value());
+  // Original is untouched
+  EXPECT_EQ(2, ptree.longestMatch(IPAddressV4("10.1.1.1"), 32)->value());
+
+  PersistentRadixTree<IPAddressV4, int> empty;
+  EXPECT_EQ(
+      nullptr,
+      empty.transformValues([](const auto& node) { return node.value(); })
+          .root());
+}
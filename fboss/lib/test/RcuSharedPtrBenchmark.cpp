@@ -0,0 +1,142 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/lib/RcuSharedPtr.h"
+
+#include <folly/Benchmark.h>
+#include <folly/SpinLock.h>
+#include "common/init/Init.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/*
+ * Many threads reading a shared_ptr which is occasionally replaced, the way
+ * the packet handlers, thrift handlers and stats collection read the
+ * SwitchState. Compares copying the shared_ptr under a spinlock, as
+ * SwSwitch::getState() used to, with RcuSharedPtr.
+ */
+
+using namespace facebook::fboss;
+
+namespace {
+
+struct State {
+  explicit State(int generation) : generation(generation) {}
+  int generation;
+};
+
+class SpinLockSharedPtr {
+ public:
+  explicit SpinLockSharedPtr(std::shared_ptr<State> ptr)
+      : ptr_(std::move(ptr)) {}
+
+  std::shared_ptr<State> load() const {
+    folly::SpinLockGuard guard(lock_);
+    return ptr_;
+  }
+
+  void store(std::shared_ptr<State> ptr) {
+    folly::SpinLockGuard guard(lock_);
+    ptr_.swap(ptr);
+  }
+
+ private:
+  std::shared_ptr<State> ptr_;
+  mutable folly::SpinLock lock_;
+};
+
+/*
+ * Split n reads across numReaders threads while another thread publishes a
+ * new state every 100us.
+ */
+template <typename ReadFn, typename StoreFn>
+void runReaders(
+    unsigned int n,
+    unsigned int numReaders,
+    const ReadFn& read,
+    const StoreFn& store) {
+  std::atomic<bool> done{false};
+  std::thread writer;
+  std::vector<std::thread> readers;
+  BENCHMARK_SUSPEND {
+    writer = std::thread([&] {
+      for (int generation = 0; !done; ++generation) {
+        store(std::make_shared<State>(generation));
+        /* sleep override */
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    });
+  }
+  for (unsigned int i = 0; i < numReaders; ++i) {
+    readers.emplace_back([&] {
+      int64_t sum = 0;
+      for (unsigned int j = 0; j < n / numReaders; ++j) {
+        sum += read();
+      }
+      folly::doNotOptimizeAway(sum);
+    });
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  BENCHMARK_SUSPEND {
+    done = true;
+    writer.join();
+  }
+}
+
+void spinLockReads(unsigned int n, unsigned int numReaders) {
+  SpinLockSharedPtr ptr(std::make_shared<State>(0));
+  runReaders(
+      n,
+      numReaders,
+      [&] { return ptr.load()->generation; },
+      [&](std::shared_ptr<State> state) { ptr.store(std::move(state)); });
+}
+
+void rcuLoads(unsigned int n, unsigned int numReaders) {
+  RcuSharedPtr<State> ptr(std::make_shared<State>(0));
+  runReaders(
+      n,
+      numReaders,
+      [&] { return ptr.load()->generation; },
+      [&](std::shared_ptr<State> state) { ptr.store(std::move(state)); });
+}
+
+void rcuReadGuards(unsigned int n, unsigned int numReaders) {
+  RcuSharedPtr<State> ptr(std::make_shared<State>(0));
+  runReaders(
+      n,
+      numReaders,
+      [&] { return ptr.read()->generation; },
+      [&](std::shared_ptr<State> state) { ptr.store(std::move(state)); });
+}
+
+} // namespace
+
+BENCHMARK_PARAM(spinLockReads, 1)
+BENCHMARK_RELATIVE_PARAM(rcuLoads, 1)
+BENCHMARK_RELATIVE_PARAM(rcuReadGuards, 1)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(spinLockReads, 4)
+BENCHMARK_RELATIVE_PARAM(rcuLoads, 4)
+BENCHMARK_RELATIVE_PARAM(rcuReadGuards, 4)
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(spinLockReads, 16)
+BENCHMARK_RELATIVE_PARAM(rcuLoads, 16)
+BENCHMARK_RELATIVE_PARAM(rcuReadGuards, 16)
+
+int main(int argc, char** argv) {
+  facebook::initFacebook(&argc, &argv);
+  folly::runBenchmarks();
+  return 0;
+}
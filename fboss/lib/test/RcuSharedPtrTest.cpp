@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/lib/RcuSharedPtr.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace facebook::fboss;
+
+namespace {
+struct Value {
+  Value(int x, std::atomic<int>* destroyed) : x(x), destroyed(destroyed) {}
+  ~Value() {
+    ++*destroyed;
+  }
+  int x;
+  std::atomic<int>* destroyed;
+};
+} // namespace
+
+TEST(RcuSharedPtr, readAndLoad) {
+  RcuSharedPtr<int> ptr;
+  EXPECT_FALSE(ptr.read());
+  EXPECT_EQ(nullptr, ptr.load());
+
+  auto value = std::make_shared<int>(42);
+  ptr.store(value);
+  EXPECT_EQ(value, ptr.load());
+  auto guard = ptr.read();
+  EXPECT_EQ(value.get(), guard.get());
+  EXPECT_EQ(42, *guard);
+}
+
+TEST(RcuSharedPtr, replacedValuesOutliveReaders) {
+  std::atomic<int> destroyed{0};
+  RcuSharedPtr<Value> ptr(std::make_shared<Value>(1, &destroyed));
+  {
+    auto guard = ptr.read();
+    ptr.store(std::make_shared<Value>(2, &destroyed));
+    // The reader still sees the value it started with
+    EXPECT_EQ(1, guard->x);
+    EXPECT_EQ(0, destroyed);
+  }
+  EXPECT_EQ(2, ptr.read()->x);
+  folly::rcu_barrier();
+  EXPECT_EQ(1, destroyed);
+}
+
+TEST(RcuSharedPtr, concurrentReadersAndWriter) {
+  std::atomic<int> destroyed{0};
+  RcuSharedPtr<Value> ptr(std::make_shared<Value>(0, &destroyed));
+  constexpr int kUpdates = 10000;
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      int last = 0;
+      while (!done) {
+        auto guard = ptr.read();
+        // Updates are seen in order
+        EXPECT_LE(last, guard->x);
+        last = guard->x;
+      }
+    });
+  }
+  for (int i = 1; i <= kUpdates; ++i) {
+    ptr.store(std::make_shared<Value>(i, &destroyed));
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  folly::rcu_barrier();
+  EXPECT_EQ(kUpdates, destroyed);
+  EXPECT_EQ(kUpdates, ptr.load()->x);
+}
@@ -288,6 +288,7 @@ void CP2112::setSMBusConfig(SMBusConfig config) {
 void CP2112::read(uint8_t address, MutableByteRange buf, milliseconds timeout) {
   // Increment the counter for I2c read transaction issued
   incrReadTotal();
+  BusyTimeGuard busyTime(this);
 
   if (buf.size() > 512) {
     LOG(ERROR) << "I2c read parameter error";
@@ -326,6 +327,7 @@ void CP2112::read(uint8_t address, MutableByteRange buf, milliseconds timeout) {
 void CP2112::write(uint8_t address, ByteRange buf, milliseconds timeout) {
   // Increment the counter for I2c write transaction issued
   incrWriteTotal();
+  BusyTimeGuard busyTime(this);
 
   if (buf.size() > 61) {
     LOG(ERROR) << "I2c write parameter error";
@@ -375,6 +377,7 @@ void CP2112::writeReadUnsafe(
   // Increment the counter for I2c write and read transaction
   incrReadTotal();
   incrWriteTotal();
+  BusyTimeGuard busyTime(this);
 
   if (writeBuf.size() > 16) {
     LOG(ERROR) << "I2c write parameter error";
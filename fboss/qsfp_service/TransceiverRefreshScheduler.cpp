@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#include "fboss/qsfp_service/TransceiverRefreshScheduler.h"
+
+#include "fboss/agent/types.h"
+#include "fboss/qsfp_service/module/Transceiver.h"
+
+#include <folly/futures/Future.h>
+#include <folly/logging/xlog.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace facebook {
+namespace fboss {
+
+TransceiverRefreshScheduler::TransceiverRefreshScheduler(
+    const std::vector<Transceiver*>& transceivers) {
+  for (auto transceiver : transceivers) {
+    auto evb = transceiver->getI2cEventBase();
+    auto bus = std::find_if(
+        buses_.begin(), buses_.end(), [evb](const BusQueue& queue) {
+          return queue.evb == evb;
+        });
+    if (bus == buses_.end()) {
+      bus = buses_.emplace(buses_.end(), evb);
+    }
+    if (transceiver->needsUrgentRefresh()) {
+      bus->urgent.push_back(transceiver);
+    } else {
+      bus->routine.push_back(transceiver);
+    }
+  }
+}
+
+void TransceiverRefreshScheduler::run() {
+  std::vector<folly::Future<folly::Unit>> futs;
+  const BusQueue* localBus{nullptr};
+  for (const auto& bus : buses_) {
+    if (!bus.evb) {
+      localBus = &bus;
+      continue;
+    }
+    futs.push_back(
+        via(bus.evb).thenValue([&bus](auto&&) { refreshBus(bus); }));
+  }
+  // Work through the buses without an eventbase while the others run
+  if (localBus) {
+    refreshBus(*localBus);
+  }
+  folly::collectAll(futs.begin(), futs.end()).wait();
+}
+
+void TransceiverRefreshScheduler::refreshBus(const BusQueue& bus) {
+  auto start = std::chrono::steady_clock::now();
+  for (auto transceiver : bus.urgent) {
+    refreshOne(transceiver);
+  }
+  for (auto transceiver : bus.routine) {
+    refreshOne(transceiver);
+  }
+  XLOG(DBG3) << "Refreshed " << bus.urgent.size() << " urgent and "
+             << bus.routine.size() << " routine transceivers in "
+             << std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start)
+                    .count()
+             << "ms";
+}
+
+void TransceiverRefreshScheduler::refreshOne(Transceiver* transceiver) {
+  try {
+    transceiver->refresh();
+  } catch (const std::exception& ex) {
+    XLOG(DBG2) << "Transceiver " << static_cast<int>(transceiver->getID())
+               << ": Error calling refresh(): " << ex.what();
+  }
+}
+
+} // namespace fboss
+} // namespace facebook
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+#pragma once
+
+#include <folly/io/async/EventBase.h>
+
+#include <vector>
+
+namespace facebook {
+namespace fboss {
+
+class Transceiver;
+
+/*
+ * Refreshes a set of transceivers with one queue per I2C bus.
+ *
+ * Transceivers reached through the same I2C controller (the same eventbase)
+ * share a bus, so their refreshes run back to back on that controller's
+ * eventbase thread. Separate controllers, e.g. the FPGA I2C masters on each
+ * Minipack PIM, are refreshed in parallel. Transceivers without an eventbase
+ * are refreshed on the calling thread while the other buses are busy.
+ *
+ * Within a bus, transceivers which need an urgent refresh (newly inserted, or
+ * with enabled ports that are down) are refreshed before the ones that are
+ * only due for routine DOM polling.
+ */
+class TransceiverRefreshScheduler {
+ public:
+  explicit TransceiverRefreshScheduler(
+      const std::vector<Transceiver*>& transceivers);
+
+  /*
+   * Refresh every transceiver and return once all are done.
+   */
+  void run();
+
+  size_t numBuses() const {
+    return buses_.size();
+  }
+
+ private:
+  struct BusQueue {
+    explicit BusQueue(folly::EventBase* evb) : evb(evb) {}
+
+    // nullptr for transceivers refreshed on the calling thread
+    folly::EventBase* evb;
+    std::vector<Transceiver*> urgent;
+    std::vector<Transceiver*> routine;
+  };
+
+  static void refreshBus(const BusQueue& bus);
+  static void refreshOne(Transceiver* transceiver);
+
+  std::vector<BusQueue> buses_;
+};
+
+} // namespace fboss
+} // namespace facebook
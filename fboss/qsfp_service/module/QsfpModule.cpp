@@ -304,7 +304,7 @@ void QsfpModule::refresh() {
 }
 
 folly::Future<folly::Unit> QsfpModule::futureRefresh() {
-  auto i2cEvb = qsfpImpl_->getI2cEventBase();
+  auto i2cEvb = getI2cEventBase();
   if (!i2cEvb) {
     try {
       refresh();
@@ -325,6 +325,25 @@ folly::Future<folly::Unit> QsfpModule::futureRefresh() {
   });
 }
 
+folly::EventBase* QsfpModule::getI2cEventBase() {
+  return qsfpImpl_->getI2cEventBase();
+}
+
+bool QsfpModule::needsUrgentRefresh() const {
+  lock_guard<std::mutex> g(qsfpModuleMutex_);
+  if (dirty_) {
+    // Newly inserted, or data we have is known to be stale
+    return true;
+  }
+  // An enabled port which is down may be waiting on customization
+  for (const auto& port : ports_) {
+    if (*port.second.enabled_ref() && !*port.second.up_ref()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void QsfpModule::refreshLocked() {
   detectPresenceLocked();
 
@@ -80,6 +80,9 @@ class QsfpModule : public Transceiver {
   folly::Future<folly::Unit> futureRefresh() override;
   void refreshLocked();
 
+  folly::EventBase* getI2cEventBase() override;
+  bool needsUrgentRefresh() const override;
+
   /*
    * Customize QSPF fields as necessary
    *
@@ -15,6 +15,7 @@
 #include "fboss/qsfp_service/if/gen-cpp2/transceiver_types.h"
 
 #include <folly/futures/Future.h>
+#include <folly/io/async/EventBase.h>
 
 namespace facebook {
 namespace fboss {
@@ -53,6 +54,23 @@ class Transceiver {
   virtual void refresh() = 0;
   virtual folly::Future<folly::Unit> futureRefresh() = 0;
 
+  /*
+   * Eventbase of the I2C controller this transceiver is reached through, or
+   * nullptr if I2C transactions run on the calling thread. Transceivers
+   * sharing an eventbase share the bus and can't be refreshed in parallel.
+   */
+  virtual folly::EventBase* getI2cEventBase() {
+    return nullptr;
+  }
+
+  /*
+   * Whether the next refresh should go ahead of routine DOM polling, e.g.
+   * because the transceiver was just inserted or its ports are down.
+   */
+  virtual bool needsUrgentRefresh() const {
+    return false;
+  }
+
   /*
    * Return all of the transceiver information
    */
@@ -0,0 +1,218 @@
+/*
+ *  Copyright (c) 2004-present, Facebook, Inc.
+ *  All rights reserved.
+ *
+ *  This source code is licensed under the BSD-style license found in the
+ *  LICENSE file in the root directory of this source tree. An additional grant
+ *  of patent rights can be found in the PATENTS file in the same directory.
+ *
+ */
+
+#include "fboss/qsfp_service/TransceiverRefreshScheduler.h"
+
+#include "fboss/agent/FbossError.h"
+#include "fboss/agent/types.h"
+#include "fboss/qsfp_service/module/Transceiver.h"
+
+#include <folly/Synchronized.h>
+#include <folly/io/async/ScopedEventBaseThread.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace fboss {
+
+namespace {
+
+/*
+ * A fake I2C bus: the eventbase thread of its controller, and how many
+ * transceivers on it are being refreshed at once.
+ */
+struct FakeBus {
+  folly::ScopedEventBaseThread thread;
+  std::atomic<int> active{0};
+  std::atomic<int> maxActive{0};
+};
+
+class FakeTransceiver : public Transceiver {
+ public:
+  FakeTransceiver(
+      int id,
+      FakeBus* bus,
+      bool urgent,
+      folly::Synchronized<std::vector<int>>* refreshed)
+      : id_(id), bus_(bus), urgent_(urgent), refreshed_(refreshed) {}
+
+  TransceiverType type() const override {
+    return TransceiverType::QSFP;
+  }
+  TransceiverID getID() const override {
+    return TransceiverID(id_);
+  }
+  TransceiverManagementInterface managementInterface() const override {
+    return TransceiverManagementInterface::SFF;
+  }
+  bool detectPresence() override {
+    return true;
+  }
+
+  void refresh() override {
+    if (bus_) {
+      EXPECT_TRUE(bus_->thread.getEventBase()->isInEventBaseThread());
+      auto active = ++bus_->active;
+      auto maxActive = bus_->maxActive.load();
+      while (active > maxActive &&
+             !bus_->maxActive.compare_exchange_weak(maxActive, active)) {
+      }
+    }
+    // Long enough for refreshes on the same bus to overlap were they not
+    // serialized
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    refreshed_->wlock()->push_back(id_);
+    if (bus_) {
+      --bus_->active;
+    }
+    if (id_ < 0) {
+      throw FbossError("failed to refresh transceiver ", id_);
+    }
+  }
+  folly::Future<folly::Unit> futureRefresh() override {
+    refresh();
+    return folly::makeFuture();
+  }
+
+  folly::EventBase* getI2cEventBase() override {
+    return bus_ ? bus_->thread.getEventBase() : nullptr;
+  }
+  bool needsUrgentRefresh() const override {
+    return urgent_;
+  }
+
+  TransceiverInfo getTransceiverInfo() override {
+    return TransceiverInfo();
+  }
+  RawDOMData getRawDOMData() override {
+    return RawDOMData();
+  }
+  DOMDataUnion getDOMDataUnion() override {
+    return DOMDataUnion();
+  }
+  void customizeTransceiver(cfg::PortSpeed /* speed */) override {}
+  void transceiverPortsChanged(
+      const std::map<uint32_t, PortStatus>& /* ports */) override {}
+  std::unique_ptr<folly::IOBuf> readTransceiver(
+      TransceiverIOParameters /* param */) override {
+    return nullptr;
+  }
+  bool writeTransceiver(TransceiverIOParameters /* param */, uint8_t /* data */)
+      override {
+    return false;
+  }
+
+ private:
+  int id_;
+  FakeBus* bus_;
+  bool urgent_;
+  folly::Synchronized<std::vector<int>>* refreshed_;
+};
+
+class TransceiverRefreshSchedulerTest : public ::testing::Test {
+ protected:
+  void addTransceiver(int id, FakeBus* bus, bool urgent) {
+    transceivers_.push_back(
+        std::make_unique<FakeTransceiver>(id, bus, urgent, &refreshed_));
+  }
+
+  void run(size_t expectedBuses) {
+    std::vector<Transceiver*> transceivers;
+    for (const auto& transceiver : transceivers_) {
+      transceivers.push_back(transceiver.get());
+    }
+    TransceiverRefreshScheduler scheduler(transceivers);
+    EXPECT_EQ(expectedBuses, scheduler.numBuses());
+    scheduler.run();
+  }
+
+  // Ids of the transceivers refreshed, in the order they were refreshed
+  std::vector<int> refreshed() const {
+    return *refreshed_.rlock();
+  }
+
+  std::vector<std::unique_ptr<FakeTransceiver>> transceivers_;
+  folly::Synchronized<std::vector<int>> refreshed_;
+};
+
+// The order in which the given transceivers were refreshed
+std::vector<int> refreshOrder(
+    const std::vector<int>& refreshed,
+    const std::set<int>& ids) {
+  std::vector<int> order;
+  for (auto id : refreshed) {
+    if (ids.count(id)) {
+      order.push_back(id);
+    }
+  }
+  return order;
+}
+
+} // namespace
+
+TEST_F(TransceiverRefreshSchedulerTest, serializeRefreshesPerBus) {
+  FakeBus bus1, bus2;
+  for (int id = 0; id < 8; ++id) {
+    addTransceiver(id, id % 2 ? &bus2 : &bus1, false);
+  }
+  run(2);
+
+  EXPECT_EQ(8, refreshed().size());
+  EXPECT_EQ(1, bus1.maxActive.load());
+  EXPECT_EQ(1, bus2.maxActive.load());
+}
+
+TEST_F(TransceiverRefreshSchedulerTest, urgentRefreshesGoFirstOnEachBus) {
+  // Ids 0 to 9 are on bus1, 10 to 19 on bus2 and 20 to 29 without a bus.
+  // Urgent transceivers are added after the routine ones of their bus.
+  FakeBus bus1, bus2;
+  for (int id : {0, 1, 2, 3, 10, 11, 20, 21, 22}) {
+    addTransceiver(id, id < 10 ? &bus1 : (id < 20 ? &bus2 : nullptr), false);
+  }
+  for (int id : {4, 5, 12, 23}) {
+    addTransceiver(id, id < 10 ? &bus1 : (id < 20 ? &bus2 : nullptr), true);
+  }
+  run(3);
+
+  auto ids = refreshed();
+  EXPECT_EQ(13, ids.size());
+  EXPECT_EQ(
+      std::vector<int>({4, 5, 0, 1, 2, 3}),
+      refreshOrder(ids, {0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(std::vector<int>({12, 10, 11}), refreshOrder(ids, {10, 11, 12}));
+  EXPECT_EQ(
+      std::vector<int>({23, 20, 21, 22}), refreshOrder(ids, {20, 21, 22, 23}));
+}
+
+TEST_F(TransceiverRefreshSchedulerTest, failedRefreshDoesNotStopTheBus) {
+  FakeBus bus;
+  addTransceiver(-1, &bus, true);
+  addTransceiver(1, &bus, false);
+  addTransceiver(-2, nullptr, false);
+  addTransceiver(2, nullptr, false);
+  run(2);
+
+  // Transceivers with negative ids fail to refresh, after which the ones
+  // following them on their bus are still refreshed
+  auto ids = refreshed();
+  EXPECT_EQ(4, ids.size());
+  EXPECT_EQ(std::vector<int>({-1, 1}), refreshOrder(ids, {-1, 1}));
+  EXPECT_EQ(std::vector<int>({-2, 2}), refreshOrder(ids, {-2, 2}));
+}
+
+} // namespace fboss
+} // namespace facebook
@@ -1,6 +1,7 @@
 #include "fboss/qsfp_service/platforms/wedge/WedgeManager.h"
 
 #include "fboss/lib/config/PlatformConfigUtils.h"
+#include "fboss/qsfp_service/TransceiverRefreshScheduler.h"
 #include "fboss/qsfp_service/module/QsfpModule.h"
 #include "fboss/qsfp_service/module/cmis/CmisModule.h"
 #include "fboss/qsfp_service/module/sff/SffModule.h"
@@ -330,18 +331,20 @@ void WedgeManager::refreshTransceivers() {
   // transceiver mapping and type here.
   updateTransceiverMap();
 
-  std::vector<folly::Future<folly::Unit>> futs;
   XLOG(INFO) << "Start refreshing all transceivers...";
 
   auto lockedTransceivers = transceivers_.rlock();
 
+  std::vector<Transceiver*> transceivers;
   for (const auto& transceiver : *lockedTransceivers) {
-    XLOG(DBG3) << "Fired to refresh transceiver "
-               << transceiver.second->getID();
-    futs.push_back(transceiver.second->futureRefresh());
+    transceivers.push_back(transceiver.second.get());
   }
-
-  folly::collectAll(futs.begin(), futs.end()).wait();
+  // Refresh each I2C bus in parallel, with newly inserted and link down
+  // transceivers ahead of routine DOM polling on every bus.
+  TransceiverRefreshScheduler scheduler(transceivers);
+  XLOG(DBG3) << "Refreshing " << transceivers.size() << " transceivers on "
+             << scheduler.numBuses() << " I2C buses";
+  scheduler.run();
   XLOG(INFO) << "Finished refreshing all transceivers";
 }
 
@@ -537,6 +540,32 @@ void WedgeManager::publishI2cTransactionStats() {
     statName = folly::to<std::string>(
         "qsfp.", *counter.controllerName__ref(), ".writeBytes");
     tcData().setCounter(statName, *counter.writeBytes__ref());
+
+    statName = folly::to<std::string>(
+        "qsfp.", *counter.controllerName__ref(), ".busyTimeUsec");
+    tcData().setCounter(statName, *counter.busyTimeUsec__ref());
+
+    // Bus utilization is the share of time since the last publish that the
+    // controller had a transaction in flight.
+    auto now = std::chrono::steady_clock::now();
+    auto [it, inserted] = lastI2cBusyTime_.try_emplace(
+        *counter.controllerName__ref(), *counter.busyTimeUsec__ref(), now);
+    if (!inserted) {
+      auto elapsedUsec = std::chrono::duration_cast<std::chrono::microseconds>(
+                             now - it->second.second)
+                             .count();
+      if (elapsedUsec > 0) {
+        statName = folly::to<std::string>(
+            "qsfp.", *counter.controllerName__ref(), ".utilizationPct");
+        tcData().setCounter(
+            statName,
+            std::min<int64_t>(
+                100,
+                (*counter.busyTimeUsec__ref() - it->second.first) * 100 /
+                    elapsedUsec));
+      }
+      it->second = {*counter.busyTimeUsec__ref(), now};
+    }
   }
 }
 
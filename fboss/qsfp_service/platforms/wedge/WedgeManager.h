@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/container/flat_map.hpp>
+#include <chrono>
 
 #include "fboss/agent/AgentConfig.h"
 #include "fboss/agent/platforms/common/PlatformMapping.h"
@@ -115,6 +116,13 @@ class WedgeManager : public TransceiverManager {
 
   PlatformMode platformMode_;
 
+  // I2C controller name -> busy time and time of the last stats publish, used
+  // to derive bus utilization between publishes
+  std::map<
+      std::string,
+      std::pair<int64_t, std::chrono::steady_clock::time_point>>
+      lastI2cBusyTime_;
+
  private:
   void loadConfig() override;
   // Forbidden copy constructor and assignment operator